@@ -87,6 +87,13 @@ namespace AZ
         //! @param tm A reference to a transform for positioning the entity within the world.
         virtual void SetWorldTM([[maybe_unused]] const Transform& tm) {}
 
+        //! Sets the world rotation and translation, keeping the scale, and notifies all listeners once.
+        //! Cheaper than setting the rotation and the translation separately, which notifies the listeners for each of them.
+        //! @param rotation A quaternion that represents the rotation to use for the entity.
+        //! @param translation A three-dimensional translation vector.
+        virtual void SetWorldRotationQuaternionAndTranslation(
+            [[maybe_unused]] const AZ::Quaternion& rotation, [[maybe_unused]] const AZ::Vector3& translation) {}
+
         //! Retrieves the entity's local and world transforms.
         //! @param[out] localTM A reference to a transform that represents the entity's
         //! position relative to its parent entity.
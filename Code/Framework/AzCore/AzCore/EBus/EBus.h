@@ -199,6 +199,17 @@ namespace AZ
         */
         static const bool LocklessDispatch = false;
 
+        /**
+        * Determines whether broadcasts walk a flat array of handler pointers instead of the handler list.
+        * The array is rebuilt whenever a handler connects or disconnects, and a broadcast to a single
+        * connected handler calls it through a cached pointer without touching the array.
+        * Only supported with EBusAddressPolicy::Single and multiple handlers.
+        * A flat dispatch bus doesn't lock during dispatch and has the same restrictions as #LocklessDispatch:
+        * handlers must not connect or disconnect from within a dispatch on the same bus.
+        * By default, broadcasts walk the handler list.
+        */
+        static const bool FlatDispatch = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -510,6 +521,8 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::FlatDispatch || (BusTraits::AddressPolicy == EBusAddressPolicy::Single && BusTraits::HandlerPolicy != EBusHandlerPolicy::Single)),
+            "FlatDispatch is only supported with EBusAddressPolicy::Single and EBusHandlerPolicy::Multiple or EBusHandlerPolicy::MultipleAndOrdered!");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -619,15 +632,17 @@ namespace AZ
              * When LocklessDispatch is set on the EBus and a NullMutex is supplied a shared_mutex is used to protect the context otherwise the supplied MutexType is used
              * The reason why a recursive_mutex is used in this situation, is that specifying LocklessDispatch is implies that the EBus will be used across multiple threads
              * @see EBusTraits::LocklessDispatch
+             * @see EBusTraits::FlatDispatch
              */
-            using ContextMutexType = AZStd::conditional_t<BusTraits::LocklessDispatch && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>;
+            using ContextMutexType = AZStd::conditional_t<(BusTraits::LocklessDispatch || BusTraits::FlatDispatch) && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>;
 
             /**
              * The scoped lock guard to use (either AZStd::scoped_lock<MutexType> or NullLockGuard<MutexType>
              * during broadcast/event dispatch.
              * @see EBusTraits::LocklessDispatch
+             * @see EBusTraits::FlatDispatch
              */
-            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch, AZ::Internal::NullLockGuard<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>;
+            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch || BusTraits::FlatDispatch, AZ::Internal::NullLockGuard<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>;
 
             /**
             * The scoped lock guard to use during connection.  Some specialized policies execute handler methods which
@@ -989,7 +1004,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
     inline void EBus<Interface, Traits>::ConnectInternal(Context& context, HandlerNode& handler, ConnectLockGuard& contextLock, const BusIdType& id)
     {
         // To call this while executing a message, you need to make sure this mutex is AZStd::recursive_mutex. Otherwise, a deadlock will occur.
-        AZ_Assert(!Traits::LocklessDispatch || !IsInDispatch(&context), "It is not safe to connect during dispatch on a lockless dispatch EBus");
+        AZ_Assert(!(Traits::LocklessDispatch || Traits::FlatDispatch) || !IsInDispatch(&context), "It is not safe to connect during dispatch on a lockless or flat dispatch EBus");
 
         // Do the actual connection
         context.m_buses.Connect(handler, id);
@@ -1025,7 +1040,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
     inline void EBus<Interface, Traits>::DisconnectInternal(Context& context, HandlerNode& handler)
     {
         // To call this while executing a message, you need to make sure this mutex is AZStd::recursive_mutex. Otherwise, a deadlock will occur.
-        AZ_Assert(!Traits::LocklessDispatch || !IsInDispatch(&context), "It is not safe to disconnect during dispatch on a lockless dispatch EBus");
+        AZ_Assert(!(Traits::LocklessDispatch || Traits::FlatDispatch) || !IsInDispatch(&context), "It is not safe to disconnect during dispatch on a lockless or flat dispatch EBus");
 
         auto callstack = context.s_callstack->m_prev;
         if (callstack)
@@ -1319,6 +1319,8 @@ namespace AZ
             using HandlerNode = HandlerNode<Interface, Traits, HandlerHolder>;
             // Defines how handlers are stored per address (will be some sort of list)
             using HandlerStorage = HandlerStoragePolicy<Interface, Traits, HandlerNode>;
+            // Defines whether a flat array of the handlers is kept for dispatch
+            using FlatHandlerStorage = FlatHandlerStoragePolicy<Interface, Traits>;
             // No need for AddressStorage, there's only 1
 
             struct BusPtr { };
@@ -1339,30 +1341,50 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
-                        auto& handlers = context->m_buses.m_handlers;
-                        auto handlerIt = handlers.begin();
-                        auto handlersEnd = handlers.end();
-
-                        auto fixer = MakeDisconnectFixer<Bus>(context, nullptr,
-                            [&handlerIt, &handlersEnd](Interface* handler)
+                        if constexpr (Traits::FlatDispatch)
+                        {
+                            // Handlers can't connect or disconnect during a flat dispatch, so there are no iterators to fix up
+                            const auto& flatHandlers = context->m_buses.m_flatHandlers;
+                            CallstackEntry entry(context, nullptr);
+                            if (Interface* handler = flatHandlers.m_singleHandler)
                             {
-                                if (handlerIt != handlersEnd && handlerIt->m_interface == handler)
+                                Traits::EventProcessingPolicy::Call(func, handler, args...);
+                            }
+                            else
+                            {
+                                for (Interface* handler : flatHandlers.m_handlers)
                                 {
-                                    ++handlerIt;
+                                    Traits::EventProcessingPolicy::Call(func, handler, args...);
                                 }
-                            },
-                            [&handlers, &handlersEnd]()
-                            {
-                                handlersEnd = handlers.end();
                             }
-                        );
-
-                        while (handlerIt != handlersEnd)
+                        }
+                        else
                         {
-                            // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
-                            // due to potential of multiple handlers of this EBus container invoking the function multiple times
-                            auto itr = handlerIt++;
-                            Traits::EventProcessingPolicy::Call(func, *itr, args...);
+                            auto& handlers = context->m_buses.m_handlers;
+                            auto handlerIt = handlers.begin();
+                            auto handlersEnd = handlers.end();
+
+                            auto fixer = MakeDisconnectFixer<Bus>(context, nullptr,
+                                [&handlerIt, &handlersEnd](Interface* handler)
+                                {
+                                    if (handlerIt != handlersEnd && handlerIt->m_interface == handler)
+                                    {
+                                        ++handlerIt;
+                                    }
+                                },
+                                [&handlers, &handlersEnd]()
+                                {
+                                    handlersEnd = handlers.end();
+                                }
+                            );
+
+                            while (handlerIt != handlersEnd)
+                            {
+                                // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
+                                // due to potential of multiple handlers of this EBus container invoking the function multiple times
+                                auto itr = handlerIt++;
+                                Traits::EventProcessingPolicy::Call(func, *itr, args...);
+                            }
                         }
                     }
                 }
@@ -1374,30 +1396,50 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
-                        auto& handlers = context->m_buses.m_handlers;
-                        auto handlerIt = handlers.begin();
-                        auto handlersEnd = handlers.end();
-
-                        auto fixer = MakeDisconnectFixer<Bus>(context, nullptr,
-                            [&handlerIt, &handlersEnd](Interface* handler)
+                        if constexpr (Traits::FlatDispatch)
+                        {
+                            // Handlers can't connect or disconnect during a flat dispatch, so there are no iterators to fix up
+                            const auto& flatHandlers = context->m_buses.m_flatHandlers;
+                            CallstackEntry entry(context, nullptr);
+                            if (Interface* handler = flatHandlers.m_singleHandler)
                             {
-                                if (handlerIt != handlersEnd && handlerIt->m_interface == handler)
+                                Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                            }
+                            else
+                            {
+                                for (Interface* handler : flatHandlers.m_handlers)
                                 {
-                                    ++handlerIt;
+                                    Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
                                 }
-                            },
-                            [&handlers, &handlersEnd]()
-                            {
-                                handlersEnd = handlers.end();
                             }
-                        );
-
-                        while (handlerIt != handlersEnd)
+                        }
+                        else
                         {
-                            // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
-                            // due to potential of multiple handlers of this EBus container invoking the function multiple times
-                            auto itr = handlerIt++;
-                            Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
+                            auto& handlers = context->m_buses.m_handlers;
+                            auto handlerIt = handlers.begin();
+                            auto handlersEnd = handlers.end();
+
+                            auto fixer = MakeDisconnectFixer<Bus>(context, nullptr,
+                                [&handlerIt, &handlersEnd](Interface* handler)
+                                {
+                                    if (handlerIt != handlersEnd && handlerIt->m_interface == handler)
+                                    {
+                                        ++handlerIt;
+                                    }
+                                },
+                                [&handlers, &handlersEnd]()
+                                {
+                                    handlersEnd = handlers.end();
+                                }
+                            );
+
+                            while (handlerIt != handlersEnd)
+                            {
+                                // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
+                                // due to potential of multiple handlers of this EBus container invoking the function multiple times
+                                auto itr = handlerIt++;
+                                Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
+                            }
                         }
                     }
                 }
@@ -1409,16 +1451,36 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
-                        auto& handlers = context->m_buses.m_handlers;
-                        auto handlerIt = handlers.rbegin();
-
-                        CallstackEntry entry(context, nullptr);
-                        while (handlerIt != handlers.rend())
+                        if constexpr (Traits::FlatDispatch)
                         {
-                            // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
-                            // due to potential of multiple handlers of this EBus container invoking the function multiple times
-                            auto itr = handlerIt++;
-                            Traits::EventProcessingPolicy::Call(func, *itr, args...);
+                            // Handlers can't connect or disconnect during a flat dispatch, so there are no iterators to fix up
+                            const auto& flatHandlers = context->m_buses.m_flatHandlers;
+                            CallstackEntry entry(context, nullptr);
+                            if (Interface* handler = flatHandlers.m_singleHandler)
+                            {
+                                Traits::EventProcessingPolicy::Call(func, handler, args...);
+                            }
+                            else
+                            {
+                                for (auto handlerIt = flatHandlers.m_handlers.rbegin(); handlerIt != flatHandlers.m_handlers.rend(); ++handlerIt)
+                                {
+                                    Traits::EventProcessingPolicy::Call(func, *handlerIt, args...);
+                                }
+                            }
+                        }
+                        else
+                        {
+                            auto& handlers = context->m_buses.m_handlers;
+                            auto handlerIt = handlers.rbegin();
+
+                            CallstackEntry entry(context, nullptr);
+                            while (handlerIt != handlers.rend())
+                            {
+                                // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
+                                // due to potential of multiple handlers of this EBus container invoking the function multiple times
+                                auto itr = handlerIt++;
+                                Traits::EventProcessingPolicy::Call(func, *itr, args...);
+                            }
                         }
                     }
                 }
@@ -1430,16 +1492,36 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
-                        auto& handlers = context->m_buses.m_handlers;
-                        auto handlerIt = handlers.rbegin();
-
-                        CallstackEntry entry(context, nullptr);
-                        while (handlerIt != handlers.rend())
+                        if constexpr (Traits::FlatDispatch)
                         {
-                            // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
-                            // due to potential of multiple handlers of this EBus container invoking the function multiple times
-                            auto itr = handlerIt++;
-                            Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
+                            // Handlers can't connect or disconnect during a flat dispatch, so there are no iterators to fix up
+                            const auto& flatHandlers = context->m_buses.m_flatHandlers;
+                            CallstackEntry entry(context, nullptr);
+                            if (Interface* handler = flatHandlers.m_singleHandler)
+                            {
+                                Traits::EventProcessingPolicy::CallResult(results, func, handler, args...);
+                            }
+                            else
+                            {
+                                for (auto handlerIt = flatHandlers.m_handlers.rbegin(); handlerIt != flatHandlers.m_handlers.rend(); ++handlerIt)
+                                {
+                                    Traits::EventProcessingPolicy::CallResult(results, func, *handlerIt, args...);
+                                }
+                            }
+                        }
+                        else
+                        {
+                            auto& handlers = context->m_buses.m_handlers;
+                            auto handlerIt = handlers.rbegin();
+
+                            CallstackEntry entry(context, nullptr);
+                            while (handlerIt != handlers.rend())
+                            {
+                                // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
+                                // due to potential of multiple handlers of this EBus container invoking the function multiple times
+                                auto itr = handlerIt++;
+                                Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
+                            }
                         }
                     }
                 }
@@ -1488,15 +1570,19 @@ namespace AZ
             {
                 // Don't need to check for duplicates here, because BusConnect would have caught it already
                 m_handlers.insert(handler);
+                m_flatHandlers.Rebuild(m_handlers);
             }
 
             void Disconnect(HandlerNode& handler)
             {
                 // Don't need to check that handler is already connected here, because BusDisconnect would have caught it already
                 m_handlers.erase(handler);
+                m_flatHandlers.Rebuild(m_handlers);
             }
 
             typename HandlerStorage::StorageType m_handlers;
+            // Copy of m_handlers that broadcasts walk when the bus uses flat dispatch, empty otherwise
+            typename FlatHandlerStorage::StorageType m_flatHandlers;
         };
 
         // Specialization for single address, single handler
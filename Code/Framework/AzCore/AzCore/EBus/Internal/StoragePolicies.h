@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/EBus/Environment.h>
 #include <AzCore/EBus/Policies.h>
 #include <AzCore/EBus/Internal/Debug.h>
 
@@ -15,6 +16,7 @@
 #include <AzCore/std/containers/rbtree.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -174,6 +176,49 @@ namespace AZ
             using StorageType = AZStd::intrusive_multiset<Handler, AZStd::intrusive_multiset_base_hook<Handler>, Compare>;
         };
 
+        /**
+         * FlatHandlerStoragePolicy is used to determine whether a flat copy of the handler list is kept for dispatch.
+         * The copy holds the interface pointers in dispatch order and is rebuilt from the handler list on every connect and disconnect.
+         *
+         * \tparam Interface    The interface for the bus.
+         * \tparam Traits       The traits for the Bus. Used to determine whether the bus uses flat dispatch.
+         */
+        template <typename Interface, typename Traits, bool = Traits::FlatDispatch>
+        struct FlatHandlerStoragePolicy
+        {
+        public:
+            struct StorageType
+            {
+                template <typename HandlerList>
+                void Rebuild(const HandlerList&)
+                {
+                }
+            };
+        };
+        template <typename Interface, typename Traits>
+        struct FlatHandlerStoragePolicy<Interface, Traits, true>
+        {
+        public:
+            struct StorageType
+            {
+                template <typename HandlerList>
+                void Rebuild(const HandlerList& handlerList)
+                {
+                    m_handlers.clear();
+                    for (const auto& handler : handlerList)
+                    {
+                        m_handlers.push_back(handler.m_interface);
+                    }
+                    m_singleHandler = m_handlers.size() == 1 ? m_handlers.front() : nullptr;
+                }
+
+                // Allocated with the EBus environment allocator, buses can have handlers connected before the system allocator exists
+                AZStd::vector<Interface*, AZ::Internal::EBusEnvironmentAllocator> m_handlers;
+                // The only connected handler, so that the common case of a single handler doesn't need to read the array
+                Interface* m_singleHandler = nullptr;
+            };
+        };
+
         // Param Handler to HandlerStoragePolicy is expected to inherit from this type.
         template <typename Handler, EBusHandlerPolicy>
         struct HandlerStorageNode
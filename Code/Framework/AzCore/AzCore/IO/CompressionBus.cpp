@@ -28,10 +28,22 @@ namespace AZ
             m_conflictResolution = rhs.m_conflictResolution;
             m_isCompressed = rhs.m_isCompressed;
             m_isSharedPak = rhs.m_isSharedPak;
+            m_blockSize = rhs.m_blockSize;
+            m_blockOffsets = AZStd::move(rhs.m_blockOffsets);
 
             return *this;
         }
 
+        bool CompressionInfo::IsBlockCompressed() const
+        {
+            return m_isCompressed && m_blockSize != 0 && m_blockOffsets && m_blockOffsets->size() > 1;
+        }
+
+        size_t CompressionInfo::GetNumBlocks() const
+        {
+            return IsBlockCompressed() ? m_blockOffsets->size() - 1 : 0;
+        }
+
         namespace CompressionUtils
         {
             bool FindCompressionInfo(CompressionInfo& info, const AZStd::string_view filename)
@@ -9,8 +9,10 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -43,6 +45,12 @@ namespace AZ
             CompressionInfo(CompressionInfo&& rhs);
             CompressionInfo& operator=(CompressionInfo&& rhs);
 
+            //! Whether or not the file was compressed as a series of independently compressed blocks. Blocks can be decompressed
+            //! in parallel and partial reads only need to decompress the blocks that overlap with the requested range.
+            bool IsBlockCompressed() const;
+            //! Returns the number of blocks in the seek table or zero if the file isn't block compressed.
+            size_t GetNumBlocks() const;
+
             //! Relative path to the archive file.
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
@@ -61,6 +69,13 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Uncompressed size of a single block if the file was compressed as a series of independent blocks. All blocks
+            //! have this size except for the last block which holds the remainder. Zero if the file was compressed as a whole.
+            size_t m_blockSize = 0;
+            //! Seek table with the offsets of the compressed blocks relative to m_offset. The table contains one additional
+            //! entry at the end which marks the end of the last block. Each block is decompressed with m_decompressor. The
+            //! table is shared because the same information is typically handed out for every read of a file.
+            AZStd::shared_ptr<const AZStd::vector<size_t>> m_blockOffsets;
         };
 
         class Compression
@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> BlockDecompressorConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            auto stackEntry = AZStd::make_shared<BlockDecompressor>(
+                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void BlockDecompressorConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<BlockDecompressorConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("MaxNumReads", &BlockDecompressorConfig::m_maxNumReads)
+                    ->Field("MaxNumJobs", &BlockDecompressorConfig::m_maxNumJobs);
+            }
+        }
+
+        BlockDecompressor::BlockDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+            : StreamStackEntry("Block decompressor")
+            , m_maxNumReads(AZ::GetMax(maxNumReads, 1u))
+            , m_maxNumJobs(AZ::GetMax(maxNumJobs, 1u))
+            , m_alignment(alignment)
+        {
+            JobManagerDesc jobDesc;
+            u32 numThreads = AZ::GetMin(m_maxNumJobs, AZStd::thread::hardware_concurrency());
+            for (u32 i = 0; i < numThreads; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+            m_decompressionJobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
+
+            m_readSlots = AZStd::make_unique<ReadSlot[]>(m_maxNumReads);
+
+            // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+            m_bytesDecompressed.PushEntry(1);
+            m_decompressionDurationMicroSec.PushEntry(1);
+        }
+
+        BlockDecompressor::~BlockDecompressor()
+        {
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                ReadSlot& slot = m_readSlots[i];
+                if (slot.m_scratchBuffer != nullptr)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_scratchBuffer, slot.m_scratchBufferSize, m_alignment);
+                }
+            }
+        }
+
+        void BlockDecompressor::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
+            if (data && data->m_compressionInfo.IsBlockCompressed())
+            {
+                m_pendingReads.push_back(request);
+            }
+            else
+            {
+                StreamStackEntry::QueueRequest(request);
+            }
+        }
+
+        bool BlockDecompressor::ExecuteRequests()
+        {
+            bool result = false;
+            // Queue as many new reads as possible. Decompression is started as soon as a read completes.
+            while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+            {
+                StartArchiveRead(m_pendingReads.front());
+                m_pendingReads.pop_front();
+                result = true;
+            }
+
+            return StreamStackEntry::ExecuteRequests() || result;
+        }
+
+        void BlockDecompressor::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            s32 numAvailableSlots = aznumeric_cast<s32>(m_maxNumReads - m_numInFlightReads);
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, numAvailableSlots);
+            status.m_isIdle = status.m_isIdle && IsIdle();
+        }
+
+        void BlockDecompressor::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            // Create predictions for all pending requests. Some will be further processed after this.
+            AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+            double microSecPerByte = aznumeric_cast<double>(m_decompressionDurationMicroSec.GetTotal()) /
+                aznumeric_cast<double>(m_bytesDecompressed.GetTotal());
+
+            // Update the reads that are in flight or decompressing. If all slots are in use, new reads have to wait until
+            // the first slot becomes available.
+            AZStd::chrono::microseconds earliestAvailableSlot = AZStd::chrono::microseconds::max();
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                const ReadSlot& slot = m_readSlots[i];
+                if (slot.m_status == ReadSlotStatus::Unused)
+                {
+                    continue;
+                }
+
+                FileRequest* compressedRequest = slot.m_request->GetParent();
+                AZ_Assert(compressedRequest, "A request attached to BlockDecompressor didn't have a parent compressed request.");
+                auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+                AZ_Assert(data, "Compressed request in BlockDecompressor didn't contain compression read data.");
+                const AZStd::vector<size_t>& blockOffsets = *data->m_compressionInfo.m_blockOffsets;
+                size_t compressedSize = blockOffsets[slot.m_firstBlock + slot.m_numBlocks] - blockOffsets[slot.m_firstBlock];
+                AZStd::chrono::microseconds decompressionDuration =
+                    EstimateDecompressionDuration(compressedSize, slot.m_numBlocks, microSecPerByte);
+
+                AZStd::chrono::system_clock::time_point baseTime;
+                if (slot.m_status == ReadSlotStatus::ReadInFlight)
+                {
+                    // Internal read requests can start and complete but pending finalization before they're ever scheduled in which case
+                    // the estimated time is not set.
+                    baseTime = slot.m_request->GetEstimatedCompletion();
+                    if (baseTime == AZStd::chrono::system_clock::time_point())
+                    {
+                        baseTime = now;
+                    }
+                    baseTime += decompressionDuration;
+                }
+                else
+                {
+                    auto timeInProcessing = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - slot.m_decompressionStartTime);
+                    auto timeLeft = decompressionDuration > timeInProcessing ? decompressionDuration - timeInProcessing : AZStd::chrono::microseconds(0);
+                    baseTime = now + timeLeft;
+                }
+                slot.m_request->SetEstimatedCompletion(baseTime);
+
+                auto timeTillAvailable = baseTime > now
+                    ? AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(baseTime - now) : AZStd::chrono::microseconds(0);
+                earliestAvailableSlot = AZStd::min(earliestAvailableSlot, timeTillAvailable);
+            }
+
+            AZStd::chrono::microseconds cumulativeDelay = (m_numInFlightReads == m_maxNumReads && earliestAvailableSlot != AZStd::chrono::microseconds::max())
+                ? earliestAvailableSlot : AZStd::chrono::microseconds(0);
+
+            // For all internally pending compressed reads add the decompression time. The read time will have already been added downstream.
+            // Because this call will go from the top of the stack to the bottom, but estimation is calculated from the bottom to the top, this
+            // list should be processed in reverse order.
+            for (auto pendingIt = internalPending.rbegin(); pendingIt != internalPending.rend(); ++pendingIt)
+            {
+                EstimateCompressedReadRequest(*pendingIt, cumulativeDelay, microSecPerByte);
+            }
+
+            // Finally add a prediction for all the requests that are waiting to be queued.
+            for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+            {
+                EstimateCompressedReadRequest(*requestIt, cumulativeDelay, microSecPerByte);
+            }
+        }
+
+        void BlockDecompressor::EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+            double microSecPerByte) const
+        {
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
+            if (data && data->m_compressionInfo.IsBlockCompressed())
+            {
+                size_t firstBlock, numBlocks, compressedOffset, compressedSize;
+                CalculateBlockRange(data->m_compressionInfo, data->m_readOffset, data->m_readSize,
+                    firstBlock, numBlocks, compressedOffset, compressedSize);
+                AZStd::chrono::microseconds processingTime = EstimateDecompressionDuration(compressedSize, numBlocks, microSecPerByte);
+
+                cumulativeDelay += processingTime;
+                request->SetEstimatedCompletion(request->GetEstimatedCompletion() + processingTime);
+            }
+        }
+
+        AZStd::chrono::microseconds BlockDecompressor::EstimateDecompressionDuration(
+            size_t compressedSize, size_t numBlocks, double microSecPerByte) const
+        {
+            // Blocks are spread over the available jobs, so assume they're decompressed in parallel.
+            double parallelism = aznumeric_cast<double>(AZ::GetClamp<size_t>(numBlocks, 1, m_maxNumJobs));
+            return AZStd::chrono::microseconds(aznumeric_cast<u64>((compressedSize * microSecPerByte) / parallelism));
+        }
+
+        void BlockDecompressor::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+            constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+            constexpr double usToMs = 1.0 / 1000.0;
+
+            if (m_bytesDecompressed.GetNumRecorded() > 1) // There's always a default added.
+            {
+                //It only makes sense to add decompression statistics when reading from block compressed files.
+                statistics.push_back(Statistic::CreateInteger(m_name, "Available read slots", m_maxNumReads - m_numInFlightReads));
+                statistics.push_back(Statistic::CreateInteger(m_name, "Decompressing", m_numDecompressing));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Buffer memory (MB)", m_memoryUsage * bytesToMB));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Blocks per read (avg.)", m_blocksPerRead.CalculateAverage()));
+                statistics.push_back(Statistic::CreateFloat(m_name, "Decompression latency (avg. ms)",
+                    m_decompressionLatencyMicroSec.CalculateAverage() * usToMs));
+
+                double totalBytesDecompressedMB = m_bytesDecompressed.GetTotal() * bytesToMB;
+                double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
+                statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
+            }
+
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        bool BlockDecompressor::IsIdle() const
+        {
+            return
+                m_pendingReads.empty() &&
+                m_numInFlightReads == 0 &&
+                m_numDecompressing == 0;
+        }
+
+        void BlockDecompressor::CalculateBlockRange(const CompressionInfo& info, u64 readOffset, u64 readSize,
+            size_t& firstBlock, size_t& numBlocks, size_t& compressedOffset, size_t& compressedSize)
+        {
+            const AZStd::vector<size_t>& blockOffsets = *info.m_blockOffsets;
+            size_t totalNumBlocks = info.GetNumBlocks();
+            if (readSize == 0 || totalNumBlocks == 0)
+            {
+                firstBlock = 0;
+                numBlocks = 0;
+                compressedOffset = 0;
+                compressedSize = 0;
+                return;
+            }
+
+            firstBlock = AZ::GetMin(aznumeric_cast<size_t>(readOffset / info.m_blockSize), totalNumBlocks - 1);
+            size_t lastBlock = AZ::GetMin(aznumeric_cast<size_t>((readOffset + readSize - 1) / info.m_blockSize), totalNumBlocks - 1);
+            numBlocks = lastBlock - firstBlock + 1;
+            compressedOffset = blockOffsets[firstBlock];
+            compressedSize = blockOffsets[lastBlock + 1] - compressedOffset;
+        }
+
+        void BlockDecompressor::StartArchiveRead(FileRequest* compressedReadRequest)
+        {
+            if (!m_next)
+            {
+                compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(compressedReadRequest);
+                return;
+            }
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedReadRequest->GetCommand());
+            AZ_Assert(data, "Compressed request that's starting a read in BlockDecompressor didn't contain compression read data.");
+            const CompressionInfo& info = data->m_compressionInfo;
+            AZ_Assert(info.m_decompressor, "FileRequest for BlockDecompressor is missing a decompression callback.");
+            AZ_Assert(data->m_readOffset + data->m_readSize <= info.m_uncompressedSize,
+                "BlockDecompressor received a read (offset %llu, size %llu) that's outside the file (size %zu).",
+                data->m_readOffset, data->m_readSize, info.m_uncompressedSize);
+
+            size_t firstBlock, numBlocks, compressedOffset, compressedSize;
+            CalculateBlockRange(info, data->m_readOffset, data->m_readSize, firstBlock, numBlocks, compressedOffset, compressedSize);
+            if (numBlocks == 0)
+            {
+                compressedReadRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(compressedReadRequest);
+                return;
+            }
+
+            for (u32 i = 0; i < m_maxNumReads; ++i)
+            {
+                ReadSlot& slot = m_readSlots[i];
+                if (slot.m_status == ReadSlotStatus::Unused)
+                {
+                    // Only read the blocks that overlap with the requested range. As with the FullFileDecompressor the buffer is aligned
+                    // down but the offset is not corrected so the same data isn't read multiple times.
+                    size_t archiveOffset = info.m_offset + compressedOffset;
+                    slot.m_alignmentOffset = archiveOffset - AZ_SIZE_ALIGN_DOWN(archiveOffset, aznumeric_cast<size_t>(m_alignment));
+                    slot.m_bufferSize = AZ_SIZE_ALIGN_UP((compressedSize + slot.m_alignmentOffset), aznumeric_cast<size_t>(m_alignment));
+                    slot.m_compressedData = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                        slot.m_bufferSize, m_alignment, 0, "AZ::IO::Streamer BlockDecompressor", __FILE__, __LINE__));
+                    slot.m_firstBlock = firstBlock;
+                    slot.m_numBlocks = numBlocks;
+                    m_memoryUsage += slot.m_bufferSize;
+
+                    FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
+                    archiveReadRequest->CreateRead(compressedReadRequest, slot.m_compressedData + slot.m_alignmentOffset,
+                        slot.m_bufferSize - slot.m_alignmentOffset, info.m_archiveFilename, archiveOffset, compressedSize, info.m_isSharedPak);
+                    archiveReadRequest->SetCompletionCallback(
+                        [this, readSlot = i](FileRequest& request)
+                        {
+                            AZ_PROFILE_FUNCTION(AzCore);
+                            FinishArchiveRead(&request, readSlot);
+                        });
+
+                    slot.m_request = archiveReadRequest;
+                    slot.m_status = ReadSlotStatus::ReadInFlight;
+                    AZ_Assert(m_numInFlightReads < m_maxNumReads,
+                        "A FileRequest was queued for reading in BlockDecompressor, but there's no slots available.");
+                    m_numInFlightReads++;
+
+                    m_next->QueueRequest(archiveReadRequest);
+                    return;
+                }
+            }
+            AZ_Assert(false, "%u of %u read slots are use in the BlockDecompressor, but no empty slot was found.", m_numInFlightReads, m_maxNumReads);
+        }
+
+        void BlockDecompressor::FinishArchiveRead(FileRequest* readRequest, u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            AZ_Assert(slot.m_request == readRequest,
+                "Request in the archive read slot isn't the same as request that's being completed.");
+
+            if (readRequest->GetStatus() == IStreamerTypes::RequestStatus::Completed)
+            {
+                StartDecompression(readSlot);
+            }
+            else
+            {
+                // The compressed request will pick up the failed or canceled status from the read request.
+                ReleaseReadSlot(readSlot);
+            }
+        }
+
+        void BlockDecompressor::StartDecompression(u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            FileRequest* compressedRequest = slot.m_request->GetParent();
+            AZ_Assert(compressedRequest, "Read requests started by BlockDecompressor is missing a parent request.");
+
+            // Add this wait so the compressed request isn't fully completed yet as only the read part is done. The
+            // last job to finish will complete this wait, which in turn will trigger FinishDecompression on the main streaming thread.
+            FileRequest* waitRequest = m_context->GetNewInternalRequest();
+            waitRequest->CreateWait(compressedRequest);
+            waitRequest->SetCompletionCallback([this, readSlot](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    FinishDecompression(&request, readSlot);
+                });
+
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request in BlockDecompressor that's starting decompression didn't contain compression read data.");
+            ReserveScratchBuffer(slot, data->m_compressionInfo.m_blockSize);
+
+            u32 numJobs = aznumeric_cast<u32>(AZ::GetMin<size_t>(slot.m_numBlocks, m_maxNumJobs));
+            slot.m_request = waitRequest;
+            slot.m_status = ReadSlotStatus::Decompressing;
+            slot.m_decompressionStartTime = AZStd::chrono::system_clock::now();
+            slot.m_nextBlock = 0;
+            slot.m_numRunningJobs = numJobs;
+            slot.m_decompressionDurationMicroSec = 0;
+            slot.m_failed = false;
+            ++m_numDecompressing;
+
+            // Rather than creating a job per block, a job per available thread is created and the jobs pick up the next
+            // block that hasn't been claimed yet. This keeps the job overhead low for files with many small blocks and
+            // balances the work if some blocks take longer to decompress than others.
+            for (u32 i = 0; i < numJobs; ++i)
+            {
+                auto job = [this, readSlot]()
+                {
+                    DecompressBlocks(readSlot);
+                };
+                AZ::CreateJobFunction(job, true, m_decompressionJobContext.get())->Start();
+            }
+        }
+
+        void BlockDecompressor::ReserveScratchBuffer(ReadSlot& slot, size_t blockSize)
+        {
+            // Room for a partial first and a partial last block, which can be decompressed at the same time by different jobs.
+            size_t requiredSize = AZ_SIZE_ALIGN_UP(blockSize * 2, aznumeric_cast<size_t>(m_alignment));
+            if (slot.m_scratchBufferSize < requiredSize)
+            {
+                if (slot.m_scratchBuffer != nullptr)
+                {
+                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_scratchBuffer, slot.m_scratchBufferSize, m_alignment);
+                    m_memoryUsage -= slot.m_scratchBufferSize;
+                }
+                slot.m_scratchBuffer = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                    requiredSize, m_alignment, 0, "AZ::IO::Streamer BlockDecompressor", __FILE__, __LINE__));
+                slot.m_scratchBufferSize = requiredSize;
+                m_memoryUsage += requiredSize;
+            }
+        }
+
+        void BlockDecompressor::FinishDecompression([[maybe_unused]] FileRequest* waitRequest, u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            AZ_Assert(slot.m_request == waitRequest, "Read slot didn't contain the expected wait request.");
+            AZ_Assert(slot.m_numRunningJobs == 0, "BlockDecompressor finished decompression while jobs are still running.");
+
+            FileRequest* compressedRequest = waitRequest->GetParent();
+            AZ_Assert(compressedRequest, "A wait request attached to BlockDecompressor was completed but didn't have a parent compressed request.");
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request in BlockDecompressor that completed decompression didn't contain compression read data.");
+            const AZStd::vector<size_t>& blockOffsets = *data->m_compressionInfo.m_blockOffsets;
+
+            auto endTime = AZStd::chrono::system_clock::now();
+            m_decompressionLatencyMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                endTime - slot.m_decompressionStartTime).count());
+            m_decompressionDurationMicroSec.PushEntry(slot.m_decompressionDurationMicroSec);
+            m_bytesDecompressed.PushEntry(blockOffsets[slot.m_firstBlock + slot.m_numBlocks] - blockOffsets[slot.m_firstBlock]);
+            m_blocksPerRead.PushEntry(slot.m_numBlocks);
+
+            AZ_Assert(m_numDecompressing > 0, "About to complete a decompression, but the internal count doesn't see a running decompression.");
+            --m_numDecompressing;
+            ReleaseReadSlot(readSlot);
+        }
+
+        void BlockDecompressor::ReleaseReadSlot(u32 readSlot)
+        {
+            ReadSlot& slot = m_readSlots[readSlot];
+            if (slot.m_compressedData != nullptr)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(slot.m_compressedData, slot.m_bufferSize, m_alignment);
+                slot.m_compressedData = nullptr;
+            }
+            m_memoryUsage -= slot.m_bufferSize;
+            slot.m_bufferSize = 0;
+            slot.m_request = nullptr;
+            slot.m_status = ReadSlotStatus::Unused;
+
+            AZ_Assert(m_numInFlightReads > 0, "Trying to release a read slot in BlockDecompressor, but no read slots are supposed to be in use.");
+            m_numInFlightReads--;
+        }
+
+        void BlockDecompressor::DecompressBlocks(u32 readSlot)
+        {
+            auto startTime = AZStd::chrono::system_clock::now();
+
+            ReadSlot& slot = m_readSlots[readSlot];
+            FileRequest* compressedRequest = slot.m_request->GetParent();
+            auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request in BlockDecompressor that's running decompression didn't contain compression read data.");
+
+            size_t block;
+            while ((block = slot.m_nextBlock.fetch_add(1)) < slot.m_numBlocks)
+            {
+                // Once a block failed the request will fail, so there's no point in decompressing the remaining blocks.
+                if (slot.m_failed)
+                {
+                    break;
+                }
+                if (!DecompressBlock(slot, block, *data))
+                {
+                    slot.m_failed = true;
+                }
+            }
+
+            slot.m_decompressionDurationMicroSec += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - startTime).count();
+
+            // The last job to finish completes the request.
+            if (slot.m_numRunningJobs.fetch_sub(1) == 1)
+            {
+                FileRequest* waitRequest = slot.m_request;
+                waitRequest->SetStatus(slot.m_failed ? IStreamerTypes::RequestStatus::Failed : IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(waitRequest);
+                m_context->WakeUpSchedulingThread();
+            }
+        }
+
+        bool BlockDecompressor::DecompressBlock(const ReadSlot& slot, size_t block, const FileRequest::CompressedReadData& data) const
+        {
+            const CompressionInfo& info = data.m_compressionInfo;
+            const AZStd::vector<size_t>& blockOffsets = *info.m_blockOffsets;
+
+            size_t blockIndex = slot.m_firstBlock + block;
+            const u8* compressed = slot.m_compressedData + slot.m_alignmentOffset + (blockOffsets[blockIndex] - blockOffsets[slot.m_firstBlock]);
+            size_t compressedSize = blockOffsets[blockIndex + 1] - blockOffsets[blockIndex];
+
+            u64 blockStart = blockIndex * info.m_blockSize;
+            u64 blockSize = AZ::GetMin<u64>(info.m_blockSize, info.m_uncompressedSize - blockStart);
+            u64 blockEnd = blockStart + blockSize;
+            u64 copyStart = AZ::GetMax(blockStart, data.m_readOffset);
+            u64 copyEnd = AZ::GetMin(blockEnd, data.m_readOffset + data.m_readSize);
+            u8* output = reinterpret_cast<u8*>(data.m_output) + (copyStart - data.m_readOffset);
+
+            if (copyStart == blockStart && copyEnd == blockEnd)
+            {
+                // The block is entirely covered by the request so decompress directly into the output.
+                return info.m_decompressor(info, compressed, compressedSize, output, blockSize);
+            }
+            else
+            {
+                // Only part of the block was requested, which can only happen for the first and last block.
+                u8* decompressionBuffer = slot.m_scratchBuffer + (block == 0 ? 0 : info.m_blockSize);
+                if (!info.m_decompressor(info, compressed, compressedSize, decompressionBuffer, blockSize))
+                {
+                    return false;
+                }
+                memcpy(output, decompressionBuffer + (copyStart - blockStart), copyEnd - copyStart);
+                return true;
+            }
+        }
+    } // namespace IO
+} // namespace AZ
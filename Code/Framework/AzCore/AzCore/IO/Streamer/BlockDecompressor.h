@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct CompressionInfo;
+
+        struct BlockDecompressorConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::BlockDecompressorConfig, "{6D1C6F0A-92B7-4C43-8E31-0B4C5E1F7A62}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(BlockDecompressorConfig, AZ::SystemAllocator, 0);
+
+            ~BlockDecompressorConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Maximum number of reads that are kept in flight.
+            u32 m_maxNumReads{ 2 };
+            //! Maximum number of blocks that can be decompressed simultaneously.
+            u32 m_maxNumJobs{ 4 };
+        };
+
+        //! Entry in the streaming stack that decompresses files from an archive that were compressed as a
+        //! series of independent blocks, as described by the seek table in CompressionInfo.
+        //! Only the blocks that overlap with the requested range are read and decompressed, which allows
+        //! for cheap random access into large compressed files. All blocks of a single read are decompressed
+        //! in parallel on a dedicated job system, so a single large file is no longer limited to the speed of
+        //! one core. Compressed reads for files that don't have a seek table are passed to the next entry,
+        //! so this entry needs to be placed above the FullFileDecompressor in the stack.
+        //! The entry isn't part of the default stacks as archives don't store a seek table yet. Projects that fill in the
+        //! block information through the CompressionBus can add it to their streamer stack with BlockDecompressorConfig.
+        class BlockDecompressor
+            : public StreamStackEntry
+        {
+        public:
+            BlockDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+            ~BlockDecompressor() override;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            using Buffer = u8*;
+
+            enum class ReadSlotStatus : uint8_t
+            {
+                Unused,
+                ReadInFlight,
+                Decompressing
+            };
+
+            struct ReadSlot
+            {
+                AZStd::chrono::system_clock::time_point m_decompressionStartTime;
+                //! The archive read while reading, or the wait request that's completed after the last block is decompressed.
+                FileRequest* m_request{ nullptr };
+                Buffer m_compressedData{ nullptr };
+                //! Buffer for the first and last block if they're only partially requested. Kept between reads to avoid
+                //! allocating while decompressing. The first half is used by the first block and the second half by the last.
+                Buffer m_scratchBuffer{ nullptr };
+                size_t m_bufferSize{ 0 };
+                size_t m_scratchBufferSize{ 0 };
+                size_t m_alignmentOffset{ 0 };
+                size_t m_firstBlock{ 0 };
+                size_t m_numBlocks{ 0 };
+                AZStd::atomic<size_t> m_nextBlock{ 0 };
+                AZStd::atomic<u32> m_numRunningJobs{ 0 };
+                AZStd::atomic<u64> m_decompressionDurationMicroSec{ 0 };
+                AZStd::atomic_bool m_failed{ false };
+                ReadSlotStatus m_status{ ReadSlotStatus::Unused };
+            };
+
+            bool IsIdle() const;
+
+            //! Calculates the range in the archive that needs to be read to decompress the blocks that overlap with the requested range.
+            static void CalculateBlockRange(const CompressionInfo& info, u64 readOffset, u64 readSize,
+                size_t& firstBlock, size_t& numBlocks, size_t& compressedOffset, size_t& compressedSize);
+            void EstimateCompressedReadRequest(FileRequest* request, AZStd::chrono::microseconds& cumulativeDelay,
+                double microSecPerByte) const;
+            AZStd::chrono::microseconds EstimateDecompressionDuration(size_t compressedSize, size_t numBlocks, double microSecPerByte) const;
+
+            void StartArchiveRead(FileRequest* compressedReadRequest);
+            void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
+            void StartDecompression(u32 readSlot);
+            void ReserveScratchBuffer(ReadSlot& slot, size_t blockSize);
+            void FinishDecompression(FileRequest* waitRequest, u32 readSlot);
+            void ReleaseReadSlot(u32 readSlot);
+
+            void DecompressBlocks(u32 readSlot);
+            bool DecompressBlock(const ReadSlot& slot, size_t block, const FileRequest::CompressedReadData& data) const;
+
+            AZStd::deque<FileRequest*> m_pendingReads;
+
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionDurationMicroSec;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_decompressionLatencyMicroSec;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_bytesDecompressed;
+            AverageWindow<size_t, double, s_statisticsWindowSize> m_blocksPerRead;
+
+            AZStd::unique_ptr<ReadSlot[]> m_readSlots;
+            AZStd::unique_ptr<JobManager> m_decompressionJobManager;
+            AZStd::unique_ptr<JobContext> m_decompressionJobContext;
+
+            size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+            u32 m_maxNumReads{ 2 };
+            u32 m_numInFlightReads{ 0 };
+            u32 m_numDecompressing{ 0 };
+            u32 m_maxNumJobs{ 1 };
+            u32 m_alignment{ 0 };
+        };
+    } // namespace IO
+} // namespace AZ
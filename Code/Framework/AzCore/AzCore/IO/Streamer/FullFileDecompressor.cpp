@@ -292,7 +292,8 @@ namespace AZ
             AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const
         {
             auto data = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand());
-            if (data)
+            // Block compressed files are handled by the BlockDecompressor, which provides its own estimation.
+            if (data && !data->m_compressionInfo.IsBlockCompressed())
             {
                 AZStd::chrono::microseconds processingTime = decompressionDelay;
                 size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
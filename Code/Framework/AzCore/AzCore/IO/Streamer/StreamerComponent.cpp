@@ -12,6 +12,7 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
@@ -191,6 +192,7 @@ namespace AZ
         }
 
         BlockCacheConfig::Reflect(context);
+        BlockDecompressorConfig::Reflect(context);
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
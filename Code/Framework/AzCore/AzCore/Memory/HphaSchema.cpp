@@ -11,8 +11,10 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
 #ifdef _DEBUG
@@ -468,6 +470,28 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+        // the thread cache keeps freed small allocations of a single thread so they can be reused without locking the buckets
+        // blocks in a thread cache are still allocated from the point of view of the buckets and are moved in batches
+        struct thread_cache
+        {
+            free_link* mBlocks[NUM_BUCKETS];
+            unsigned short mCount[NUM_BUCKETS];
+            unsigned mPurgeEpoch;
+            AZStd::atomic<size_t> mCachedSize;  // only written by the owning thread
+            AZStd::atomic<bool> mClaimed;
+        };
+        thread_cache* thread_cache_get();
+        thread_cache* thread_cache_claim(unsigned registryIndex);
+        void* thread_cache_alloc(thread_cache& cache, unsigned bi);
+        void thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        void thread_cache_flush(thread_cache& cache, unsigned bi, size_t keepCount);
+        void thread_cache_flush_all(thread_cache& cache);
+        size_t thread_cache_get_cached_size() const;
+        void thread_cache_create(size_t threadCacheSize);
+        void thread_cache_destroy();
+        // called when a thread exits, returns the blocks in its cache to the buckets
+        void thread_cache_release(unsigned cacheIndex);
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -723,6 +747,12 @@ namespace AZ {
         size_t mTotalCapacitySizeBuckets = 0;
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
+
+        thread_cache* mThreadCaches = nullptr;
+        unsigned short mThreadCacheLimit[NUM_BUCKETS];  // max number of blocks a thread cache keeps per bucket
+        unsigned mThreadCacheRegistryIndex = 0;
+        AZ::u64 mThreadCacheId = 0;                     // 0 if the thread caches are disabled
+        AZStd::atomic<unsigned> mThreadCachePurgeEpoch{ 0 };
     public:
         HpAllocator(AZ::HphaSchema::Descriptor desc);
         ~HpAllocator();
@@ -1047,6 +1077,17 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Blocks in thread caches keep their pages alive. The cache of this thread is returned right away,
+            // other threads return theirs the next time they use this allocator.
+            if (mThreadCacheId != 0)
+            {
+                mThreadCachePurgeEpoch.fetch_add(1, AZStd::memory_order_relaxed);
+                if (thread_cache* cache = thread_cache_get())
+                {
+                    thread_cache_flush_all(*cache);
+                }
+            }
+
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1063,7 +1104,7 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_get_cached_size();
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1087,6 +1128,61 @@ namespace AZ {
 #endif
     };
 
+    //////////////////////////////////////////////////////////////////////////
+    namespace HphaThreadCache
+    {
+        // max number of threads that can have a cache in a single allocator, other threads use the buckets directly
+        static const unsigned MAX_THREAD_CACHES = 64;
+        // max number of allocators that can have thread caches at the same time
+        static const unsigned MAX_ALLOCATORS = 16;
+        // bounds for the number of blocks a thread cache keeps per bucket
+        static const size_t MIN_BLOCKS_PER_BUCKET = 4;
+        static const size_t MAX_BLOCKS_PER_BUCKET = 128;
+        static const unsigned INVALID_CACHE_INDEX = ~0u;
+
+        // allocators with thread caches, so exiting threads only return their blocks to allocators that still exist
+        struct RegistryEntry
+        {
+            HpAllocator* mAllocator;
+            AZ::u64 mId;
+        };
+        static RegistryEntry s_registry[MAX_ALLOCATORS];
+        static AZ::u64 s_lastId = 0;
+        static AZStd::spin_mutex s_registryLock;
+
+        // the cache the current thread claimed in each of the registered allocators
+        struct ThreadSlot
+        {
+            AZ::u64 mId;
+            unsigned mCacheIndex;
+        };
+        static AZ_THREAD_LOCAL ThreadSlot t_slots[MAX_ALLOCATORS];
+        static AZ_THREAD_LOCAL bool t_isExiting = false;
+
+        struct ThreadExitHandler
+        {
+            ~ThreadExitHandler()
+            {
+                // any allocation freed after this point goes straight to the buckets
+                t_isExiting = true;
+
+                AZStd::lock_guard<AZStd::spin_mutex> lock(s_registryLock);
+                for (unsigned i = 0; i < MAX_ALLOCATORS; ++i)
+                {
+                    ThreadSlot& slot = t_slots[i];
+                    if (slot.mId != 0 && slot.mId == s_registry[i].mId && slot.mCacheIndex != INVALID_CACHE_INDEX)
+                    {
+                        s_registry[i].mAllocator->thread_cache_release(slot.mCacheIndex);
+                    }
+                    slot.mId = 0;
+                }
+            }
+
+            bool mIsInstalled = false;
+        };
+        static thread_local ThreadExitHandler t_exitHandler;
+    } // namespace HphaThreadCache
+
 #ifdef DEBUG_MULTI_RBTREE
     unsigned intrusive_multi_rbtree_base::check_height(node_base* node) const
     {
@@ -1155,6 +1251,10 @@ namespace AZ {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
             tree_attach(bl);
         }
+        else if (m_isPoolAllocations && desc.m_threadCacheSize > 0)
+        {
+            thread_cache_create(desc.m_threadCacheSize);
+        }
 
 #if AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
 #   if  defined(MULTITHREADED)
@@ -1180,7 +1280,8 @@ namespace AZ {
         report();
         check();
 #endif
-        
+
+        thread_cache_destroy();
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1371,6 +1472,10 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_alloc(*cache, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1438,6 +1543,10 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_free(*cache, ptr, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1456,6 +1565,10 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (thread_cache* cache = thread_cache_get())
+        {
+            return thread_cache_free(*cache, ptr, bi);
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1570,6 +1683,262 @@ namespace AZ {
         }
     }
 
+    void HpAllocator::thread_cache_create(size_t threadCacheSize)
+    {
+        using namespace HphaThreadCache;
+
+        const size_t storageSize = AZ::SizeAlignUp(sizeof(thread_cache) * MAX_THREAD_CACHES, OS_VIRTUAL_PAGE_SIZE);
+        thread_cache* caches = reinterpret_cast<thread_cache*>(SystemAlloc(storageSize, OS_VIRTUAL_PAGE_SIZE));
+        if (!caches)
+        {
+            return;
+        }
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(s_registryLock);
+            for (unsigned i = 0; i < MAX_ALLOCATORS; ++i)
+            {
+                if (s_registry[i].mId == 0)
+                {
+                    s_registry[i].mAllocator = this;
+                    s_registry[i].mId = ++s_lastId;
+                    mThreadCacheRegistryIndex = i;
+                    mThreadCacheId = s_registry[i].mId;
+                    break;
+                }
+            }
+        }
+        if (mThreadCacheId == 0)
+        {
+            // too many allocators with thread caches, use the buckets directly
+            SystemFree(caches);
+            return;
+        }
+
+        for (unsigned i = 0; i < MAX_THREAD_CACHES; ++i)
+        {
+            thread_cache* cache = new (&caches[i]) thread_cache;
+            memset(cache->mBlocks, 0, sizeof(cache->mBlocks));
+            memset(cache->mCount, 0, sizeof(cache->mCount));
+            cache->mPurgeEpoch = 0;
+            cache->mCachedSize.store(0, AZStd::memory_order_relaxed);
+            cache->mClaimed.store(false, AZStd::memory_order_relaxed);
+        }
+
+        const size_t bucketCacheSize = threadCacheSize / NUM_BUCKETS;
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            const size_t blockCount = bucketCacheSize / bucket_spacing_function_inverse(bi);
+            mThreadCacheLimit[bi] = (unsigned short)AZStd::GetMin(AZStd::GetMax(blockCount, MIN_BLOCKS_PER_BUCKET), MAX_BLOCKS_PER_BUCKET);
+        }
+        mThreadCaches = caches;
+    }
+
+    void HpAllocator::thread_cache_destroy()
+    {
+        using namespace HphaThreadCache;
+
+        if (mThreadCacheId == 0)
+        {
+            return;
+        }
+        {
+            AZStd::lock_guard<AZStd::spin_mutex> lock(s_registryLock);
+            s_registry[mThreadCacheRegistryIndex].mAllocator = nullptr;
+            s_registry[mThreadCacheRegistryIndex].mId = 0;
+        }
+        mThreadCacheId = 0;
+
+        // the allocator is no longer in use, so the caches of threads that are still running can be returned as well
+        for (unsigned i = 0; i < MAX_THREAD_CACHES; ++i)
+        {
+            thread_cache_flush_all(mThreadCaches[i]);
+        }
+        SystemFree(mThreadCaches);
+        mThreadCaches = nullptr;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get()
+    {
+        using namespace HphaThreadCache;
+
+        if (mThreadCacheId == 0 || t_isExiting)
+        {
+            return nullptr;
+        }
+
+        thread_cache* cache = nullptr;
+        const ThreadSlot& slot = t_slots[mThreadCacheRegistryIndex];
+        if (slot.mId == mThreadCacheId)
+        {
+            if (slot.mCacheIndex == INVALID_CACHE_INDEX)
+            {
+                return nullptr;
+            }
+            cache = &mThreadCaches[slot.mCacheIndex];
+        }
+        else
+        {
+            cache = thread_cache_claim(mThreadCacheRegistryIndex);
+            if (!cache)
+            {
+                return nullptr;
+            }
+        }
+
+        const unsigned purgeEpoch = mThreadCachePurgeEpoch.load(AZStd::memory_order_relaxed);
+        if (cache->mPurgeEpoch != purgeEpoch)
+        {
+            // the allocator was purged since this thread last used it
+            cache->mPurgeEpoch = purgeEpoch;
+            thread_cache_flush_all(*cache);
+        }
+        return cache;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_claim(unsigned registryIndex)
+    {
+        using namespace HphaThreadCache;
+
+        // Mark this thread as not having a cache first. Installing the exit handler can allocate, in which case
+        // the allocation uses the buckets directly.
+        ThreadSlot& slot = t_slots[registryIndex];
+        slot.mId = mThreadCacheId;
+        slot.mCacheIndex = INVALID_CACHE_INDEX;
+        t_exitHandler.mIsInstalled = true;
+
+        for (unsigned i = 0; i < MAX_THREAD_CACHES; ++i)
+        {
+            bool expected = false;
+            if (mThreadCaches[i].mClaimed.compare_exchange_strong(expected, true, AZStd::memory_order_acq_rel))
+            {
+                mThreadCaches[i].mPurgeEpoch = mThreadCachePurgeEpoch.load(AZStd::memory_order_relaxed);
+                slot.mCacheIndex = i;
+                return &mThreadCaches[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void HpAllocator::thread_cache_release(unsigned cacheIndex)
+    {
+        HPPA_ASSERT(cacheIndex < HphaThreadCache::MAX_THREAD_CACHES);
+        thread_cache& cache = mThreadCaches[cacheIndex];
+        thread_cache_flush_all(cache);
+        cache.mClaimed.store(false, AZStd::memory_order_release);
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        if (!cache.mBlocks[bi])
+        {
+            // refill half of the cache with a single lock of the bucket
+            const size_t fillCount = AZStd::GetMax<size_t>(mThreadCacheLimit[bi] / 2, 1);
+            size_t count = 0;
+            {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+                AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+                for (; count < fillCount; ++count)
+                {
+                    page* p = mBuckets[bi].get_free_page();
+                    if (!p)
+                    {
+                        p = bucket_grow(elemSize, mBuckets[bi].marker());
+                        if (!p)
+                        {
+                            break;
+                        }
+                        mBuckets[bi].add_free_page(p);
+                    }
+                    mTotalAllocatedSizeBuckets += elemSize;
+                    free_link* block = (free_link*)mBuckets[bi].alloc(p);
+                    block->mNext = cache.mBlocks[bi];
+                    cache.mBlocks[bi] = block;
+                }
+            }
+            if (count == 0)
+            {
+                return NULL;
+            }
+            cache.mCount[bi] = (unsigned short)count;
+            cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) + count * elemSize, AZStd::memory_order_relaxed);
+        }
+
+        free_link* block = cache.mBlocks[bi];
+        cache.mBlocks[bi] = block->mNext;
+        cache.mCount[bi]--;
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) - elemSize, AZStd::memory_order_relaxed);
+        return block;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi)
+    {
+        free_link* block = (free_link*)ptr;
+        block->mNext = cache.mBlocks[bi];
+        cache.mBlocks[bi] = block;
+        cache.mCount[bi]++;
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        if (cache.mCount[bi] > mThreadCacheLimit[bi])
+        {
+            // return half of the cache with a single lock of the bucket
+            thread_cache_flush(cache, bi, mThreadCacheLimit[bi] / 2);
+        }
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache& cache, unsigned bi, size_t keepCount)
+    {
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        size_t flushCount = 0;
+        {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+            while (cache.mCount[bi] > keepCount)
+            {
+                free_link* block = cache.mBlocks[bi];
+                cache.mBlocks[bi] = block->mNext;
+                cache.mCount[bi]--;
+                mTotalAllocatedSizeBuckets -= elemSize;
+                mBuckets[bi].free(ptr_get_page(block), block);
+                ++flushCount;
+            }
+        }
+        cache.mCachedSize.store(cache.mCachedSize.load(AZStd::memory_order_relaxed) - flushCount * elemSize, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_flush_all(thread_cache& cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache.mCount[bi] > 0)
+            {
+                thread_cache_flush(cache, bi, 0);
+            }
+        }
+    }
+
+    size_t HpAllocator::thread_cache_get_cached_size() const
+    {
+        size_t cachedSize = 0;
+        if (mThreadCaches)
+        {
+            for (unsigned i = 0; i < HphaThreadCache::MAX_THREAD_CACHES; ++i)
+            {
+                cachedSize += mThreadCaches[i].mCachedSize.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return cachedSize;
+    }
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
@@ -2308,7 +2677,7 @@ namespace AZ {
     size_t
     HpAllocator::GetUnAllocatedMemory(bool isPrint) const
     {
-        return bucket_get_unused_memory(isPrint) + tree_get_unused_memory(isPrint);
+        return bucket_get_unused_memory(isPrint) + tree_get_unused_memory(isPrint) + thread_cache_get_cached_size();
     }
 
     //=========================================================================
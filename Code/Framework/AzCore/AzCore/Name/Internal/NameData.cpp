@@ -34,6 +34,20 @@ namespace AZ
             ++m_useCount;
         }
 
+        bool NameData::TryAddRef()
+        {
+            int32_t useCount = m_useCount.load();
+            do
+            {
+                // A negative count means the dictionary is about to delete this entry.
+                if (useCount < 0)
+                {
+                    return false;
+                }
+            } while (!m_useCount.compare_exchange_weak(useCount, useCount + 1));
+            return true;
+        }
+
         void NameData::release()
         {
             // this could be released after we decrement the counter, therefore we will
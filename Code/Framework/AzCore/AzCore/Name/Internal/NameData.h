@@ -34,12 +34,25 @@ namespace AZ
             //! Returns the hash part of the name data.
             Hash GetHash() const;
 
+            //! Calculates the hash for the provided name string. This doesn't resolve hash collisions so the final hash
+            //! of a name can differ from the calculated value.
+            static constexpr Hash CalcHash(AZStd::string_view name)
+            {
+                // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+                // of network synchronization. So just take the low 32 bits.
+                return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+            }
+
         private:
             NameData(AZStd::string&& name, Hash hash);
 
             void add_ref();
             void release();
 
+            // Adds a reference unless the NameData is being removed from the dictionary. This allows taking a
+            // reference to an entry that was found without holding any dictionary locks.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
@@ -39,6 +39,12 @@ namespace AZ
         , m_hash{data->GetHash()}
     {}
 
+    Name::Name(Internal::NameData* data, AdoptReference)
+        : m_data{data, false}
+        , m_view{data->GetName()}
+        , m_hash{data->GetHash()}
+    {}
+
     Name::Name(const Name& rhs)
     {
         *this = rhs;
@@ -197,6 +203,46 @@ namespace AZ
             jsonContext->Serializer<NameJsonSerializer>()->HandlesType<Name>();
         }
     }
-    
+
+    NameLiteral::NameLiteral(AZStd::string_view literal)
+        : NameLiteral(literal, CalcHash(literal))
+    {
+    }
+
+    NameLiteral::NameLiteral(AZStd::string_view literal, Name::Hash literalHash)
+        : m_literal(literal)
+        , m_literalHash(literalHash)
+    {
+        AZ_Assert(m_literalHash == CalcHash(m_literal), "Hash provided for name literal '%.*s' doesn't match the literal.", AZ_STRING_ARG(m_literal));
+
+        // Literals are often statically declared, in which case the NameDictionary might not be available yet. Resolving
+        // is delayed until the dictionary is created or the name is first requested.
+        NameDictionary::AddPendingLiteral(*this);
+    }
+
+    NameLiteral::~NameLiteral()
+    {
+        Release();
+    }
+
+    void NameLiteral::Resolve() const
+    {
+        AZ_Assert(NameDictionary::IsReady(), "Name literal '%.*s' used before the NameDictionary was created.", AZ_STRING_ARG(m_literal));
+        NameDictionary::Instance().ResolveLiteral(const_cast<NameLiteral&>(*this));
+    }
+
+    void NameLiteral::Release()
+    {
+        if (m_isResolved.load(AZStd::memory_order_acquire))
+        {
+            // A resolved literal is always released before the dictionary it was resolved against is destroyed.
+            NameDictionary::Instance().ReleaseLiteral(*this);
+        }
+        else
+        {
+            NameDictionary::RemovePendingLiteral(*this);
+        }
+    }
+
 } // namespace AZ
 
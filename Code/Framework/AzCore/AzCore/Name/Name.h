@@ -30,7 +30,7 @@ namespace AZ
     //! Equality-comparison of two Name objects is very fast.
     //!
     //! The dictionary must be initialized before Name objects are created.
-    //! A Name instance must not be statically declared.
+    //! A Name instance must not be statically declared. Use NameLiteral or AZ_NAME_LITERAL for names that are known at compile time.
     class Name
     {
         friend NameDictionary;
@@ -108,6 +108,10 @@ namespace AZ
         // This constructor is used by NameDictionary to construct from a dictionary-held NameData instance.
         Name(Internal::NameData* nameData);
 
+        // Used by NameDictionary to construct from a NameData instance that already had a reference added for this Name.
+        struct AdoptReference {};
+        Name(Internal::NameData* nameData, AdoptReference);
+
         static void ScriptConstructor(Name* thisPtr, ScriptDataContext& dc);
 
         // Points to the string that represents the value of this name.
@@ -122,8 +126,69 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data;
     };
 
+
+    //! A name that's known at compile time. Unlike Name, a NameLiteral can be statically declared. Literals are
+    //! registered when they're constructed and are resolved against the NameDictionary as soon as the dictionary
+    //! is available, after which retrieving the Name is as cheap as reading a pointer. The hash of the literal is
+    //! calculated at compile time when declared through AZ_NAME_LITERAL.
+    //! If the NameDictionary is destroyed, all literals are released and will be resolved again on their next use.
+    class NameLiteral
+    {
+        friend NameDictionary;
+    public:
+        explicit NameLiteral(AZStd::string_view literal);
+        NameLiteral(AZStd::string_view literal, Name::Hash literalHash);
+        ~NameLiteral();
+
+        NameLiteral(const NameLiteral&) = delete;
+        NameLiteral& operator=(const NameLiteral&) = delete;
+
+        //! Returns the Name for the literal, resolving it against the NameDictionary if that hasn't happened yet.
+        const Name& GetName() const
+        {
+            if (!m_isResolved.load(AZStd::memory_order_acquire))
+            {
+                Resolve();
+            }
+            return m_name;
+        }
+
+        operator const Name&() const
+        {
+            return GetName();
+        }
+
+        //! Calculates the hash of the literal before collision resolution. This is used to calculate hashes at compile time.
+        static constexpr Name::Hash CalcHash(AZStd::string_view literal)
+        {
+            return Internal::NameData::CalcHash(literal);
+        }
+
+    private:
+        void Resolve() const;
+        void Release();
+
+        AZStd::string_view m_literal;
+        mutable Name m_name;
+        // Intrusive links for either the list of literals waiting for the dictionary or the list of resolved literals in the dictionary.
+        NameLiteral* m_previous{ nullptr };
+        NameLiteral* m_next{ nullptr };
+        Name::Hash m_literalHash;
+        mutable AZStd::atomic_bool m_isResolved{ false };
+    };
 } // namespace AZ
 
+//! Returns a reference to a Name for the provided string literal. The hash is calculated at compile time and the
+//! name is only looked up in the NameDictionary on first use, so this is suitable for hot paths.
+//! Example: if (materialProperty == AZ_NAME_LITERAL("baseColor.factor")) { ... }
+#define AZ_NAME_LITERAL(str) \
+    ([]() -> const AZ::Name& \
+    { \
+        constexpr AZ::Name::Hash literalHash = AZ::NameLiteral::CalcHash(str); \
+        static const AZ::NameLiteral nameLiteral(str, literalHash); \
+        return nameLiteral.GetName(); \
+    }())
+
 namespace AZStd
 {
     template <typename T>
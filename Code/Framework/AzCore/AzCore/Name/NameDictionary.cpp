@@ -11,6 +11,8 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/function/function_template.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -39,6 +41,9 @@ namespace AZ
         {
             s_instance.Set(aznew NameDictionary());
         }
+
+        // Literals that were declared before the dictionary existed can be resolved now.
+        s_instance.Get()->ResolvePendingLiterals();
     }
 
     void NameDictionary::Destroy()
@@ -76,18 +81,87 @@ namespace AZ
         return *(*s_instance);
     }
     
+    namespace NameDictionaryInternal
+    {
+        // Marks a slot whose entry was removed. Probing continues past tombstones.
+        static Internal::NameData* const s_tombstone = reinterpret_cast<Internal::NameData*>(uintptr_t(1));
+
+        static bool IsEntry(const Internal::NameData* nameData)
+        {
+            return nameData != nullptr && nameData != s_tombstone;
+        }
+
+        // Literals that were constructed in this module but haven't been resolved against a dictionary yet.
+        static NameLiteral* s_pendingLiterals = nullptr;
+
+        static AZStd::mutex& GetPendingLiteralMutex()
+        {
+            static AZStd::mutex s_pendingLiteralMutex;
+            return s_pendingLiteralMutex;
+        }
+    }
+
+    NameDictionary::Table* NameDictionary::Table::Create(size_t capacity)
+    {
+        AZ_Assert((capacity & (capacity - 1)) == 0, "NameDictionary table capacity must be a power of two.");
+
+        const size_t byteSize = sizeof(Table) + sizeof(AZStd::atomic<Internal::NameData*>) * capacity;
+        void* memory = AZ::AllocatorInstance<AZ::OSAllocator>::Get().Allocate(byteSize, alignof(Table), 0, "NameDictionary::Table");
+        Table* table = new (memory) Table{ capacity - 1 };
+        AZStd::atomic<Internal::NameData*>* slots = table->GetSlots();
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (&slots[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+        }
+        return table;
+    }
+
+    void NameDictionary::Table::Destroy(Table* table)
+    {
+        if (table)
+        {
+            table->~Table();
+            AZ::AllocatorInstance<AZ::OSAllocator>::Get().DeAllocate(table);
+        }
+    }
+
+    AZStd::atomic<Internal::NameData*>* NameDictionary::Table::GetSlots()
+    {
+        return reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(this + 1);
+    }
+
+    NameDictionary::ShardReadScope::ShardReadScope(const Shard& shard)
+        : m_shard(shard)
+    {
+        // Sequentially consistent so a writer that sees no active readers also knows that new readers will see
+        // the slots it cleared before counting the readers.
+        m_shard.m_activeReaders.fetch_add(1);
+    }
+
+    NameDictionary::ShardReadScope::~ShardReadScope()
+    {
+        m_shard.m_activeReaders.fetch_sub(1);
+    }
+
     NameDictionary::NameDictionary()
-    {}
+    {
+        for (Shard& shard : m_shards)
+        {
+            shard.m_table.store(Table::Create(InitialShardCapacity));
+        }
+    }
 
     NameDictionary::~NameDictionary()
     {
+        // Literals hold references to their names, which would otherwise be reported as leaks.
+        ReleaseAllLiterals();
+
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        VisitEntries([&leaksDetected](Internal::NameData* nameData)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+            const int useCount = nameData->m_useCount;
+            [[maybe_unused]] const bool hadCollision = nameData->m_hashCollision;
 
             if (useCount == 0)
             {
@@ -98,20 +172,198 @@ namespace AZ
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
             }
+        });
+
+        for (Shard& shard : m_shards)
+        {
+            for (Internal::NameData* nameData : shard.m_retiredNames)
+            {
+                delete nameData;
+            }
+            for (Table* table : shard.m_retiredTables)
+            {
+                Table::Destroy(table);
+            }
+            Table::Destroy(shard.m_table.load());
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash >> ShardHashShift];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash >> ShardHashShift];
+    }
+
+    Internal::NameData* NameDictionary::FindInShard(const Shard& shard, Name::Hash hash)
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_acquire);
+        AZStd::atomic<Internal::NameData*>* slots = table->GetSlots();
+        for (size_t index = hash & table->m_mask; ; index = (index + 1) & table->m_mask)
+        {
+            Internal::NameData* nameData = slots[index].load(AZStd::memory_order_acquire);
+            if (nameData == nullptr)
+            {
+                return nullptr;
+            }
+            if (nameData != NameDictionaryInternal::s_tombstone && nameData->m_hash == hash)
+            {
+                return nameData;
+            }
+        }
+    }
+
+    void NameDictionary::InsertInShard(Shard& shard, Internal::NameData* nameData)
+    {
+        // Keep the load factor, including tombstones, below 75% so probe sequences stay short and always terminate.
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        if ((shard.m_entryCount + shard.m_tombstoneCount + 1) * 4 > (table->m_mask + 1) * 3)
+        {
+            GrowShard(shard, shard.m_entryCount + 1);
+            table = shard.m_table.load(AZStd::memory_order_relaxed);
+        }
+
+        AZStd::atomic<Internal::NameData*>* slots = table->GetSlots();
+        for (size_t index = nameData->m_hash & table->m_mask; ; index = (index + 1) & table->m_mask)
+        {
+            // Reusing tombstones is safe because readers treat them the same as a different entry.
+            Internal::NameData* slotData = slots[index].load(AZStd::memory_order_relaxed);
+            if (!NameDictionaryInternal::IsEntry(slotData))
+            {
+                if (slotData == NameDictionaryInternal::s_tombstone)
+                {
+                    --shard.m_tombstoneCount;
+                }
+                slots[index].store(nameData, AZStd::memory_order_release);
+                ++shard.m_entryCount;
+                return;
+            }
+        }
+    }
+
+    bool NameDictionary::RemoveFromShard(Shard& shard, Internal::NameData* nameData)
+    {
+        Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+        AZStd::atomic<Internal::NameData*>* slots = table->GetSlots();
+        for (size_t index = nameData->m_hash & table->m_mask; ; index = (index + 1) & table->m_mask)
+        {
+            Internal::NameData* slotData = slots[index].load(AZStd::memory_order_relaxed);
+            if (slotData == nullptr)
+            {
+                return false;
+            }
+            if (slotData == nameData)
+            {
+                slots[index].store(NameDictionaryInternal::s_tombstone);
+                --shard.m_entryCount;
+                ++shard.m_tombstoneCount;
+                return true;
+            }
+        }
+    }
+
+    void NameDictionary::GrowShard(Shard& shard, size_t requiredCapacity)
+    {
+        Table* oldTable = shard.m_table.load(AZStd::memory_order_relaxed);
+
+        // Size the table so the live entries fill at most half of it. If most slots were taken up by tombstones
+        // this rebuilds the table at the same size.
+        size_t capacity = InitialShardCapacity;
+        while (capacity < requiredCapacity * 2)
+        {
+            capacity *= 2;
+        }
+
+        Table* newTable = Table::Create(capacity);
+        AZStd::atomic<Internal::NameData*>* oldSlots = oldTable->GetSlots();
+        AZStd::atomic<Internal::NameData*>* newSlots = newTable->GetSlots();
+        for (size_t i = 0; i <= oldTable->m_mask; ++i)
+        {
+            Internal::NameData* nameData = oldSlots[i].load(AZStd::memory_order_relaxed);
+            if (NameDictionaryInternal::IsEntry(nameData))
+            {
+                size_t index = nameData->m_hash & newTable->m_mask;
+                while (newSlots[index].load(AZStd::memory_order_relaxed) != nullptr)
+                {
+                    index = (index + 1) & newTable->m_mask;
+                }
+                newSlots[index].store(nameData, AZStd::memory_order_relaxed);
+            }
+        }
+
+        shard.m_table.store(newTable);
+        shard.m_tombstoneCount = 0;
+
+        // Readers might still be probing the old table.
+        shard.m_retiredTables.push_back(oldTable);
+        ReclaimRetired(shard);
+    }
+
+    void NameDictionary::ReclaimRetired(Shard& shard)
+    {
+        // Any reader that starts after this point can only find the tables and entries that are currently published.
+        if (shard.m_activeReaders.load() != 0)
+        {
+            return;
+        }
+
+        for (Internal::NameData* nameData : shard.m_retiredNames)
+        {
+            delete nameData;
+        }
+        shard.m_retiredNames.clear();
+
+        for (Table* table : shard.m_retiredTables)
+        {
+            Table::Destroy(table);
+        }
+        shard.m_retiredTables.clear();
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::scoped_lock lock(shard.m_writeMutex);
+            entryCount += shard.m_entryCount;
+        }
+        return entryCount;
+    }
+
+    void NameDictionary::VisitEntries(const AZStd::function<void(Internal::NameData*)>& visitor) const
+    {
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::scoped_lock lock(shard.m_writeMutex);
+            Table* table = shard.m_table.load(AZStd::memory_order_relaxed);
+            AZStd::atomic<Internal::NameData*>* slots = table->GetSlots();
+            for (size_t i = 0; i <= table->m_mask; ++i)
+            {
+                Internal::NameData* nameData = slots[i].load(AZStd::memory_order_relaxed);
+                if (NameDictionaryInternal::IsEntry(nameData))
+                {
+                    visitor(nameData);
+                }
+            }
+        }
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        ShardReadScope readScope(shard);
+        Internal::NameData* nameData = FindInShard(shard, hash);
+        if (nameData && nameData->TryAddRef())
         {
-            return Name(iter->second);
+            return Name(nameData, Name::AdoptReference{});
         }
         return Name();
     }
@@ -124,44 +376,64 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        Shard& shard = GetShard(hash);
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // If we find the same name, just return it. This path doesn't take any locks, so threads looking up
+        // existing names don't contend with each other. Hash collisions are followed the same way as in the
+        // loop below, which is possible because collision probing never leaves the shard.
         {
-            return AZStd::move(name);
+            ShardReadScope readScope(shard);
+            Name::Hash probeHash = hash;
+            while (Internal::NameData* nameData = FindInShard(shard, probeHash))
+            {
+                if (nameData->GetName() == nameString)
+                {
+                    if (nameData->TryAddRef())
+                    {
+                        return Name(nameData, Name::AdoptReference{});
+                    }
+                    break;
+                }
+                if (!nameData->m_hashCollision)
+                {
+                    break;
+                }
+                probeHash = NextCollisionHash(probeHash);
+            }
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        // The name doesn't exist in the dictionary, so we have to lock the shard and add it
+        AZStd::scoped_lock lock(shard.m_writeMutex);
 
-        auto iter = m_dictionary.find(hash);
+        Internal::NameData* nameData = FindInShard(shard, hash);
         bool collisionDetected = false;
         while (true)
         {
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (nameData == nullptr)
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                InsertInShard(shard, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            else if (nameData->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(nameData);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                hash = NextCollisionHash(hash);
+                nameData = FindInShard(shard, hash);
             }
         }
     }
@@ -179,42 +451,185 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
+        Shard& shard = GetShard(hash);
+        {
+            AZStd::scoped_lock lock(shard.m_writeMutex);
+
+            Internal::NameData* nameData = FindInShard(shard, hash);
+            if (nameData == nullptr)
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
+
+            // Check m_hashCollision inside the shard's lock because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name. Lock-free readers won't take a
+            // reference to an entry with a negative count.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                RemoveFromShard(shard, nameData);
+
+                // Readers that found the entry before it was removed might still be comparing its name.
+                shard.m_retiredNames.push_back(nameData);
+                ReclaimRetired(shard);
+            }
+        }
+
+        ReportStats();
+    }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+    void NameDictionary::ResolveLiteral(NameLiteral& literal)
+    {
+        AZStd::scoped_lock lock(m_literalMutex);
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        // Another thread might have resolved the literal while waiting for the lock.
+        if (literal.m_isResolved.load(AZStd::memory_order_acquire))
         {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
             return;
         }
 
-        Internal::NameData* nameData = dictIt->second;
+        RemovePendingLiteral(literal);
+
+        literal.m_name = literal.m_literal.empty() ? Name() : MakeName(literal.m_literal, literal.m_literalHash);
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        literal.m_previous = nullptr;
+        literal.m_next = m_resolvedLiterals;
+        if (m_resolvedLiterals)
+        {
+            m_resolvedLiterals->m_previous = &literal;
+        }
+        m_resolvedLiterals = &literal;
+
+        literal.m_isResolved.store(true, AZStd::memory_order_release);
+    }
+
+    void NameDictionary::ReleaseLiteral(NameLiteral& literal)
+    {
+        AZStd::scoped_lock lock(m_literalMutex);
+
+        if (!literal.m_isResolved.load(AZStd::memory_order_acquire))
         {
             return;
         }
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+        if (literal.m_previous)
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            literal.m_previous->m_next = literal.m_next;
+        }
+        else
+        {
+            m_resolvedLiterals = literal.m_next;
+        }
+        if (literal.m_next)
+        {
+            literal.m_next->m_previous = literal.m_previous;
         }
+        literal.m_previous = nullptr;
+        literal.m_next = nullptr;
 
-        ReportStats();
+        literal.m_isResolved.store(false, AZStd::memory_order_release);
+        literal.m_name = Name();
+    }
+
+    void NameDictionary::ResolvePendingLiterals()
+    {
+        while (NameLiteral* literal = PopPendingLiteral())
+        {
+            ResolveLiteral(*literal);
+        }
+    }
+
+    void NameDictionary::ReleaseAllLiterals()
+    {
+        AZStd::scoped_lock lock(m_literalMutex);
+
+        NameLiteral* literal = m_resolvedLiterals;
+        while (literal)
+        {
+            NameLiteral* next = literal->m_next;
+            literal->m_previous = nullptr;
+            literal->m_next = nullptr;
+            literal->m_isResolved.store(false, AZStd::memory_order_release);
+            literal->m_name = Name();
+            literal = next;
+        }
+        m_resolvedLiterals = nullptr;
+    }
+
+    void NameDictionary::AddPendingLiteral(NameLiteral& literal)
+    {
+        using namespace NameDictionaryInternal;
+
+        AZStd::scoped_lock lock(GetPendingLiteralMutex());
+        literal.m_previous = nullptr;
+        literal.m_next = s_pendingLiterals;
+        if (s_pendingLiterals)
+        {
+            s_pendingLiterals->m_previous = &literal;
+        }
+        s_pendingLiterals = &literal;
+    }
+
+    void NameDictionary::RemovePendingLiteral(NameLiteral& literal)
+    {
+        using namespace NameDictionaryInternal;
+
+        AZStd::scoped_lock lock(GetPendingLiteralMutex());
+
+        // Literals that were released by a dictionary aren't in any list.
+        if (literal.m_previous == nullptr && s_pendingLiterals != &literal)
+        {
+            return;
+        }
+
+        if (literal.m_previous)
+        {
+            literal.m_previous->m_next = literal.m_next;
+        }
+        else
+        {
+            s_pendingLiterals = literal.m_next;
+        }
+        if (literal.m_next)
+        {
+            literal.m_next->m_previous = literal.m_previous;
+        }
+        literal.m_previous = nullptr;
+        literal.m_next = nullptr;
+    }
+
+    NameLiteral* NameDictionary::PopPendingLiteral()
+    {
+        using namespace NameDictionaryInternal;
+
+        AZStd::scoped_lock lock(GetPendingLiteralMutex());
+
+        NameLiteral* literal = s_pendingLiterals;
+        if (literal)
+        {
+            s_pendingLiterals = literal->m_next;
+            if (s_pendingLiterals)
+            {
+                s_pendingLiterals->m_previous = nullptr;
+            }
+            literal->m_next = nullptr;
+        }
+        return literal;
     }
 
     void NameDictionary::ReportStats() const
@@ -232,34 +647,37 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+
+            VisitEntries([&](Internal::NameData* nameData)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
+                ++nameCount;
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
-            }
+            });
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -281,12 +699,4 @@ namespace AZ
 
 #endif // AZ_DEBUG_BUILD
     }
-
-    Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
-    {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
-    }
 }
@@ -8,10 +8,12 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -43,12 +45,18 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The dictionary is split into shards based on the upper bits of the hash so threads working on
+    //! different names rarely touch the same data. Every shard is an open addressing hash table that
+    //! can be searched without taking a lock; only adding and removing entries locks the shard. Memory
+    //! for removed entries is reclaimed once no reader is active in the shard anymore.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
 
         friend Module;
         friend Name;
+        friend NameLiteral;
         friend Internal::NameData;
         friend UnitTest::NameDictionaryTester;
         
@@ -73,11 +81,56 @@ namespace AZ
         Name FindName(Name::Hash hash) const;
 
     private:
+        static constexpr size_t ShardCountLog2 = 6;
+        static constexpr size_t ShardCount = size_t(1) << ShardCountLog2;
+        static constexpr uint32_t ShardHashShift = 32 - ShardCountLog2;
+        static constexpr uint32_t ShardHashMask = ~uint32_t(0) << ShardHashShift;
+        static constexpr size_t InitialShardCapacity = 64;
+
+        // Open addressing table with linear probing. Slots are either null, a tombstone for a removed entry or a
+        // pointer to the entry. Tables never shrink and are replaced as a whole when they grow.
+        struct Table
+        {
+            static Table* Create(size_t capacity);
+            static void Destroy(Table* table);
+
+            AZStd::atomic<Internal::NameData*>* GetSlots();
+
+            size_t m_mask;
+        };
+
+        struct alignas(64) Shard
+        {
+            AZStd::atomic<Table*> m_table{ nullptr };
+            // Number of threads currently searching the shard without holding the lock.
+            mutable AZStd::atomic<uint32_t> m_activeReaders{ 0 };
+            // Only taken to add or remove entries.
+            mutable AZStd::mutex m_writeMutex;
+            size_t m_entryCount{ 0 };
+            size_t m_tombstoneCount{ 0 };
+            // Removed entries and replaced tables that might still be accessed by readers.
+            AZStd::vector<Internal::NameData*, AZ::OSStdAllocator> m_retiredNames;
+            AZStd::vector<Table*, AZ::OSStdAllocator> m_retiredTables;
+        };
+
+        // Tracks a reader in a shard so retired memory isn't reclaimed while the shard is searched.
+        class ShardReadScope
+        {
+        public:
+            explicit ShardReadScope(const Shard& shard);
+            ~ShardReadScope();
+        private:
+            const Shard& m_shard;
+        };
+
         NameDictionary();
         ~NameDictionary();
 
         void ReportStats() const;
 
+        //! Makes a Name from the provided raw string and the hash that was calculated for it.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
@@ -87,11 +140,52 @@ namespace AZ
         
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // Private API for NameLiteral
+
+        void ResolveLiteral(NameLiteral& literal);
+        void ReleaseLiteral(NameLiteral& literal);
+        void ResolvePendingLiterals();
+        void ReleaseAllLiterals();
+
+        // Literals that are constructed before the dictionary is available are kept in a list per module.
+        static void AddPendingLiteral(NameLiteral& literal);
+        static void RemovePendingLiteral(NameLiteral& literal);
+        static NameLiteral* PopPendingLiteral();
+
+        //////////////////////////////////////////////////////////////////////////
+
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        static constexpr Name::Hash CalcHash(AZStd::string_view name)
+        {
+            return Internal::NameData::CalcHash(name);
+        }
+
+        // Returns the next hash to try after a hash collision. The probe stays inside the shard of the original hash.
+        static constexpr Name::Hash NextCollisionHash(Name::Hash hash)
+        {
+            return (hash & ShardHashMask) | ((hash + 1) & ~ShardHashMask);
+        }
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        // Finds the entry for the hash in the shard. Safe to call without holding the shard's lock.
+        static Internal::NameData* FindInShard(const Shard& shard, Name::Hash hash);
+        // Functions below require the shard's write lock to be held.
+        static void InsertInShard(Shard& shard, Internal::NameData* nameData);
+        static bool RemoveFromShard(Shard& shard, Internal::NameData* nameData);
+        static void GrowShard(Shard& shard, size_t requiredCapacity);
+        static void ReclaimRetired(Shard& shard);
+
+        size_t GetEntryCount() const;
+        void VisitEntries(const AZStd::function<void(Internal::NameData*)>& visitor) const;
+
+        Shard m_shards[ShardCount];
+
+        // Literals that have been resolved against this dictionary. Guarded by m_literalMutex.
+        NameLiteral* m_resolvedLiterals{ nullptr };
+        AZStd::mutex m_literalMutex;
     };
 }
@@ -771,7 +771,9 @@ namespace AZ
     enum ScriptContextIds : ScriptContextId
     {
         DefaultScriptContextId = 0,
-        CryScriptContextId = 1
+        CryScriptContextId = 1,
+        /// Pooled contexts created by the script system use the ids starting at this id
+        FirstPooledScriptContextId = 0x80000000
     };
 
     using StackVariableAllocator = AZStd::static_buffer_allocator<256, 16>;
@@ -70,6 +70,28 @@ namespace AZ
         /// Returns the script context that has been registered with the app, if there is one.
         virtual ScriptContext* GetContext(ScriptContextId id) = 0;
 
+        /**
+         * Returns one of the pooled script contexts, the contexts are created on first use and the same key always returns the same context.
+         * Pooled contexts are bound to the same BehaviorContext as the default context, so all reflected classes, methods and buses
+         * are available, but each one has its own Lua state. Globals, loaded scripts and entity tables aren't shared between them
+         * or with the default context, so scripts running in a pooled context can only share state through the engine.
+         *
+         * \param key      key that selects the context, usually the id of the entity that owns the script
+         */
+        virtual ScriptContext* GetPooledContext(AZ::u64 key) = 0;
+
+        /**
+         * Calls OnTick(table, deltaTime, timePoint) on the table every tick. The tables of all pooled contexts tick in parallel, one
+         * job per context, and the tables of one context tick one after the other, so the OnTick functions only need to be safe
+         * to run at the same time as the OnTick functions in the other pooled contexts.
+         * Tick handlers can only be added and removed from the main thread, not from within OnTick.
+         *
+         * \param context          pooled context that the table lives in
+         * \param tableReference   reference to the table in the Lua registry of the context
+         */
+        virtual void AddPooledTickHandler(ScriptContext* context, int tableReference) = 0;
+        virtual void RemovePooledTickHandler(ScriptContext* context, int tableReference) = 0;
+
         /// Full GC will be performed
         virtual void GarbageCollect() = 0;
 
@@ -16,6 +16,10 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/PlatformId/PlatformId.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -28,6 +32,7 @@
 #include <AzCore/Serialization/DynamicSerializableField.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 
 using namespace AZ;
@@ -104,9 +109,14 @@ void ScriptSystemComponent::Deactivate()
 {
     AZ::AssetTypeInfoBus::Handler::BusDisconnect();
     Data::AssetBus::MultiHandler::BusDisconnect();
+    TickBus::Handler::BusDisconnect();
     SystemTickBus::Handler::BusDisconnect();
     ScriptSystemRequestBus::Handler::BusDisconnect();
 
+    // The pooled contexts are owned by m_contexts and deleted with the other contexts
+    m_pooledContexts.clear();
+    m_pooledTickTableCount = 0;
+
     for (auto& context : m_contexts)
     {
         if (context.m_isOwner)
@@ -252,6 +262,12 @@ bool ScriptSystemComponent::RemoveContextWithId(ScriptContextId id)
     ContextContainer* container = AZStd::find_if(m_contexts.begin(), m_contexts.end(), [&id](const ContextContainer& ctxContainer) { return ctxContainer.m_context->GetId() == id; });
     if (container != m_contexts.end())
     {
+        if (PooledContext* pooledContext = FindPooledContext(container->m_context))
+        {
+            AZ_Assert(pooledContext->m_tickTables.empty(), "Removing a pooled script context that still has tick handlers!");
+            m_pooledTickTableCount -= pooledContext->m_tickTables.size();
+            *pooledContext = PooledContext();
+        }
         delete container->m_context;
         m_contexts.erase(container);
         return true;
@@ -274,6 +290,167 @@ ScriptContext*  ScriptSystemComponent::GetContext(ScriptContextId id)
     return nullptr;
 }
 
+//=========================================================================
+// GetPooledContext
+//=========================================================================
+ScriptContext* ScriptSystemComponent::GetPooledContext(AZ::u64 key)
+{
+    if (m_pooledContexts.empty())
+    {
+        size_t pooledContextCount = aznumeric_cast<size_t>(m_pooledContextCount);
+        if (pooledContextCount == 0)
+        {
+            JobContext* jobContext = JobContext::GetGlobalContext();
+            pooledContextCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : AZStd::thread::hardware_concurrency();
+        }
+        m_pooledContexts.resize(AZStd::max<size_t>(pooledContextCount, 1));
+    }
+
+    const size_t pooledContextIndex = key % m_pooledContexts.size();
+    PooledContext& pooledContext = m_pooledContexts[pooledContextIndex];
+    if (!pooledContext.m_context)
+    {
+        pooledContext.m_context = AddContextWithId(ScriptContextIds::FirstPooledScriptContextId + aznumeric_cast<ScriptContextId>(pooledContextIndex));
+    }
+    return pooledContext.m_context;
+}
+
+//=========================================================================
+// AddPooledTickHandler
+//=========================================================================
+void ScriptSystemComponent::AddPooledTickHandler(ScriptContext* context, int tableReference)
+{
+    AZ_Assert(!m_isTickingPooledContexts, "Pooled tick handlers can't be added while the pooled contexts tick!");
+    PooledContext* pooledContext = FindPooledContext(context);
+    if (!pooledContext)
+    {
+        AZ_Error("Script", false, "Pooled tick handlers can only be added to contexts returned by GetPooledContext!");
+        return;
+    }
+
+    pooledContext->m_tickTables.push_back(tableReference);
+    if (m_pooledTickTableCount++ == 0)
+    {
+        TickBus::Handler::BusConnect();
+    }
+}
+
+//=========================================================================
+// RemovePooledTickHandler
+//=========================================================================
+void ScriptSystemComponent::RemovePooledTickHandler(ScriptContext* context, int tableReference)
+{
+    AZ_Assert(!m_isTickingPooledContexts, "Pooled tick handlers can't be removed while the pooled contexts tick!");
+    PooledContext* pooledContext = FindPooledContext(context);
+    if (!pooledContext)
+    {
+        return;
+    }
+
+    auto tableIt = AZStd::find(pooledContext->m_tickTables.begin(), pooledContext->m_tickTables.end(), tableReference);
+    if (tableIt != pooledContext->m_tickTables.end())
+    {
+        pooledContext->m_tickTables.erase(tableIt);
+        if (--m_pooledTickTableCount == 0)
+        {
+            TickBus::Handler::BusDisconnect();
+        }
+    }
+}
+
+//=========================================================================
+// FindPooledContext
+//=========================================================================
+ScriptSystemComponent::PooledContext* ScriptSystemComponent::FindPooledContext(ScriptContext* context)
+{
+    if (!context)
+    {
+        return nullptr;
+    }
+
+    auto pooledContextIt = AZStd::find_if(m_pooledContexts.begin(), m_pooledContexts.end(),
+        [context](const PooledContext& pooledContext) { return pooledContext.m_context == context; });
+    return pooledContextIt != m_pooledContexts.end() ? pooledContextIt : nullptr;
+}
+
+//=========================================================================
+// TickPooledContext
+//=========================================================================
+void ScriptSystemComponent::TickPooledContext(PooledContext& pooledContext, float deltaTime, const ScriptTimePoint& time, AZStd::thread::id ownerThreadId)
+{
+    ScriptContext* context = pooledContext.m_context;
+    lua_State* lua = context->NativeContext();
+
+    // Make the ticking thread the owner of the context for the duration of the tick, so that Lua bus handlers in this context
+    // that are called from any other thread in the meantime raise the usual owner thread assert
+    context->DebugSetOwnerThread(AZStd::this_thread::get_id());
+
+    for (int tableReference : pooledContext.m_tickTables)
+    {
+        lua_rawgeti(lua, LUA_REGISTRYINDEX, tableReference); // Stack: EntityTable
+        lua_getfield(lua, -1, "OnTick"); // Stack: EntityTable EntityTable.OnTick
+        if (lua_isfunction(lua, -1))
+        {
+            lua_pushvalue(lua, -2);
+            lua_pushnumber(lua, deltaTime);
+            ScriptValue<ScriptTimePoint>::StackPush(lua, time);
+            Internal::LuaSafeCall(lua, 3, 0); // Stack: EntityTable
+        }
+        else
+        {
+            lua_pop(lua, 1);
+        }
+        lua_pop(lua, 1);
+    }
+
+    context->DebugSetOwnerThread(ownerThreadId);
+}
+
+//=========================================================================
+// OnTick
+//=========================================================================
+void ScriptSystemComponent::OnTick(float deltaTime, ScriptTimePoint time)
+{
+    AZ_PROFILE_FUNCTION(AzCore);
+
+    m_isTickingPooledContexts = true;
+    const AZStd::thread::id ownerThreadId = AZStd::this_thread::get_id();
+
+    // Each pooled context has its own Lua state, so the contexts tick in parallel and the tables of one context tick in order
+    JobContext* jobContext = JobContext::GetGlobalContext();
+    if (jobContext != nullptr && jobContext->GetJobManager().GetCurrentJob() == nullptr)
+    {
+        JobCompletion jobCompletion(jobContext);
+        for (PooledContext& pooledContext : m_pooledContexts)
+        {
+            if (!pooledContext.m_tickTables.empty())
+            {
+                Job* job = CreateJobFunction(
+                    [&pooledContext, deltaTime, &time, ownerThreadId]()
+                    {
+                        TickPooledContext(pooledContext, deltaTime, time, ownerThreadId);
+                    },
+                    true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+    else
+    {
+        for (PooledContext& pooledContext : m_pooledContexts)
+        {
+            if (!pooledContext.m_tickTables.empty())
+            {
+                TickPooledContext(pooledContext, deltaTime, time, ownerThreadId);
+            }
+        }
+    }
+
+    m_isTickingPooledContexts = false;
+}
+
 //=========================================================================
 // OnSystemTick
 //=========================================================================
@@ -898,9 +1075,10 @@ void ScriptSystemComponent::Reflect(ReflectContext* reflection)
     {
         
         serializeContext->Class<ScriptSystemComponent, AZ::Component>()
-            ->Version(1)
+            ->Version(2)
             // ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AZ_CRC("AssetBuilder", 0xc739c7d7) }))
             ->Field("garbageCollectorSteps", &ScriptSystemComponent::m_defaultGarbageCollectorSteps)
+            ->Field("pooledContextCount", &ScriptSystemComponent::m_pooledContextCount)
             ;
 
         if (EditContext* editContext = serializeContext->GetEditContext())
@@ -14,6 +14,7 @@
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetTypeInfoBus.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ
 {
@@ -29,6 +30,7 @@ namespace AZ
         : public Component
         , public ScriptSystemRequestBus::Handler
         , public SystemTickBus::Handler
+        , public TickBus::Handler
         , public Data::AssetHandler
         , public AssetTypeInfoBus::Handler
         , protected Data::AssetBus::MultiHandler
@@ -59,6 +61,10 @@ namespace AZ
         /// Returns the script context that has been registered with the app, if there is one.
         ScriptContext* GetContext(ScriptContextId id = ScriptContextIds::DefaultScriptContextId) override;
 
+        ScriptContext* GetPooledContext(AZ::u64 key) override;
+        void AddPooledTickHandler(ScriptContext* context, int tableReference) override;
+        void RemovePooledTickHandler(ScriptContext* context, int tableReference) override;
+
         void GarbageCollect() override;
         void GarbageCollectStep(int numberOfSteps) override;
 
@@ -76,6 +82,12 @@ namespace AZ
         void OnSystemTick() override;
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // TickBus
+        /// Ticks the tables of all pooled contexts, only connected while there are pooled tick handlers
+        void OnTick(float deltaTime, ScriptTimePoint time) override;
+        //////////////////////////////////////////////////////////////////////////
+
         //////////////////////////////////////////////////////////////////////////
         // AssetHandler
         /// Called by the asset database to create a new asset. No loading should during this call
@@ -124,6 +136,7 @@ namespace AZ
             int                                 m_tableReference = -2; //< The reference to the table returned by the script (default -2 == LUA_NOREF)
         };
         int m_defaultGarbageCollectorSteps;
+        int m_pooledContextCount = 0; ///< Number of pooled contexts, 0 to use one per job worker thread
 
         struct ContextContainer
         {
@@ -173,6 +186,19 @@ namespace AZ
 
         AZStd::vector<ContextContainer> m_contexts;
 
+        struct PooledContext
+        {
+            ScriptContext* m_context = nullptr; ///< Created on first use, owned by m_contexts
+            AZStd::vector<int> m_tickTables; ///< Registry references of the tables that tick in this context
+        };
+
+        PooledContext* FindPooledContext(ScriptContext* context);
+        static void TickPooledContext(PooledContext& pooledContext, float deltaTime, const ScriptTimePoint& time, AZStd::thread::id ownerThreadId);
+
+        AZStd::vector<PooledContext> m_pooledContexts;
+        size_t m_pooledTickTableCount = 0;
+        bool m_isTickingPooledContexts = false;
+
         // #TEMP: Remove when asset dependencies are in place
         // Used to avoid cascading reloads
         bool m_isReloadQueued = false;
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/BlobSerialization.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/Matrix3x3.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace BlobSerializationInternal
+    {
+        //! "AZBL" when read on a little endian platform, blobs written on a platform with a different endianness don't match.
+        static constexpr u32 Signature = 0x4C425A41;
+
+        struct Header
+        {
+            u32 m_signature;
+            u32 m_formatVersion;
+            u32 m_objectSize;
+            u32 m_objectCount;
+            Uuid m_typeId;
+            u64 m_layoutHash;
+            u32 m_fieldCount;
+            u32 m_fieldsOffset;     //!< Offset of the field table from the start of the blob.
+            u32 m_objectsOffset;    //!< Offset of the first record from the start of the blob.
+            u32 m_reserved[3];
+        };
+        static_assert(sizeof(Header) == 64, "The blob header is part of the format and can't change without changing the format version.");
+        static_assert(sizeof(BlobSerialization::Field) == 32, "The field table is part of the format and can't change without changing the format version.");
+
+        //! A range of bytes copied between a record and an object.
+        struct CopyRange
+        {
+            u32 m_sourceOffset;
+            u32 m_targetOffset;
+            u32 m_size;
+        };
+        using CopyRanges = AZStd::vector<CopyRange>;
+
+        static SerializeContext* GetSerializeContext(SerializeContext* context)
+        {
+            if (context == nullptr)
+            {
+                ComponentApplicationBus::BroadcastResult(context, &ComponentApplicationRequests::GetSerializeContext);
+                AZ_Error("Serialization", context != nullptr, "No serialize context provided and no global serialize context available.");
+            }
+            return context;
+        }
+
+        static bool IsFixedSizeType(const SerializeContext& context, const Uuid& typeId)
+        {
+            static const Uuid fixedSizeTypes[] =
+            {
+                azrtti_typeid<bool>(), azrtti_typeid<char>(), azrtti_typeid<s8>(), azrtti_typeid<u8>(),
+                azrtti_typeid<s16>(), azrtti_typeid<u16>(), azrtti_typeid<s32>(), azrtti_typeid<u32>(),
+                azrtti_typeid<long>(), azrtti_typeid<unsigned long>(), azrtti_typeid<s64>(), azrtti_typeid<u64>(),
+                azrtti_typeid<float>(), azrtti_typeid<double>(), azrtti_typeid<Uuid>(),
+                azrtti_typeid<Vector2>(), azrtti_typeid<Vector3>(), azrtti_typeid<Vector4>(), azrtti_typeid<Quaternion>(),
+                azrtti_typeid<Color>(), azrtti_typeid<Transform>(), azrtti_typeid<Aabb>(),
+                azrtti_typeid<Matrix3x3>(), azrtti_typeid<Matrix3x4>(), azrtti_typeid<Matrix4x4>()
+            };
+
+            // Enums are stored as their underlying type
+            const Uuid& storedTypeId = context.GetUnderlyingTypeId(typeId);
+            return AZStd::find(AZStd::begin(fixedSizeTypes), AZStd::end(fixedSizeTypes), storedTypeId) != AZStd::end(fixedSizeTypes);
+        }
+
+        static u32 CombinePathCrc(u32 pathCrc, u32 nameCrc)
+        {
+            Crc32 combined(pathCrc);
+            combined.Add(&nameCrc, sizeof(nameCrc));
+            return static_cast<u32>(combined);
+        }
+
+        static bool AddFields(BlobSerialization::Layout& layout, size_t& hash, const SerializeContext& context,
+            const SerializeContext::ClassData* parent, const SerializeContext::ClassElement& element, size_t offset, u32 pathCrc)
+        {
+            if (IsFixedSizeType(context, element.m_typeId))
+            {
+                BlobSerialization::Field field;
+                field.m_typeId = element.m_typeId;
+                field.m_pathCrc = pathCrc;
+                field.m_offset = aznumeric_cast<u32>(offset);
+                field.m_size = aznumeric_cast<u32>(element.m_dataSize);
+                layout.m_fields.push_back(field);
+                return true;
+            }
+
+            const SerializeContext::ClassData* classData = context.FindClassData(element.m_typeId, parent, element.m_nameCrc);
+            if (classData == nullptr)
+            {
+                AZ_Error("Serialization", false, "Element '%s' of type %s isn't reflected to the serialize context.",
+                    element.m_name, element.m_typeId.ToString<AZStd::string>().c_str());
+                return false;
+            }
+            if ((element.m_flags & (SerializeContext::ClassElement::FLG_POINTER | SerializeContext::ClassElement::FLG_DYNAMIC_FIELD)) != 0 ||
+                classData->m_container != nullptr || classData->m_serializer != nullptr)
+            {
+                AZ_Error("Serialization", false, "Element '%s' of type '%s' doesn't have a fixed size and can't be stored in a blob.",
+                    element.m_name, classData->m_name);
+                return false;
+            }
+
+            AZStd::hash_combine(hash, classData->m_version);
+            for (const SerializeContext::ClassElement& childElement : classData->m_elements)
+            {
+                if ((childElement.m_flags & SerializeContext::ClassElement::FLG_UI_ELEMENT) != 0)
+                {
+                    continue;
+                }
+
+                // Fields of base classes are stored as if they were part of the derived class
+                const bool isBaseClass = (childElement.m_flags & SerializeContext::ClassElement::FLG_BASE_CLASS) != 0;
+                const u32 childPathCrc = isBaseClass ? pathCrc : CombinePathCrc(pathCrc, childElement.m_nameCrc);
+                if (!AddFields(layout, hash, context, classData, childElement, offset + childElement.m_offset, childPathCrc))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static void AddCopyRange(CopyRanges& ranges, u32 sourceOffset, u32 targetOffset, u32 size)
+        {
+            ranges.push_back({ sourceOffset, targetOffset, size });
+        }
+
+        //! Merges ranges that are adjacent in both the source and the target, so consecutive fields are copied at once.
+        static void MergeCopyRanges(CopyRanges& ranges)
+        {
+            if (ranges.empty())
+            {
+                return;
+            }
+
+            AZStd::sort(ranges.begin(), ranges.end(), [](const CopyRange& lhs, const CopyRange& rhs) { return lhs.m_targetOffset < rhs.m_targetOffset; });
+            size_t merged = 0;
+            for (size_t i = 1; i < ranges.size(); ++i)
+            {
+                CopyRange& last = ranges[merged];
+                const CopyRange& next = ranges[i];
+                if (next.m_sourceOffset == last.m_sourceOffset + last.m_size && next.m_targetOffset == last.m_targetOffset + last.m_size)
+                {
+                    last.m_size += next.m_size;
+                }
+                else
+                {
+                    ranges[++merged] = next;
+                }
+            }
+            ranges.resize(merged + 1);
+        }
+
+        static void CopyObjects(void* target, size_t targetStride, const void* source, size_t sourceStride, size_t objectCount, const CopyRanges& ranges)
+        {
+            u8* targetObject = reinterpret_cast<u8*>(target);
+            const u8* sourceObject = reinterpret_cast<const u8*>(source);
+            for (size_t i = 0; i < objectCount; ++i)
+            {
+                for (const CopyRange& range : ranges)
+                {
+                    memcpy(targetObject + range.m_targetOffset, sourceObject + range.m_sourceOffset, range.m_size);
+                }
+                targetObject += targetStride;
+                sourceObject += sourceStride;
+            }
+        }
+
+        static bool ReadHeader(Header& header, const void* blob, size_t blobSize, bool reportErrors)
+        {
+            if (blob == nullptr || blobSize < sizeof(Header))
+            {
+                AZ_Error("Serialization", !reportErrors, "Buffer is too small to contain a blob.");
+                return false;
+            }
+
+            // The header is copied as the blob doesn't need to be aligned
+            memcpy(&header, blob, sizeof(Header));
+            if (header.m_signature != Signature)
+            {
+                AZ_Error("Serialization", !reportErrors, "Buffer doesn't contain a blob or the blob was written on a platform with a different endianness.");
+                return false;
+            }
+            if (header.m_formatVersion != BlobSerialization::FormatVersion)
+            {
+                AZ_Error("Serialization", !reportErrors, "Blob format version %u isn't supported, expected version %u.",
+                    header.m_formatVersion, BlobSerialization::FormatVersion);
+                return false;
+            }
+
+            const u64 fieldsEnd = u64{ header.m_fieldsOffset } + u64{ header.m_fieldCount } * sizeof(BlobSerialization::Field);
+            const u64 objectsEnd = u64{ header.m_objectsOffset } + u64{ header.m_objectCount } * header.m_objectSize;
+            if (fieldsEnd > blobSize || objectsEnd > blobSize)
+            {
+                AZ_Error("Serialization", !reportErrors, "Blob is truncated, expected at least %llu bytes but got %zu bytes.",
+                    static_cast<unsigned long long>(AZStd::max(fieldsEnd, objectsEnd)), blobSize);
+                return false;
+            }
+            return true;
+        }
+
+        static bool ReadHeader(Header& header, const void* blob, size_t blobSize, const BlobSerialization::Layout& layout)
+        {
+            if (!ReadHeader(header, blob, blobSize, true))
+            {
+                return false;
+            }
+            if (header.m_typeId != layout.m_typeId)
+            {
+                AZ_Error("Serialization", false, "Blob contains objects of type %s instead of %s.",
+                    header.m_typeId.ToString<AZStd::string>().c_str(), layout.m_typeId.ToString<AZStd::string>().c_str());
+                return false;
+            }
+            return true;
+        }
+
+        static bool IsLayoutUnchanged(const Header& header, const BlobSerialization::Layout& layout)
+        {
+            return header.m_layoutHash == layout.m_hash && header.m_objectSize == layout.m_objectSize;
+        }
+    } // namespace BlobSerializationInternal
+
+    bool BlobSerialization::CreateLayout(Layout& layout, const Uuid& typeId, size_t objectSize, SerializeContext* context)
+    {
+        using namespace BlobSerializationInternal;
+
+        layout = Layout{};
+        context = GetSerializeContext(context);
+        if (context == nullptr)
+        {
+            return false;
+        }
+
+        // Treat the class as an element so the class itself can be a plain number or math type as well
+        SerializeContext::ClassElement rootElement;
+        rootElement.m_name = "Root";
+        rootElement.m_nameCrc = 0;
+        rootElement.m_typeId = typeId;
+        rootElement.m_dataSize = objectSize;
+        rootElement.m_offset = 0;
+        rootElement.m_azRtti = nullptr;
+        rootElement.m_editData = nullptr;
+        rootElement.m_flags = 0;
+
+        size_t hash = 0;
+        AZStd::hash_combine(hash, FormatVersion);
+        if (!AddFields(layout, hash, *context, nullptr, rootElement, 0, 0))
+        {
+            layout = Layout{};
+            return false;
+        }
+
+        for (const Field& field : layout.m_fields)
+        {
+            if (field.m_offset + field.m_size > objectSize)
+            {
+                AZ_Error("Serialization", false, "Field of type %s is outside of the object, the object size doesn't match the reflected class.",
+                    field.m_typeId.ToString<AZStd::string>().c_str());
+                layout = Layout{};
+                return false;
+            }
+            AZStd::hash_combine(hash, field.m_typeId, field.m_pathCrc, field.m_offset, field.m_size);
+        }
+        AZStd::hash_combine(hash, typeId, objectSize);
+
+        layout.m_typeId = typeId;
+        layout.m_hash = hash;
+        layout.m_objectSize = aznumeric_cast<u32>(objectSize);
+        return true;
+    }
+
+    bool BlobSerialization::Save(IO::GenericStream& stream, const Layout& layout, const void* objects, size_t objectCount)
+    {
+        using namespace BlobSerializationInternal;
+
+        AZ_Error("Serialization", objects != nullptr || objectCount == 0, "No objects provided to store in the blob.");
+        if (objects == nullptr && objectCount != 0)
+        {
+            return false;
+        }
+
+        Header header;
+        header.m_signature = Signature;
+        header.m_formatVersion = FormatVersion;
+        header.m_typeId = layout.m_typeId;
+        header.m_layoutHash = layout.m_hash;
+        header.m_objectSize = layout.m_objectSize;
+        header.m_objectCount = aznumeric_cast<u32>(objectCount);
+        header.m_fieldCount = aznumeric_cast<u32>(layout.m_fields.size());
+        header.m_fieldsOffset = sizeof(Header);
+        header.m_objectsOffset = aznumeric_cast<u32>(AZ_SIZE_ALIGN_UP(sizeof(Header) + layout.m_fields.size() * sizeof(Field), RecordAlignment));
+        memset(header.m_reserved, 0, sizeof(header.m_reserved));
+
+        // Only the reflected fields are copied, so padding and members that aren't reflected are always stored as zeros
+        AZStd::vector<u8> blob(header.m_objectsOffset + objectCount * layout.m_objectSize, 0);
+        memcpy(blob.data(), &header, sizeof(Header));
+        if (!layout.m_fields.empty())
+        {
+            memcpy(blob.data() + header.m_fieldsOffset, layout.m_fields.data(), layout.m_fields.size() * sizeof(Field));
+        }
+
+        CopyRanges ranges;
+        ranges.reserve(layout.m_fields.size());
+        for (const Field& field : layout.m_fields)
+        {
+            AddCopyRange(ranges, field.m_offset, field.m_offset, field.m_size);
+        }
+        MergeCopyRanges(ranges);
+        CopyObjects(blob.data() + header.m_objectsOffset, layout.m_objectSize, objects, layout.m_objectSize, objectCount, ranges);
+
+        return stream.Write(blob.size(), blob.data()) == blob.size();
+    }
+
+    size_t BlobSerialization::GetObjectCount(const void* blob, size_t blobSize)
+    {
+        BlobSerializationInternal::Header header;
+        return BlobSerializationInternal::ReadHeader(header, blob, blobSize, false) ? header.m_objectCount : 0;
+    }
+
+    const void* BlobSerialization::LoadInPlace(const void* blob, size_t blobSize, const Layout& layout, size_t& objectCount)
+    {
+        using namespace BlobSerializationInternal;
+
+        objectCount = 0;
+        Header header;
+        if (!ReadHeader(header, blob, blobSize, layout) || !IsLayoutUnchanged(header, layout))
+        {
+            return nullptr;
+        }
+
+        objectCount = header.m_objectCount;
+        return reinterpret_cast<const u8*>(blob) + header.m_objectsOffset;
+    }
+
+    bool BlobSerialization::Load(void* objects, size_t objectCount, const void* blob, size_t blobSize, const Layout& layout)
+    {
+        using namespace BlobSerializationInternal;
+
+        Header header;
+        if (!ReadHeader(header, blob, blobSize, layout))
+        {
+            return false;
+        }
+        if (objectCount != header.m_objectCount)
+        {
+            AZ_Error("Serialization", false, "Blob contains %u objects but %zu objects were provided.", header.m_objectCount, objectCount);
+            return false;
+        }
+
+        CopyRanges ranges;
+        ranges.reserve(layout.m_fields.size());
+        if (IsLayoutUnchanged(header, layout))
+        {
+            for (const Field& field : layout.m_fields)
+            {
+                AddCopyRange(ranges, field.m_offset, field.m_offset, field.m_size);
+            }
+        }
+        else
+        {
+            // The class changed since the blob was written, match the fields by name and type instead of by location
+            AZStd::vector<Field> storedFields(header.m_fieldCount);
+            if (!storedFields.empty())
+            {
+                memcpy(storedFields.data(), reinterpret_cast<const u8*>(blob) + header.m_fieldsOffset, storedFields.size() * sizeof(Field));
+            }
+
+            for (const Field& field : layout.m_fields)
+            {
+                auto storedField = AZStd::find_if(storedFields.begin(), storedFields.end(), [&field](const Field& stored)
+                {
+                    return stored.m_pathCrc == field.m_pathCrc && stored.m_typeId == field.m_typeId && stored.m_size == field.m_size;
+                });
+                if (storedField != storedFields.end() && storedField->m_offset + storedField->m_size <= header.m_objectSize)
+                {
+                    AddCopyRange(ranges, storedField->m_offset, field.m_offset, field.m_size);
+                }
+            }
+        }
+
+        MergeCopyRanges(ranges);
+        CopyObjects(objects, layout.m_objectSize, reinterpret_cast<const u8*>(blob) + header.m_objectsOffset, header.m_objectSize, objectCount, ranges);
+        return true;
+    }
+} // namespace AZ
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/typetraits/is_destructible.h>
+#include <AzCore/std/typetraits/is_polymorphic.h>
+
+namespace AZ
+{
+    class SerializeContext;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Versioned binary format for arrays of objects whose reflected fields all have a fixed size, such as numbers, enums,
+    //! math types and uuids. The format is generated from the SerializeContext reflection of the class.
+    //!
+    //! A blob starts with a header and a table describing the fields, followed by one fixed-layout record per object.
+    //! All locations in a blob are stored as offsets relative to the start of the blob, so a blob can be used straight from
+    //! a memory-mapped file or a read buffer. If the layout of the class hasn't changed since the blob was written, the records
+    //! can be used in place without any parsing or allocations. Otherwise the fields are copied one by one, matched by their name
+    //! and type, and fields that aren't in the blob keep their default value. Version converters of the reflected classes aren't
+    //! invoked, so a class that needs a converter to upgrade its data should be re-exported instead.
+    class BlobSerialization final
+    {
+    public:
+        //! Version of the blob format itself, blobs written with a different format version are rejected.
+        static constexpr u32 FormatVersion = 1;
+        //! Alignment of the records relative to the start of a blob.
+        static constexpr size_t RecordAlignment = 16;
+
+        //! A reflected field with a fixed size, flattened from base classes and nested classes into the outer class.
+        //! This is also the layout of the field table stored in a blob.
+        struct Field
+        {
+            Uuid m_typeId;
+            u32 m_pathCrc;  //!< Hash of the name of the field and the names of the elements containing it.
+            u32 m_offset;   //!< Offset from the start of the outer class.
+            u32 m_size;
+            u32 m_reserved = 0;
+        };
+
+        //! Fixed-size fields of a class, generated from its SerializeContext reflection.
+        //! Creating a layout walks the reflection of the class, so it's best to create it once and reuse it for multiple loads.
+        struct Layout
+        {
+            Uuid m_typeId = Uuid::CreateNull();
+            u64 m_hash = 0; //!< Hash of the fields, sizes and class versions. Blobs written with the same hash can be used in place.
+            u32 m_objectSize = 0;
+            AZStd::vector<Field> m_fields;
+        };
+
+        //! Creates the layout of a class reflected to the SerializeContext.
+        //! Fails if the class or any class it contains has elements that don't have a fixed size, such as pointers and containers.
+        static bool CreateLayout(Layout& layout, const Uuid& typeId, size_t objectSize, SerializeContext* context = nullptr);
+        template<typename T>
+        static bool CreateLayout(Layout& layout, SerializeContext* context = nullptr);
+
+        //! Writes the reflected fields of an array of objects, stored layout.m_objectSize bytes apart, as a blob.
+        static bool Save(IO::GenericStream& stream, const Layout& layout, const void* objects, size_t objectCount);
+        template<typename T>
+        static bool Save(IO::GenericStream& stream, const T* objects, size_t objectCount, SerializeContext* context = nullptr);
+
+        //! Returns the number of objects in a blob, or 0 if the buffer doesn't contain a valid blob.
+        static size_t GetObjectCount(const void* blob, size_t blobSize);
+
+        //! Returns the records of a blob without copying them, or nullptr if the blob was written with a different layout.
+        //! The records are only valid as long as the blob. Only classes without virtual functions that don't own any resources
+        //! can be used in place.
+        static const void* LoadInPlace(const void* blob, size_t blobSize, const Layout& layout, size_t& objectCount);
+        template<typename T>
+        static const T* LoadInPlace(const void* blob, size_t blobSize, size_t& objectCount, SerializeContext* context = nullptr);
+
+        //! Copies the objects of a blob to an array of objectCount constructed objects, stored layout.m_objectSize bytes apart.
+        //! Blobs written with a different layout are converted field by field.
+        static bool Load(void* objects, size_t objectCount, const void* blob, size_t blobSize, const Layout& layout);
+        template<typename T>
+        static bool Load(AZStd::vector<T>& objects, const void* blob, size_t blobSize, SerializeContext* context = nullptr);
+    };
+
+    template<typename T>
+    bool BlobSerialization::CreateLayout(Layout& layout, SerializeContext* context)
+    {
+        return CreateLayout(layout, AzTypeInfo<T>::Uuid(), sizeof(T), context);
+    }
+
+    template<typename T>
+    bool BlobSerialization::Save(IO::GenericStream& stream, const T* objects, size_t objectCount, SerializeContext* context)
+    {
+        Layout layout;
+        return CreateLayout<T>(layout, context) && Save(stream, layout, objects, objectCount);
+    }
+
+    template<typename T>
+    const T* BlobSerialization::LoadInPlace(const void* blob, size_t blobSize, size_t& objectCount, SerializeContext* context)
+    {
+        static_assert(AZStd::is_trivially_destructible_v<T> && !AZStd::is_polymorphic_v<T>,
+            "Only classes without virtual functions that don't own any resources can be used in place.");
+
+        Layout layout;
+        if (!CreateLayout<T>(layout, context))
+        {
+            objectCount = 0;
+            return nullptr;
+        }
+
+        const void* objects = LoadInPlace(blob, blobSize, layout, objectCount);
+        if (objects != nullptr && (reinterpret_cast<uintptr_t>(objects) % alignof(T)) != 0)
+        {
+            // The blob itself isn't aligned enough for the class, the objects need to be copied instead
+            objectCount = 0;
+            return nullptr;
+        }
+        return reinterpret_cast<const T*>(objects);
+    }
+
+    template<typename T>
+    bool BlobSerialization::Load(AZStd::vector<T>& objects, const void* blob, size_t blobSize, SerializeContext* context)
+    {
+        Layout layout;
+        if (!CreateLayout<T>(layout, context))
+        {
+            return false;
+        }
+
+        objects.resize(GetObjectCount(blob, blobSize));
+        return Load(objects.data(), objects.size(), blob, blobSize, layout);
+    }
+} // namespace AZ
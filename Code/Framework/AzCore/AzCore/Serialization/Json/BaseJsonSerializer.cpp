@@ -68,17 +68,26 @@ namespace AZ
 
     void JsonBaseContext::PushPath(AZStd::string_view child)
     {
-        m_path.Push(child);
+        if (m_trackPath)
+        {
+            m_path.Push(child);
+        }
     }
 
     void JsonBaseContext::PushPath(size_t index)
     {
-        m_path.Push(index);
+        if (m_trackPath)
+        {
+            m_path.Push(index);
+        }
     }
 
     void JsonBaseContext::PopPath()
     {
-        m_path.Pop();
+        if (m_trackPath)
+        {
+            m_path.Pop();
+        }
     }
 
     const StackedString& JsonBaseContext::GetPath() const
@@ -86,6 +95,16 @@ namespace AZ
         return m_path;
     }
 
+    void JsonBaseContext::SetPathTracking(bool enabled)
+    {
+        m_trackPath = enabled;
+    }
+
+    bool JsonBaseContext::IsTrackingPath() const
+    {
+        return m_trackPath;
+    }
+
     JsonSerializationMetadata& JsonBaseContext::GetMetadata()
     {
         return m_metadata;
@@ -126,14 +145,40 @@ namespace AZ
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
             StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
         , m_clearContainers(settings.m_clearContainers)
+        , m_loadInParallel(settings.m_loadInParallel)
+    {
+        if (settings.m_useFastPath)
+        {
+            m_cache = AZStd::make_unique<JsonDeserializerCache>();
+        }
+    }
+
+    JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting)
+        : JsonBaseContext(parent.m_metadata, AZStd::move(reporting),
+            StackedString::Format::JsonPointer, parent.m_serializeContext, parent.m_registrationContext)
+        , m_clearContainers(parent.m_clearContainers)
+        , m_loadInParallel(parent.m_loadInParallel)
     {
+        m_path = parent.m_path;
+        m_trackPath = parent.m_trackPath;
+        if (parent.m_cache)
+        {
+            m_cache = AZStd::make_unique<JsonDeserializerCache>();
+        }
     }
 
+    JsonDeserializerContext::~JsonDeserializerContext() = default;
+
     bool JsonDeserializerContext::ShouldClearContainers() const
     {
         return m_clearContainers;
     }
 
+    bool JsonDeserializerContext::ShouldLoadInParallel() const
+    {
+        return m_loadInParallel;
+    }
+
 
 
     //
@@ -222,6 +267,19 @@ namespace AZ
             : JsonDeserializer::Load(object, typeId, value, loadAsNewInstance, useCustom, context);
     }
 
+    void BaseJsonSerializer::ContinueLoadingElements(AZStd::vector<JsonSerializationResult::ResultCode>& results,
+        const AZStd::vector<void*>& objects, const Uuid& typeId, const rapidjson::Value& array, JsonDeserializerContext& context,
+        ContinuationFlags flags)
+    {
+        bool loadAsNewInstance = (flags & ContinuationFlags::LoadAsNewInstance) == ContinuationFlags::LoadAsNewInstance;
+        bool resolvePointer = (flags & ContinuationFlags::ResolvePointer) == ContinuationFlags::ResolvePointer;
+        JsonDeserializer::UseTypeDeserializer useCustom = (flags & ContinuationFlags::IgnoreTypeSerializer) == ContinuationFlags::IgnoreTypeSerializer
+            ? JsonDeserializer::UseTypeDeserializer::No
+            : JsonDeserializer::UseTypeDeserializer::Yes;
+
+        JsonDeserializer::LoadElements(results, objects, typeId, array, loadAsNewInstance, resolvePointer, useCustom, context);
+    }
+
     JsonSerializationResult::ResultCode BaseJsonSerializer::ContinueStoring(
         rapidjson::Value& output, const void* object, const void* defaultObject, const Uuid& typeId, JsonSerializerContext& context,
         ContinuationFlags flags)
@@ -14,10 +14,13 @@
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ
 {
     struct Uuid;
+    struct JsonDeserializerCache;
 
     class JsonBaseContext
     {
@@ -56,6 +59,11 @@ namespace AZ
         void PopPath();
         //! Gets the path to the element that's currently being operated on.
         const StackedString& GetPath() const;
+        //! Enables or disables tracking of the path. While disabled the path isn't updated and stays at its last value.
+        //! This should only be changed before processing starts.
+        void SetPathTracking(bool enabled);
+        //! Returns true if the path is updated for every element that's operated on.
+        bool IsTrackingPath() const;
 
         JsonSerializationMetadata& GetMetadata();
         const JsonSerializationMetadata& GetMetadata() const;
@@ -73,6 +81,8 @@ namespace AZ
 
         //! Path to the element that's currently being operated on.
         StackedString m_path;
+        //! If false, pushing and popping entries on the path is skipped.
+        bool m_trackPath = true;
 
         //! Metadata that's passed in by the settings as additional configuration options or metadata that's collected
         //! during processing for later use.
@@ -87,9 +97,11 @@ namespace AZ
     class JsonDeserializerContext final
         : public JsonBaseContext
     {
+        friend class JsonDeserializer;
+
     public:
         explicit JsonDeserializerContext(JsonDeserializerSettings& settings);
-        ~JsonDeserializerContext() override = default;
+        ~JsonDeserializerContext() override;
 
         JsonDeserializerContext(const JsonDeserializerContext&) = delete;
         JsonDeserializerContext(JsonDeserializerContext&&) = delete;
@@ -100,9 +112,18 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool ShouldClearContainers() const;
+        //! If true then large arrays can be loaded on multiple threads. Use BaseJsonSerializer::ContinueLoadingElements to do so.
+        bool ShouldLoadInParallel() const;
 
     private:
+        //! Creates a context to load part of a document on another thread. The new context shares the settings and metadata with
+        //! the parent context, starts at the parent's current path and uses the provided callback for reporting.
+        JsonDeserializerContext(JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting);
+
+        //! Cached serializer and class lookups, only available if the fast path is enabled.
+        AZStd::unique_ptr<JsonDeserializerCache> m_cache;
         bool m_clearContainers = false;
+        bool m_loadInParallel = false;
     };
 
     class JsonSerializerContext final
@@ -216,6 +237,19 @@ namespace AZ
             rapidjson::Value& output, const void* object, const void* defaultObject, const Uuid& typeId, JsonSerializerContext& context,
             ContinuationFlags flags = ContinuationFlags::None);
 
+        //! Continues loading of the elements of a json array into a list of objects of the same type, where the object at index i
+        //! receives element i of the array. If loading in parallel is enabled the elements are loaded on multiple threads,
+        //! otherwise this is the same as calling ContinueLoading for every element. The objects can't overlap.
+        //! @param results The result of loading each of the objects. Will be resized to the number of objects.
+        //! @param objects Pointers to the objects where the data will be loaded into. The objects need to stay at the same location
+        //!     until this function returns.
+        //! @param typeId Type id of the objects passed in.
+        //! @param array Json array with at least as many elements as there are objects.
+        //! @param context The context used during deserialization. Use the value passed in from Load.
+        void ContinueLoadingElements(
+            AZStd::vector<JsonSerializationResult::ResultCode>& results, const AZStd::vector<void*>& objects, const Uuid& typeId,
+            const rapidjson::Value& array, JsonDeserializerContext& context, ContinuationFlags flags = ContinuationFlags::None);
+
         //! Retrieves the type id from a json object or json string.
         //! @param typeId The retrieved type id.
         //! @param input The json object to read type information from. This call will fail if input is not an object.
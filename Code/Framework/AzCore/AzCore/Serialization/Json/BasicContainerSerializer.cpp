@@ -193,54 +193,65 @@ namespace AZ
             retVal.Combine(result);
         }
         rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        if (context.ShouldLoadInParallel() && container->CanAccessElementsByIndex() && !container->IsFixedSize() &&
+            !container->IsFixedCapacity() && !container->GetAssociativeContainerInterface())
         {
-            ScopedContextPath subPath(context, i);
-
-            size_t expectedSize = container->Size(outputValue) + 1;
-
-            if (expectedSize > capacity)
-            {
-                retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
-                    "Unable to load more entries in basic container because it's full."));
-                break;
-            }
-
-            void* elementAddress = container->ReserveElement(outputValue, classElement);
-            if (!elementAddress)
-            {
-                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
-                    "Failed to allocate an item in the basic container.");
-            }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            if (!LoadElementsInParallel(retVal, outputValue, *container, *classElement, inputValue, context, flags))
             {
-                *reinterpret_cast<void**>(elementAddress) = nullptr;
-            }
-            
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
-            if (result.GetProcessing() == JSR::Processing::Halted)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                 return context.Report(retVal, "Failed to read element for basic container.");
             }
-            else if (result.GetProcessing() == JSR::Processing::Altered)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                retVal.Combine(result);
-            }
-            else
+        }
+        else
+        {
+            for (rapidjson::SizeType i = 0; i < arraySize; ++i)
             {
-                container->StoreElement(outputValue, elementAddress);
-                if (container->Size(outputValue) != expectedSize)
+                ScopedContextPath subPath(context, i);
+
+                size_t expectedSize = container->Size(outputValue) + 1;
+
+                if (expectedSize > capacity)
                 {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
-                        "Unable to store element to basic container."));
+                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                        "Unable to load more entries in basic container because it's full."));
+                    break;
                 }
-                else
+
+                void* elementAddress = container->ReserveElement(outputValue, classElement);
+                if (!elementAddress)
+                {
+                    return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                        "Failed to allocate an item in the basic container.");
+                }
+                if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+                {
+                    *reinterpret_cast<void**>(elementAddress) = nullptr;
+                }
+            
+                JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+                if (result.GetProcessing() == JSR::Processing::Halted)
                 {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                    return context.Report(retVal, "Failed to read element for basic container.");
+                }
+                else if (result.GetProcessing() == JSR::Processing::Altered)
+                {
+                    container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                     retVal.Combine(result);
                 }
-            } 
+                else
+                {
+                    container->StoreElement(outputValue, elementAddress);
+                    if (container->Size(outputValue) != expectedSize)
+                    {
+                        retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
+                            "Unable to store element to basic container."));
+                    }
+                    else
+                    {
+                        retVal.Combine(result);
+                    }
+                } 
+            }
         }
 
         if (!retVal.HasDoneWork() && inputValue.Empty())
@@ -260,4 +271,68 @@ namespace AZ
             "Partially read data for basic container.";
         return context.Report(retVal, message);
     }
+
+    bool JsonBasicContainerSerializer::LoadElementsInParallel(JsonSerializationResult::ResultCode& retVal, void* outputValue,
+        SerializeContext::IDataContainer& container, const SerializeContext::ClassElement& classElement, const rapidjson::Value& inputValue,
+        JsonDeserializerContext& context, ContinuationFlags flags)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        // Reserve all elements up front so their addresses don't change while they're loaded on other threads.
+        const size_t firstIndex = container.Size(outputValue);
+        const size_t arraySize = inputValue.Size();
+        for (size_t i = 0; i < arraySize; ++i)
+        {
+            void* elementAddress = container.ReserveElement(outputValue, &classElement);
+            if (!elementAddress)
+            {
+                while (container.Size(outputValue) > firstIndex)
+                {
+                    container.RemoveElement(outputValue,
+                        container.GetElementByIndex(outputValue, &classElement, container.Size(outputValue) - 1),
+                        context.GetSerializeContext());
+                }
+                retVal = context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic, "Failed to allocate an item in the basic container.");
+                return false;
+            }
+            if (classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            {
+                *reinterpret_cast<void**>(elementAddress) = nullptr;
+            }
+            container.StoreElement(outputValue, elementAddress);
+        }
+
+        AZStd::vector<void*> elements(arraySize);
+        for (size_t i = 0; i < arraySize; ++i)
+        {
+            elements[i] = container.GetElementByIndex(outputValue, &classElement, firstIndex + i);
+        }
+        AZStd::vector<JSR::ResultCode> results;
+        ContinueLoadingElements(results, elements, classElement.m_typeId, inputValue, context, flags);
+
+        // Match loading one element at a time, where altered elements are discarded and loading stops at the first element
+        // that was halted, so that element and all elements after it are discarded.
+        size_t loadedCount = arraySize;
+        for (size_t i = 0; i < loadedCount; ++i)
+        {
+            if (results[i].GetProcessing() == JSR::Processing::Halted)
+            {
+                loadedCount = i;
+            }
+            else
+            {
+                retVal.Combine(results[i]);
+            }
+        }
+        // Remove from the back so the indices of the elements that still need to be checked don't change.
+        for (size_t i = arraySize; i-- > 0;)
+        {
+            if (i >= loadedCount || results[i].GetProcessing() == JSR::Processing::Altered)
+            {
+                container.RemoveElement(outputValue, container.GetElementByIndex(outputValue, &classElement, firstIndex + i),
+                    context.GetSerializeContext());
+            }
+        }
+        return loadedCount == arraySize;
+    }
 } // namespace AZ
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Memory/Memory.h>
+#include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 
 namespace AZ
@@ -27,5 +28,10 @@ namespace AZ
     private:
         JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
             JsonDeserializerContext& context);
+        //! Loads all elements of a sequence container with random access on multiple threads.
+        //! Returns false if loading of one of the elements was halted.
+        bool LoadElementsInParallel(JsonSerializationResult::ResultCode& retVal, void* outputValue, SerializeContext::IDataContainer& container,
+            const SerializeContext::ClassElement& classElement, const rapidjson::Value& inputValue, JsonDeserializerContext& context,
+            ContinuationFlags flags);
     };
 } // namespace AZ
@@ -7,6 +7,10 @@
  */
 
 #include "AzCore/RTTI/TypeInfo.h"
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/UuidSerializer.h>
 #include <AzCore/RTTI/AttributeReader.h>
 #include <AzCore/Serialization/Json/CastingHelpers.h>
@@ -17,9 +21,21 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/fixed_string.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 
 namespace AZ
 {
+    namespace JsonDeserializerInternal
+    {
+        //! Arrays with fewer elements are always loaded on the calling thread.
+        static constexpr size_t ParallelLoadMinElements = 64;
+        //! The minimum number of elements a single job loads, to keep the overhead of jobs low for small elements.
+        static constexpr size_t ParallelLoadMinElementsPerJob = 16;
+        //! The number of jobs that are created per worker thread to balance elements that take longer to load than others.
+        static constexpr size_t ParallelLoadJobsPerWorker = 4;
+    }
+
     JsonSerializationResult::ResultCode JsonDeserializer::DeserializerDefaultCheck(BaseJsonSerializer* serializer, void* object,
         const Uuid& typeId,const rapidjson::Value& value, bool isNewInstance, JsonDeserializerContext& context)
     {
@@ -50,12 +66,12 @@ namespace AZ
         }
 
         if (BaseJsonSerializer* serializer
-            = (custom == UseTypeDeserializer::Yes ? context.GetRegistrationContext()->GetSerializerForType(typeId) : nullptr))
+            = (custom == UseTypeDeserializer::Yes ? GetSerializerForType(typeId, context) : nullptr))
         {
             return DeserializerDefaultCheck(serializer, object, typeId, value, isNewInstance, context);
         }
 
-        const SerializeContext::ClassData* classData = context.GetSerializeContext()->FindClassData(typeId);
+        const SerializeContext::ClassData* classData = FindClassData(typeId, context);
         if (!classData)
         {
             return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
@@ -74,7 +90,7 @@ namespace AZ
             
             if (BaseJsonSerializer* serializer
                 = (custom == UseTypeDeserializer::Yes)
-                    ? context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId())
+                    ? GetSerializerForType(classData->m_azRtti->GetGenericTypeId(), context)
                     : nullptr)
             {
                 return DeserializerDefaultCheck(serializer, object, typeId, value, isNewInstance, context);
@@ -109,7 +125,7 @@ namespace AZ
     {
         using namespace JsonSerializationResult;
 
-        const SerializeContext::ClassData* classData = context.GetSerializeContext()->FindClassData(typeId);
+        const SerializeContext::ClassData* classData = FindClassData(typeId, context);
         if (!classData)
         {
             return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown, 
@@ -135,7 +151,7 @@ namespace AZ
         }
         else
         {
-            const SerializeContext::ClassData* resolvedClassData = context.GetSerializeContext()->FindClassData(resolvedTypeId);
+            const SerializeContext::ClassData* resolvedClassData = FindClassData(resolvedTypeId, context);
             if (resolvedClassData)
             {
                 status = JsonDeserializer::Load(*objectPtr, resolvedTypeId, value, true, useCustom, context);
@@ -190,6 +206,9 @@ namespace AZ
 
         AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
 
+        const JsonDeserializerCache::ClassElements* cachedElements =
+            context.m_cache ? &GetClassElements(classData, *context.m_cache, context) : nullptr;
+
         size_t numLoads = 0;
         ResultCode retVal(Tasks::ReadField);
         for (auto iter = value.MemberBegin(); iter != value.MemberEnd(); ++iter)
@@ -201,7 +220,24 @@ namespace AZ
                 continue;
             }
             Crc32 nameCrc(name);
-            ElementDataResult foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            ElementDataResult foundElementData;
+            if (cachedElements)
+            {
+                for (const JsonDeserializerCache::Element& element : cachedElements->m_elements)
+                {
+                    if (element.m_info->m_nameCrc == nameCrc)
+                    {
+                        foundElementData.m_data = reinterpret_cast<char*>(object) + element.m_offset;
+                        foundElementData.m_info = element.m_info;
+                        foundElementData.m_found = true;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            }
 
             ScopedContextPath subPath(context, name);
             if (foundElementData.m_found)
@@ -225,7 +261,7 @@ namespace AZ
             }
         }
 
-        size_t elementCount = CountElements(*context.GetSerializeContext(), classData);
+        size_t elementCount = cachedElements ? cachedElements->m_elementCount : CountElements(*context.GetSerializeContext(), classData);
         if (elementCount > numLoads)
         {
             retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
@@ -255,7 +291,7 @@ namespace AZ
             }
         }
 
-        const SerializeContext::ClassData* underlyingClassData = context.GetSerializeContext()->FindClassData(underlyingTypeId);
+        const SerializeContext::ClassData* underlyingClassData = FindClassData(underlyingTypeId, context);
         if (!underlyingClassData)
         {
             return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
@@ -848,7 +884,7 @@ namespace AZ
                 const Uuid* lastApplicableCandidate = nullptr;
                 for (const Uuid& typeId : typeIdCandidates)
                 {
-                    const SerializeContext::ClassData* classData = context.GetSerializeContext()->FindClassData(typeId);
+                    const SerializeContext::ClassData* classData = FindClassData(typeId, context);
                     if (context.GetSerializeContext()->CanDowncast(typeId, baseClassRtti->GetTypeId(), 
                         classData ? classData->m_azRtti : nullptr, baseClassRtti))
                     {
@@ -938,4 +974,142 @@ namespace AZ
     {
         return value.IsObject() && value.MemberCount() == 0;
     }
+
+    void JsonDeserializer::LoadElements(AZStd::vector<JsonSerializationResult::ResultCode>& results, const AZStd::vector<void*>& objects,
+        const Uuid& typeId, const rapidjson::Value& array, bool isNewInstance, bool resolvePointer, UseTypeDeserializer useCustom,
+        JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+        using namespace JsonDeserializerInternal;
+
+        AZ_Assert(array.IsArray() && array.Size() >= objects.size(), "Not enough json array elements provided to load all objects.");
+
+        const size_t objectCount = objects.size();
+        results.assign(objectCount, ResultCode(Tasks::ReadField));
+
+        auto loadElement = [&results, &objects, &typeId, &array, isNewInstance, resolvePointer, useCustom](
+            size_t index, JsonDeserializerContext& elementContext)
+        {
+            ScopedContextPath subPath(elementContext, index);
+            const rapidjson::Value& value = array[aznumeric_cast<rapidjson::SizeType>(index)];
+            results[index] = resolvePointer
+                ? LoadToPointer(objects[index], typeId, value, useCustom, elementContext)
+                : Load(objects[index], typeId, value, isNewInstance, useCustom, elementContext);
+        };
+
+        JobContext* jobContext = nullptr;
+        if (context.ShouldLoadInParallel() && objectCount >= ParallelLoadMinElements)
+        {
+            jobContext = JobContext::GetGlobalContext();
+            // Arrays loaded from inside a job, such as arrays nested in an array that's already loaded in parallel, are loaded on
+            // the calling thread to avoid blocking a worker thread while it waits for other jobs.
+            if (jobContext && jobContext->GetJobManager().GetCurrentJob() != nullptr)
+            {
+                jobContext = nullptr;
+            }
+        }
+
+        if (!jobContext)
+        {
+            for (size_t i = 0; i < objectCount; ++i)
+            {
+                loadElement(i, context);
+            }
+            return;
+        }
+
+        // Reporting callbacks don't need to be thread safe, so calls from the jobs are serialized.
+        AZStd::mutex reportingMutex;
+        const JsonIssueCallback& parentReporting = context.GetReporter();
+        JsonIssueCallback reporting = [&reportingMutex, &parentReporting](AZStd::string_view message, ResultCode result, AZStd::string_view path)
+        {
+            AZStd::scoped_lock lock(reportingMutex);
+            return parentReporting(message, result, path);
+        };
+
+        const size_t jobCount = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1) * ParallelLoadJobsPerWorker;
+        const size_t elementsPerJob = AZStd::max(ParallelLoadMinElementsPerJob, (objectCount + jobCount - 1) / jobCount);
+
+        JobCompletion completion(jobContext);
+        for (size_t begin = 0; begin < objectCount; begin += elementsPerJob)
+        {
+            const size_t end = AZStd::min(begin + elementsPerJob, objectCount);
+            Job* job = CreateJobFunction([&context, &reporting, &loadElement, begin, end]()
+                {
+                    JsonDeserializerContext elementContext(context, reporting);
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        loadElement(i, elementContext);
+                    }
+                }, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+
+    BaseJsonSerializer* JsonDeserializer::GetSerializerForType(const Uuid& typeId, JsonDeserializerContext& context)
+    {
+        if (!context.m_cache)
+        {
+            return context.GetRegistrationContext()->GetSerializerForType(typeId);
+        }
+
+        auto it = context.m_cache->m_serializers.find(typeId);
+        if (it == context.m_cache->m_serializers.end())
+        {
+            it = context.m_cache->m_serializers.emplace(typeId, context.GetRegistrationContext()->GetSerializerForType(typeId)).first;
+        }
+        return it->second;
+    }
+
+    const SerializeContext::ClassData* JsonDeserializer::FindClassData(const Uuid& typeId, JsonDeserializerContext& context)
+    {
+        if (!context.m_cache)
+        {
+            return context.GetSerializeContext()->FindClassData(typeId);
+        }
+
+        auto it = context.m_cache->m_classData.find(typeId);
+        if (it == context.m_cache->m_classData.end())
+        {
+            it = context.m_cache->m_classData.emplace(typeId, context.GetSerializeContext()->FindClassData(typeId)).first;
+        }
+        return it->second;
+    }
+
+    const JsonDeserializerCache::ClassElements& JsonDeserializer::GetClassElements(const SerializeContext::ClassData& classData,
+        JsonDeserializerCache& cache, JsonDeserializerContext& context)
+    {
+        auto it = cache.m_classElements.find(&classData);
+        if (it == cache.m_classElements.end())
+        {
+            JsonDeserializerCache::ClassElements classElements;
+            AddClassElements(classElements, classData, 0, context);
+            it = cache.m_classElements.emplace(&classData, AZStd::move(classElements)).first;
+        }
+        return it->second;
+    }
+
+    void JsonDeserializer::AddClassElements(JsonDeserializerCache::ClassElements& classElements,
+        const SerializeContext::ClassData& classData, size_t offset, JsonDeserializerContext& context)
+    {
+        // Uses the same order as FindElementByNameCrc so derived class data takes precedence over base classes' data.
+        for (auto elementData = classData.m_elements.crbegin(); elementData != classData.m_elements.crend(); ++elementData)
+        {
+            classElements.m_elements.push_back({ &*elementData, offset + elementData->m_offset });
+
+            if (elementData->m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
+            {
+                if (const SerializeContext::ClassData* baseClassData = FindClassData(elementData->m_typeId, context))
+                {
+                    AddClassElements(classElements, *baseClassData, offset + elementData->m_offset, context);
+                }
+            }
+            else
+            {
+                classElements.m_elementCount++;
+            }
+        }
+    }
 } // namespace AZ
@@ -11,12 +11,36 @@
 #include <AzCore/JSON/document.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/utils.h>
 
 namespace AZ
 {
     struct Uuid;
 
+    //! Serializer and class lookups that are cached for the duration of a single load if the fast path is enabled.
+    struct JsonDeserializerCache final
+    {
+        //! A member of a class or one of its base classes.
+        struct Element
+        {
+            const SerializeContext::ClassElement* m_info{ nullptr };
+            size_t m_offset{ 0 }; //!< Offset from the start of the class, including the offset of base classes.
+        };
+        struct ClassElements
+        {
+            //! All elements including the elements of base classes, in the order they're searched by name.
+            AZStd::vector<Element> m_elements;
+            //! Number of elements that would be at the root of a json object.
+            size_t m_elementCount{ 0 };
+        };
+
+        AZStd::unordered_map<Uuid, BaseJsonSerializer*> m_serializers;
+        AZStd::unordered_map<Uuid, const SerializeContext::ClassData*> m_classData;
+        AZStd::unordered_map<const SerializeContext::ClassData*, ClassElements> m_classElements;
+    };
+
     class JsonDeserializer final
     {
         friend class JsonSerialization;
@@ -66,6 +90,11 @@ namespace AZ
         static JsonSerializationResult::ResultCode LoadToPointer(void* object, const Uuid& typeId, const rapidjson::Value& value,
             UseTypeDeserializer useCustom, JsonDeserializerContext& context);
 
+        //! Loads the elements of a json array into separate objects, on multiple threads if the context allows it.
+        static void LoadElements(AZStd::vector<JsonSerializationResult::ResultCode>& results, const AZStd::vector<void*>& objects,
+            const Uuid& typeId, const rapidjson::Value& array, bool isNewInstance, bool resolvePointer, UseTypeDeserializer useCustom,
+            JsonDeserializerContext& context);
+
         static JsonSerializationResult::ResultCode LoadWithClassElement(void* object, const rapidjson::Value& value,
             const SerializeContext::ClassElement& classElement, JsonDeserializerContext& context);
         
@@ -113,6 +142,14 @@ namespace AZ
         //! Counts the total number of elements that would be at the root of a json object.
         static size_t CountElements(SerializeContext& serializeContext, const SerializeContext::ClassData& classData);
 
+        //! Versions of the serializer and class lookups that use the cache in the context if available.
+        static BaseJsonSerializer* GetSerializerForType(const Uuid& typeId, JsonDeserializerContext& context);
+        static const SerializeContext::ClassData* FindClassData(const Uuid& typeId, JsonDeserializerContext& context);
+        static const JsonDeserializerCache::ClassElements& GetClassElements(const SerializeContext::ClassData& classData,
+            JsonDeserializerCache& cache, JsonDeserializerContext& context);
+        static void AddClassElements(JsonDeserializerCache::ClassElements& classElements, const SerializeContext::ClassData& classData,
+            size_t offset, JsonDeserializerContext& context);
+
         //! Checks if a value is an explicit default. This means the value is an object with no members.
         static bool IsExplicitDefault(const rapidjson::Value& value);
 
@@ -235,6 +235,8 @@ namespace AZ
         {
             return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
         };
+        // The path is only used to report issues, so the fast path only tracks it if the caller provided a way to receive them.
+        const bool trackPath = !settings.m_useFastPath || settings.m_reporting;
         if (!settings.m_reporting)
         {
             settings.m_reporting = issueReportingCallback;
@@ -245,6 +247,7 @@ namespace AZ
         {
             StackedString path(StackedString::Format::JsonPointer);
             JsonDeserializerContext context(settings);
+            context.SetPathTracking(trackPath);
             result = JsonDeserializer::Load(object, objectType, root, false, JsonDeserializer::UseTypeDeserializer::Yes, context);
         }
         return result;
@@ -36,6 +36,15 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool m_clearContainers = false;
+        //! If true, serializer and class lookups are cached for the duration of the load and the path to the value being loaded is
+        //! only tracked if a reporting callback was provided. This speeds up loading of large documents, but issues reported
+        //! through the default issue reporting won't include a path. Don't enable this for documents with values that use the
+        //! path while loading, such as material property values.
+        bool m_useFastPath = false;
+        //! If true, the elements of large arrays that are loaded into sequence containers such as AZStd::vector are loaded in
+        //! parallel on the job system. The reporting callback will be called from multiple threads, but never at the same time.
+        //! The metadata is shared between threads, so only enable this if the serializers of the elements don't change the metadata.
+        bool m_loadInParallel = false;
     };
 
     //! Optional settings used while storing an object to a json value.
@@ -71,6 +71,11 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline uint32_t Task::GetCpuMask() const noexcept
+    {
+        return m_descriptor.cpuMask;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
@@ -43,7 +43,9 @@ namespace AZ
         TaskPriority priority = TaskPriority::MEDIUM;
 
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
-        // corresponding to a set bit. 0 is synonymous with all bits set
+        // corresponding to a set bit. 0 is synonymous with all bits set. Bit N corresponds to the
+        // Nth worker of the executor, which is pinned to core N if there is a worker for every core.
+        // Tasks with a restricted mask are never stolen by workers outside of the mask
         uint32_t cpuMask = 0;
     };
 }
@@ -18,6 +18,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Module/Environment.h>
+#include <AzCore/Math/MathIntrinsics.h>
 
 #include <random>
 
@@ -86,115 +87,258 @@ namespace AZ
             return remaining;
         }
 
-        struct QueueStatus
-        {
-            AZStd::atomic<uint16_t> head;
-            AZStd::atomic<uint16_t> tail;
-            AZStd::atomic<uint16_t> reserve;
-        };
-
-        // The Task Queue is a lock free 4-priority queue. Its basic operation is as follows:
-        // Each priority level is associated with a different queue, corresponding to the maximum size of a uint16_t.
-        // Each queue is implemented as a ring buffer, and a 64 bit atomic maintains the following state per queue:
-        // - offset to the "head" of the ring, from where we acquire elements
-        // - offset to the "tail" of the ring, which tracks where new elements should be enqueued
-        // - offset to a tail reservation index, which is used to reserve a slot to enqueue elements
-        class TaskQueue final
+        // Chase-Lev work stealing deque. Only the worker owning the deque pushes and pops tasks at the bottom,
+        // while other workers steal tasks from the top. The ring buffer grows when it's full. Replaced buffers
+        // are kept until the deque is destroyed because a thief may still be reading from them.
+        class WorkStealingDeque final
         {
         public:
-            // Preallocating upfront allows us to reserve slots to insert tasks without locks.
-            // Each thread allocated by the task manager consumes ~2 MB.
-            constexpr static uint16_t MaxQueueSize = 0xffff;
-            constexpr static uint8_t PriorityLevelCount = static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT);
+            constexpr static int64_t InitialCapacity = 256;
 
-            TaskQueue() = default;
-            TaskQueue(const TaskQueue&) = delete;
-            TaskQueue& operator=(const TaskQueue&) = delete;
+            WorkStealingDeque();
+            ~WorkStealingDeque();
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
 
-            void Enqueue(Task* task);
-            Task* TryDequeue();
+            // Only to be called by the owning worker
+            void Push(Task* task);
+            Task* Pop();
+
+            // Can be called from any thread
+            Task* Steal();
+            bool IsEmpty() const;
 
         private:
-            QueueStatus m_status[PriorityLevelCount] = {};
-            Task* m_queues[PriorityLevelCount][MaxQueueSize] = {};
+            struct Buffer
+            {
+                int64_t m_mask;
+                AZStd::atomic<Task*> m_slots[1];
+
+                static Buffer* Create(int64_t capacity);
+                static void Destroy(Buffer* buffer);
+
+                int64_t Capacity() const
+                {
+                    return m_mask + 1;
+                }
+
+                Task* Get(int64_t index) const
+                {
+                    return m_slots[index & m_mask].load(AZStd::memory_order_relaxed);
+                }
+
+                void Put(int64_t index, Task* task)
+                {
+                    m_slots[index & m_mask].store(task, AZStd::memory_order_relaxed);
+                }
+            };
+
+            Buffer* Grow(Buffer* buffer, int64_t bottom, int64_t top);
+
+            AZStd::atomic<int64_t> m_top{ 0 };
+            AZStd::atomic<int64_t> m_bottom{ 0 };
+            AZStd::atomic<Buffer*> m_buffer{ nullptr };
+            AZStd::vector<Buffer*> m_retiredBuffers;
         };
 
-        void TaskQueue::Enqueue(Task* task)
+        WorkStealingDeque::Buffer* WorkStealingDeque::Buffer::Create(int64_t capacity)
         {
-            uint8_t priority = task->GetPriorityNumber();
-            QueueStatus& status = m_status[priority];
-
-            AZStd::exponential_backoff backoff;
-            while (true)
+            const size_t byteSize = sizeof(Buffer) + sizeof(AZStd::atomic<Task*>) * (capacity - 1);
+            Buffer* buffer = reinterpret_cast<Buffer*>(azmalloc(byteSize, alignof(Buffer)));
+            buffer->m_mask = capacity - 1;
+            for (int64_t i = 0; i != capacity; ++i)
             {
-                uint16_t reserve = status.reserve.load();
-                uint16_t head = status.head.load();
+                new (&buffer->m_slots[i]) AZStd::atomic<Task*>(nullptr);
+            }
+            return buffer;
+        }
 
-                // Enqueuing is done in two phases because we cannot atomically write the task to the slot we reserve
-                // and simulataneously publish the fact that the slot is now available.
-                if (reserve != head - 1)
-                {
-                    // Try to reserve a slot
-                    if (status.reserve.compare_exchange_weak(reserve, reserve + 1))
-                    {
-                        m_queues[priority][reserve] = task;
+        void WorkStealingDeque::Buffer::Destroy(Buffer* buffer)
+        {
+            azfree(buffer);
+        }
 
-                        uint16_t expectedReserve = reserve;
+        WorkStealingDeque::WorkStealingDeque()
+        {
+            m_buffer.store(Buffer::Create(InitialCapacity), AZStd::memory_order_relaxed);
+        }
 
-                        // Increment the tail to advertise the new task
-                        while (!status.tail.compare_exchange_weak(expectedReserve, reserve + 1))
-                        {
-                            expectedReserve = reserve;
-                        }
+        WorkStealingDeque::~WorkStealingDeque()
+        {
+            Buffer::Destroy(m_buffer.load(AZStd::memory_order_relaxed));
+            for (Buffer* buffer : m_retiredBuffers)
+            {
+                Buffer::Destroy(buffer);
+            }
+        }
 
-                        return;
-                    }
+        WorkStealingDeque::Buffer* WorkStealingDeque::Grow(Buffer* buffer, int64_t bottom, int64_t top)
+        {
+            Buffer* grownBuffer = Buffer::Create(buffer->Capacity() * 2);
+            for (int64_t i = top; i != bottom; ++i)
+            {
+                grownBuffer->Put(i, buffer->Get(i));
+            }
+            m_retiredBuffers.push_back(buffer);
+            m_buffer.store(grownBuffer, AZStd::memory_order_release);
+            return grownBuffer;
+        }
 
-                    // We failed to reserve a slot, try again
-                }
-                else
-                {
-                    backoff.wait();
-                }
+        void WorkStealingDeque::Push(Task* task)
+        {
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+            if (bottom - top > buffer->Capacity() - 1)
+            {
+                buffer = Grow(buffer, bottom, top);
             }
+            buffer->Put(bottom, task);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
         }
 
-        Task* TaskQueue::TryDequeue()
+        Task* WorkStealingDeque::Pop()
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+            Task* task = nullptr;
+            if (top <= bottom)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                task = buffer->Get(bottom);
+                if (top == bottom)
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
-                    {
-                        // Queue empty
-                        break;
-                    }
-                    else
+                    // Last task in the deque, race against thieves for it
+                    if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
+                        task = nullptr;
                     }
+                    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
                 }
             }
+            else
+            {
+                // The deque was empty
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        Task* WorkStealingDeque::Steal()
+        {
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+            if (top < bottom)
+            {
+                Buffer* buffer = m_buffer.load(AZStd::memory_order_acquire);
+                Task* task = buffer->Get(top);
+                if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    return task;
+                }
+                // Lost the race against the owner or another thief
+            }
+            return nullptr;
+        }
+
+        bool WorkStealingDeque::IsEmpty() const
+        {
+            return m_top.load(AZStd::memory_order_relaxed) >= m_bottom.load(AZStd::memory_order_relaxed);
+        }
+
+        // Queue for tasks that are submitted from threads that don't own the worker, such as tasks submitted from
+        // outside of the executor or tasks that are restricted to a specific worker. The queues grow as needed.
+        class TaskInbox final
+        {
+        public:
+            constexpr static uint8_t PriorityLevelCount = static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT);
+
+            TaskInbox() = default;
+            TaskInbox(const TaskInbox&) = delete;
+            TaskInbox& operator=(const TaskInbox&) = delete;
+
+            void Enqueue(Task* task);
+            Task* TryDequeue();
+            Task* TryDequeue(uint8_t priority);
+
+        private:
+            AZStd::mutex m_mutex;
+            // Allows checking for an empty inbox without taking the lock
+            AZStd::atomic<uint32_t> m_count{ 0 };
+            AZStd::queue<Task*> m_queues[PriorityLevelCount];
+        };
+
+        void TaskInbox::Enqueue(Task* task)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_queues[task->GetPriorityNumber()].push(task);
+            m_count.fetch_add(1, AZStd::memory_order_release);
+        }
+
+        Task* TaskInbox::TryDequeue()
+        {
+            if (m_count.load(AZStd::memory_order_acquire) == 0)
+            {
+                return nullptr;
+            }
 
+            AZStd::scoped_lock lock(m_mutex);
+            for (AZStd::queue<Task*>& queue : m_queues)
+            {
+                if (!queue.empty())
+                {
+                    Task* task = queue.front();
+                    queue.pop();
+                    m_count.fetch_sub(1, AZStd::memory_order_relaxed);
+                    return task;
+                }
+            }
             return nullptr;
         }
 
+        Task* TaskInbox::TryDequeue(uint8_t priority)
+        {
+            if (m_count.load(AZStd::memory_order_acquire) == 0)
+            {
+                return nullptr;
+            }
+
+            AZStd::scoped_lock lock(m_mutex);
+            AZStd::queue<Task*>& queue = m_queues[priority];
+            if (queue.empty())
+            {
+                return nullptr;
+            }
+            Task* task = queue.front();
+            queue.pop();
+            m_count.fetch_sub(1, AZStd::memory_order_relaxed);
+            return task;
+        }
+
+        // The worker of the executor that is running on the current thread, if any
+        static thread_local TaskWorker* s_currentWorker = nullptr;
+
+        // Each worker owns a work stealing deque per priority level that receives the tasks the worker submits
+        // itself, such as the successors of a finished task. Tasks submitted from other threads are placed in the
+        // worker's inbox. Idle workers steal from the deques and inboxes of other workers. Tasks that are restricted
+        // to a set of cores are placed in the pinned inbox of an allowed worker, which is never stolen from.
         class TaskWorker
         {
         public:
-            void Spawn(::AZ::TaskExecutor& executor, size_t id, AZStd::semaphore& initSemaphore, bool affinitize)
+            constexpr static uint8_t PriorityLevelCount = static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT);
+
+            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
-                AZStd::string threadName = AZStd::string::format("TaskWorker %zu", id);
+                AZStd::string threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
                 desc.m_name = threadName.c_str();
                 if (affinitize)
@@ -202,9 +346,11 @@ namespace AZ
                     desc.m_cpuId = 1 << id;
                 }
                 m_active.store(true, AZStd::memory_order_release);
+                m_busy.store(true, AZStd::memory_order_release);
 
                 m_thread = AZStd::thread{ [this, &initSemaphore]
                                           {
+                                              s_currentWorker = this;
                                               initSemaphore.release();
                                               Run();
                                           },
@@ -218,15 +364,51 @@ namespace AZ
                 m_thread.join();
             }
 
-            void Enqueue(Task* task)
+            uint32_t GetId() const
             {
-                m_queue.Enqueue(task);
+                return m_id;
+            }
+
+            // Only to be called from the worker's own thread
+            void EnqueueLocal(Task* task)
+            {
+                m_deques[task->GetPriorityNumber()].Push(task);
+            }
+
+            void EnqueueShared(Task* task)
+            {
+                m_inbox.Enqueue(task);
+            }
 
+            void EnqueuePinned(Task* task)
+            {
+                m_pinnedInbox.Enqueue(task);
+            }
+
+            // Wakes the worker if it's idle. Returns false if the worker was already busy.
+            bool TryWake()
+            {
                 if (!m_busy.exchange(true))
                 {
                     // The worker was idle prior to enqueueing the task, release the semaphore
                     m_semaphore.release();
+                    return true;
                 }
+                return false;
+            }
+
+            bool IsIdle() const
+            {
+                return !m_busy.load(AZStd::memory_order_relaxed);
+            }
+
+            Task* Steal(uint8_t priority)
+            {
+                if (Task* task = m_deques[priority].Steal())
+                {
+                    return task;
+                }
+                return m_inbox.TryDequeue(priority);
             }
 
         private:
@@ -234,39 +416,85 @@ namespace AZ
             {
                 while (m_active)
                 {
-                    m_busy = false;
-                    m_semaphore.acquire();
-
-                    if (!m_active)
+                    Task* task = FindTask();
+                    if (!task)
                     {
-                        return;
+                        // Advertise that this worker is idle before checking for work one last time. Anyone submitting
+                        // a task after this point will see the worker as idle and wake it.
+                        m_busy.store(false);
+                        m_executor->m_idleWorkerCount.fetch_add(1);
+                        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+
+                        task = FindTask();
+                        if (!task)
+                        {
+                            m_semaphore.acquire();
+                            m_executor->m_idleWorkerCount.fetch_sub(1);
+                            continue;
+                        }
+
+                        m_executor->m_idleWorkerCount.fetch_sub(1);
+                        // A submitter may have woken this worker in the meantime, in which case the next wait returns
+                        // immediately and the worker checks for work again.
+                        m_busy.store(true);
                     }
 
-                    m_busy = true;
+                    do
+                    {
+                        Execute(task);
+                        task = FindTask();
+                    } while (task);
+                }
+            }
+
+            void Execute(Task* task)
+            {
+                // A task submitted without a graph belongs to the submitter, which may reuse it as soon as it has run
+                CompiledTaskGraph* graph = task->m_graph;
+                task->Invoke();
+                if (!graph)
+                {
+                    return;
+                }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
-                        {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
-                        }
+                        m_executor->Submit(*successor);
+                    }
+                }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
-                        {
-                            m_executor->ReleaseGraph();
-                        }
+                bool isRetained = graph->m_parent != nullptr;
+                if (graph->Release() == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
+            }
 
-                        task = m_queue.TryDequeue();
+            Task* FindTask()
+            {
+                // Work owned by this worker first, in priority order. The deque is popped in LIFO order so
+                // successors run while the data of their predecessors is still in the cache.
+                for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_pinnedInbox.TryDequeue(priority))
+                    {
+                        return task;
+                    }
+                    if (Task* task = m_deques[priority].Pop())
+                    {
+                        return task;
+                    }
+                    if (Task* task = m_inbox.TryDequeue(priority))
+                    {
+                        return task;
                     }
                 }
+
+                return m_executor->Steal(m_id);
             }
 
             AZStd::thread m_thread;
@@ -275,7 +503,11 @@ namespace AZ
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
-            TaskQueue m_queue;
+            uint32_t m_id = 0;
+
+            WorkStealingDeque m_deques[PriorityLevelCount];
+            TaskInbox m_inbox;
+            TaskInbox m_pinnedInbox;
         };
     } // namespace Internal
 
@@ -305,15 +537,23 @@ namespace AZ
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
 
-        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
+        // Only the first 32 workers can be addressed by the cpuMask of a TaskDescriptor
+        m_workerMask = m_threadCount >= 32 ? ~0u : (1u << m_threadCount) - 1;
+
+        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker), alignof(Internal::TaskWorker)));
 
         bool affinitize = m_threadCount == AZStd::thread::hardware_concurrency();
 
         AZStd::semaphore initSemaphore;
 
-        for (size_t i = 0; i != m_threadCount; ++i)
+        for (uint32_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
+        }
+
+        // All workers need to exist before any of them starts looking for tasks to steal
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].Spawn(*this, i, initSemaphore, affinitize);
         }
 
@@ -328,6 +568,10 @@ namespace AZ
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
+        }
+
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].~TaskWorker();
         }
 
@@ -349,10 +593,97 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
-        m_workers[++m_lastSubmission % m_threadCount].Enqueue(&task);
+        Internal::TaskWorker* currentWorker = GetCurrentWorker();
+
+        const uint32_t cpuMask = task.GetCpuMask() & m_workerMask;
+        if (cpuMask != 0 && cpuMask != m_workerMask)
+        {
+            // The task may only run on specific workers, so it's placed where it can't be stolen.
+            if (currentWorker && (cpuMask & (1u << currentWorker->GetId())))
+            {
+                currentWorker->EnqueuePinned(&task);
+                return;
+            }
+
+            // Distribute the tasks over the allowed workers by picking the Nth set bit of the mask.
+            uint32_t remainingMask = cpuMask;
+            for (uint32_t skip = ++m_lastSubmission % az_popcnt_u32(cpuMask); skip != 0; --skip)
+            {
+                remainingMask &= remainingMask - 1;
+            }
+            Internal::TaskWorker& worker = m_workers[az_ctz_u32(remainingMask)];
+            worker.EnqueuePinned(&task);
+            worker.TryWake();
+            return;
+        }
+
+        AZ_Warning("TaskExecutor", task.GetCpuMask() == 0 || cpuMask != 0,
+            "Task cpuMask 0x%08x doesn't include any of the %u task workers. The task can run on any worker.", task.GetCpuMask(), m_threadCount);
+
+        if (currentWorker)
+        {
+            // Tasks submitted from a worker, such as successors of a finished task, stay on that worker unless
+            // an idle worker steals them.
+            currentWorker->EnqueueLocal(&task);
+            WakeIdleWorker();
+            return;
+        }
+
+        Internal::TaskWorker& worker = m_workers[++m_lastSubmission % m_threadCount];
+        worker.EnqueueShared(&task);
+        if (!worker.TryWake())
+        {
+            // The worker is busy, let an idle worker steal the task instead of waiting on it.
+            WakeIdleWorker();
+        }
+    }
+
+    Internal::TaskWorker* TaskExecutor::GetCurrentWorker()
+    {
+        Internal::TaskWorker* worker = Internal::s_currentWorker;
+        if (worker && worker >= m_workers && worker < m_workers + m_threadCount)
+        {
+            return worker;
+        }
+        return nullptr;
+    }
+
+    void TaskExecutor::WakeIdleWorker()
+    {
+        // Pairs with the fence of a worker that's going idle, so either the worker sees the new task or the
+        // submitter sees the idle worker.
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_idleWorkerCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        const uint32_t start = m_lastWake.fetch_add(1, AZStd::memory_order_relaxed);
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            Internal::TaskWorker& worker = m_workers[(start + i) % m_threadCount];
+            if (worker.IsIdle() && worker.TryWake())
+            {
+                return;
+            }
+        }
+    }
+
+    Internal::Task* TaskExecutor::Steal(uint32_t thiefId)
+    {
+        // Higher priority tasks are stolen first. Victims are visited starting at the next worker so the thieves
+        // don't all pick on the same victim.
+        for (uint8_t priority = 0; priority != Internal::TaskWorker::PriorityLevelCount; ++priority)
+        {
+            for (uint32_t i = 1; i < m_threadCount; ++i)
+            {
+                if (Internal::Task* task = m_workers[(thiefId + i) % m_threadCount].Steal(priority))
+                {
+                    return task;
+                }
+            }
+        }
+        return nullptr;
     }
 
     void TaskExecutor::ReleaseGraph()
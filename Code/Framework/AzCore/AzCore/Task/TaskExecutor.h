@@ -74,16 +74,36 @@ namespace AZ
 
         void Submit(Internal::CompiledTaskGraph& graph);
 
+        // Tasks can also be submitted on their own, without a graph. The executor doesn't track or release
+        // these, the caller owns the task and can submit it again once its lambda has returned.
         void Submit(Internal::Task& task);
 
+        uint32_t GetThreadCount() const
+        {
+            return m_threadCount;
+        }
+
     private:
         friend class Internal::TaskWorker;
 
         void ReleaseGraph();
 
+        // Returns the worker of this executor that runs on the calling thread, or nullptr if called from another thread
+        Internal::TaskWorker* GetCurrentWorker();
+
+        // Wakes one idle worker so it can steal a newly submitted task
+        void WakeIdleWorker();
+
+        // Steals a task from any worker other than the thief, highest priority first
+        Internal::Task* Steal(uint32_t thiefId);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        // The workers that can be addressed by the cpuMask of a TaskDescriptor
+        uint32_t m_workerMask = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
+        AZStd::atomic<uint32_t> m_lastWake{ 0 };
+        AZStd::atomic<uint32_t> m_idleWorkerCount{ 0 };
         AZStd::atomic<uint64_t> m_graphsRemaining;
     };
 } // namespace AZ
@@ -182,6 +182,8 @@ set(FILES
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/BlockDecompressor.h
+    IO/Streamer/BlockDecompressor.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -498,6 +500,8 @@ set(FILES
     Serialization/DataPatchBus.h
     Serialization/DataPatchUpgradeManager.h
     Serialization/DataPatchUpgradeManager.cpp
+    Serialization/BlobSerialization.h
+    Serialization/BlobSerialization.cpp
     Serialization/Json/ArraySerializer.h
     Serialization/Json/ArraySerializer.cpp
     Serialization/Json/BaseJsonSerializer.h
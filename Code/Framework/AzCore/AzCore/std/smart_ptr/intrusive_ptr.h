@@ -94,6 +94,17 @@ namespace AZStd
             }
         }
 
+        //! Same as boost's intrusive_ptr(T* p, bool add_ref). If addRef is false, the pointer adopts a reference
+        //! that was already added to p.
+        intrusive_ptr(T* p, bool addRef)
+            : px(p)
+        {
+            if (px != 0 && addRef)
+            {
+                CountPolicy::add_ref(px);
+            }
+        }
+
         template<class U>
         intrusive_ptr(intrusive_ptr<U> const& rhs, enable_if_t<is_convertible<U*, T*>::value, int> = 0)
             : px(rhs.get())
@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/ReadQueue_Linux.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define AZ_STREAMER_IO_URING_SUPPORTED 1
+#else
+#define AZ_STREAMER_IO_URING_SUPPORTED 0
+#endif
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_IO_URING_SUPPORTED
+    //! Read queue that talks to io_uring directly through the system calls so there's no dependency on liburing. Reads
+    //! are submitted as IORING_OP_READV as that's supported by all kernels that have io_uring. An eventfd is registered
+    //! with the ring so a small thread can sleep until completions arrive and wake up the Streamer thread.
+    class IoUringReadQueue final
+        : public ReadQueueLinux
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(IoUringReadQueue, SystemAllocator, 0);
+
+        ~IoUringReadQueue() override
+        {
+            if (m_notificationThread.joinable())
+            {
+                m_isRunning = false;
+                u64 wakeUp = 1;
+                [[maybe_unused]] ssize_t written = ::write(m_eventFd, &wakeUp, sizeof(wakeUp));
+                m_notificationThread.join();
+            }
+
+            if (m_sqes != MAP_FAILED)
+            {
+                ::munmap(m_sqes, m_sqesSize);
+            }
+            if (m_cqRing != MAP_FAILED && m_cqRing != m_sqRing)
+            {
+                ::munmap(m_cqRing, m_cqRingSize);
+            }
+            if (m_sqRing != MAP_FAILED)
+            {
+                ::munmap(m_sqRing, m_sqRingSize);
+            }
+            if (m_ringFd >= 0)
+            {
+                ::close(m_ringFd);
+            }
+            if (m_eventFd >= 0)
+            {
+                ::close(m_eventFd);
+            }
+        }
+
+        bool Initialize(u32 queueDepth, CompletionNotification notification)
+        {
+            m_notification = AZStd::move(notification);
+
+            io_uring_params params{};
+            m_ringFd = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, queueDepth, &params));
+            if (m_ringFd < 0)
+            {
+                return false;
+            }
+
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMap)
+            {
+                m_sqRingSize = AZStd::max(m_sqRingSize, m_cqRingSize);
+                m_cqRingSize = m_sqRingSize;
+            }
+
+            m_sqRing = ::mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+            if (m_sqRing == MAP_FAILED)
+            {
+                return false;
+            }
+            m_cqRing = singleMap ? m_sqRing :
+                ::mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+            if (m_cqRing == MAP_FAILED)
+            {
+                return false;
+            }
+            m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = ::mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+            if (m_sqes == MAP_FAILED)
+            {
+                return false;
+            }
+
+            u8* sqRing = reinterpret_cast<u8*>(m_sqRing);
+            m_sqHead = reinterpret_cast<u32*>(sqRing + params.sq_off.head);
+            m_sqTail = reinterpret_cast<u32*>(sqRing + params.sq_off.tail);
+            m_sqMask = *reinterpret_cast<u32*>(sqRing + params.sq_off.ring_mask);
+            m_sqArray = reinterpret_cast<u32*>(sqRing + params.sq_off.array);
+            m_sqEntryCount = params.sq_entries;
+
+            u8* cqRing = reinterpret_cast<u8*>(m_cqRing);
+            m_cqHead = reinterpret_cast<u32*>(cqRing + params.cq_off.head);
+            m_cqTail = reinterpret_cast<u32*>(cqRing + params.cq_off.tail);
+            m_cqMask = *reinterpret_cast<u32*>(cqRing + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes);
+
+            m_eventFd = ::eventfd(0, EFD_CLOEXEC);
+            if (m_eventFd < 0)
+            {
+                return false;
+            }
+            if (::syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_EVENTFD, &m_eventFd, 1) < 0)
+            {
+                return false;
+            }
+
+            m_iovecs.resize(m_sqEntryCount);
+
+            m_isRunning = true;
+            m_notificationThreadDesc.m_name = "IO Completion (io_uring)";
+            m_notificationThread = AZStd::thread([this]()
+            {
+                NotificationLoop();
+            }, &m_notificationThreadDesc);
+            return true;
+        }
+
+        const char* GetName() const override
+        {
+            return "io_uring";
+        }
+
+        void Submit(size_t slot, int fileDescriptor, void* output, u64 size, u64 offset) override
+        {
+            AZ_Assert(slot < m_iovecs.size(), "Read slot %zu is larger than the io_uring submission queue supports (%zu).",
+                slot, m_iovecs.size());
+
+            iovec& buffer = m_iovecs[slot];
+            buffer.iov_base = output;
+            buffer.iov_len = size;
+
+            // Only the Streamer thread writes to the tail so a relaxed read is enough.
+            u32 tail = __atomic_load_n(m_sqTail, __ATOMIC_RELAXED);
+            u32 index = tail & m_sqMask;
+            io_uring_sqe& entry = reinterpret_cast<io_uring_sqe*>(m_sqes)[index];
+            memset(&entry, 0, sizeof(entry));
+            entry.opcode = IORING_OP_READV;
+            entry.fd = fileDescriptor;
+            entry.off = offset;
+            entry.addr = reinterpret_cast<u64>(&buffer);
+            entry.len = 1;
+            entry.user_data = slot;
+            m_sqArray[index] = index;
+            // Make sure the entry is visible to the kernel before the tail moves.
+            __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+            ++m_numUnsubmitted;
+        }
+
+        void Flush() override
+        {
+            u32 numRetries = 0;
+            while (m_numUnsubmitted > 0)
+            {
+                long submitted = ::syscall(__NR_io_uring_enter, m_ringFd, m_numUnsubmitted, 0, 0, nullptr, 0);
+                if (submitted > 0)
+                {
+                    m_numUnsubmitted -= aznumeric_cast<u32>(submitted);
+                    numRetries = 0;
+                    continue;
+                }
+
+                // A signal can interrupt the call at any time, but running out of kernel resources or a full completion queue
+                // may not resolve while the Streamer thread is waiting here, so those are only retried a few times.
+                const int error = (submitted < 0) ? errno : 0;
+                if (error == EINTR || ((error == EAGAIN || error == EBUSY) && ++numRetries < MaxSubmitRetries))
+                {
+                    AZStd::this_thread::yield();
+                    continue;
+                }
+
+                // The kernel isn't accepting the remaining reads, so fail them rather than leaving them in the ring forever.
+                AZ_Error("StorageDriveLinux", false, "io_uring_enter failed to submit %u reads with error %i.\n", m_numUnsubmitted, error);
+                FailUnsubmittedReads(error != 0 ? error : EIO);
+                break;
+            }
+        }
+
+        void ReapCompletions(AZStd::vector<ReadQueueCompletionLinux>& completions) override
+        {
+            u32 head = __atomic_load_n(m_cqHead, __ATOMIC_RELAXED);
+            u32 tail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+            while (head != tail)
+            {
+                const io_uring_cqe& entry = m_cqes[head & m_cqMask];
+                completions.push_back(ReadQueueCompletionLinux{ aznumeric_cast<size_t>(entry.user_data), entry.res });
+                ++head;
+            }
+            __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+
+            completions.insert(completions.end(), m_failedSubmissions.begin(), m_failedSubmissions.end());
+            m_failedSubmissions.clear();
+        }
+
+    private:
+        static constexpr u32 MaxSubmitRetries = 16;
+
+        void FailUnsubmittedReads(int error)
+        {
+            // Without SQPOLL the kernel only consumes entries during io_uring_enter, so everything between the head and the
+            // tail is still owned by this thread and can be taken back out of the ring.
+            u32 head = __atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE);
+            u32 tail = __atomic_load_n(m_sqTail, __ATOMIC_RELAXED);
+            for (u32 entry = head; entry != tail; ++entry)
+            {
+                const io_uring_sqe& submission = reinterpret_cast<io_uring_sqe*>(m_sqes)[m_sqArray[entry & m_sqMask]];
+                m_failedSubmissions.push_back(ReadQueueCompletionLinux{ aznumeric_cast<size_t>(submission.user_data), -error });
+            }
+            __atomic_store_n(m_sqTail, head, __ATOMIC_RELEASE);
+            m_numUnsubmitted = 0;
+
+            // Make sure the Streamer thread runs again to pick up the failed reads.
+            m_notification();
+        }
+
+        void NotificationLoop()
+        {
+            while (m_isRunning)
+            {
+                u64 count = 0;
+                ssize_t result = ::read(m_eventFd, &count, sizeof(count));
+                if (result < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (m_isRunning)
+                {
+                    m_notification();
+                }
+            }
+        }
+
+        CompletionNotification m_notification;
+        AZStd::vector<iovec> m_iovecs;
+        //! Reads that couldn't be submitted to the kernel. These are reported as failed the next time completions are reaped.
+        AZStd::vector<ReadQueueCompletionLinux> m_failedSubmissions;
+        AZStd::thread m_notificationThread;
+        AZStd::thread_desc m_notificationThreadDesc;
+        AZStd::atomic_bool m_isRunning{ false };
+
+        void* m_sqRing{ MAP_FAILED };
+        void* m_cqRing{ MAP_FAILED };
+        void* m_sqes{ MAP_FAILED };
+        size_t m_sqRingSize{ 0 };
+        size_t m_cqRingSize{ 0 };
+        size_t m_sqesSize{ 0 };
+
+        u32* m_sqHead{ nullptr };
+        u32* m_sqTail{ nullptr };
+        u32* m_sqArray{ nullptr };
+        u32* m_cqHead{ nullptr };
+        u32* m_cqTail{ nullptr };
+        io_uring_cqe* m_cqes{ nullptr };
+        u32 m_sqMask{ 0 };
+        u32 m_cqMask{ 0 };
+        u32 m_sqEntryCount{ 0 };
+        u32 m_numUnsubmitted{ 0 };
+
+        int m_ringFd{ -1 };
+        int m_eventFd{ -1 };
+    };
+#endif // AZ_STREAMER_IO_URING_SUPPORTED
+
+    //! Fallback read queue for kernels without io_uring or environments where it has been disabled, such as some
+    //! container runtimes. Regular files can't be waited on with epoll so a small number of threads issue blocking
+    //! preads instead, which still allows multiple reads to be in flight at the same time.
+    class ThreadPoolReadQueue final
+        : public ReadQueueLinux
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ThreadPoolReadQueue, SystemAllocator, 0);
+
+        ~ThreadPoolReadQueue() override
+        {
+            {
+                AZStd::scoped_lock lock(m_pendingGuard);
+                m_isRunning = false;
+            }
+            m_pendingSignal.notify_all();
+            for (AZStd::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        void Initialize(u32 numThreads, CompletionNotification notification)
+        {
+            m_notification = AZStd::move(notification);
+            m_isRunning = true;
+
+            m_threadDesc.m_name = "IO Completion (thread pool)";
+            m_threads.reserve(numThreads);
+            for (u32 i = 0; i < numThreads; ++i)
+            {
+                m_threads.emplace_back([this]()
+                {
+                    WorkerLoop();
+                }, &m_threadDesc);
+            }
+        }
+
+        const char* GetName() const override
+        {
+            return "thread pool";
+        }
+
+        void Submit(size_t slot, int fileDescriptor, void* output, u64 size, u64 offset) override
+        {
+            AZStd::scoped_lock lock(m_pendingGuard);
+            m_pending.push_back(PendingRead{ output, size, offset, slot, fileDescriptor });
+        }
+
+        void Flush() override
+        {
+            m_pendingSignal.notify_all();
+        }
+
+        void ReapCompletions(AZStd::vector<ReadQueueCompletionLinux>& completions) override
+        {
+            AZStd::scoped_lock lock(m_completedGuard);
+            completions.insert(completions.end(), m_completed.begin(), m_completed.end());
+            m_completed.clear();
+        }
+
+    private:
+        struct PendingRead
+        {
+            void* m_output;
+            u64 m_size;
+            u64 m_offset;
+            size_t m_slot;
+            int m_fileDescriptor;
+        };
+
+        void WorkerLoop()
+        {
+            while (true)
+            {
+                PendingRead read;
+                {
+                    AZStd::unique_lock<AZStd::mutex> lock(m_pendingGuard);
+                    m_pendingSignal.wait(lock, [this]() { return !m_isRunning || !m_pending.empty(); });
+                    if (!m_isRunning)
+                    {
+                        return;
+                    }
+                    read = m_pending.front();
+                    m_pending.pop_front();
+                }
+
+                s64 result = Read(read);
+                {
+                    AZStd::scoped_lock lock(m_completedGuard);
+                    m_completed.push_back(ReadQueueCompletionLinux{ read.m_slot, result });
+                }
+                m_notification();
+            }
+        }
+
+        static s64 Read(const PendingRead& read)
+        {
+            u8* output = reinterpret_cast<u8*>(read.m_output);
+            u64 totalRead = 0;
+            while (totalRead < read.m_size)
+            {
+                ssize_t bytesRead = ::pread(read.m_fileDescriptor, output + totalRead, read.m_size - totalRead, read.m_offset + totalRead);
+                if (bytesRead < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    return -errno;
+                }
+                if (bytesRead == 0)
+                {
+                    break; // End of file.
+                }
+                totalRead += bytesRead;
+            }
+            return aznumeric_cast<s64>(totalRead);
+        }
+
+        CompletionNotification m_notification;
+
+        AZStd::mutex m_pendingGuard;
+        AZStd::condition_variable m_pendingSignal;
+        AZStd::deque<PendingRead> m_pending;
+
+        AZStd::mutex m_completedGuard;
+        AZStd::vector<ReadQueueCompletionLinux> m_completed;
+
+        AZStd::vector<AZStd::thread> m_threads;
+        AZStd::thread_desc m_threadDesc;
+        bool m_isRunning{ false };
+    };
+
+    AZStd::unique_ptr<ReadQueueLinux> ReadQueueLinux::CreateIoUringQueue(
+        [[maybe_unused]] u32 queueDepth, [[maybe_unused]] CompletionNotification notification)
+    {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+        auto queue = AZStd::make_unique<IoUringReadQueue>();
+        if (queue->Initialize(queueDepth, AZStd::move(notification)))
+        {
+            return queue;
+        }
+#endif
+        return nullptr;
+    }
+
+    AZStd::unique_ptr<ReadQueueLinux> ReadQueueLinux::CreateThreadPoolQueue(u32 numThreads, CompletionNotification notification)
+    {
+        auto queue = AZStd::make_unique<ThreadPoolReadQueue>();
+        queue->Initialize(AZStd::max(numThreads, 1u), AZStd::move(notification));
+        return queue;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    //! Result of a single read that was submitted to a ReadQueueLinux.
+    struct ReadQueueCompletionLinux
+    {
+        //! The slot index the read was submitted with.
+        size_t m_slot{ 0 };
+        //! The number of bytes read or a negative errno value if the read failed.
+        s64 m_result{ 0 };
+    };
+
+    //! Interface for the asynchronous read backends used by StorageDriveLinux. Reads are submitted with a slot index
+    //! that's returned with the completion. Reads are only guaranteed to be passed to the kernel after Flush has been called.
+    //! Reads that the kernel doesn't accept are reported as completed with a negative errno value rather than being dropped.
+    //! Submit, Flush and ReapCompletions are only called from the Streamer thread, but the completion callback will be
+    //! called from a backend owned thread.
+    class ReadQueueLinux
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ReadQueueLinux, SystemAllocator, 0);
+
+        //! Callback that's triggered from a backend thread when one or more reads have completed.
+        using CompletionNotification = AZStd::function<void()>;
+
+        virtual ~ReadQueueLinux() = default;
+
+        virtual const char* GetName() const = 0;
+        virtual void Submit(size_t slot, int fileDescriptor, void* output, u64 size, u64 offset) = 0;
+        virtual void Flush() = 0;
+        //! Appends all reads that have completed since the last call to the completions list.
+        virtual void ReapCompletions(AZStd::vector<ReadQueueCompletionLinux>& completions) = 0;
+
+        //! Creates a read queue backed by io_uring. Returns null if io_uring isn't available on the running kernel.
+        static AZStd::unique_ptr<ReadQueueLinux> CreateIoUringQueue(u32 queueDepth, CompletionNotification notification);
+        //! Creates a read queue that uses a small pool of threads that issue blocking reads.
+        static AZStd::unique_ptr<ReadQueueLinux> CreateThreadPoolQueue(u32 numThreads, CompletionNotification notification);
+    };
+} // namespace AZ::IO
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        // Fallback in case the block devices couldn't be queried. This matches the default depth of most block devices.
+        constexpr u32 DefaultQueueDepth = 64;
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableIoUring = m_enableIoUring;
+        options.m_enableDirectReads = m_enableDirectReads;
+        options.m_minimalReporting = m_minimalReporting;
+
+        u32 queueDepth = m_queueDepth;
+        if (const LinuxDriveInformation* drive = AZStd::any_cast<LinuxDriveInformation>(&hardware.m_platformData); drive)
+        {
+            options.m_hasSeekPenalty = drive->m_hasSeekPenalty;
+            if (queueDepth == 0)
+            {
+                queueDepth = drive->m_queueDepth;
+            }
+        }
+        if (queueDepth == 0)
+        {
+            queueDepth = DefaultQueueDepth;
+        }
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(m_maxFileHandles, m_maxMetaDataCache, hardware.m_maxPhysicalSectorSize,
+            hardware.m_maxLogicalSectorSize, queueDepth, m_overcommit, m_fallbackThreadCount, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("FallbackThreadCount", &LinuxStorageDriveConfig::m_fallbackThreadCount)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableIoUring", &LinuxStorageDriveConfig::m_enableIoUring)
+                ->Field("EnableDirectReads", &LinuxStorageDriveConfig::m_enableDirectReads)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
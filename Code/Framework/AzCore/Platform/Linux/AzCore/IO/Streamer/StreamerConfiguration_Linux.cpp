@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceValue(const char* device, const char* attribute, size_t& value)
+    {
+        AZStd::string path = AZStd::string::format("/sys/block/%s/queue/%s", device, attribute);
+        FILE* file = fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long readValue = 0;
+        bool result = fscanf(file, "%llu", &readValue) == 1;
+        fclose(file);
+        value = aznumeric_cast<size_t>(readValue);
+        return result;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        // The numbers below are based on common defaults from a local hardware survey and are used if sysfs isn't available,
+        // such as in some containers.
+        info.m_maxPageSize = 4096;
+        info.m_maxTransfer = 512_kib;
+        info.m_maxPhysicalSectorSize = 4096;
+        info.m_maxLogicalSectorSize = 512;
+        info.m_profile = "Generic";
+
+        LinuxDriveInformation driveInfo;
+        if (DIR* blockDevices = opendir("/sys/block"); blockDevices != nullptr)
+        {
+            size_t maxPhysicalSectorSize = 0;
+            size_t maxLogicalSectorSize = 0;
+            size_t maxTransfer = 0;
+            bool hasSeekPenalty = false;
+            u32 queueDepth = 0;
+
+            while (dirent* entry = readdir(blockDevices))
+            {
+                // Skip entries such as "." and virtual devices that don't represent storage hardware.
+                const char* name = entry->d_name;
+                if (name[0] == '.' || strncmp(name, "loop", 4) == 0 || strncmp(name, "ram", 3) == 0 ||
+                    strncmp(name, "zram", 4) == 0)
+                {
+                    continue;
+                }
+
+                size_t value = 0;
+                if (!ReadBlockDeviceValue(name, "logical_block_size", value))
+                {
+                    continue;
+                }
+                maxLogicalSectorSize = AZStd::max(maxLogicalSectorSize, value);
+                if (ReadBlockDeviceValue(name, "physical_block_size", value))
+                {
+                    maxPhysicalSectorSize = AZStd::max(maxPhysicalSectorSize, value);
+                }
+                if (ReadBlockDeviceValue(name, "max_sectors_kb", value))
+                {
+                    maxTransfer = AZStd::max(maxTransfer, value * 1024);
+                }
+                if (ReadBlockDeviceValue(name, "rotational", value))
+                {
+                    hasSeekPenalty = hasSeekPenalty || (value != 0);
+                }
+                if (ReadBlockDeviceValue(name, "nr_requests", value) && value > 0)
+                {
+                    queueDepth = (queueDepth == 0) ? aznumeric_cast<u32>(value) : AZStd::min(queueDepth, aznumeric_cast<u32>(value));
+                }
+
+                if (reportHardware)
+                {
+                    AZ_Printf("Streamer", "Found block device '%s'.\n", name);
+                }
+            }
+            closedir(blockDevices);
+
+            if (maxLogicalSectorSize > 0)
+            {
+                info.m_maxLogicalSectorSize = maxLogicalSectorSize;
+                info.m_maxPhysicalSectorSize = AZStd::max(maxPhysicalSectorSize, maxLogicalSectorSize);
+                if (maxTransfer > 0)
+                {
+                    info.m_maxTransfer = maxTransfer;
+                }
+                driveInfo.m_hasSeekPenalty = hasSeekPenalty;
+                driveInfo.m_queueDepth = queueDepth;
+            }
+        }
+
+        if (reportHardware)
+        {
+            AZ_Printf("Streamer", "  Physical sector size: %zu\n", info.m_maxPhysicalSectorSize);
+            AZ_Printf("Streamer", "  Logical sector size: %zu\n", info.m_maxLogicalSectorSize);
+            AZ_Printf("Streamer", "  Max transfer: %zu\n", info.m_maxTransfer);
+            AZ_Printf("Streamer", "  Queue depth: %u\n", driveInfo.m_queueDepth);
+            AZ_Printf("Streamer", "  Seek penalty: %s\n", driveInfo.m_hasSeekPenalty ? "Yes" : "No");
+        }
+
+        info.m_platformData = driveInfo;
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
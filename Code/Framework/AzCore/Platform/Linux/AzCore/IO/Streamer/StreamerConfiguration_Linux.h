@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/RTTI/TypeInfo.h>
+
+namespace AZ::IO
+{
+    //! Combined information of the block devices that were found in sysfs.
+    struct LinuxDriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::LinuxDriveInformation, "{0F6B77A4-8C8E-4B6B-A7D4-6E1D3B0E6A29}");
+
+        //! The smallest number of requests any of the block devices can have queued.
+        u32 m_queueDepth{ 0 };
+        //! True if any of the block devices is a rotational disk.
+        bool m_hasSeekPenalty{ true };
+    };
+} // namespace AZ::IO
@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool flatDispatch = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -53,6 +53,7 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static const bool FlatDispatch = flatDispatch;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
@@ -193,8 +194,8 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool flatDispatch = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, flatDispatch>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -214,6 +215,14 @@ EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
 
+#define EBUS_TEST_FLAT_ALIAS(BusType, HandlerPolicy)                                                                  \
+    using BusType = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::HandlerPolicy, false, true>;        \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
+// Single with flat dispatch
+EBUS_TEST_FLAT_ALIAS(OneToManyFlat, Multiple)
+EBUS_TEST_FLAT_ALIAS(OneToManyOrderedFlat, MultipleAndOrdered)
+
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
 class Handler
@@ -2745,6 +2754,57 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1);
     }
 
+    TEST_F(EBus, FlatDispatch_ConnectAndDisconnect_BroadcastsReachConnectedHandlersInOrder)
+    {
+        using Bus = OneToManyOrderedFlat;
+        constexpr bool connectOnConstruct{ true };
+        Handler<Bus> first(0, 1, connectOnConstruct);
+        Handler<Bus> second(0, 2, connectOnConstruct);
+        Handler<Bus> third(0, 3, connectOnConstruct);
+
+        Bus::Broadcast(&Bus::Events::OnEvent);
+        EXPECT_LT(first.m_executedOrder, second.m_executedOrder);
+        EXPECT_LT(second.m_executedOrder, third.m_executedOrder);
+
+        Bus::BroadcastReverse(&Bus::Events::OnEvent);
+        EXPECT_GT(first.m_executedOrder, second.m_executedOrder);
+        EXPECT_GT(second.m_executedOrder, third.m_executedOrder);
+
+        // Disconnecting rebuilds the flat handlers
+        second.Disconnect();
+        Bus::Broadcast(&Bus::Events::OnEvent);
+        EXPECT_EQ(3, first.m_eventCalls);
+        EXPECT_EQ(2, second.m_eventCalls);
+        EXPECT_EQ(3, third.m_eventCalls);
+
+        // A single connected handler is called through the cached pointer
+        first.Disconnect();
+        third.Disconnect();
+        second.Connect();
+        EBusReduceResult<int, AZStd::plus<int>> result(0);
+        Bus::BroadcastResult(result, &Bus::Events::OnEvent);
+        EXPECT_EQ(2, result.value);
+        EXPECT_EQ(3, second.m_eventCalls);
+
+        // Reconnecting the other handlers goes back to the array
+        first.Connect();
+        third.Connect();
+        EBusReduceResult<int, AZStd::plus<int>> reverseResult(0);
+        Bus::BroadcastResultReverse(reverseResult, &Bus::Events::OnEvent);
+        EXPECT_EQ(6, reverseResult.value);
+        EXPECT_GT(first.m_executedOrder, second.m_executedOrder);
+        EXPECT_GT(second.m_executedOrder, third.m_executedOrder);
+        EXPECT_EQ(4, first.m_eventCalls);
+        EXPECT_EQ(4, second.m_eventCalls);
+        EXPECT_EQ(4, third.m_eventCalls);
+
+        first.Disconnect();
+        second.Disconnect();
+        third.Disconnect();
+        Bus::Broadcast(&Bus::Events::OnEvent);
+        EXPECT_EQ(4, second.m_eventCalls);
+    }
+
     namespace LocklessTest
     {
         struct LocklessConnectorEvents
@@ -4163,6 +4223,8 @@ namespace Benchmark
     cb(fn, OneToOne, OneToOne)                  \
     cb(fn, OneToMany, OneToMany)                \
     cb(fn, OneToManyOrdered, OneToMany)         \
+    cb(fn, OneToManyFlat, OneToMany)            \
+    cb(fn, OneToManyOrderedFlat, OneToMany)     \
     BUS_BENCHMARK_PRIVATE_LIST_ID(cb, fn)
 
 // Internal macro callback for registering a benchmark
@@ -4501,6 +4563,31 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_Flat(::benchmark::State& state)
+    {
+        using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, true>;
+
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnWait);
+        };
+
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_EBus_Multithreaded_Flat)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
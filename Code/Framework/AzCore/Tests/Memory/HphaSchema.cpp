@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -111,6 +112,126 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_threadCacheSize = 64 * s_kiloByte;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+
+        static constexpr size_t s_numberOfThreads = 8;
+        static constexpr size_t s_numberOfAllocationsPerThread = 1000;
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, DeAllocate_CachedAllocations_NotCountedAsAllocated)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        void* allocation = allocator.Allocate(64, 0);
+        EXPECT_NE(nullptr, allocation);
+        EXPECT_LE(allocatedBytes + 64, allocator.NumAllocatedBytes());
+
+        allocator.DeAllocate(allocation, 64);
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+
+        // The block is reused by this thread
+        void* reusedAllocation = allocator.Allocate(64, 0);
+        EXPECT_EQ(allocation, reusedAllocation);
+        allocator.DeAllocate(reusedAllocation, 64);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateDeAllocate_MultipleThreads_AllMemoryReturned)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < s_numberOfThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, threadIndex]()
+            {
+                AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+                for (size_t i = 0; i < s_numberOfAllocationsPerThread; ++i)
+                {
+                    const size_t allocationSize = s_smallAllocationSizes[(i + threadIndex) % s_smallAllocationSizes.size()];
+                    void* allocation = allocator.Allocate(allocationSize, 0);
+                    EXPECT_NE(nullptr, allocation);
+                    memset(allocation, static_cast<int>(threadIndex), allocationSize);
+                    allocations.push_back(allocation);
+                }
+                for (size_t i = 0; i < allocations.size(); ++i)
+                {
+                    const size_t allocationSize = s_smallAllocationSizes[(i + threadIndex) % s_smallAllocationSizes.size()];
+                    EXPECT_EQ(static_cast<unsigned char>(threadIndex), *reinterpret_cast<unsigned char*>(allocations[i]));
+                    allocator.DeAllocate(allocations[i], allocationSize);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, DeAllocate_FromOtherThread_AllMemoryReturned)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        AZStd::thread producer([&allocator, &allocations]()
+        {
+            for (size_t i = 0; i < s_numberOfAllocationsPerThread; ++i)
+            {
+                allocations.push_back(allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0));
+            }
+        });
+        producer.join();
+
+        AZStd::thread consumer([&allocator, &allocations]()
+        {
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+            }
+        });
+        consumer.join();
+
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, GarbageCollect_CachedAllocations_PagesReleased)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        allocator.GarbageCollect();
+        const size_t capacity = allocator.Capacity();
+
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        for (size_t i = 0; i < s_numberOfAllocationsPerThread; ++i)
+        {
+            allocations.push_back(allocator.Allocate(32, 0));
+        }
+        for (void* allocation : allocations)
+        {
+            allocator.DeAllocate(allocation, 32);
+        }
+
+        allocator.GarbageCollect();
+        EXPECT_EQ(capacity, allocator.Capacity());
+    }
 }
 
 
@@ -178,6 +299,71 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Several threads allocating and freeing small allocations at the same time, with and without thread caches
+    class HphaSchemaThreadedBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state)
+        {
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_threadCacheSize = state.range(1) ? 64 * s_kiloByte : 0;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown(const ::benchmark::State& state)
+        {
+            AZ_UNUSED(state);
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+
+        static constexpr size_t s_numberOfAllocationsPerThread = 10000;
+        static constexpr size_t s_numberOfLiveAllocations = 64;
+    };
+
+    BENCHMARK_DEFINE_F(HphaSchemaThreadedBenchmarkFixture, ThreadedSmallAllocations)(benchmark::State& state)
+    {
+        const size_t numberOfThreads = aznumeric_cast<size_t>(state.range(0));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            for (size_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+            {
+                threads.emplace_back([threadIndex]()
+                {
+                    auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+                    void* allocations[s_numberOfLiveAllocations] = {};
+                    size_t allocationSizes[s_numberOfLiveAllocations] = {};
+                    for (size_t i = 0; i < s_numberOfAllocationsPerThread; ++i)
+                    {
+                        const size_t slot = i % s_numberOfLiveAllocations;
+                        if (allocations[slot])
+                        {
+                            allocator.DeAllocate(allocations[slot], allocationSizes[slot]);
+                        }
+                        allocationSizes[slot] = s_smallAllocationSizes[(i + threadIndex) % s_smallAllocationSizes.size()];
+                        allocations[slot] = allocator.Allocate(allocationSizes[slot], 0);
+                    }
+                    for (size_t slot = 0; slot < s_numberOfLiveAllocations; ++slot)
+                    {
+                        allocator.DeAllocate(allocations[slot], allocationSizes[slot]);
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * numberOfThreads * s_numberOfAllocationsPerThread);
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaThreadedBenchmarkFixture, ThreadedSmallAllocations)
+        ->ArgNames({ "Threads", "ThreadCache" })
+        ->Args({ 1, 0 })->Args({ 1, 1 })
+        ->Args({ 4, 0 })->Args({ 4, 1 })
+        ->Args({ 8, 0 })->Args({ 8, 1 })
+        ->Unit(benchmark::kMillisecond);
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+    namespace NameBenchmarkInternal
+    {
+        constexpr size_t NameCount = 1024;
+
+        // Sets up the allocators and the name dictionary once for all threads of a benchmark.
+        class NameBenchmarkEnvironment
+            : public UnitTest::AllocatorsBase
+        {
+        public:
+            void SetUp()
+            {
+                SetupAllocator();
+                AZ::NameDictionary::Create();
+
+                m_nameStrings.reserve(NameCount);
+                m_names.reserve(NameCount);
+                for (size_t i = 0; i < NameCount; ++i)
+                {
+                    m_nameStrings.push_back("BenchmarkName_" + std::to_string(i));
+                    m_names.emplace_back(AZStd::string_view(m_nameStrings.back().c_str(), m_nameStrings.back().size()));
+                }
+            }
+
+            void TearDown()
+            {
+                m_names.clear();
+                m_nameStrings.clear();
+
+                AZ::NameDictionary::Destroy();
+                TeardownAllocator();
+            }
+
+            AZStd::string_view GetNameString(size_t index) const
+            {
+                const std::string& nameString = m_nameStrings[index % NameCount];
+                return AZStd::string_view(nameString.c_str(), nameString.size());
+            }
+
+            const AZ::Name& GetName(size_t index) const
+            {
+                return m_names[index % NameCount];
+            }
+
+        private:
+            std::vector<std::string> m_nameStrings;
+            // Keeps the names alive so the benchmarks look up existing entries.
+            std::vector<AZ::Name> m_names;
+        };
+
+        static NameBenchmarkEnvironment s_environment;
+    }
+
+    // Creating a Name for a string that's already in the dictionary, which is the common case at runtime.
+    static void BM_Name_CreateExisting(::benchmark::State& state)
+    {
+        using namespace NameBenchmarkInternal;
+
+        if (state.thread_index == 0)
+        {
+            s_environment.SetUp();
+        }
+
+        size_t index = state.thread_index * 7;
+        while (state.KeepRunning())
+        {
+            AZ::Name name(s_environment.GetNameString(index++));
+            benchmark::DoNotOptimize(name);
+        }
+
+        if (state.thread_index == 0)
+        {
+            s_environment.TearDown();
+        }
+    }
+    BENCHMARK(BM_Name_CreateExisting)->ThreadRange(1, 8);
+
+    // Creating and releasing names that only exist for a short time, so every iteration adds and removes a dictionary entry.
+    static void BM_Name_CreateAndRelease(::benchmark::State& state)
+    {
+        using namespace NameBenchmarkInternal;
+
+        if (state.thread_index == 0)
+        {
+            s_environment.SetUp();
+        }
+
+        const std::string prefix = "TemporaryName_" + std::to_string(state.thread_index) + "_";
+        size_t index = 0;
+        while (state.KeepRunning())
+        {
+            const std::string nameString = prefix + std::to_string(index++ % NameCount);
+            AZ::Name name(AZStd::string_view(nameString.c_str(), nameString.size()));
+            benchmark::DoNotOptimize(name);
+        }
+
+        if (state.thread_index == 0)
+        {
+            s_environment.TearDown();
+        }
+    }
+    BENCHMARK(BM_Name_CreateAndRelease)->ThreadRange(1, 8);
+
+    static void BM_Name_FindByHash(::benchmark::State& state)
+    {
+        using namespace NameBenchmarkInternal;
+
+        if (state.thread_index == 0)
+        {
+            s_environment.SetUp();
+        }
+
+        size_t index = state.thread_index * 7;
+        while (state.KeepRunning())
+        {
+            AZ::Name name = AZ::NameDictionary::Instance().FindName(s_environment.GetName(index++).GetHash());
+            benchmark::DoNotOptimize(name);
+        }
+
+        if (state.thread_index == 0)
+        {
+            s_environment.TearDown();
+        }
+    }
+    BENCHMARK(BM_Name_FindByHash)->ThreadRange(1, 8);
+
+    // Baseline for BM_Name_Literal, looking up the same string every time.
+    static void BM_Name_CreateFromStringLiteral(::benchmark::State& state)
+    {
+        using namespace NameBenchmarkInternal;
+
+        s_environment.SetUp();
+
+        while (state.KeepRunning())
+        {
+            AZ::Name name("BenchmarkName_42");
+            benchmark::DoNotOptimize(name);
+        }
+
+        s_environment.TearDown();
+    }
+    BENCHMARK(BM_Name_CreateFromStringLiteral);
+
+    static void BM_Name_Literal(::benchmark::State& state)
+    {
+        using namespace NameBenchmarkInternal;
+
+        s_environment.SetUp();
+
+        while (state.KeepRunning())
+        {
+            const AZ::Name& name = AZ_NAME_LITERAL("BenchmarkName_42");
+            benchmark::DoNotOptimize(name);
+        }
+
+        s_environment.TearDown();
+    }
+    BENCHMARK(BM_Name_Literal);
+}
+
+#endif // HAVE_BENCHMARK
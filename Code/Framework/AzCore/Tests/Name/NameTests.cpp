@@ -48,14 +48,19 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
-        
-        static size_t GetEntryCount()
+
+        static bool ContainsName(AZStd::string_view nameString)
         {
-            return GetDictionary().size();
+            bool found = false;
+            AZ::NameDictionary::Instance().VisitEntries([&found, nameString](AZ::Internal::NameData* nameData)
+            {
+                found = found || nameData->GetName() == nameString;
+            });
+            return found;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -280,11 +285,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -635,6 +636,96 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, ManyNames_AllNamesCanBeFoundAfterDictionaryGrows)
+    {
+        // Enough names to make every shard of the dictionary grow several times.
+        constexpr int NameCount = 20000;
+
+        AZStd::vector<AZ::Name> names;
+        names.reserve(NameCount);
+        for (int i = 0; i < NameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name%d", i));
+        }
+        EXPECT_EQ(NameCount, NameDictionaryTester::GetEntryCount());
+
+        // Release every other name so the tables contain removed entries between the remaining ones.
+        for (int i = 0; i < NameCount; i += 2)
+        {
+            names[i] = AZ::Name();
+        }
+        EXPECT_EQ(NameCount / 2, NameDictionaryTester::GetEntryCount());
+
+        for (int i = 1; i < NameCount; i += 2)
+        {
+            AZ::Name foundName = AZ::NameDictionary::Instance().FindName(names[i].GetHash());
+            EXPECT_EQ(names[i], foundName);
+            EXPECT_EQ(names[i], AZ::Name(AZStd::string::format("name%d", i)));
+        }
+    }
+
+    static const AZ::Name& GetMacroLiteralName()
+    {
+        return AZ_NAME_LITERAL("macroLiteral");
+    }
+
+    TEST_F(NameTest, NameLiteral_ResolvesToSameEntryAsName)
+    {
+        {
+            AZ::NameLiteral literal("literal");
+            AZ::Name name("literal");
+
+            EXPECT_EQ(name, literal.GetName());
+            EXPECT_EQ(name.GetHash(), literal.GetName().GetHash());
+            EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+        }
+
+        // The literal releases its reference when it's destroyed.
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+    }
+
+    TEST_F(NameTest, NameLiteral_EmptyLiteral_IsEmptyName)
+    {
+        AZ::NameLiteral literal("");
+        EXPECT_TRUE(literal.GetName().IsEmpty());
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+    }
+
+    TEST_F(NameTest, NameLiteral_CreatedBeforeDictionary_ResolvedWhenDictionaryIsCreated)
+    {
+        AZ::NameDictionary::Destroy();
+
+        AZ::NameLiteral literal("pendingLiteral");
+        EXPECT_FALSE(AZ::NameDictionary::IsReady());
+
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+        EXPECT_EQ(AZ::Name("pendingLiteral"), literal.GetName());
+    }
+
+    TEST_F(NameTest, NameLiteralMacro_ReturnsSameNameOnEveryCall)
+    {
+        const AZ::Name& first = GetMacroLiteralName();
+        const AZ::Name& second = GetMacroLiteralName();
+
+        EXPECT_EQ(&first, &second);
+        EXPECT_EQ(AZ::Name("macroLiteral"), first);
+        EXPECT_EQ(AZ::NameLiteral::CalcHash("macroLiteral"), NameDictionaryTester::CalcDirectHashValue("macroLiteral"));
+    }
+
+    TEST_F(NameTest, NameLiteralMacro_DictionaryRecreated_LiteralIsResolvedAgain)
+    {
+        EXPECT_EQ(AZ::Name("macroLiteral"), GetMacroLiteralName());
+
+        // Resolved literals don't count as leaked names.
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+
+        EXPECT_EQ(AZ::Name("macroLiteral"), GetMacroLiteralName());
+        EXPECT_EQ(1, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = 1000;
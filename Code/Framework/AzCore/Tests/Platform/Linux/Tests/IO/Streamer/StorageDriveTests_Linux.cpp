@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 4;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr AZ::u32 TestFallbackThreads = 2;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestFallbackThreads, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    struct StorageDriveLinuxTestParams
+    {
+        bool m_enableIoUring;
+        bool m_enableDirectReads;
+    };
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<StorageDriveLinuxTestParams>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyLinux.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive{};
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored == AZ::Utils::ExecutablePathResult::Success)
+            {
+                AZStd::string filePath(exePath);
+                if (result.m_pathIncludesFilename)
+                {
+                    AZ::StringFunc::Path::StripFullName(filePath);
+                }
+                AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+                if (AZ::IO::SystemFile::Exists(filePath.c_str()) || AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+                }
+            }
+        }
+
+        void SetUp() override
+        {
+            ASSERT_FALSE(m_dummyFilepath.empty());
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableIoUring = GetParam().m_enableIoUring;
+            options.m_enableDirectReads = GetParam().m_enableDirectReads;
+            options.m_minimalReporting = true;
+
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestFallbackThreads, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            m_context.reset();
+            AZ::IO::SystemFile::Delete(m_dummyFilepath.c_str());
+        }
+
+        // Create a file filled with a single character. If chunkOffset is non-zero, a marker character is written every
+        // chunkOffset bytes. If beginEndMarkers is true, the first and last byte will be marked.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            ASSERT_EQ(fileSize, file.Write(buffer.get(), fileSize));
+            file.Close();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_minimalReporting = true;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0,
+            TestQueueDepth, TestOverCommit, TestFallbackThreads, options);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, UpdateStatus_NoRequestsQueued_AllSlotsAvailable)
+    {
+        StreamStackEntry::Status status;
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_EQ(aznumeric_cast<s32>(TestQueueDepth) + TestOverCommit, status.m_numAvailableSlots);
+        EXPECT_TRUE(status.m_isIdle);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_StorageDriveHandledRequest)
+    {
+        constexpr size_t fileSize = 16_kib;
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+        constexpr char unexpectedChar = 'Z';
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestPhysicalSectorSize));
+        buffer[unalignedSize] = unexpectedChar;
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllReadsCompleteWithCorrectData)
+    {
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t numReads = TestQueueDepth * 4;
+        constexpr size_t fileSize = chunkSize * numReads;
+        CreateDummyFile(fileSize, chunkSize);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        ::memset(buffer, 'Z', fileSize);
+
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer + (i * chunkSize), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    numCompleted++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+        WaitTillCompleted();
+
+        EXPECT_EQ(numReads, numCompleted);
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            EXPECT_EQ(s_chunkCharacter, buffer[i * chunkSize]);
+            EXPECT_EQ(s_fileCharacter, buffer[(i + 1) * chunkSize - 1]);
+        }
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        auto queueDepth = AZStd::find_if(statistics.begin(), statistics.end(),
+            [](const Statistic& statistic) { return statistic.GetName() == "Queue depth (max.)"; });
+        ASSERT_NE(statistics.end(), queueDepth);
+        EXPECT_GT(queueDepth->GetIntegerValue(), 1);
+        EXPECT_LE(queueDepth->GetIntegerValue(), TestQueueDepth);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FileDoesNotExist_RequestFails)
+    {
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        char buffer[16];
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Failed);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        Streamer_StorageDriveLinux,
+        Streamer_StorageDriveLinuxTestFixture,
+        ::testing::Values(
+            StorageDriveLinuxTestParams{ true, false },
+            StorageDriveLinuxTestParams{ true, true },
+            StorageDriveLinuxTestParams{ false, false },
+            StorageDriveLinuxTestParams{ false, true }));
+} // namespace AZ::IO
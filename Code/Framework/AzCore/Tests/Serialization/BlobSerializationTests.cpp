@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/BlobSerialization.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    namespace BlobSerializationTestTypes
+    {
+        enum class BlobMode : AZ::u8
+        {
+            Static,
+            Dynamic,
+            Kinematic
+        };
+
+        struct BlobBase
+        {
+            AZ_TYPE_INFO(BlobBase, "{2B1E1B34-7E0B-4C38-9B0A-5A7D9B6A8E11}");
+
+            float m_weight = 1.0f;
+        };
+
+        struct BlobNested
+        {
+            AZ_TYPE_INFO(BlobNested, "{6F0C7F55-2E7A-4A2A-8D8E-3C1C3F1D4B22}");
+
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::u32 m_flags = 0;
+        };
+
+        struct BlobObject
+            : public BlobBase
+        {
+            AZ_TYPE_INFO(BlobObject, "{B8A3E2D1-5C4F-4E1B-9A7D-0D2E6F3C8B33}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Enum<BlobMode>()
+                    ->Value("Static", BlobMode::Static)
+                    ->Value("Dynamic", BlobMode::Dynamic)
+                    ->Value("Kinematic", BlobMode::Kinematic);
+                context.Class<BlobBase>()
+                    ->Field("Weight", &BlobBase::m_weight);
+                context.Class<BlobNested>()
+                    ->Field("Position", &BlobNested::m_position)
+                    ->Field("Flags", &BlobNested::m_flags);
+                context.Class<BlobObject, BlobBase>()
+                    ->Version(1)
+                    ->Field("Id", &BlobObject::m_id)
+                    ->Field("Mode", &BlobObject::m_mode)
+                    ->Field("Nested", &BlobObject::m_nested)
+                    ->Field("Asset", &BlobObject::m_asset)
+                    ->Field("Count", &BlobObject::m_count);
+            }
+
+            AZ::s64 m_id = 0;
+            BlobMode m_mode = BlobMode::Static;
+            BlobNested m_nested;
+            AZ::Uuid m_asset = AZ::Uuid::CreateNull();
+            AZ::u16 m_count = 0;
+        };
+
+        //! Newer version of BlobObject, with a removed field, a renamed field, a new field and a different member order.
+        struct BlobObjectV2
+            : public BlobBase
+        {
+            AZ_TYPE_INFO(BlobObjectV2, "{B8A3E2D1-5C4F-4E1B-9A7D-0D2E6F3C8B33}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<BlobBase>()
+                    ->Field("Weight", &BlobBase::m_weight);
+                context.Class<BlobNested>()
+                    ->Field("Position", &BlobNested::m_position)
+                    ->Field("Flags", &BlobNested::m_flags);
+                context.Class<BlobObjectV2, BlobBase>()
+                    ->Version(2)
+                    ->Field("Nested", &BlobObjectV2::m_nested)
+                    ->Field("Id", &BlobObjectV2::m_id)
+                    ->Field("AssetId", &BlobObjectV2::m_assetId)
+                    ->Field("Scale", &BlobObjectV2::m_scale);
+            }
+
+            BlobNested m_nested;
+            AZ::s64 m_id = 0;
+            AZ::Uuid m_assetId = AZ::Uuid::CreateNull();
+            float m_scale = 1.0f;
+        };
+
+        struct BlobObjectWithContainer
+        {
+            AZ_TYPE_INFO(BlobObjectWithContainer, "{4C7D2E19-83A5-4F6B-B1C0-7E9D5A2F6C44}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<BlobObjectWithContainer>()
+                    ->Field("Id", &BlobObjectWithContainer::m_id)
+                    ->Field("Values", &BlobObjectWithContainer::m_values);
+            }
+
+            AZ::u32 m_id = 0;
+            AZStd::vector<float> m_values;
+        };
+
+        BlobObject CreateBlobObject(AZ::u32 index)
+        {
+            BlobObject object;
+            object.m_weight = 0.5f * index;
+            object.m_id = -static_cast<AZ::s64>(index) * 1000000007;
+            object.m_mode = static_cast<BlobMode>(index % 3);
+            object.m_nested.m_position = AZ::Vector3(static_cast<float>(index), 2.0f, -3.0f);
+            object.m_nested.m_flags = index | 0x80000000;
+            object.m_asset = AZ::Uuid::CreateName(AZStd::to_string(index).c_str());
+            object.m_count = static_cast<AZ::u16>(index * 3);
+            return object;
+        }
+    } // namespace BlobSerializationTestTypes
+
+    class BlobSerializationTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            AZ::MathReflect(m_serializeContext.get());
+            BlobSerializationTestTypes::BlobObject::Reflect(*m_serializeContext);
+
+            for (AZ::u32 i = 0; i < ObjectCount; ++i)
+            {
+                m_objects.push_back(BlobSerializationTestTypes::CreateBlobObject(i));
+            }
+            AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&m_blob);
+            ASSERT_TRUE(AZ::BlobSerialization::Save(stream, m_objects.data(), m_objects.size(), m_serializeContext.get()));
+        }
+
+        void TearDown() override
+        {
+            m_blob = {};
+            m_objects = {};
+            m_serializeContext.reset();
+
+            AllocatorsFixture::TearDown();
+        }
+
+    protected:
+        static constexpr AZ::u32 ObjectCount = 16;
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<BlobSerializationTestTypes::BlobObject> m_objects;
+        AZStd::vector<AZ::u8> m_blob;
+    };
+
+    TEST_F(BlobSerializationTest, CreateLayout_FlattensBaseAndNestedClasses)
+    {
+        AZ::BlobSerialization::Layout layout;
+        ASSERT_TRUE(AZ::BlobSerialization::CreateLayout<BlobSerializationTestTypes::BlobObject>(layout, m_serializeContext.get()));
+        EXPECT_EQ(azrtti_typeid<BlobSerializationTestTypes::BlobObject>(), layout.m_typeId);
+        EXPECT_EQ(sizeof(BlobSerializationTestTypes::BlobObject), layout.m_objectSize);
+        // Weight, Id, Mode, Nested.Position, Nested.Flags, Asset and Count.
+        EXPECT_EQ(7, layout.m_fields.size());
+    }
+
+    TEST_F(BlobSerializationTest, LoadInPlace_SameLayout_ReturnsObjectsInBlob)
+    {
+        using namespace BlobSerializationTestTypes;
+
+        EXPECT_EQ(ObjectCount, AZ::BlobSerialization::GetObjectCount(m_blob.data(), m_blob.size()));
+
+        size_t objectCount = 0;
+        const BlobObject* objects = AZ::BlobSerialization::LoadInPlace<BlobObject>(m_blob.data(), m_blob.size(), objectCount, m_serializeContext.get());
+        ASSERT_NE(nullptr, objects);
+        ASSERT_EQ(ObjectCount, objectCount);
+        EXPECT_GE(reinterpret_cast<const AZ::u8*>(objects), m_blob.data());
+        EXPECT_LT(reinterpret_cast<const AZ::u8*>(objects), m_blob.data() + m_blob.size());
+        for (AZ::u32 i = 0; i < ObjectCount; ++i)
+        {
+            EXPECT_EQ(m_objects[i].m_weight, objects[i].m_weight);
+            EXPECT_EQ(m_objects[i].m_id, objects[i].m_id);
+            EXPECT_EQ(m_objects[i].m_mode, objects[i].m_mode);
+            EXPECT_TRUE(m_objects[i].m_nested.m_position.IsClose(objects[i].m_nested.m_position));
+            EXPECT_EQ(m_objects[i].m_nested.m_flags, objects[i].m_nested.m_flags);
+            EXPECT_EQ(m_objects[i].m_asset, objects[i].m_asset);
+            EXPECT_EQ(m_objects[i].m_count, objects[i].m_count);
+        }
+    }
+
+    TEST_F(BlobSerializationTest, Load_SameLayout_CopiesObjects)
+    {
+        using namespace BlobSerializationTestTypes;
+
+        AZStd::vector<BlobObject> objects;
+        ASSERT_TRUE(AZ::BlobSerialization::Load(objects, m_blob.data(), m_blob.size(), m_serializeContext.get()));
+        ASSERT_EQ(ObjectCount, objects.size());
+        for (AZ::u32 i = 0; i < ObjectCount; ++i)
+        {
+            EXPECT_EQ(m_objects[i].m_weight, objects[i].m_weight);
+            EXPECT_EQ(m_objects[i].m_id, objects[i].m_id);
+            EXPECT_EQ(m_objects[i].m_mode, objects[i].m_mode);
+            EXPECT_TRUE(m_objects[i].m_nested.m_position.IsClose(objects[i].m_nested.m_position));
+            EXPECT_EQ(m_objects[i].m_nested.m_flags, objects[i].m_nested.m_flags);
+            EXPECT_EQ(m_objects[i].m_asset, objects[i].m_asset);
+            EXPECT_EQ(m_objects[i].m_count, objects[i].m_count);
+        }
+    }
+
+    TEST_F(BlobSerializationTest, Load_ChangedLayout_ConvertsFieldByField)
+    {
+        using namespace BlobSerializationTestTypes;
+
+        AZ::SerializeContext newContext;
+        AZ::MathReflect(&newContext);
+        BlobObjectV2::Reflect(newContext);
+
+        size_t objectCount = 0;
+        EXPECT_EQ(nullptr, AZ::BlobSerialization::LoadInPlace<BlobObjectV2>(m_blob.data(), m_blob.size(), objectCount, &newContext));
+        EXPECT_EQ(0, objectCount);
+
+        AZStd::vector<BlobObjectV2> objects;
+        ASSERT_TRUE(AZ::BlobSerialization::Load(objects, m_blob.data(), m_blob.size(), &newContext));
+        ASSERT_EQ(ObjectCount, objects.size());
+        for (AZ::u32 i = 0; i < ObjectCount; ++i)
+        {
+            EXPECT_EQ(m_objects[i].m_weight, objects[i].m_weight);
+            EXPECT_EQ(m_objects[i].m_id, objects[i].m_id);
+            EXPECT_TRUE(m_objects[i].m_nested.m_position.IsClose(objects[i].m_nested.m_position));
+            EXPECT_EQ(m_objects[i].m_nested.m_flags, objects[i].m_nested.m_flags);
+            // Renamed and new fields keep their default values.
+            EXPECT_TRUE(objects[i].m_assetId.IsNull());
+            EXPECT_EQ(1.0f, objects[i].m_scale);
+        }
+    }
+
+    TEST_F(BlobSerializationTest, Load_DifferentType_Fails)
+    {
+        AZ::BlobSerialization::Layout layout;
+        layout.m_typeId = azrtti_typeid<BlobSerializationTestTypes::BlobNested>();
+        layout.m_objectSize = sizeof(BlobSerializationTestTypes::BlobNested);
+        AZStd::vector<BlobSerializationTestTypes::BlobNested> objects(ObjectCount);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::BlobSerialization::Load(objects.data(), objects.size(), m_blob.data(), m_blob.size(), layout));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(BlobSerializationTest, Load_TruncatedBlob_Fails)
+    {
+        using namespace BlobSerializationTestTypes;
+
+        const size_t truncatedSize = m_blob.size() - sizeof(BlobObject) / 2;
+        EXPECT_EQ(0, AZ::BlobSerialization::GetObjectCount(m_blob.data(), truncatedSize));
+
+        AZ::BlobSerialization::Layout layout;
+        ASSERT_TRUE(AZ::BlobSerialization::CreateLayout<BlobObject>(layout, m_serializeContext.get()));
+        AZStd::vector<BlobObject> objects(ObjectCount);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::BlobSerialization::Load(objects.data(), objects.size(), m_blob.data(), truncatedSize, layout));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(BlobSerializationTest, CreateLayout_ClassWithContainer_Fails)
+    {
+        AZ::SerializeContext context;
+        BlobSerializationTestTypes::BlobObjectWithContainer::Reflect(context);
+
+        AZ::BlobSerialization::Layout layout;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::BlobSerialization::CreateLayout<BlobSerializationTestTypes::BlobObjectWithContainer>(layout, &context));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(layout.m_fields.empty());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/Utils.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace BlobSerializationBenchmarkInternal
+    {
+        struct BlobBenchmarkObject
+        {
+            AZ_TYPE_INFO(BlobBenchmarkObject, "{9D3F6A27-1B84-4C2E-A5F0-8E7B2C4D6A55}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<BlobBenchmarkObject>()
+                    ->Field("Id", &BlobBenchmarkObject::m_id)
+                    ->Field("Position", &BlobBenchmarkObject::m_position)
+                    ->Field("Rotation", &BlobBenchmarkObject::m_rotation)
+                    ->Field("Scale", &BlobBenchmarkObject::m_scale)
+                    ->Field("Flags", &BlobBenchmarkObject::m_flags);
+            }
+
+            AZ::u64 m_id = 0;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+            float m_scale = 1.0f;
+            AZ::u32 m_flags = 0;
+        };
+
+        //! Root object for the formats that store a whole object graph instead of an array of records.
+        struct BlobBenchmarkList
+        {
+            AZ_TYPE_INFO(BlobBenchmarkList, "{0E5B8C41-7A2D-4F93-B6C1-3D9E4F7A2B66}");
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<BlobBenchmarkList>()
+                    ->Field("Objects", &BlobBenchmarkList::m_objects);
+            }
+
+            AZStd::vector<BlobBenchmarkObject> m_objects;
+        };
+    } // namespace BlobSerializationBenchmarkInternal
+
+    // Compares the time it takes to load a list of plain data objects from memory in each of the serialization formats.
+    class BM_BlobSerialization
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp, UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            using namespace BlobSerializationBenchmarkInternal;
+
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent.reset(AZ::JsonSystemComponent::CreateDescriptor());
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            AZ::MathReflect(m_serializeContext.get());
+            BlobBenchmarkObject::Reflect(*m_serializeContext);
+            BlobBenchmarkList::Reflect(*m_serializeContext);
+
+            m_list.m_objects.resize(aznumeric_cast<size_t>(state.range(0)));
+            for (size_t i = 0; i < m_list.m_objects.size(); ++i)
+            {
+                BlobBenchmarkObject& object = m_list.m_objects[i];
+                object.m_id = i;
+                object.m_position = AZ::Vector3(static_cast<float>(i), 1.0f, 2.0f);
+                object.m_rotation = AZ::Quaternion::CreateRotationZ(0.01f * i);
+                object.m_scale = 1.0f + 0.5f * (i % 4);
+                object.m_flags = static_cast<AZ::u32>(i * 31);
+            }
+
+            {
+                AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&m_xmlBuffer);
+                AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_XML, &m_list, m_serializeContext.get());
+            }
+            {
+                AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&m_binaryBuffer);
+                AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &m_list, m_serializeContext.get());
+            }
+            {
+                AZ::JsonSerializerSettings settings;
+                settings.m_serializeContext = m_serializeContext.get();
+                settings.m_registrationContext = m_jsonRegistrationContext.get();
+                rapidjson::Document document;
+                AZ::JsonSerialization::Store(document, document.GetAllocator(), m_list, settings);
+                AZ::JsonSerializationUtils::WriteJsonString(document, m_jsonText);
+            }
+            {
+                AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> stream(&m_blob);
+                AZ::BlobSerialization::Save(stream, m_list.m_objects.data(), m_list.m_objects.size(), m_serializeContext.get());
+            }
+            AZ::BlobSerialization::CreateLayout<BlobBenchmarkObject>(m_layout, m_serializeContext.get());
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_layout = {};
+            m_blob = {};
+            m_jsonText = {};
+            m_binaryBuffer = {};
+            m_xmlBuffer = {};
+            m_list = {};
+
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_serializeContext->EnableRemoveReflection();
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            m_jsonSystemComponent.reset();
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void LoadObjectStream(::benchmark::State& state, const AZStd::vector<AZ::u8>& buffer)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                BlobSerializationBenchmarkInternal::BlobBenchmarkList list;
+                AZ::Utils::LoadObjectFromBufferInPlace(buffer.data(), buffer.size(), list, m_serializeContext.get());
+                benchmark::DoNotOptimize(list.m_objects.data());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_jsonSystemComponent;
+        BlobSerializationBenchmarkInternal::BlobBenchmarkList m_list;
+        AZStd::vector<AZ::u8> m_xmlBuffer;
+        AZStd::vector<AZ::u8> m_binaryBuffer;
+        AZStd::string m_jsonText;
+        AZStd::vector<AZ::u8> m_blob;
+        AZ::BlobSerialization::Layout m_layout;
+    };
+
+    BENCHMARK_DEFINE_F(BM_BlobSerialization, LoadXml)(::benchmark::State& state)
+    {
+        LoadObjectStream(state, m_xmlBuffer);
+    }
+    BENCHMARK_REGISTER_F(BM_BlobSerialization, LoadXml)->Arg(1000)->Arg(100000);
+
+    BENCHMARK_DEFINE_F(BM_BlobSerialization, LoadObjectStreamBinary)(::benchmark::State& state)
+    {
+        LoadObjectStream(state, m_binaryBuffer);
+    }
+    BENCHMARK_REGISTER_F(BM_BlobSerialization, LoadObjectStreamBinary)->Arg(1000)->Arg(100000);
+
+    BENCHMARK_DEFINE_F(BM_BlobSerialization, LoadJson)(::benchmark::State& state)
+    {
+        AZ::JsonDeserializerSettings settings;
+        settings.m_serializeContext = m_serializeContext.get();
+        settings.m_registrationContext = m_jsonRegistrationContext.get();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto document = AZ::JsonSerializationUtils::ReadJsonString(m_jsonText);
+            BlobSerializationBenchmarkInternal::BlobBenchmarkList list;
+            AZ::JsonSerialization::Load(list, document.GetValue(), settings);
+            benchmark::DoNotOptimize(list.m_objects.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_BlobSerialization, LoadJson)->Arg(1000)->Arg(100000);
+
+    BENCHMARK_DEFINE_F(BM_BlobSerialization, LoadBlob)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<BlobSerializationBenchmarkInternal::BlobBenchmarkObject> objects(
+                AZ::BlobSerialization::GetObjectCount(m_blob.data(), m_blob.size()));
+            AZ::BlobSerialization::Load(objects.data(), objects.size(), m_blob.data(), m_blob.size(), m_layout);
+            benchmark::DoNotOptimize(objects.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_BlobSerialization, LoadBlob)->Arg(1000)->Arg(100000);
+
+    BENCHMARK_DEFINE_F(BM_BlobSerialization, LoadBlobInPlace)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t objectCount = 0;
+            const void* objects = AZ::BlobSerialization::LoadInPlace(m_blob.data(), m_blob.size(), m_layout, objectCount);
+            benchmark::DoNotOptimize(objects);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(BM_BlobSerialization, LoadBlobInPlace)->Arg(1000)->Arg(100000);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
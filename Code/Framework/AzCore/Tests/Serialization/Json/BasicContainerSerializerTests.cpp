@@ -6,6 +6,9 @@
  *
  */
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/list.h>
@@ -343,6 +346,124 @@ namespace JsonSerializationTests
         Expect_DocStrEq(R"([{"$type": "SimpleInheritence"},{"$type": "SimpleInheritence"}])");
     }
 
+    // Tests for loading the elements of an AZStd::vector on multiple threads
+
+    class JsonVectorParallelLoadTests
+        : public JsonVectorSerializerTests
+    {
+    public:
+        using IntContainer = AZStd::vector<int>;
+        static constexpr int ElementCount = 1000;
+
+        void SetUp() override
+        {
+            JsonVectorSerializerTests::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            m_deserializationSettings->m_useFastPath = true;
+            m_deserializationSettings->m_loadInParallel = true;
+            ResetJsonContexts();
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            JsonVectorSerializerTests::TearDown();
+        }
+
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            JsonVectorSerializerTests::RegisterAdditional(serializeContext);
+            serializeContext->RegisterGenericType<IntContainer>();
+        }
+
+    protected:
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(JsonVectorParallelLoadTests, Load_LargeArray_AllElementsLoaded)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value testVal(rapidjson::kArrayType);
+        for (int i = 0; i < ElementCount; ++i)
+        {
+            rapidjson::Value element(rapidjson::kObjectType);
+            element.AddMember("var1", i, m_jsonDocument->GetAllocator());
+            element.AddMember("var2", static_cast<float>(i) * 0.5f, m_jsonDocument->GetAllocator());
+            testVal.PushBack(AZStd::move(element), m_jsonDocument->GetAllocator());
+        }
+
+        Container instance;
+        instance.emplace_back(-1, -1.0f);
+        ResultCode result = m_serializer->Load(&instance, azrtti_typeid(&instance), testVal, *m_jsonDeserializationContext);
+        EXPECT_EQ(Processing::Completed, result.GetProcessing());
+        EXPECT_EQ(Outcomes::Success, result.GetOutcome());
+
+        ASSERT_EQ(ElementCount + 1, instance.size());
+        EXPECT_EQ(-1, instance[0].m_var1);
+        for (int i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_EQ(i, instance[i + 1].m_var1);
+            EXPECT_FLOAT_EQ(static_cast<float>(i) * 0.5f, instance[i + 1].m_var2);
+        }
+    }
+
+    TEST_F(JsonVectorParallelLoadTests, Load_InvalidElements_MatchesSequentialLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value testVal(rapidjson::kArrayType);
+        for (int i = 0; i < ElementCount; ++i)
+        {
+            if (i % 10 == 3)
+            {
+                testVal.PushBack(rapidjson::Value(rapidjson::kObjectType), m_jsonDocument->GetAllocator());
+            }
+            else if (i % 10 == 7)
+            {
+                testVal.PushBack(rapidjson::StringRef("invalid"), m_jsonDocument->GetAllocator());
+            }
+            else
+            {
+                testVal.PushBack(rapidjson::Value(i), m_jsonDocument->GetAllocator());
+            }
+        }
+
+        IntContainer parallelInstance;
+        ResultCode parallelResult =
+            m_serializer->Load(&parallelInstance, azrtti_typeid(&parallelInstance), testVal, *m_jsonDeserializationContext);
+
+        m_deserializationSettings->m_loadInParallel = false;
+        ResetJsonContexts();
+        IntContainer sequentialInstance;
+        ResultCode sequentialResult =
+            m_serializer->Load(&sequentialInstance, azrtti_typeid(&sequentialInstance), testVal, *m_jsonDeserializationContext);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        EXPECT_EQ(sequentialInstance, parallelInstance);
+    }
+
     // Specific tests for AZStd::fixed_vector
 
     class JsonFixedVectorSerializerTests
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    namespace JsonDeserializerBenchmarkInternal
+    {
+        // The classes below mirror the layout of a prefab, a list of entities that each have a list of components,
+        // without depending on the reflection of the actual entity and component classes.
+        struct BenchmarkComponent
+        {
+            AZ_TYPE_INFO(BenchmarkComponent, "{6C1E5F0A-3B7D-4E29-8A1C-2F4D9B0E7A11}");
+
+            AZ::u64 m_id = 0;
+            AZStd::array<float, 3> m_translation = { { 0.0f, 0.0f, 0.0f } };
+            float m_scale = 1.0f;
+            bool m_enabled = true;
+            AZStd::vector<AZStd::string> m_tags;
+        };
+
+        struct BenchmarkEntity
+        {
+            AZ_TYPE_INFO(BenchmarkEntity, "{2A9F4C71-5D3E-4B86-9E0F-7C1B3A5D8E22}");
+
+            AZ::u64 m_id = 0;
+            AZStd::string m_name;
+            AZStd::vector<BenchmarkComponent> m_components;
+        };
+
+        struct BenchmarkPrefab
+        {
+            AZ_TYPE_INFO(BenchmarkPrefab, "{D4B07E3A-9C61-4F2D-B85A-1E6F0C9A7B33}");
+
+            AZStd::string m_name;
+            AZStd::vector<BenchmarkEntity> m_entities;
+        };
+
+        void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<BenchmarkComponent>()
+                ->Field("Id", &BenchmarkComponent::m_id)
+                ->Field("Translation", &BenchmarkComponent::m_translation)
+                ->Field("Scale", &BenchmarkComponent::m_scale)
+                ->Field("Enabled", &BenchmarkComponent::m_enabled)
+                ->Field("Tags", &BenchmarkComponent::m_tags);
+            context.Class<BenchmarkEntity>()
+                ->Field("Id", &BenchmarkEntity::m_id)
+                ->Field("Name", &BenchmarkEntity::m_name)
+                ->Field("Components", &BenchmarkEntity::m_components);
+            context.Class<BenchmarkPrefab>()
+                ->Field("Name", &BenchmarkPrefab::m_name)
+                ->Field("Entities", &BenchmarkPrefab::m_entities);
+        }
+
+        constexpr size_t ComponentsPerEntity = 6;
+    } // namespace JsonDeserializerBenchmarkInternal
+
+    class BM_JsonDeserializer
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp, UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            using namespace JsonDeserializerBenchmarkInternal;
+
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent.reset(AZ::JsonSystemComponent::CreateDescriptor());
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            Reflect(*m_serializeContext);
+
+            BenchmarkPrefab prefab;
+            prefab.m_name = "BenchmarkPrefab";
+            prefab.m_entities.resize(aznumeric_cast<size_t>(state.range(0)));
+            for (size_t i = 0; i < prefab.m_entities.size(); ++i)
+            {
+                BenchmarkEntity& entity = prefab.m_entities[i];
+                entity.m_id = 1000 + i;
+                entity.m_name = AZStd::string::format("Entity_%zu", i);
+                entity.m_components.resize(ComponentsPerEntity);
+                for (size_t c = 0; c < ComponentsPerEntity; ++c)
+                {
+                    BenchmarkComponent& component = entity.m_components[c];
+                    component.m_id = entity.m_id * ComponentsPerEntity + c;
+                    component.m_translation[0] = static_cast<float>(i);
+                    component.m_translation[1] = static_cast<float>(c);
+                    component.m_scale = 2.0f;
+                    component.m_enabled = (c % 2) == 0;
+                    component.m_tags = { "Tag", AZStd::string::format("Component_%zu", c) };
+                }
+            }
+
+            AZ::JsonSerializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_jsonRegistrationContext.get();
+            AZ::JsonSerialization::Store(m_document, m_document.GetAllocator(), prefab, settings);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_document = rapidjson::Document();
+
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_serializeContext->EnableRemoveReflection();
+            m_jsonSystemComponent->Reflect(m_serializeContext.get());
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            m_jsonSystemComponent.reset();
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void Load(::benchmark::State& state, bool useFastPath, bool loadInParallel)
+        {
+            AZ::JsonDeserializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_jsonRegistrationContext.get();
+            settings.m_useFastPath = useFastPath;
+            settings.m_loadInParallel = loadInParallel;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                JsonDeserializerBenchmarkInternal::BenchmarkPrefab prefab;
+                // Use a fresh copy of the settings as loading stores the default reporting callback in them.
+                AZ::JsonDeserializerSettings loadSettings = settings;
+                AZ::JsonSerialization::Load(prefab, m_document, loadSettings);
+                benchmark::DoNotOptimize(prefab.m_entities.data());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_jsonSystemComponent;
+        rapidjson::Document m_document;
+    };
+
+    BENCHMARK_DEFINE_F(BM_JsonDeserializer, LoadPrefab)(::benchmark::State& state)
+    {
+        Load(state, false, false);
+    }
+    BENCHMARK_REGISTER_F(BM_JsonDeserializer, LoadPrefab)->Arg(100)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(BM_JsonDeserializer, LoadPrefabFastPath)(::benchmark::State& state)
+    {
+        Load(state, true, false);
+    }
+    BENCHMARK_REGISTER_F(BM_JsonDeserializer, LoadPrefabFastPath)->Arg(100)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(BM_JsonDeserializer, LoadPrefabFastPathInParallel)(::benchmark::State& state)
+    {
+        Load(state, true, true);
+    }
+    BENCHMARK_REGISTER_F(BM_JsonDeserializer, LoadPrefabFastPathInParallel)->Arg(100)->Arg(5000)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
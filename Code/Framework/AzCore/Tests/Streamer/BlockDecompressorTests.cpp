@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/BlockDecompressor.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class BlockDecompressorTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<BlockDecompressor>
+    {
+    public:
+        static constexpr u32 m_arbitrarilyLargeAlignment = 4096;
+
+        BlockDecompressor CreateInstance() override
+        {
+            return BlockDecompressor(2, 2, m_arbitrarilyLargeAlignment);
+        }
+
+        void SetUp() override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_BlockDecompressorConformityTests, StreamStackEntryConformityTests, BlockDecompressorTestDescription);
+
+    class Streamer_BlockDecompressorTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        enum ReadResult
+        {
+            Success,
+            Failed
+        };
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            m_decompressor.reset();
+            m_mock.reset();
+
+            delete[] m_buffer;
+            m_buffer = nullptr;
+
+            delete m_context;
+            m_context = nullptr;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        {
+            m_buffer = new u32[m_fakeFileLength >> 2];
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_decompressor = AZStd::make_shared<BlockDecompressor>(maxNumReads, maxNumJobs,
+                BlockDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+
+            m_context = new StreamerContext();
+            m_decompressor->SetContext(*m_context);
+            m_decompressor->SetNext(m_mock);
+        }
+
+        void SetupEnvironment()
+        {
+            SetupEnvironment(1, 4);
+        }
+
+        void MockReadCalls(ReadResult mockResult, size_t count = 1)
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests())
+                .WillOnce(Return(true))
+                .WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(aznumeric_cast<int>(count));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+
+            if (mockResult == ReadResult::Success)
+            {
+                ON_CALL(*m_mock, QueueRequest(_))
+                    .WillByDefault(Invoke(this, &Streamer_BlockDecompressorTest::PrepareReadRequest));
+            }
+            else
+            {
+                ON_CALL(*m_mock, QueueRequest(_))
+                    .WillByDefault(Invoke(this, &Streamer_BlockDecompressorTest::PrepareFailedReadRequest));
+            }
+        }
+
+        void PrepareReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            m_lastReadOffset = data->m_offset;
+            m_lastReadSize = data->m_size;
+
+            u64 size = data->m_size >> 2;
+            u32* buffer = reinterpret_cast<u32*>(data->m_output);
+            for (u64 i = 0; i < size; ++i)
+            {
+                buffer[i] = aznumeric_caster(data->m_offset + (i << 2));
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void PrepareFailedReadRequest(FileRequest* request)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        static bool Decompressor(const CompressionInfo&, const void* compressed, size_t compressedSize,
+            void* uncompressed, [[maybe_unused]] size_t uncompressedBufferSize)
+        {
+            // The fake compression stores every block as-is, so the block sizes need to match.
+            if (compressedSize != uncompressedBufferSize)
+            {
+                return false;
+            }
+            memcpy(uncompressed, compressed, compressedSize);
+            return true;
+        }
+
+        static bool CorruptedDecompressor(const CompressionInfo&, const void*, size_t, void*, size_t)
+        {
+            return false;
+        }
+
+        CompressionInfo CreateCompressionInfo(bool corrupted) const
+        {
+            auto blockOffsets = AZStd::make_shared<AZStd::vector<size_t>>();
+            for (size_t offset = 0; offset < m_fakeFileLength; offset += m_blockSize)
+            {
+                blockOffsets->push_back(offset);
+            }
+            blockOffsets->push_back(m_fakeFileLength);
+
+            CompressionInfo compressionInfo;
+            compressionInfo.m_compressedSize = m_fakeFileLength;
+            compressionInfo.m_isCompressed = true;
+            compressionInfo.m_offset = 0;
+            compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_blockSize = m_blockSize;
+            compressionInfo.m_blockOffsets = AZStd::move(blockOffsets);
+            if (corrupted)
+            {
+                compressionInfo.m_decompressor = &Streamer_BlockDecompressorTest::CorruptedDecompressor;
+            }
+            else
+            {
+                compressionInfo.m_decompressor = &Streamer_BlockDecompressorTest::Decompressor;
+            }
+            return compressionInfo;
+        }
+
+        void RunTillIdle()
+        {
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                if (status.m_isIdle)
+                {
+                    hasCompleted = true;
+                }
+
+                m_context->FinalizeCompletedRequests();
+            }
+        }
+
+        void ProcessCompressedRead(u64 offset, u64 size, bool corrupted, IStreamerTypes::RequestStatus expectedResult)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, CreateCompressionInfo(corrupted), m_buffer, offset, size);
+            bool result = true;
+            auto completed = [&result, expectedResult](const FileRequest& request)
+            {
+                result = result && request.GetStatus() == expectedResult;
+            };
+            request->SetCompletionCallback(completed);
+
+            m_decompressor->QueueRequest(request);
+            RunTillIdle();
+
+            EXPECT_TRUE(result);
+        }
+
+        void ProcessMultipleCompressedReads()
+        {
+            static const constexpr size_t count = 16;
+            MockReadCalls(ReadResult::Success, count);
+
+            CompressionInfo compressionInfo = CreateCompressionInfo(false);
+
+            bool allCompleted = true;
+            auto completed = [&allCompleted](const FileRequest& request)
+            {
+                allCompleted = allCompleted && request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+            };
+
+            FileRequest* requests[count];
+            AZStd::unique_ptr<u32[]> buffers[count];
+            for (size_t i = 0; i < count; ++i)
+            {
+                buffers[i] = AZStd::unique_ptr<u32[]>(new u32[m_fakeFileLength >> 2]);
+                requests[i] = m_context->GetNewInternalRequest();
+                requests[i]->CreateCompressedRead(nullptr, compressionInfo, buffers[i].get(), 0, m_fakeFileLength);
+                requests[i]->SetCompletionCallback(completed);
+                m_decompressor->QueueRequest(requests[i]);
+            }
+
+            RunTillIdle();
+
+            EXPECT_TRUE(allCompleted);
+            for (size_t i = 0; i < count; ++i)
+            {
+                VerifyReadBuffer(buffers[i].get(), 0, m_fakeFileLength);
+            }
+        }
+
+        void VerifyReadBuffer(u32* buffer, u64 offset, u64 size)
+        {
+            size = size >> 2;
+            for (u64 i = 0; i < size; ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would
+                // cause a large amount of log noise.
+                ASSERT_EQ(buffer[i], offset + (i << 2));
+            }
+        }
+
+        void VerifyReadBuffer(u64 offset, u64 size)
+        {
+            VerifyReadBuffer(m_buffer, offset, size);
+        }
+
+        u32* m_buffer{ nullptr };
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<BlockDecompressor> m_decompressor;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        u64 m_lastReadOffset{ 0 };
+        u64 m_lastReadSize{ 0 };
+        // The file length isn't a multiple of the block size so the last block is smaller than the others.
+        u64 m_fakeFileLength{ 1 * 1024 * 1024 + 4096 };
+        size_t m_blockSize{ 64 * 1024 };
+    };
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(0, m_lastReadOffset);
+        EXPECT_EQ(m_fakeFileLength, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_PartialReadAndDecompressData_SuccessfullyReadData)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(256, m_fakeFileLength - 512, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_ReadInsideSingleBlock_OnlyReadsCoveringBlock)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        const u64 offset = 3 * m_blockSize + 128;
+        ProcessCompressedRead(offset, 512, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, 512);
+        EXPECT_EQ(3 * m_blockSize, m_lastReadOffset);
+        EXPECT_EQ(m_blockSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_ReadAcrossBlockBoundary_OnlyReadsCoveringBlocks)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        const u64 offset = 5 * m_blockSize - 256;
+        ProcessCompressedRead(offset, 512, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, 512);
+        EXPECT_EQ(4 * m_blockSize, m_lastReadOffset);
+        EXPECT_EQ(2 * m_blockSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_ReadFromLastBlock_SuccessfullyReadData)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        const u64 offset = m_fakeFileLength - 1024;
+        ProcessCompressedRead(offset, 1024, false, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(offset, 1024);
+        EXPECT_EQ(m_fakeFileLength - (m_fakeFileLength % m_blockSize), m_lastReadOffset);
+        EXPECT_EQ(m_fakeFileLength % m_blockSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_FailedRead_FailureIsDetectedAndReported)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Failed);
+        ProcessCompressedRead(0, m_fakeFileLength, false, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_CorruptedArchiveRead_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, true, IStreamerTypes::RequestStatus::Failed);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, QueueRequest_CompressedReadWithoutSeekTable_ForwardedToNextEntry)
+    {
+        using ::testing::_;
+
+        SetupEnvironment();
+
+        CompressionInfo compressionInfo;
+        compressionInfo.m_compressedSize = m_fakeFileLength;
+        compressionInfo.m_isCompressed = true;
+        compressionInfo.m_uncompressedSize = m_fakeFileLength;
+        compressionInfo.m_decompressor = &Streamer_BlockDecompressorTest::Decompressor;
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, 0, m_fakeFileLength);
+
+        EXPECT_CALL(*m_mock, QueueRequest(request)).Times(1);
+        m_decompressor->QueueRequest(request);
+
+        m_context->RecycleRequest(request);
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithSingleJob_AllRequestsComplete)
+    {
+        SetupEnvironment(4, 1);
+        ProcessMultipleCompressedReads();
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithSingleRead_AllRequestsComplete)
+    {
+        SetupEnvironment(1, 4);
+        ProcessMultipleCompressedReads();
+    }
+
+    TEST_F(Streamer_BlockDecompressorTest, DecompressedRead_MultipleRequestsWithMultipleReadAndJobs_AllRequestsComplete)
+    {
+        SetupEnvironment(4, 4);
+        ProcessMultipleCompressedReads();
+    }
+} // namespace AZ::IO
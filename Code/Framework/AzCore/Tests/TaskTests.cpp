@@ -8,7 +8,12 @@
 
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -544,6 +549,133 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, LargeFanOut_ExceedsInitialQueueCapacity)
+    {
+        // All successors of the root are submitted from the worker that ran the root, so they end up in its own
+        // queue, which has to grow. Other workers steal from it.
+        constexpr int TaskCount = 5000;
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> result = 0;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                result = x.load();
+            });
+
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            auto task = graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++x;
+                });
+            root.Precedes(task);
+            join.Follows(task);
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(TaskCount, result);
+    }
+
+    TEST_F(TaskGraphTestFixture, ManyRootTasks_AllTasksRun)
+    {
+        constexpr int TaskCount = 5000;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++x;
+                });
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(TaskCount, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, CpuMask_TasksOnlyRunOnAllowedWorker)
+    {
+        // Only the second worker is allowed to run these tasks
+        TaskDescriptor pinnedTD{ "TaskGraphTestPinnedTask", "TaskGraphTests", TaskPriority::MEDIUM, 0b10 };
+
+        constexpr size_t TaskCount = 64;
+        AZStd::thread::id threadIds[TaskCount];
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            pinnedTD,
+            [&threadIds]
+            {
+                threadIds[0] = AZStd::this_thread::get_id();
+            });
+        for (size_t i = 1; i != TaskCount; ++i)
+        {
+            // Mix tasks that are submitted from outside the executor and from a worker
+            auto task = graph.AddTask(
+                pinnedTD,
+                [&threadIds, i]
+                {
+                    threadIds[i] = AZStd::this_thread::get_id();
+                });
+            if (i % 2)
+            {
+                root.Precedes(task);
+            }
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        for (size_t i = 1; i != TaskCount; ++i)
+        {
+            EXPECT_EQ(threadIds[0], threadIds[i]);
+        }
+        EXPECT_NE(AZStd::this_thread::get_id(), threadIds[0]);
+    }
+
+    TEST_F(TaskGraphTestFixture, StandaloneTask_ResubmittedAfterEachRun)
+    {
+        constexpr int SubmitCount = 1000;
+        AZStd::atomic<int> x = 0;
+        AZStd::binary_semaphore ran;
+
+        // The same task object is submitted again as soon as it has run, without a graph
+        Task task(
+            defaultTD,
+            [&x, &ran]
+            {
+                ++x;
+                ran.release();
+            });
+        for (int i = 0; i != SubmitCount; ++i)
+        {
+            m_executor->Submit(task);
+            ran.acquire();
+        }
+
+        EXPECT_EQ(SubmitCount, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -639,5 +771,157 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // Compares the task executor against the JobManager on the same fan-out workload. Every 16th task is much more
+    // expensive than the others, so the work isn't balanced between the workers unless they steal from each other.
+    class TaskExecutorVsJobManagerBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(benchmark::State&) override
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            const uint32_t threadCount = AZStd::thread::hardware_concurrency();
+
+            executor = new TaskExecutor(threadCount);
+
+            AZ::JobManagerDesc desc;
+            for (uint32_t i = 0; i != threadCount; ++i)
+            {
+                desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            jobManager = new AZ::JobManager(desc);
+            jobContext = new AZ::JobContext(*jobManager);
+        }
+
+        void TearDown(benchmark::State&) override
+        {
+            delete jobContext;
+            delete jobManager;
+            delete executor;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        static void Work(int64_t index)
+        {
+            const int64_t iterations = (index % 16 == 0) ? 20000 : 200;
+            double value = 0.0;
+            for (int64_t i = 0; i != iterations; ++i)
+            {
+                value += 1.0 / static_cast<double>(i * 2 + 1);
+            }
+            benchmark::DoNotOptimize(value);
+        }
+
+        TaskDescriptor descriptor{ "fan out", "benchmark" };
+
+        TaskExecutor* executor;
+        AZ::JobManager* jobManager;
+        AZ::JobContext* jobContext;
+    };
+
+    BENCHMARK_DEFINE_F(TaskExecutorVsJobManagerBenchmarkFixture, FanOut_TaskExecutor)(benchmark::State& state)
+    {
+        TaskGraph graph;
+        for (int64_t i = 0; i != state.range(0); ++i)
+        {
+            graph.AddTask(
+                descriptor,
+                [i]
+                {
+                    Work(i);
+                });
+        }
+
+        for (auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskExecutorVsJobManagerBenchmarkFixture, FanOut_TaskExecutor)->Arg(64)->Arg(1024)->Arg(16384);
+
+    BENCHMARK_DEFINE_F(TaskExecutorVsJobManagerBenchmarkFixture, FanOut_JobManager)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::JobCompletion completion(jobContext);
+            for (int64_t i = 0; i != state.range(0); ++i)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [i]
+                    {
+                        Work(i);
+                    },
+                    true, jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskExecutorVsJobManagerBenchmarkFixture, FanOut_JobManager)->Arg(64)->Arg(1024)->Arg(16384);
+
+    // Successors are submitted from inside the executor, which places them on the submitting worker's own queue
+    BENCHMARK_DEFINE_F(TaskExecutorVsJobManagerBenchmarkFixture, NestedFanOut_TaskExecutor)(benchmark::State& state)
+    {
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            descriptor,
+            []
+            {
+            });
+        for (int64_t i = 0; i != state.range(0); ++i)
+        {
+            auto task = graph.AddTask(
+                descriptor,
+                [i]
+                {
+                    Work(i);
+                });
+            root.Precedes(task);
+        }
+
+        for (auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskExecutorVsJobManagerBenchmarkFixture, NestedFanOut_TaskExecutor)->Arg(64)->Arg(1024)->Arg(16384);
+
+    BENCHMARK_DEFINE_F(TaskExecutorVsJobManagerBenchmarkFixture, NestedFanOut_JobManager)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::JobCompletion completion(jobContext);
+            const int64_t taskCount = state.range(0);
+            AZ::Job* root = AZ::CreateJobFunction(
+                [this, taskCount, &completion]
+                {
+                    for (int64_t i = 0; i != taskCount; ++i)
+                    {
+                        AZ::Job* job = AZ::CreateJobFunction(
+                            [i]
+                            {
+                                Work(i);
+                            },
+                            true, jobContext);
+                        job->SetDependentStarted(&completion);
+                        job->Start();
+                    }
+                },
+                true, jobContext);
+            root->SetDependent(&completion);
+            root->Start();
+            completion.StartAndWaitForCompletion();
+        }
+    }
+    BENCHMARK_REGISTER_F(TaskExecutorVsJobManagerBenchmarkFixture, NestedFanOut_JobManager)->Arg(64)->Arg(1024)->Arg(16384);
 } // namespace Benchmark
 #endif
@@ -72,6 +72,7 @@ set(FILES
     Debug/Trace.cpp
     Name/NameJsonSerializerTests.cpp
     Name/NameTests.cpp
+    Name/NameBenchmarks.cpp
     RTTI/TypeSafeIntegralTests.cpp
     SettingsRegistryTests.cpp
     SettingsRegistryMergeUtilsTests.cpp
@@ -79,6 +80,7 @@ set(FILES
     Settings/SettingsRegistryConsoleUtilsTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
     Streamer/BlockCacheTests.cpp
+    Streamer/BlockDecompressorTests.cpp
     Streamer/DedicatedCacheTests.cpp
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
@@ -88,6 +90,7 @@ set(FILES
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Serialization/BlobSerializationTests.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/BaseJsonSerializerFixture.h
     Serialization/Json/BaseJsonSerializerTests.cpp
@@ -97,6 +100,7 @@ set(FILES
     Serialization/Json/ColorSerializerTests.cpp
     Serialization/Json/DoubleSerializerTests.cpp
     Serialization/Json/IntSerializerTests.cpp
+    Serialization/Json/JsonDeserializerBenchmarks.cpp
     Serialization/Json/JsonRegistrationContextTests.cpp
     Serialization/Json/JsonSerializationMetadataTests.cpp
     Serialization/Json/JsonSerializationResultTests.cpp
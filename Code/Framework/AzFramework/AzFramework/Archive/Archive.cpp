@@ -56,6 +56,8 @@ namespace AZ::IO
     AZ_CVAR(int32_t, az_archive_verbosity, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Sets the verbosity level for logging Archive operations\n"
         ">=1 - Turns on verbose logging of all operations");
+    AZ_CVAR(bool, az_archive_path_index, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, files in the mounted archives are found through a hashed index of their paths instead of searching every archive");
 }
 
 namespace AZ::IO::ArchiveInternal
@@ -506,6 +508,7 @@ namespace AZ::IO
     {
         Release();
 
+        m_pathIndex.Clear();
         m_arrZips = {};
 
         uint32_t numFilesForcedToClose = 0;
@@ -891,6 +894,21 @@ namespace AZ::IO
         }
 
 
+        if (az_archive_path_index)
+        {
+            ZipDir::FileEntry* pFileEntry{};
+            switch (m_pathIndex.Find(unaliasedPath, bSkipInMemoryArchives, pFileEntry, nArchiveFlags, pZip))
+            {
+            case ArchivePathIndex::FindResult::Found:
+                return pFileEntry;
+            case ArchivePathIndex::FindResult::NotFound:
+                nArchiveFlags = 0;
+                return nullptr;
+            case ArchivePathIndex::FindResult::NotIndexed:
+                break;
+            }
+        }
+
         AZStd::shared_lock lock(m_csZips);
         // scan through registered archive files and try to find this file
         for (auto itZip = m_arrZips.rbegin(); itZip != m_arrZips.rend(); ++itZip)
@@ -936,6 +954,17 @@ namespace AZ::IO
         return nullptr;
     }
 
+    void Archive::RebuildPathIndex()
+    {
+        AZStd::vector<ArchivePathIndex::MountedArchive> archivesByPriority;
+        archivesByPriority.reserve(m_arrZips.size());
+        for (auto itZip = m_arrZips.rbegin(); itZip != m_arrZips.rend(); ++itZip)
+        {
+            archivesByPriority.push_back({ itZip->m_pathBindRoot, itZip->pArchive, itZip->pZip, itZip->m_mountedPaths });
+        }
+        m_pathIndex.Rebuild(AZStd::move(archivesByPriority));
+    }
+
     ZipDir::FileEntry* Archive::FindPakFileEntry(AZStd::string_view szPath) const
     {
         uint32_t flags;
@@ -1487,6 +1516,7 @@ namespace AZ::IO
 
         AZ_TracePrintf("Archive", "Opening archive file %.*s\n", aznumeric_cast<int>(szFullPath.size()), szFullPath.data());
         desc.pZip = static_cast<NestedArchive*>(desc.pArchive.get())->GetCache();
+        desc.m_mountedPaths = ArchivePathIndex::CreateMountedPaths(*desc.pZip, desc.m_pathBindRoot);
 
         AZStd::unique_lock lock(m_csZips);
         // Insert the archive lexically but before any override archives
@@ -1527,6 +1557,7 @@ namespace AZ::IO
         if (usePrefabSystemForLevels)
         {
             m_arrZips.insert(revItZip.base(), desc);
+            RebuildPathIndex();
         }
         else
         {
@@ -1553,6 +1584,7 @@ namespace AZ::IO
             }
 
             m_arrZips.insert(revItZip.base(), desc);
+            RebuildPathIndex();
 
             m_levelOpenEvent.Signal(levelDirs);
         }
@@ -1599,6 +1631,7 @@ namespace AZ::IO
                 if (usePrefabSystemForLevels)
                 {
                     it = m_arrZips.erase(it);
+                    RebuildPathIndex();
                 }
                 else
                 {
@@ -1610,6 +1643,7 @@ namespace AZ::IO
                     }
 
                     it = m_arrZips.erase(it);
+                    RebuildPathIndex();
 
                     if (needRescan)
                     {
@@ -28,6 +28,7 @@
 #include <AzCore/std/string/fixed_string.h>
 #include <AzCore/std/string/osstring.h>
 
+#include <AzFramework/Archive/ArchivePathIndex.h>
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/Archive/ZipDirCache.h>
 
@@ -124,6 +125,8 @@ namespace AZ::IO
 
             AZStd::intrusive_ptr<INestedArchive> pArchive;
             ZipDir::CachePtr pZip;
+            // paths of the files in the archive prefixed with the bind root, nullptr if the archive can't be indexed
+            AZStd::shared_ptr<const ArchivePathIndex::MountedPaths> m_mountedPaths;
         };
         using ZipArray = AZStd::vector<PackDesc, AZ::OSStdAllocator>;
 
@@ -315,6 +318,9 @@ namespace AZ::IO
 
         ZipDir::FileEntry* FindPakFileEntry(AZStd::string_view szPath) const;
 
+        // Rebuilds the path index from the mounted archives, m_csZips needs to be locked exclusively
+        void RebuildPathIndex();
+
         void CheckFileAccess(AZStd::string_view szFilename);
 
         // this function gets the file data for the given file, if found.
@@ -354,6 +360,8 @@ namespace AZ::IO
 
         mutable AZStd::shared_mutex m_csZips;
         ZipArray m_arrZips;
+        // Resolves paths to the files of the archives in m_arrZips without locking m_csZips
+        ArchivePathIndex m_pathIndex;
 
         //////////////////////////////////////////////////////////////////////////
         // Opened files collector.
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <AzFramework/Archive/ArchivePathIndex.h>
+
+namespace AZ::IO
+{
+    namespace ArchivePathIndexInternal
+    {
+        // Continues an FNV-1a hash started with AZStd::hash_string, so that the paths of all files in an archive can be hashed
+        // with the bind root of the archive as prefix without hashing the bind root again for every file
+        static size_t ContinuePathHash(size_t hash, AZStd::string_view path)
+        {
+            constexpr size_t fnvPrime = 1099511628211ULL;
+            for (const char character : path)
+            {
+                hash ^= static_cast<size_t>(character);
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+
+        // Appends the lower case components of the path separated by forward slashes to the key.
+        // Returns false for paths with relative or empty components, the archive lookup normalizes those so they can't be indexed.
+        template<class StringType>
+        static bool AppendPathKey(StringType& key, AZ::IO::PathView path)
+        {
+            for (const AZ::IO::PathView& component : path)
+            {
+                AZStd::string_view componentString = component.Native();
+                if (componentString.empty() || componentString == "." || componentString == "..")
+                {
+                    return false;
+                }
+
+                if (!key.empty())
+                {
+                    key.push_back('/');
+                }
+                const size_t componentOffset = key.size();
+                key += componentString;
+                AZStd::to_lower(key.begin() + componentOffset, key.end());
+                AZStd::replace(key.begin() + componentOffset, key.end(), '\\', '/');
+            }
+            return true;
+        }
+
+        // Registers a lookup with the reader count of the current epoch for as long as it uses a snapshot
+        class ReaderScope
+        {
+        public:
+            ReaderScope(AZStd::atomic<uint32_t>& readerEpoch, AZStd::atomic<uint32_t>* readerCounts)
+                : m_readerCount(readerCounts[readerEpoch.load() & 1])
+            {
+                m_readerCount.fetch_add(1);
+            }
+            ~ReaderScope()
+            {
+                m_readerCount.fetch_sub(1);
+            }
+
+        private:
+            AZStd::atomic<uint32_t>& m_readerCount;
+        };
+    } // namespace ArchivePathIndexInternal
+
+    struct ArchivePathIndex::Snapshot
+    {
+        AZ_CLASS_ALLOCATOR(Snapshot, AZ::SystemAllocator, 0);
+
+        struct Entry
+        {
+            size_t m_pathHash{};
+            uint32_t m_archiveIndex{};
+            uint32_t m_pathIndex{};
+        };
+
+        AZStd::vector<MountedArchive> m_archives;
+        //! Sorted by hash, then by archive priority
+        AZStd::vector<Entry> m_entries;
+        //! False if one of the archives couldn't be indexed
+        bool m_indexed = true;
+    };
+
+    ArchivePathIndex::~ArchivePathIndex()
+    {
+        Clear();
+    }
+
+    AZStd::shared_ptr<const ArchivePathIndex::MountedPaths> ArchivePathIndex::CreateMountedPaths(ZipDir::Cache& zip, AZ::IO::PathView bindRoot)
+    {
+        const ZipDir::Cache::PathIndex* zipPaths = zip.BuildPathIndex();
+        if (!zipPaths)
+        {
+            return {};
+        }
+
+        auto paths = AZStd::make_shared<MountedPaths>();
+        if (!ArchivePathIndexInternal::AppendPathKey(paths->m_bindRootKey, bindRoot))
+        {
+            return {};
+        }
+        paths->m_zipPaths = zipPaths;
+
+        size_t prefixHash = AZStd::hash_string(paths->m_bindRootKey.begin(), paths->m_bindRootKey.size());
+        if (!paths->m_bindRootKey.empty())
+        {
+            prefixHash = ArchivePathIndexInternal::ContinuePathHash(prefixHash, "/");
+        }
+
+        paths->m_pathHashes.reserve(zipPaths->m_entries.size());
+        for (const ZipDir::Cache::PathIndex::Entry& entry : zipPaths->m_entries)
+        {
+            paths->m_pathHashes.push_back(ArchivePathIndexInternal::ContinuePathHash(prefixHash, zipPaths->GetPath(entry)));
+        }
+        return paths;
+    }
+
+    void ArchivePathIndex::Rebuild(AZStd::vector<MountedArchive> archivesByPriority)
+    {
+        auto snapshot = new Snapshot;
+        snapshot->m_archives = AZStd::move(archivesByPriority);
+
+        size_t entryCount = 0;
+        for (const MountedArchive& archive : snapshot->m_archives)
+        {
+            if (!archive.m_paths)
+            {
+                snapshot->m_indexed = false;
+                break;
+            }
+            entryCount += archive.m_paths->m_pathHashes.size();
+        }
+
+        if (snapshot->m_indexed)
+        {
+            snapshot->m_entries.reserve(entryCount);
+            for (size_t archiveIndex = 0; archiveIndex < snapshot->m_archives.size(); ++archiveIndex)
+            {
+                const AZStd::vector<size_t>& pathHashes = snapshot->m_archives[archiveIndex].m_paths->m_pathHashes;
+                for (size_t pathIndex = 0; pathIndex < pathHashes.size(); ++pathIndex)
+                {
+                    snapshot->m_entries.push_back({ pathHashes[pathIndex], aznumeric_cast<uint32_t>(archiveIndex), aznumeric_cast<uint32_t>(pathIndex) });
+                }
+            }
+
+            AZStd::sort(snapshot->m_entries.begin(), snapshot->m_entries.end(), [](const Snapshot::Entry& lhs, const Snapshot::Entry& rhs)
+            {
+                return lhs.m_pathHash < rhs.m_pathHash || (lhs.m_pathHash == rhs.m_pathHash && lhs.m_archiveIndex < rhs.m_archiveIndex);
+            });
+        }
+
+        Publish(snapshot);
+    }
+
+    void ArchivePathIndex::Clear()
+    {
+        Publish(nullptr);
+    }
+
+    void ArchivePathIndex::Publish(const Snapshot* snapshot)
+    {
+        const Snapshot* previousSnapshot = m_snapshot.exchange(snapshot);
+        if (!previousSnapshot)
+        {
+            return;
+        }
+
+        // A lookup registers with the reader count of the current epoch before it loads the snapshot, so once both counts have
+        // been seen at zero after the exchange no lookup can still use the previous snapshot. Flipping the epoch before waiting
+        // on a count sends new lookups to the other count, which keeps lookups from stalling the rebuild.
+        for (int flip = 0; flip < 2; ++flip)
+        {
+            const uint32_t previousEpoch = m_readerEpoch.fetch_add(1) & 1;
+            while (m_readerCounts[previousEpoch].load() != 0)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+        delete previousSnapshot;
+    }
+
+    auto ArchivePathIndex::Find(AZ::IO::PathView aliasedPath, bool skipInMemoryArchives, ZipDir::FileEntry*& fileEntry,
+        uint32_t& archiveFlags, ZipDir::CachePtr* zip) const -> FindResult
+    {
+        AZ::IO::FixedMaxPathString key;
+        if (!ArchivePathIndexInternal::AppendPathKey(key, aliasedPath))
+        {
+            return FindResult::NotIndexed;
+        }
+        const size_t keyHash = AZStd::hash_string(key.begin(), key.size());
+        const AZStd::string_view keyView = key;
+
+        ArchivePathIndexInternal::ReaderScope readerScope(m_readerEpoch, m_readerCounts);
+        const Snapshot* snapshot = m_snapshot.load();
+        if (!snapshot)
+        {
+            return FindResult::NotFound;
+        }
+        if (!snapshot->m_indexed)
+        {
+            return FindResult::NotIndexed;
+        }
+
+        auto entryIt = AZStd::lower_bound(snapshot->m_entries.begin(), snapshot->m_entries.end(), keyHash,
+            [](const Snapshot::Entry& entry, size_t hash) { return entry.m_pathHash < hash; });
+        for (; entryIt != snapshot->m_entries.end() && entryIt->m_pathHash == keyHash; ++entryIt)
+        {
+            const MountedArchive& archive = snapshot->m_archives[entryIt->m_archiveIndex];
+            const MountedPaths& paths = *archive.m_paths;
+            const ZipDir::Cache::PathIndex::Entry& zipEntry = paths.m_zipPaths->m_entries[entryIt->m_pathIndex];
+
+            // Rule out hash collisions, the key is the bind root key followed by the path in the archive
+            AZStd::string_view relativeKey = keyView;
+            if (!paths.m_bindRootKey.empty())
+            {
+                if (!relativeKey.starts_with(paths.m_bindRootKey) || relativeKey.size() <= paths.m_bindRootKey.size()
+                    || relativeKey[paths.m_bindRootKey.size()] != '/')
+                {
+                    continue;
+                }
+                relativeKey.remove_prefix(paths.m_bindRootKey.size() + 1);
+            }
+            if (relativeKey != paths.m_zipPaths->GetPath(zipEntry))
+            {
+                continue;
+            }
+
+            const uint32_t flags = archive.m_archive->GetFlags();
+            if (skipInMemoryArchives && (flags & INestedArchive::FLAGS_IN_MEMORY_MASK))
+            {
+                continue;
+            }
+            if (flags & INestedArchive::FLAGS_DISABLE_PAK)
+            {
+                continue;
+            }
+
+            // The key is lower case, the bind root still needs to match the way the archive scan compares it
+            auto [bindRootIter, pathIter] = AZStd::mismatch(archive.m_bindRoot.begin(), archive.m_bindRoot.end(),
+                aliasedPath.begin(), aliasedPath.end());
+            if (bindRootIter != archive.m_bindRoot.end())
+            {
+                continue;
+            }
+
+            fileEntry = zipEntry.m_fileEntry;
+            archiveFlags = flags;
+            if (zip)
+            {
+                *zip = archive.m_zip;
+            }
+            return FindResult::Found;
+        }
+        return FindResult::NotFound;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+
+namespace AZ::IO
+{
+    //! Maps the hash of a full aliased path, the bind root of a mounted archive followed by the path of a file inside it,
+    //! to the mounted archives and file entries that the path resolves to. Finding a file in the mounted archives then costs
+    //! one hash and a binary search instead of a directory tree walk in every mounted archive.
+    //!
+    //! The index is rebuilt as an immutable snapshot whenever archives are mounted or unmounted. Lookups don't take any locks,
+    //! they register with one of two reader counts and a rebuild waits for the readers of the previous snapshot to leave it
+    //! before deleting it, so rebuilds never wait on lookups that start after they publish the new snapshot.
+    class ArchivePathIndex
+    {
+    public:
+        //! Hashes of the paths of the files in a mounted archive, prefixed with the bind root of the archive.
+        //! Created once when the archive is mounted so that rebuilding the index only needs to merge the archives.
+        struct MountedPaths
+        {
+            //! Lower case bind root with the path components separated by forward slashes.
+            AZStd::string m_bindRootKey;
+            //! Path index of the archive, kept alive by the cache of the mounted archive.
+            const ZipDir::Cache::PathIndex* m_zipPaths{};
+            //! Hash of the full path of every entry in m_zipPaths, in the same order.
+            AZStd::vector<size_t> m_pathHashes;
+        };
+
+        struct MountedArchive
+        {
+            AZ::IO::Path m_bindRoot;
+            AZStd::intrusive_ptr<INestedArchive> m_archive;
+            ZipDir::CachePtr m_zip;
+            AZStd::shared_ptr<const MountedPaths> m_paths;
+        };
+
+        enum class FindResult
+        {
+            Found,
+            NotFound,
+            //! The path or one of the mounted archives can't be resolved through the index, the archives need to be scanned.
+            NotIndexed
+        };
+
+        ArchivePathIndex() = default;
+        ArchivePathIndex(const ArchivePathIndex&) = delete;
+        ArchivePathIndex& operator=(const ArchivePathIndex&) = delete;
+        ~ArchivePathIndex();
+
+        //! Builds the paths for an archive mounted at the bind root, returns nullptr if the archive can't be indexed.
+        static AZStd::shared_ptr<const MountedPaths> CreateMountedPaths(ZipDir::Cache& zip, AZ::IO::PathView bindRoot);
+
+        //! Replaces the index with one built from the mounted archives, ordered from the highest to the lowest priority.
+        //! Calls to Rebuild and Clear need to be serialized by the caller, Find can be called concurrently.
+        void Rebuild(AZStd::vector<MountedArchive> archivesByPriority);
+        void Clear();
+
+        //! Finds the file in the highest priority archive that contains it, skipping the archives that are disabled and,
+        //! if requested, the archives loaded to memory, the same way a scan over the mounted archives would.
+        FindResult Find(AZ::IO::PathView aliasedPath, bool skipInMemoryArchives, ZipDir::FileEntry*& fileEntry,
+            uint32_t& archiveFlags, ZipDir::CachePtr* zip) const;
+
+    private:
+        struct Snapshot;
+
+        void Publish(const Snapshot* snapshot);
+
+        AZStd::atomic<const Snapshot*> m_snapshot{ nullptr };
+        mutable AZStd::atomic<uint32_t> m_readerEpoch{ 0 };
+        mutable AZStd::atomic<uint32_t> m_readerCounts[2]{ {0}, {0} };
+    };
+} // namespace AZ::IO
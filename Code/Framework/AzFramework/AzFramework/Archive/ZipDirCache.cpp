@@ -10,6 +10,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -182,6 +183,11 @@ namespace AZ::IO::ZipDir
             }
         }
         m_allocator = nullptr;
+        {
+            AZStd::scoped_lock lock(m_pathIndexMutex);
+            m_pathIndexView.store(nullptr, AZStd::memory_order_release);
+            m_pathIndex.reset();
+        }
         m_treeDir.Clear();
     }
 
@@ -773,8 +779,30 @@ namespace AZ::IO::ZipDir
         AZ::StringFunc::Path::Normalize(szPath);
         AZStd::to_lower(AZStd::begin(szPath), AZStd::end(szPath));
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry{};
+        if (const PathIndex* pathIndex = GetPathIndex(); pathIndex)
+        {
+            // Split the path the same way FindExact walks the directory tree, the index stores the paths with forward slashes
+            AZ::IO::PathString indexPath;
+            AZStd::string_view remainingPath = szPath;
+            bool firstPathEntry = true;
+            for (AZStd::optional<AZStd::string_view> pathEntry = AZ::StringFunc::TokenizeNext(remainingPath, AZ_CORRECT_AND_WRONG_FILESYSTEM_SEPARATOR);
+                pathEntry; pathEntry = AZ::StringFunc::TokenizeNext(remainingPath, AZ_CORRECT_AND_WRONG_FILESYSTEM_SEPARATOR))
+            {
+                if (!firstPathEntry)
+                {
+                    indexPath.push_back('/');
+                }
+                indexPath += *pathEntry;
+                firstPathEntry = false;
+            }
+            fileEntry = pathIndex->Find(indexPath);
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
@@ -786,10 +814,79 @@ namespace AZ::IO::ZipDir
         return fileEntry;
     }
 
+    FileEntry* Cache::PathIndex::Find(AZStd::string_view path) const
+    {
+        const size_t pathHash = AZStd::hash_string(path.begin(), path.size());
+        auto entryIt = AZStd::lower_bound(m_entries.begin(), m_entries.end(), pathHash,
+            [](const Entry& entry, size_t hash) { return entry.m_pathHash < hash; });
+        for (; entryIt != m_entries.end() && entryIt->m_pathHash == pathHash; ++entryIt)
+        {
+            if (GetPath(*entryIt) == path)
+            {
+                return entryIt->m_fileEntry;
+            }
+        }
+        return nullptr;
+    }
+
+    const Cache::PathIndex* Cache::BuildPathIndex()
+    {
+        if (!(m_nFlags & FLAGS_READ_ONLY))
+        {
+            return nullptr;
+        }
+
+        AZStd::scoped_lock lock(m_pathIndexMutex);
+        if (m_pathIndex)
+        {
+            return m_pathIndex.get();
+        }
+
+        auto pathIndex = AZStd::make_unique<PathIndex>();
+        pathIndex->m_entries.reserve(m_treeDir.NumFilesTotal());
+
+        // walk the directory tree depth first, directoryPath holds the path of the current directory with a trailing slash
+        AZStd::string directoryPath;
+        auto AddDirectory = [&pathIndex, &directoryPath](FileEntryTree* directory, auto& addDirectory) -> void
+        {
+            for (auto fileIt = directory->GetFileBegin(); fileIt != directory->GetFileEnd(); ++fileIt)
+            {
+                PathIndex::Entry& entry = pathIndex->m_entries.emplace_back();
+                entry.m_pathOffset = aznumeric_cast<uint32_t>(pathIndex->m_paths.size());
+                pathIndex->m_paths += directoryPath;
+                pathIndex->m_paths += directory->GetFileName(fileIt);
+                entry.m_pathLength = aznumeric_cast<uint32_t>(pathIndex->m_paths.size() - entry.m_pathOffset);
+                entry.m_pathHash = AZStd::hash_string(pathIndex->m_paths.begin() + entry.m_pathOffset, entry.m_pathLength);
+                entry.m_fileEntry = directory->GetFileEntry(fileIt);
+            }
+            for (auto dirIt = directory->GetDirBegin(); dirIt != directory->GetDirEnd(); ++dirIt)
+            {
+                const size_t parentPathLength = directoryPath.size();
+                directoryPath += directory->GetDirName(dirIt);
+                directoryPath.push_back('/');
+                addDirectory(directory->GetDirEntry(dirIt), addDirectory);
+                directoryPath.resize(parentPathLength);
+            }
+        };
+        AddDirectory(&m_treeDir, AddDirectory);
+
+        AZStd::sort(pathIndex->m_entries.begin(), pathIndex->m_entries.end(),
+            [](const PathIndex::Entry& lhs, const PathIndex::Entry& rhs) { return lhs.m_pathHash < rhs.m_pathHash; });
+
+        m_pathIndex = AZStd::move(pathIndex);
+        m_pathIndexView.store(m_pathIndex.get(), AZStd::memory_order_release);
+        return m_pathIndex.get();
+    }
+
     // returns the size of memory occupied by the instance referred to by this cache
     size_t Cache::GetSize() const
     {
-        return sizeof(*this) + m_strFilePath.capacity() + m_treeDir.GetSize() - sizeof(m_treeDir);
+        size_t pathIndexSize = 0;
+        if (const PathIndex* pathIndex = GetPathIndex(); pathIndex)
+        {
+            pathIndexSize = sizeof(PathIndex) + pathIndex->m_paths.capacity() + pathIndex->m_entries.capacity() * sizeof(PathIndex::Entry);
+        }
+        return sizeof(*this) + m_strFilePath.capacity() + m_treeDir.GetSize() - sizeof(m_treeDir) + pathIndexSize;
     }
 
     // refreshes information about the given file entry into this file entry
@@ -17,7 +17,10 @@
 
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -31,6 +34,31 @@ namespace AZ::IO::ZipDir
     {
     public:
         AZ_CLASS_ALLOCATOR(Cache, AZ::SystemAllocator, 0);
+
+        //! Flat index of the files in a read only archive, sorted by the hash of their path relative to the archive root.
+        //! Paths are stored the way they appear in the directory tree, with directories separated by forward slashes.
+        struct PathIndex
+        {
+            struct Entry
+            {
+                size_t m_pathHash{};
+                uint32_t m_pathOffset{};
+                uint32_t m_pathLength{};
+                FileEntry* m_fileEntry{};
+            };
+
+            AZStd::string_view GetPath(const Entry& entry) const
+            {
+                return AZStd::string_view(m_paths).substr(entry.m_pathOffset, entry.m_pathLength);
+            }
+
+            //! Returns the file with the given path, the path needs to be in the same form as the stored paths.
+            FileEntry* Find(AZStd::string_view path) const;
+
+            AZStd::string m_paths;
+            AZStd::vector<Entry> m_entries;
+        };
+
         // the size of the buffer that's using during re-linking the zip file
         inline static constexpr size_t g_nSizeRelinkBuffer = 1024 * 1024;
         inline static constexpr size_t g_nMaxItemsRelinkBuffer = 128; // max number of files to read before (without) writing
@@ -79,6 +107,15 @@ namespace AZ::IO::ZipDir
 
         FileEntry* FindFile(AZStd::string_view szPath, bool bFullInfo = false);
 
+        // builds the path index used by FindFile, the directory tree of read only archives can't change so it's built at most once.
+        // returns nullptr for archives that can be written to
+        const PathIndex* BuildPathIndex();
+        // returns the path index if it has been built
+        const PathIndex* GetPathIndex() const
+        {
+            return m_pathIndexView.load(AZStd::memory_order_acquire);
+        }
+
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
 
         void Free(void* ptr)
@@ -137,6 +174,11 @@ namespace AZ::IO::ZipDir
         AZ::IAllocatorAllocate* m_allocator;
         AZStd::string m_strFilePath;
 
+        // Built on demand for read only archives, see BuildPathIndex
+        AZStd::mutex m_pathIndexMutex;
+        AZStd::unique_ptr<PathIndex> m_pathIndex;
+        AZStd::atomic<const PathIndex*> m_pathIndexView{ nullptr };
+
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZStd::string> m_relativePathPool;
 
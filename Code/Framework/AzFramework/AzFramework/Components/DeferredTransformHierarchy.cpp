@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/DeferredTransformHierarchy.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    AZ_CVAR(bool, az_deferredTransformHierarchy, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Resolve the world transforms of game entities once per frame and send one change notification per entity and frame. "
+        "Applies to transform components that activate after it is set.");
+
+    namespace DeferredTransformHierarchyInternal
+    {
+        //! Levels with fewer slots are resolved on the calling thread.
+        static constexpr AZ::u32 MinSlotsPerJob = 1024;
+        //! Change notifications can move other entities, those moves are resolved in the same frame up to this many times.
+        static constexpr int MaxResolvePassesPerFrame = 4;
+    } // namespace DeferredTransformHierarchyInternal
+
+    void DeferredTransformHierarchy::Connect()
+    {
+        AZ::Interface<DeferredTransformHierarchy>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void DeferredTransformHierarchy::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<DeferredTransformHierarchy>::Unregister(this);
+
+        // Components that are still active go back to updating their transforms eagerly
+        for (AZ::u32 slot = 0; slot < m_components.size(); ++slot)
+        {
+            if (TransformComponent* component = m_components[slot])
+            {
+                ResolveWorldTM(slot, component->m_worldTM);
+                component->m_deferredHierarchy = nullptr;
+                component->m_deferredSlot = InvalidSlot;
+            }
+        }
+
+        m_localTMs = {};
+        m_worldTMs = {};
+        m_parentSlots = {};
+        m_childCounts = {};
+        m_dirtyStates = {};
+        m_worldChanged = {};
+        m_components = {};
+        m_levelOffsets = {};
+        m_changedSlots = {};
+        m_dirtyCount = 0;
+        m_sorted = true;
+        m_worldTransformsSynced = false;
+    }
+
+    bool DeferredTransformHierarchy::IsEnabled() const
+    {
+        return az_deferredTransformHierarchy;
+    }
+
+    AZ::u32 DeferredTransformHierarchy::Register(TransformComponent& component)
+    {
+        const AZ::u32 slot = aznumeric_cast<AZ::u32>(m_components.size());
+        m_localTMs.push_back(component.m_localTM);
+        m_worldTMs.push_back(component.m_worldTM);
+        m_parentSlots.push_back(InvalidSlot);
+        m_childCounts.push_back(0);
+        m_dirtyStates.push_back(DirtyState::Clean);
+        m_worldChanged.push_back(0);
+        m_components.push_back(&component);
+        m_sorted = false;
+        return slot;
+    }
+
+    void DeferredTransformHierarchy::Unregister(AZ::u32 slot)
+    {
+        // Children unlink themselves when their parent deactivates, this only happens if a child missed that
+        if (m_childCounts[slot] != 0)
+        {
+            for (AZ::u32 childSlot = 0; childSlot < m_parentSlots.size(); ++childSlot)
+            {
+                if (m_parentSlots[childSlot] == slot)
+                {
+                    m_parentSlots[childSlot] = InvalidSlot;
+                    MarkDirty(childSlot, DirtyState::LocalChanged);
+                }
+            }
+            m_childCounts[slot] = 0;
+        }
+
+        SetParentSlot(slot, InvalidSlot);
+        if (m_dirtyStates[slot] != DirtyState::Clean)
+        {
+            m_dirtyStates[slot] = DirtyState::Clean;
+            --m_dirtyCount;
+        }
+        m_components[slot] = nullptr;
+        m_sorted = false;
+    }
+
+    void DeferredTransformHierarchy::SetParentSlot(AZ::u32 slot, AZ::u32 parentSlot)
+    {
+        const AZ::u32 previousParentSlot = m_parentSlots[slot];
+        if (previousParentSlot == parentSlot)
+        {
+            return;
+        }
+
+        if (previousParentSlot != InvalidSlot)
+        {
+            --m_childCounts[previousParentSlot];
+        }
+        if (parentSlot != InvalidSlot)
+        {
+            ++m_childCounts[parentSlot];
+        }
+        m_parentSlots[slot] = parentSlot;
+        m_sorted = false;
+        m_worldTransformsSynced = false;
+    }
+
+    void DeferredTransformHierarchy::SetLocalTM(AZ::u32 slot, const AZ::Transform& localTM)
+    {
+        m_localTMs[slot] = localTM;
+        MarkDirty(slot, DirtyState::LocalChanged);
+    }
+
+    void DeferredTransformHierarchy::SetLocalAndWorldTM(AZ::u32 slot, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        m_localTMs[slot] = localTM;
+        m_worldTMs[slot] = worldTM;
+        MarkDirty(slot, DirtyState::WorldChanged);
+    }
+
+    void DeferredTransformHierarchy::MarkParentChanged(AZ::u32 slot)
+    {
+        MarkDirty(slot, DirtyState::LocalChanged);
+    }
+
+    void DeferredTransformHierarchy::MarkDirty(AZ::u32 slot, DirtyState dirtyState)
+    {
+        m_worldTransformsSynced = false;
+        if (m_dirtyStates[slot] == DirtyState::Clean)
+        {
+            ++m_dirtyCount;
+        }
+        m_dirtyStates[slot] = dirtyState;
+    }
+
+    bool DeferredTransformHierarchy::ResolveWorldTM(AZ::u32 slot, AZ::Transform& worldTM) const
+    {
+        if (m_dirtyCount == 0)
+        {
+            worldTM = m_worldTMs[slot];
+            return false;
+        }
+
+        // Find the highest dirty slot on the path to the root, everything below it needs to be recomputed
+        AZ::u32 dirtySlot = InvalidSlot;
+        for (AZ::u32 pathSlot = slot; pathSlot != InvalidSlot; pathSlot = m_parentSlots[pathSlot])
+        {
+            if (m_dirtyStates[pathSlot] != DirtyState::Clean)
+            {
+                dirtySlot = pathSlot;
+            }
+        }
+
+        if (dirtySlot == InvalidSlot)
+        {
+            worldTM = m_worldTMs[slot];
+            return false;
+        }
+
+        // Combine the local transforms below the dirty slot bottom up, so no scratch memory is needed to walk the path top down
+        AZ::Transform pathTM = AZ::Transform::CreateIdentity();
+        for (AZ::u32 pathSlot = slot; pathSlot != dirtySlot; pathSlot = m_parentSlots[pathSlot])
+        {
+            pathTM = m_localTMs[pathSlot] * pathTM;
+        }
+
+        const AZ::u32 parentSlot = m_parentSlots[dirtySlot];
+        AZ::Transform resolvedTM;
+        if (m_dirtyStates[dirtySlot] == DirtyState::WorldChanged)
+        {
+            resolvedTM = m_worldTMs[dirtySlot];
+        }
+        else
+        {
+            resolvedTM = parentSlot != InvalidSlot ? m_worldTMs[parentSlot] * m_localTMs[dirtySlot] : ComputeRootWorldTM(dirtySlot);
+        }
+        worldTM = resolvedTM * pathTM;
+        return true;
+    }
+
+    AZ::Transform DeferredTransformHierarchy::ComputeRootWorldTM(AZ::u32 slot) const
+    {
+        // Same as TransformComponent::ComputeWorldTM for a parent that isn't in the hierarchy
+        const TransformComponent* component = m_components[slot];
+        if (component->m_parentTM)
+        {
+            return component->m_parentTM->GetWorldTM() * m_localTMs[slot];
+        }
+        if (!component->m_parentActive)
+        {
+            return m_localTMs[slot];
+        }
+        return m_worldTMs[slot];
+    }
+
+    void DeferredTransformHierarchy::SortByDepth()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        const AZ::u32 slotCount = aznumeric_cast<AZ::u32>(m_components.size());
+
+        // Compute the depth of every registered slot, walking up only to the first ancestor whose depth is known
+        AZStd::vector<AZ::u32> depths(slotCount, InvalidSlot);
+        AZStd::vector<AZ::u32> levelCounts;
+        AZStd::vector<AZ::u32> path;
+        for (AZ::u32 slot = 0; slot < slotCount; ++slot)
+        {
+            if (!m_components[slot] || depths[slot] != InvalidSlot)
+            {
+                continue;
+            }
+
+            path.clear();
+            AZ::u32 ancestorSlot = slot;
+            while (ancestorSlot != InvalidSlot && depths[ancestorSlot] == InvalidSlot && path.size() <= slotCount)
+            {
+                path.push_back(ancestorSlot);
+                ancestorSlot = m_parentSlots[ancestorSlot];
+            }
+            AZ_Assert(path.size() <= slotCount, "Circular parenting in the deferred transform hierarchy.");
+
+            AZ::u32 depth = ancestorSlot != InvalidSlot ? depths[ancestorSlot] + 1 : 0;
+            for (size_t pathIndex = path.size(); pathIndex-- > 0; ++depth)
+            {
+                depths[path[pathIndex]] = depth;
+                if (depth >= levelCounts.size())
+                {
+                    levelCounts.resize(depth + 1, 0);
+                }
+                ++levelCounts[depth];
+            }
+        }
+
+        // Counting sort by depth, unregistered slots are dropped
+        m_levelOffsets.resize(levelCounts.size() + 1);
+        m_levelOffsets[0] = 0;
+        for (size_t level = 0; level < levelCounts.size(); ++level)
+        {
+            m_levelOffsets[level + 1] = m_levelOffsets[level] + levelCounts[level];
+        }
+        const AZ::u32 sortedCount = m_levelOffsets.back();
+
+        AZStd::vector<AZ::u32> sortedSlots(slotCount, InvalidSlot);
+        AZStd::vector<AZ::u32> levelCursors(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+        for (AZ::u32 slot = 0; slot < slotCount; ++slot)
+        {
+            if (m_components[slot])
+            {
+                sortedSlots[slot] = levelCursors[depths[slot]]++;
+            }
+        }
+
+        AZStd::vector<AZ::Transform> localTMs(sortedCount);
+        AZStd::vector<AZ::Transform> worldTMs(sortedCount);
+        AZStd::vector<AZ::u32> parentSlots(sortedCount);
+        AZStd::vector<AZ::u32> childCounts(sortedCount, 0);
+        AZStd::vector<DirtyState> dirtyStates(sortedCount);
+        AZStd::vector<TransformComponent*> components(sortedCount);
+        for (AZ::u32 slot = 0; slot < slotCount; ++slot)
+        {
+            const AZ::u32 sortedSlot = sortedSlots[slot];
+            if (sortedSlot == InvalidSlot)
+            {
+                continue;
+            }
+
+            localTMs[sortedSlot] = m_localTMs[slot];
+            worldTMs[sortedSlot] = m_worldTMs[slot];
+            dirtyStates[sortedSlot] = m_dirtyStates[slot];
+            components[sortedSlot] = m_components[slot];
+            components[sortedSlot]->m_deferredSlot = sortedSlot;
+
+            const AZ::u32 parentSlot = m_parentSlots[slot];
+            parentSlots[sortedSlot] = parentSlot != InvalidSlot ? sortedSlots[parentSlot] : InvalidSlot;
+            if (parentSlot != InvalidSlot)
+            {
+                ++childCounts[sortedSlots[parentSlot]];
+            }
+        }
+
+        m_localTMs = AZStd::move(localTMs);
+        m_worldTMs = AZStd::move(worldTMs);
+        m_parentSlots = AZStd::move(parentSlots);
+        m_childCounts = AZStd::move(childCounts);
+        m_dirtyStates = AZStd::move(dirtyStates);
+        m_components = AZStd::move(components);
+        m_worldChanged.assign(sortedCount, 0);
+        m_sorted = true;
+    }
+
+    void DeferredTransformHierarchy::ResolveLevel(AZ::u32 levelBegin, AZ::u32 levelEnd)
+    {
+        // Parents are on the previous level, which is resolved already
+        for (AZ::u32 slot = levelBegin; slot < levelEnd; ++slot)
+        {
+            const AZ::u32 parentSlot = m_parentSlots[slot];
+            const bool parentChanged = parentSlot != InvalidSlot && m_worldChanged[parentSlot];
+            if (parentChanged || m_dirtyStates[slot] == DirtyState::LocalChanged)
+            {
+                m_worldTMs[slot] = parentSlot != InvalidSlot ? m_worldTMs[parentSlot] * m_localTMs[slot] : ComputeRootWorldTM(slot);
+                m_worldChanged[slot] = 1;
+            }
+            else if (m_dirtyStates[slot] == DirtyState::WorldChanged)
+            {
+                m_worldChanged[slot] = 1;
+            }
+        }
+    }
+
+    void DeferredTransformHierarchy::ProcessTransformChanges()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        using namespace DeferredTransformHierarchyInternal;
+
+        for (int pass = 0; pass < MaxResolvePassesPerFrame && m_dirtyCount != 0; ++pass)
+        {
+            ResolveLevels();
+
+            m_changedSlots.clear();
+            for (AZ::u32 slot = 0; slot < m_worldChanged.size(); ++slot)
+            {
+                if (m_worldChanged[slot])
+                {
+                    m_changedSlots.push_back(slot);
+                    m_worldChanged[slot] = 0;
+                }
+                m_dirtyStates[slot] = DirtyState::Clean;
+            }
+            m_dirtyCount = 0;
+
+            NotifyChangedSlots();
+        }
+    }
+
+    void DeferredTransformHierarchy::SyncWorldTransforms()
+    {
+        if (!NeedsWorldTransformSync())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        ResolveLevels();
+
+        // The slots stay dirty, so the next ProcessTransformChanges resolves them again and sends the notifications
+        for (AZ::u32 slot = 0; slot < m_worldChanged.size(); ++slot)
+        {
+            if (m_worldChanged[slot])
+            {
+                if (TransformComponent* component = m_components[slot])
+                {
+                    component->m_worldTM = m_worldTMs[slot];
+                }
+                m_worldChanged[slot] = 0;
+            }
+        }
+        m_worldTransformsSynced = true;
+    }
+
+    void DeferredTransformHierarchy::ResolveLevels()
+    {
+        using namespace DeferredTransformHierarchyInternal;
+
+        if (!m_sorted)
+        {
+            SortByDepth();
+        }
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const bool useJobs = jobContext != nullptr && jobContext->GetJobManager().GetCurrentJob() == nullptr;
+        const AZ::u32 workerCount = useJobs ? jobContext->GetJobManager().GetNumWorkerThreads() : 1;
+
+        for (size_t level = 0; level + 1 < m_levelOffsets.size(); ++level)
+        {
+            const AZ::u32 levelBegin = m_levelOffsets[level];
+            const AZ::u32 levelEnd = m_levelOffsets[level + 1];
+            const AZ::u32 jobCount = AZStd::min((levelEnd - levelBegin) / MinSlotsPerJob, workerCount);
+            if (jobCount < 2)
+            {
+                ResolveLevel(levelBegin, levelEnd);
+                continue;
+            }
+
+            AZ_PROFILE_SCOPE(AzFramework, "DeferredTransformHierarchy::ResolveLevelJobs");
+            AZ::JobCompletion jobCompletion(jobContext);
+            const AZ::u32 slotsPerJob = (levelEnd - levelBegin + jobCount - 1) / jobCount;
+            for (AZ::u32 jobBegin = levelBegin; jobBegin < levelEnd; jobBegin += slotsPerJob)
+            {
+                const AZ::u32 jobEnd = AZStd::min(jobBegin + slotsPerJob, levelEnd);
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [this, jobBegin, jobEnd]()
+                    {
+                        ResolveLevel(jobBegin, jobEnd);
+                    },
+                    true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
+    void DeferredTransformHierarchy::NotifyChangedSlots()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        // Every component gets its world transform before any notification is sent,
+        // so that the handlers read the resolved transforms of the other entities too
+        for (const AZ::u32 slot : m_changedSlots)
+        {
+            m_components[slot]->m_worldTM = m_worldTMs[slot];
+        }
+
+        // Handlers can move or deactivate entities, which only marks slots dirty or clears their component until the next resolve
+        for (const AZ::u32 slot : m_changedSlots)
+        {
+            if (TransformComponent* component = m_components[slot])
+            {
+                component->NotifyTransformChanged();
+            }
+        }
+    }
+
+    void DeferredTransformHierarchy::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformChanges();
+    }
+
+    int DeferredTransformHierarchy::GetTickOrder()
+    {
+        // After the game and UI tick handlers, before the renderer which ticks at TICK_LAST
+        return AZ::TICK_LAST - 1;
+    }
+} // namespace AzFramework
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Resolves the world transforms of transform components once per frame instead of every time a transform is set.
+    //!
+    //! The local and world transforms of the registered components are stored in arrays sorted by depth in the transform
+    //! hierarchy. Setting a transform only marks it dirty. Before the frame is rendered the world transforms are resolved
+    //! level by level, each level in parallel, and every entity whose world transform changed is notified once through the
+    //! TransformNotificationBus and its TransformChangedEvent, no matter how often it or its ancestors moved during the frame.
+    //!
+    //! The TransformBus stays compatible: reading the world transform of a component while changes are pending resolves it
+    //! from its ancestors. Only the time at which change notifications are sent differs from eager updates.
+    //! Resolving stores the result in the component, so world transforms must only be read from the main thread while changes
+    //! are pending. Code that reads transforms from jobs calls SyncWorldTransforms before starting them.
+    //! Enabled with the az_deferredTransformHierarchy CVar, which applies to transform components that activate after it is set.
+    class DeferredTransformHierarchy
+        : private AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(DeferredTransformHierarchy, "{FCBA0C89-0F6C-4636-B3D9-EBE06A07E8C1}");
+        AZ_CLASS_ALLOCATOR(DeferredTransformHierarchy, AZ::SystemAllocator, 0);
+
+        static constexpr AZ::u32 InvalidSlot = AZStd::numeric_limits<AZ::u32>::max();
+
+        DeferredTransformHierarchy() = default;
+        virtual ~DeferredTransformHierarchy() = default;
+
+        void Connect();
+        void Disconnect();
+
+        //! Returns true if transform components that activate now should register with the hierarchy.
+        bool IsEnabled() const;
+
+        //! Resolves the pending changes and notifies the entities whose world transform changed.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        void ProcessTransformChanges();
+
+        //! Returns true if transforms were set since the last call to ProcessTransformChanges.
+        bool HasPendingChanges() const { return m_dirtyCount != 0; }
+
+        //! Writes the resolved world transforms into the components without sending change notifications, which are still sent
+        //! by the next ProcessTransformChanges. Until another transform is set, world transforms can be read from any thread.
+        //! Only call this from the main thread.
+        void SyncWorldTransforms();
+
+        //! Returns true if reading a world transform would resolve it, which is only safe on the main thread.
+        bool NeedsWorldTransformSync() const { return m_dirtyCount != 0 && !m_worldTransformsSynced; }
+
+    private:
+        friend class TransformComponent;
+
+        enum class DirtyState : AZ::u8
+        {
+            Clean,
+            //! The world transform needs to be computed from the local transform.
+            LocalChanged,
+            //! The world transform was set, it's kept unless an ancestor changed too.
+            WorldChanged
+        };
+
+        //! Methods used by the registered transform components. Slots are renumbered when the hierarchy is sorted,
+        //! which updates the slot stored in the component.
+        //! @{
+        AZ::u32 Register(TransformComponent& component);
+        void Unregister(AZ::u32 slot);
+        //! Links the slot to the slot of its parent, or unlinks it when passing InvalidSlot.
+        void SetParentSlot(AZ::u32 slot, AZ::u32 parentSlot);
+        void SetLocalTM(AZ::u32 slot, const AZ::Transform& localTM);
+        void SetLocalAndWorldTM(AZ::u32 slot, const AZ::Transform& localTM, const AZ::Transform& worldTM);
+        //! Called when the parent of a slot isn't in the hierarchy and has moved.
+        void MarkParentChanged(AZ::u32 slot);
+        AZ::u32 GetParentSlot(AZ::u32 slot) const { return m_parentSlots[slot]; }
+        //! Writes the world transform of the slot, including the pending changes of the slot and its ancestors.
+        //! Returns true if there were pending changes for the slot or one of its ancestors.
+        //! Only reads the hierarchy, so it can be called from multiple threads as long as no transforms are set at the same time.
+        bool ResolveWorldTM(AZ::u32 slot, AZ::Transform& worldTM) const;
+        //! @}
+
+        // TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        void MarkDirty(AZ::u32 slot, DirtyState dirtyState);
+        //! Sorts the slots by depth so that every level can be resolved in one pass over contiguous slots.
+        void SortByDepth();
+        //! Resolves the world transforms of all levels without clearing the dirty states.
+        void ResolveLevels();
+        void ResolveLevel(AZ::u32 levelBegin, AZ::u32 levelEnd);
+        //! Computes the world transform of a slot without a parent in the hierarchy, the way the component would.
+        AZ::Transform ComputeRootWorldTM(AZ::u32 slot) const;
+        void NotifyChangedSlots();
+
+        //! Arrays indexed by slot.
+        //! @{
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<AZ::u32> m_parentSlots;
+        AZStd::vector<AZ::u32> m_childCounts;
+        AZStd::vector<DirtyState> m_dirtyStates;
+        //! Set for the slots whose world transform changed while resolving.
+        AZStd::vector<AZ::u8> m_worldChanged;
+        //! nullptr for the slots of unregistered components until the hierarchy is sorted again.
+        AZStd::vector<TransformComponent*> m_components;
+        //! @}
+
+        //! First slot of every depth in the hierarchy, followed by the slot count. Valid while m_sorted is true.
+        AZStd::vector<AZ::u32> m_levelOffsets;
+        //! Slots whose world transform changed in the last resolve, in depth order.
+        AZStd::vector<AZ::u32> m_changedSlots;
+        AZ::u32 m_dirtyCount = 0;
+        bool m_sorted = true;
+        //! Set by SyncWorldTransforms until the next transform change.
+        bool m_worldTransformsSynced = false;
+    };
+} // namespace AzFramework
@@ -139,6 +139,10 @@ namespace AzFramework
         {
             config->m_localTransform = m_localTM;
             config->m_worldTransform = m_worldTM;
+            if (m_deferredHierarchy)
+            {
+                m_deferredHierarchy->ResolveWorldTM(m_deferredSlot, config->m_worldTransform);
+            }
             config->m_parentId = m_parentId;
             config->m_parentActivationTransformMode = m_parentActivationTransformMode;
             config->m_isStatic = m_isStatic;
@@ -152,12 +156,21 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        DeferredTransformHierarchy* deferredHierarchy = AZ::Interface<DeferredTransformHierarchy>::Get();
+        if (deferredHierarchy && deferredHierarchy->IsEnabled())
+        {
+            m_deferredHierarchy = deferredHierarchy;
+            m_deferredSlot = deferredHierarchy->Register(*this);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
 
     void TransformComponent::Deactivate()
     {
+        UnregisterFromDeferredHierarchy();
+
         EBUS_EVENT_ID(m_parentId, AZ::TransformNotificationBus, OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -195,6 +208,15 @@ namespace AzFramework
         m_childChangedEvent.Signal(changeType, entityId);
     }
 
+    const AZ::Transform& TransformComponent::GetWorldTM()
+    {
+        if (m_deferredHierarchy && m_deferredHierarchy->NeedsWorldTransformSync())
+        {
+            m_deferredHierarchy->ResolveWorldTM(m_deferredSlot, m_worldTM);
+        }
+        return m_worldTM;
+    }
+
     void TransformComponent::SetLocalTM(const AZ::Transform& tm)
     {
         if (AreMoveRequestsAllowed())
@@ -223,7 +245,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
@@ -237,7 +259,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetTranslation();
+        return GetWorldTM().GetTranslation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
@@ -247,25 +269,25 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -325,19 +347,27 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
     }
 
+    void TransformComponent::SetWorldRotationQuaternionAndTranslation(const AZ::Quaternion& rotation, const AZ::Vector3& translation)
+    {
+        AZ::Transform newWorldTransform = GetWorldTM();
+        newWorldTransform.SetRotation(rotation);
+        newWorldTransform.SetTranslation(translation);
+        SetWorldTM(newWorldTransform);
+    }
+
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        return m_worldTM.GetRotation().GetEulerRadians();
+        return GetWorldTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        return m_worldTM.GetRotation();
+        return GetWorldTM().GetRotation();
     }
 
     void TransformComponent::SetLocalRotation(const AZ::Vector3& eulerRadianAngles)
@@ -422,7 +452,7 @@ namespace AzFramework
 
     float TransformComponent::GetWorldUniformScale()
     {
-        return m_worldTM.GetUniformScale();
+        return GetWorldTM().GetUniformScale();
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetChildren()
@@ -500,8 +530,23 @@ namespace AzFramework
         AZ_Assert(parentEntity, "We expect to have a parent entity associated with the provided parent's entity Id.");
         if (parentEntity)
         {
+            if (m_deferredHierarchy)
+            {
+                // The world transform is kept or used to compute the local transform relative to the new parent
+                GetWorldTM();
+            }
+
             m_parentTM = parentEntity->GetTransform();
 
+            if (m_deferredHierarchy)
+            {
+                // Link to the parent if it's resolved by the same hierarchy, otherwise it notifies this component when it moves
+                auto* parentTransform = azrtti_cast<TransformComponent*>(m_parentTM);
+                const bool parentDeferred = parentTransform && parentTransform->m_deferredHierarchy == m_deferredHierarchy;
+                m_deferredHierarchy->SetParentSlot(
+                    m_deferredSlot, parentDeferred ? parentTransform->m_deferredSlot : DeferredTransformHierarchy::InvalidSlot);
+            }
+
             AZ_Warning("TransformComponent", !m_isStatic || m_parentTM->IsStaticTransform(),
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
                 GetEntity()->GetName().c_str(), GetEntityId().ToString().c_str());
@@ -520,6 +565,11 @@ namespace AzFramework
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        if (m_deferredHierarchy)
+        {
+            GetWorldTM();
+            m_deferredHierarchy->SetParentSlot(m_deferredSlot, DeferredTransformHierarchy::InvalidSlot);
+        }
         m_parentTM = nullptr;
         m_parentActive = false;
         ComputeLocalTM();
@@ -533,9 +583,18 @@ namespace AzFramework
             return;
         }
 
+        if (m_deferredHierarchy)
+        {
+            GetWorldTM();
+        }
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
+            if (m_deferredHierarchy)
+            {
+                m_deferredHierarchy->SetParentSlot(m_deferredSlot, DeferredTransformHierarchy::InvalidSlot);
+            }
             AZ::TransformNotificationBus::Handler::BusDisconnect();
             AZ::TransformHierarchyInformationBus::Handler::BusDisconnect();
             AZ::EntityBus::Handler::BusDisconnect();
@@ -614,6 +673,16 @@ namespace AzFramework
         // Ignore the event until we've already derived our local transform.
         if (m_parentTM)
         {
+            if (m_deferredHierarchy)
+            {
+                // A parent in the same hierarchy has been resolved already, it only notifies once its children are resolved too
+                if (m_deferredHierarchy->GetParentSlot(m_deferredSlot) == DeferredTransformHierarchy::InvalidSlot)
+                {
+                    m_deferredHierarchy->MarkParentChanged(m_deferredSlot);
+                }
+                return;
+            }
+
             m_worldTM = parentWorldTM * m_localTM;
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -631,18 +700,25 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
-        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
-        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
-
-        AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
-        if (boundsUnion != nullptr)
+        if (m_deferredHierarchy)
         {
-            boundsUnion->OnTransformUpdated(GetEntity());
+            // Notified once the hierarchy is resolved
+            m_deferredHierarchy->SetLocalAndWorldTM(m_deferredSlot, m_localTM, m_worldTM);
+            return;
         }
+
+        NotifyTransformChanged();
     }
 
     void TransformComponent::ComputeWorldTM()
     {
+        if (m_deferredHierarchy)
+        {
+            // The world transform is computed and notified once the hierarchy is resolved
+            m_deferredHierarchy->SetLocalTM(m_deferredSlot, m_localTM);
+            return;
+        }
+
         if (m_parentTM)
         {
             m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
@@ -656,6 +732,37 @@ namespace AzFramework
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    void TransformComponent::NotifyTransformChanged()
+    {
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        if (boundsUnion != nullptr)
+        {
+            boundsUnion->OnTransformUpdated(GetEntity());
+        }
+    }
+
+    void TransformComponent::UnregisterFromDeferredHierarchy()
+    {
+        if (!m_deferredHierarchy)
+        {
+            return;
+        }
+
+        // Deliver the pending notification before this component stops being resolved
+        const bool changed = m_deferredHierarchy->ResolveWorldTM(m_deferredSlot, m_worldTM);
+        m_deferredHierarchy->Unregister(m_deferredSlot);
+        m_deferredHierarchy = nullptr;
+        m_deferredSlot = DeferredTransformHierarchy::InvalidSlot;
+
+        if (changed)
+        {
+            NotifyTransformChanged();
+        }
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/DeferredTransformHierarchy.h>
 
 namespace AzToolsFramework
 {
@@ -41,6 +42,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class DeferredTransformHierarchy;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -56,9 +58,11 @@ namespace AzFramework
         //! Returns true if the tm was set to the local transform.
         const AZ::Transform& GetLocalTM() override { return m_localTM; }
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        //! With the deferred transform hierarchy pending changes are resolved first, which isn't safe to do from other threads
+        //! unless DeferredTransformHierarchy::SyncWorldTransforms was called after the last change.
+        const AZ::Transform& GetWorldTM() override;
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = GetWorldTM(); }
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -109,6 +113,7 @@ namespace AzFramework
 
         // Rotation modifiers
         void SetWorldRotationQuaternion(const AZ::Quaternion& quaternion) override;
+        void SetWorldRotationQuaternionAndTranslation(const AZ::Quaternion& rotation, const AZ::Vector3& translation) override;
 
         AZ::Vector3 GetWorldRotation() override;
         AZ::Quaternion GetWorldRotationQuaternion() override;
@@ -157,6 +162,8 @@ namespace AzFramework
         void OnTransformChangedImpl(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM);
         void ComputeLocalTM();
         void ComputeWorldTM();
+        void NotifyTransformChanged();
+        void UnregisterFromDeferredHierarchy();
         //////////////////////////////////////////////////////////////////////////
 
         //! Returns whether external calls are currently allowed to move the transform.
@@ -185,5 +192,8 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+
+        DeferredTransformHierarchy* m_deferredHierarchy = nullptr; ///< Set while the world transform is resolved by the deferred transform hierarchy.
+        AZ::u32 m_deferredSlot = DeferredTransformHierarchy::InvalidSlot; ///< Slot of this component in the deferred transform hierarchy.
     };
 }   // namespace AZ
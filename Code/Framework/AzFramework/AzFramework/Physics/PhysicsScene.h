@@ -130,6 +130,7 @@ namespace AzPhysics
         //! Make many blocking queries into the scene.
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
+        //! The requests may be processed in parallel, so their filter callbacks need to be thread safe.
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(SceneHandle sceneHandle, const SceneQueryRequests& requests) = 0;
 
@@ -341,6 +342,7 @@ namespace AzPhysics
 
         //! Make many blocking queries into the scene.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
+        //! The requests may be processed in parallel, so their filter callbacks need to be thread safe.
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(const SceneQueryRequests& requests) = 0;
 
@@ -506,6 +506,8 @@ namespace AzFramework
         , m_contextId(AZ::ScriptContextIds::DefaultScriptContextId)
         , m_script(AZ::Data::AssetLoadBehavior::PreLoad)
         , m_table(LUA_NOREF)
+        , m_threadSafeTick(false)
+        , m_isPooledTickHandler(false)
     {
         m_properties.m_name = "Properties";
     }
@@ -541,6 +543,16 @@ namespace AzFramework
         m_script = script;
     }
 
+    //=========================================================================
+    // SetThreadSafeTick
+    //=========================================================================
+    void ScriptComponent::SetThreadSafeTick(bool threadSafeTick)
+    {
+        AZ_Assert(m_entity == nullptr || m_entity->GetState() == AZ::Entity::State::Constructed, "You can't change the tick mode after the entity is initialized");
+
+        m_threadSafeTick = threadSafeTick;
+    }
+
     AZ::ScriptProperty* ScriptComponent::GetScriptProperty(const char* propertyName)
     {
         return m_properties.GetProperty(propertyName);
@@ -548,8 +560,15 @@ namespace AzFramework
 
     void ScriptComponent::Init()
     {
-        // Grab the script context
-        EBUS_EVENT_RESULT(m_context, AZ::ScriptSystemRequestBus, GetContext, m_contextId);
+        // Grab the script context, scripts with a thread safe tick run in the pooled context picked by the entity id
+        if (m_threadSafeTick && m_contextId == AZ::ScriptContextIds::DefaultScriptContextId)
+        {
+            EBUS_EVENT_RESULT(m_context, AZ::ScriptSystemRequestBus, GetPooledContext, static_cast<AZ::u64>(GetEntityId()));
+        }
+        else
+        {
+            EBUS_EVENT_RESULT(m_context, AZ::ScriptSystemRequestBus, GetContext, m_contextId);
+        }
         AZ_Assert(m_context, "We must have a valid script context!");
     }
 
@@ -648,7 +667,7 @@ namespace AzFramework
 
         // Set the metamethods as we will use the script table as a metatable for entity tables
         bool success = false;
-        EBUS_EVENT_RESULT(success, AZ::ScriptSystemRequestBus, Load, m_script, AZ::k_scriptLoadBinaryOrText, m_contextId);
+        EBUS_EVENT_RESULT(success, AZ::ScriptSystemRequestBus, Load, m_script, AZ::k_scriptLoadBinaryOrText, m_context->GetId());
         if (!success)
         {
             return false;
@@ -830,6 +849,19 @@ namespace AzFramework
             lua_pop(lua, 1); // remove the OnActivate result
         }
 
+        // Let the pooled contexts call OnTick, the script doesn't connect to the TickBus itself
+        if (m_threadSafeTick && m_context->GetId() >= AZ::ScriptContextIds::FirstPooledScriptContextId)
+        {
+            lua_pushliteral(lua, "OnTick");
+            lua_rawget(lua, baseStackIndex); // ScriptTable[OnTick]
+            if (lua_isfunction(lua, -1))
+            {
+                EBUS_EVENT(AZ::ScriptSystemRequestBus, AddPooledTickHandler, m_context, m_table);
+                m_isPooledTickHandler = true;
+            }
+            lua_pop(lua, 1); // remove the OnTick result
+        }
+
         lua_pop(lua, 2); // remove the base property table and base script table
     }
 
@@ -843,6 +875,12 @@ namespace AzFramework
             lua_State* lua = m_context->NativeContext();
             LSV_BEGIN(lua, 0);
 
+            if (m_isPooledTickHandler)
+            {
+                EBUS_EVENT(AZ::ScriptSystemRequestBus, RemovePooledTickHandler, m_context, m_table);
+                m_isPooledTickHandler = false;
+            }
+
             // call OnDeactivate
             // load table
             lua_rawgeti(lua, LUA_REGISTRYINDEX, m_table);
@@ -974,10 +1012,11 @@ namespace AzFramework
                 };
 
                 serializeContext->Class<ScriptComponent, AZ::Component>()
-                    ->Version(4, converter)
+                    ->Version(5, converter)
                     ->Field("ContextID", &ScriptComponent::m_contextId)
                     ->Field("Properties", &ScriptComponent::m_properties)
                     ->Field("Script", &ScriptComponent::m_script)
+                    ->Field("ThreadSafeTick", &ScriptComponent::m_threadSafeTick)
                     ;
 
                 serializeContext->Class<ScriptPropertyGroup>()
@@ -104,6 +104,12 @@ namespace AzFramework
         const AZ::Data::Asset<AZ::ScriptAsset>& GetScript() const       { return m_script; }
         void                                    SetScript(const AZ::Data::Asset<AZ::ScriptAsset>& script);
 
+        /// Thread safe scripts run in one of the pooled script contexts, and their OnTick(self, deltaTime, timePoint) function is called
+        /// every tick in parallel with the scripts in the other pooled contexts. Only set this for scripts that don't share state
+        /// with other scripts through Lua and only call thread safe engine functions from OnTick.
+        bool                                    IsThreadSafeTick() const        { return m_threadSafeTick; }
+        void                                    SetThreadSafeTick(bool threadSafeTick);
+
         // Methods used for unit tests
         AZ::ScriptProperty* GetScriptProperty(const char* propertyName);
 
@@ -140,6 +146,8 @@ namespace AzFramework
         AZ::ScriptContextId                 m_contextId;            ///< Id of the script context.
         AZ::Data::Asset<AZ::ScriptAsset>    m_script;               ///< Reference to the script asset used for this component.
         int                                 m_table;                ///< Cached table index
+        bool                                m_threadSafeTick;       ///< Run the script in a pooled context and call OnTick in parallel with the other pooled contexts.
+        bool                                m_isPooledTickHandler;  ///< True if OnTick of the entity table is called by the pooled contexts.
         ScriptPropertyGroup                 m_properties;           ///< List with all properties that were tweaked in the editor and should override values in the m_sourceScriptName class inside m_script.
     };        
 }   // namespace AZ
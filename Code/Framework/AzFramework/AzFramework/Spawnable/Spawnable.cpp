@@ -42,6 +42,16 @@ namespace AzFramework
         return m_metaData;
     }
 
+    void Spawnable::BuildClonePlan(AZ::SerializeContext& serializeContext)
+    {
+        m_clonePlan = AZStd::make_unique<SpawnableClonePlan>(m_entities, serializeContext);
+    }
+
+    const SpawnableClonePlan* Spawnable::GetClonePlan() const
+    {
+        return m_clonePlan.get();
+    }
+
     void Spawnable::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
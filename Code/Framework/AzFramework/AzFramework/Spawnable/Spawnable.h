@@ -13,11 +13,13 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
 
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
@@ -50,6 +52,12 @@ namespace AzFramework
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
+        //! Builds the plan used to quickly clone the entities in this spawnable. This is done automatically when the spawnable is
+        //! loaded as an asset, but needs to be called again if the list of entities is changed afterwards.
+        void BuildClonePlan(AZ::SerializeContext& serializeContext);
+        //! Returns the plan used to clone the entities in this spawnable or nullptr if no plan has been built.
+        const SpawnableClonePlan* GetClonePlan() const;
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
@@ -58,6 +66,8 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+
+        AZStd::unique_ptr<SpawnableClonePlan> m_clonePlan;
     };
 
     using SpawnableList = AZStd::vector<Spawnable>;
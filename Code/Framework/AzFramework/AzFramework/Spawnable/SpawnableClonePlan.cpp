@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
+
+namespace AzFramework
+{
+    namespace SpawnableClonePlanInternal
+    {
+        using ClassData = AZ::SerializeContext::ClassData;
+        using ClassElement = AZ::SerializeContext::ClassElement;
+
+        static constexpr int UnpatchableElementFlags = ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD;
+
+        static const ClassData* FindClassData(AZ::SerializeContext& serializeContext, const AZ::TypeId& typeId, const ClassElement* element)
+        {
+            if (element && element->m_genericClassInfo)
+            {
+                return element->m_genericClassInfo->GetClassData();
+            }
+            return serializeContext.FindClassData(typeId);
+        }
+
+        //! Returns true if an entity id can be stored anywhere in an instance of the class, including in containers and behind pointers.
+        static bool MayContainEntityId(
+            AZ::SerializeContext& serializeContext, const ClassData& classData, AZStd::unordered_set<AZ::TypeId>& visited)
+        {
+            if (classData.m_typeId == azrtti_typeid<AZ::EntityId>())
+            {
+                return true;
+            }
+            if (!visited.insert(classData.m_typeId).second)
+            {
+                // Already checked or being checked further up the stack.
+                return false;
+            }
+
+            bool result = false;
+            auto checkElement = [&serializeContext, &visited, &result](const AZ::TypeId& typeId, const ClassElement* element)
+            {
+                if (element && (element->m_flags & UnpatchableElementFlags))
+                {
+                    // The actual type of the object pointed to is only known at runtime.
+                    result = true;
+                }
+                else if (const ClassData* elementClassData = FindClassData(serializeContext, typeId, element))
+                {
+                    result = MayContainEntityId(serializeContext, *elementClassData, visited);
+                }
+                return !result;
+            };
+
+            if (classData.m_container)
+            {
+                classData.m_container->EnumTypes(checkElement);
+            }
+            else
+            {
+                for (const ClassElement& element : classData.m_elements)
+                {
+                    if (!checkElement(element.m_typeId, &element))
+                    {
+                        break;
+                    }
+                }
+            }
+            return result;
+        }
+
+        //! Collects the offsets of all entity ids in the class, including the ones in base classes and nested classes.
+        //! Returns false if the class stores entity ids in a way that can't be patched by offset.
+        static bool CollectEntityIdOffsets(
+            AZ::SerializeContext& serializeContext, const ClassData& classData, size_t baseOffset, AZStd::vector<AZ::u32>& offsets)
+        {
+            // Event handlers get called when ids are remapped through the serialize context, which patching by offset would skip.
+            if (classData.m_eventHandler)
+            {
+                return false;
+            }
+
+            if (classData.m_container)
+            {
+                // Changing entity ids in containers may require the container to be updated, for instance when they're used as keys
+                // in associative containers, so these are left to the remapper.
+                AZStd::unordered_set<AZ::TypeId> visited;
+                return !MayContainEntityId(serializeContext, classData, visited);
+            }
+
+            for (const ClassElement& element : classData.m_elements)
+            {
+                if (element.m_flags & UnpatchableElementFlags)
+                {
+                    return false;
+                }
+
+                const size_t elementOffset = baseOffset + element.m_offset;
+                if (element.m_typeId == azrtti_typeid<AZ::EntityId>())
+                {
+                    if (AZ::FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction, element.m_attributes))
+                    {
+                        // Fields with an id generator get a new id instead of a remapped one.
+                        return false;
+                    }
+                    offsets.push_back(aznumeric_cast<AZ::u32>(elementOffset));
+                }
+                else if (const ClassData* elementClassData = FindClassData(serializeContext, element.m_typeId, &element))
+                {
+                    if (!CollectEntityIdOffsets(serializeContext, *elementClassData, elementOffset, offsets))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+    } // namespace SpawnableClonePlanInternal
+
+    SpawnableClonePlan::SpawnableClonePlan(const EntityList& entities, AZ::SerializeContext& serializeContext)
+        : m_serializeContext(&serializeContext)
+    {
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            for (const AZ::Component* component : entity->GetComponents())
+            {
+                AddComponentType(component->RTTI_GetType());
+            }
+        }
+    }
+
+    bool SpawnableClonePlan::CanClone(const AZ::Entity& entityTemplate) const
+    {
+        for (const AZ::Component* component : entityTemplate.GetComponents())
+        {
+            auto it = m_componentPlans.find(component->RTTI_GetType());
+            if (it == m_componentPlans.end() || !it->second.m_patchable)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZ::Entity* SpawnableClonePlan::Clone(const AZ::Entity& entityTemplate, const EntityIdMap& templateToCloneMap) const
+    {
+        if (!CanClone(entityTemplate))
+        {
+            return nullptr;
+        }
+
+        auto entityIdIt = templateToCloneMap.find(entityTemplate.GetId());
+        AZ_Assert(entityIdIt != templateToCloneMap.end(), "Entity '%s' isn't in the entity id map provided to the spawnable clone plan.",
+            entityTemplate.GetName().c_str());
+        if (entityIdIt == templateToCloneMap.end())
+        {
+            return nullptr;
+        }
+
+        AZ::Entity* clone = m_serializeContext->CloneObject(&entityTemplate);
+        if (!clone)
+        {
+            return nullptr;
+        }
+        clone->SetId(entityIdIt->second);
+
+        for (AZ::Component* component : clone->GetComponents())
+        {
+            const AZ::TypeId& typeId = component->RTTI_GetType();
+            const ComponentPlan& plan = m_componentPlans.find(typeId)->second;
+            if (plan.m_entityIdOffsets.empty())
+            {
+                continue;
+            }
+
+            char* componentAddress = reinterpret_cast<char*>(component->RTTI_AddressOf(typeId));
+            for (AZ::u32 offset : plan.m_entityIdOffsets)
+            {
+                AZ::EntityId& entityId = *reinterpret_cast<AZ::EntityId*>(componentAddress + offset);
+                if (auto it = templateToCloneMap.find(entityId); it != templateToCloneMap.end())
+                {
+                    entityId = it->second;
+                }
+            }
+        }
+        return clone;
+    }
+
+    AZ::SerializeContext& SpawnableClonePlan::GetSerializeContext() const
+    {
+        return *m_serializeContext;
+    }
+
+    bool SpawnableClonePlan::IsFullyPatchable() const
+    {
+        return m_isFullyPatchable;
+    }
+
+    void SpawnableClonePlan::AddComponentType(const AZ::TypeId& typeId)
+    {
+        auto [it, inserted] = m_componentPlans.try_emplace(typeId);
+        if (inserted)
+        {
+            ComponentPlan& plan = it->second;
+            // Types that aren't reflected are skipped by the serialize context as well, so there's nothing to patch for them.
+            if (const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(typeId))
+            {
+                plan.m_patchable = SpawnableClonePlanInternal::CollectEntityIdOffsets(
+                    *m_serializeContext, *classData, 0, plan.m_entityIdOffsets);
+            }
+            if (!plan.m_patchable)
+            {
+                plan.m_entityIdOffsets.clear();
+                m_isFullyPatchable = false;
+            }
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class Entity;
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! Precompiled information used to clone the entities of a spawnable without walking the reflection of every entity twice to
+    //! remap the entity ids. For every component type in the spawnable the plan records the offsets of the entity ids stored
+    //! in the component, so after an entity has been cloned its ids can be patched in a single pass.
+    //! Component types that store entity ids in a way that can't be patched by offset, such as in containers, behind pointers
+    //! or in classes that have an event handler, are marked as such and entities using them are cloned through
+    //! AZ::IdUtils::Remapper instead.
+    //! A plan doesn't change after it's been built, so it can be used from multiple threads at the same time.
+    class SpawnableClonePlan final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableClonePlan, AZ::SystemAllocator, 0);
+
+        using EntityList = AZStd::vector<AZStd::unique_ptr<AZ::Entity>>;
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        SpawnableClonePlan(const EntityList& entities, AZ::SerializeContext& serializeContext);
+
+        //! Returns true if the entity only has components that were found while building the plan and can be patched by offset.
+        bool CanClone(const AZ::Entity& entityTemplate) const;
+        //! Clones the entity and replaces the entity ids in the clone with the ids in templateToCloneMap. Entity ids that aren't in
+        //! the map are left unchanged. The id of the template entity itself must be in the map.
+        //! Returns nullptr if the entity can't be cloned with this plan, see CanClone.
+        AZ::Entity* Clone(const AZ::Entity& entityTemplate, const EntityIdMap& templateToCloneMap) const;
+
+        //! Returns the serialize context the plan was built with. The plan can only be used with the same serialize context.
+        AZ::SerializeContext& GetSerializeContext() const;
+
+        //! Returns true if every component used in the spawnable can be patched by offset.
+        bool IsFullyPatchable() const;
+
+    private:
+        struct ComponentPlan
+        {
+            AZStd::vector<AZ::u32> m_entityIdOffsets; //!< Offsets of the entity ids relative to the start of the component.
+            bool m_patchable{ true };
+        };
+
+        void AddComponentType(const AZ::TypeId& typeId);
+
+        AZStd::unordered_map<AZ::TypeId, ComponentPlan> m_componentPlans;
+        AZ::SerializeContext* m_serializeContext;
+        bool m_isFullyPatchable{ true };
+    };
+} // namespace AzFramework
@@ -8,6 +8,10 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -20,6 +24,12 @@
 
 namespace AzFramework
 {
+    namespace SpawnableEntitiesManagerInternal
+    {
+        static constexpr size_t ParallelCloneMinEntitiesPerJob = 16;
+        static constexpr size_t ParallelCloneJobsPerWorker = 4;
+    } // namespace SpawnableEntitiesManagerInternal
+
     template<typename T>
     void SpawnableEntitiesManager::QueueRequest(EntitySpawnTicket& ticket, SpawnablePriority priority, T&& request)
     {
@@ -43,6 +53,8 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            settingsRegistry->Get(m_parallelCloneThreshold, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
         }
     }
 
@@ -243,9 +255,23 @@ namespace AzFramework
         }
     }
 
+    const SpawnableClonePlan* SpawnableEntitiesManager::FindClonePlan(const Spawnable& spawnable, AZ::SerializeContext& serializeContext)
+    {
+        const SpawnableClonePlan* clonePlan = spawnable.GetClonePlan();
+        return (clonePlan && &clonePlan->GetSerializeContext() == &serializeContext) ? clonePlan : nullptr;
+    }
+
     AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate,
-        EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
+        EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext, const SpawnableClonePlan* clonePlan)
     {
+        if (clonePlan)
+        {
+            if (AZ::Entity* clone = clonePlan->Clone(entityTemplate, templateToCloneMap); clone != nullptr)
+            {
+                return clone;
+            }
+        }
+
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
 
@@ -253,6 +279,33 @@ namespace AzFramework
                 &entityTemplate, templateToCloneMap, &serializeContext);
     }
 
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        AZ::JobContext& jobContext, const Spawnable::EntityList& entityTemplates, const EntityIdMap& templateToCloneMap,
+        const SpawnableClonePlan& clonePlan, AZ::Entity** clones)
+    {
+        using namespace SpawnableEntitiesManagerInternal;
+
+        const size_t entityCount = entityTemplates.size();
+        const size_t jobCount = AZStd::max<size_t>(jobContext.GetJobManager().GetNumWorkerThreads(), 1) * ParallelCloneJobsPerWorker;
+        const size_t entitiesPerJob = AZStd::max(ParallelCloneMinEntitiesPerJob, (entityCount + jobCount - 1) / jobCount);
+
+        AZ::JobCompletion completion(&jobContext);
+        for (size_t begin = 0; begin < entityCount; begin += entitiesPerJob)
+        {
+            const size_t end = AZStd::min(begin + entitiesPerJob, entityCount);
+            AZ::Job* job = AZ::CreateJobFunction([&entityTemplates, &templateToCloneMap, &clonePlan, clones, begin, end]()
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        clones[i] = clonePlan.Clone(*entityTemplates[i], templateToCloneMap);
+                    }
+                }, true, &jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -314,16 +367,57 @@ namespace AzFramework
             // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
             InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-            for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+            const SpawnableClonePlan* clonePlan = FindClonePlan(*ticket.m_spawnable, *request.m_serializeContext);
+
+            AZ::JobContext* jobContext = nullptr;
+            if (clonePlan && m_parallelCloneThreshold != 0 && entitiesToSpawnSize >= m_parallelCloneThreshold)
+            {
+                jobContext = AZ::JobContext::GetGlobalContext();
+                // Don't block a worker thread while waiting for other jobs if spawning is done from within a job.
+                if (jobContext && jobContext->GetJobManager().GetCurrentJob() != nullptr)
+                {
+                    jobContext = nullptr;
+                }
+            }
+
+            if (jobContext)
             {
-                // If this entity has previously been spawned, give it a new id in the reference map
-                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                // Update the mappings for all entities first so the map doesn't change while the entities are cloned.
+                for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                }
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize, nullptr);
+                AZ::Entity** clones = spawnedEntities.data() + spawnedEntitiesInitialCount;
+                CloneEntitiesInParallel(*jobContext, entitiesToSpawn, ticket.m_entityIdReferenceMap, *clonePlan, clones);
 
-                spawnedEntities.emplace_back(clone);
-                spawnedEntityIndices.push_back(i);
+                for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    if (clones[i] == nullptr)
+                    {
+                        // The entity has components that can't be patched by the clone plan, so clone it the regular way.
+                        clones[i] = CloneSingleEntity(
+                            *entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext, nullptr);
+                        AZ_Assert(clones[i] != nullptr, "Failed to clone spawnable entity.");
+                    }
+                    spawnedEntityIndices.push_back(i);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    // If this entity has previously been spawned, give it a new id in the reference map
+                    RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan);
+                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+
+                    spawnedEntities.emplace_back(clone);
+                    spawnedEntityIndices.push_back(i);
+                }
             }
 
             // loadAll is true if every entity has been spawned only once
@@ -392,6 +486,8 @@ namespace AzFramework
             spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
             spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
+            const SpawnableClonePlan* clonePlan = FindClonePlan(*ticket.m_spawnable, *request.m_serializeContext);
+
             for (size_t index : request.m_entityIndices)
             {
                 if (index < entitiesToSpawn.size())
@@ -400,8 +496,8 @@ namespace AzFramework
                     RefreshEntityIdMapping(
                         entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone =
-                        CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(
+                        *entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     spawnedEntities.push_back(clone);
@@ -497,6 +593,8 @@ namespace AzFramework
             // match the new set of template entities getting spawned.
             InitializeEntityIdMappings(entities, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
+            const SpawnableClonePlan* clonePlan = FindClonePlan(*request.m_spawnable, *request.m_serializeContext);
+
             if (ticket.m_loadAll)
             {
                 // The new spawnable may have a different number of entities and since the intent of the user was
@@ -509,7 +607,8 @@ namespace AzFramework
                     // If this entity has previously been spawned, give it a new id in the reference map
                     RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone =
+                        CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -530,7 +629,8 @@ namespace AzFramework
                         // If this entity has previously been spawned, give it a new id in the reference map
                         RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(
+                            *entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext, clonePlan);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
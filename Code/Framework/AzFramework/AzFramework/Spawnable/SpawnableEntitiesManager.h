@@ -20,6 +20,7 @@
 namespace AZ
 {
     class Entity;
+    class JobContext;
     class SerializeContext;
 }
 
@@ -193,9 +194,17 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(Queue& queue);
 
+        //! Returns the clone plan of the spawnable if it was built for the provided serialize context, otherwise nullptr.
+        static const SpawnableClonePlan* FindClonePlan(const Spawnable& spawnable, AZ::SerializeContext& serializeContext);
         AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
-        
+            const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext,
+            const SpawnableClonePlan* clonePlan);
+        //! Clones the entities using the clone plan across the job system. The id map isn't modified while cloning, so all mappings
+        //! need to be up to date before calling this. Entities that can't be cloned with the plan are left as nullptr.
+        void CloneEntitiesInParallel(
+            AZ::JobContext& jobContext, const Spawnable::EntityList& entityTemplates, const EntityIdMap& templateToCloneMap,
+            const SpawnableClonePlan& clonePlan, AZ::Entity** clones);
+
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
         bool ProcessRequest(DespawnAllEntitiesCommand& request);
@@ -224,6 +233,10 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of entities in a spawnable before SpawnAllEntities clones the entities across the job system. Parallel
+        //! cloning requires all component constructors to be thread safe, so it's disabled by default (a value of 0). The value can be
+        //! configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold".
+        AZ::u64 m_parallelCloneThreshold { 0 };
     };
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AzFramework::SpawnableEntitiesManager::CommandQueuePriority);
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
 {
@@ -88,6 +89,98 @@ namespace AzFramework
             //!                  otherwise *terrainExistsPtr will be set to true.
             virtual AZ::Vector3 GetNormal(AZ::Vector3 position, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
             virtual AZ::Vector3 GetNormalFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
+
+            // Batched queries. These fill caller provided vectors in the order of the input positions so that systems sampling large
+            // numbers of points, like heightfield generation or vegetation placement, don't need a bus call per point. The output
+            // vectors need to be the same size as the input positions.
+            //! @terrainExists: Can be nullptr. If != nullptr then it needs to be the same size as the input positions, and each entry is
+            //!                  set the same way as *terrainExistsPtr in the single position queries.
+
+            //! Batched version of GetHeight.
+            virtual void GetHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights,
+                Sampler sampler = Sampler::BILINEAR, AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                AZ_Assert(inPositions.size() == outHeights.size(), "The output vector needs to be the same size as the input positions");
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    bool exists = true;
+                    outHeights[index] = GetHeight(inPositions[index], sampler, &exists);
+                    if (terrainExists)
+                    {
+                        (*terrainExists)[index] = exists;
+                    }
+                }
+            }
+
+            //! Batched version of GetNormal.
+            virtual void GetNormals(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outNormals,
+                Sampler sampleFilter = Sampler::BILINEAR, AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                AZ_Assert(inPositions.size() == outNormals.size(), "The output vector needs to be the same size as the input positions");
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    bool exists = true;
+                    outNormals[index] = GetNormal(inPositions[index], sampleFilter, &exists);
+                    if (terrainExists)
+                    {
+                        (*terrainExists)[index] = exists;
+                    }
+                }
+            }
+
+            //! Batched version of GetMaxSurfaceWeight.
+            virtual void GetMaxSurfaceWeights(const AZStd::vector<AZ::Vector3>& inPositions,
+                AZStd::vector<SurfaceData::SurfaceTagWeight>& outSurfaceWeights, Sampler sampleFilter = Sampler::BILINEAR,
+                AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                AZ_Assert(inPositions.size() == outSurfaceWeights.size(), "The output vector needs to be the same size as the input positions");
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    bool exists = true;
+                    outSurfaceWeights[index] = GetMaxSurfaceWeight(inPositions[index], sampleFilter, &exists);
+                    if (terrainExists)
+                    {
+                        (*terrainExists)[index] = exists;
+                    }
+                }
+            }
+
+            //! Returns the number of points along x and y of the grid sampled by GetHeightsFromRegion.
+            static void GetRegionSampleCounts(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, size_t& outCountX, size_t& outCountY)
+            {
+                outCountX = static_cast<size_t>(inRegion.GetXExtent() / stepSize.GetX());
+                outCountY = static_cast<size_t>(inRegion.GetYExtent() / stepSize.GetY());
+            }
+
+            //! Samples the heights of a grid of points that starts at the min corner of inRegion and is spaced stepSize apart.
+            //! outHeights (and terrainExists if provided) are resized to the grid size from GetRegionSampleCounts and filled in row major
+            //! order, so vectors reused between calls don't need to be reallocated.
+            virtual void GetHeightsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, AZStd::vector<float>& outHeights,
+                Sampler sampler = Sampler::BILINEAR, AZStd::vector<bool>* terrainExists = nullptr) const
+            {
+                size_t countX = 0;
+                size_t countY = 0;
+                GetRegionSampleCounts(inRegion, stepSize, countX, countY);
+
+                AZStd::vector<AZ::Vector3> positions;
+                positions.reserve(countX * countY);
+                for (size_t y = 0; y < countY; ++y)
+                {
+                    for (size_t x = 0; x < countX; ++x)
+                    {
+                        positions.emplace_back(
+                            inRegion.GetMin().GetX() + (x * stepSize.GetX()), inRegion.GetMin().GetY() + (y * stepSize.GetY()),
+                            inRegion.GetMin().GetZ());
+                    }
+                }
+
+                outHeights.resize(positions.size());
+                if (terrainExists)
+                {
+                    terrainExists->resize(positions.size());
+                }
+                GetHeights(positions, outHeights, sampler, terrainExists);
+            }
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
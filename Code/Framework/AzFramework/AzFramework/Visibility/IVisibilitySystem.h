@@ -36,13 +36,39 @@ namespace AzFramework
             TYPE_RPI_Cullable = 1 << 2 // Cullable by the render system
         };
 
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
         AZ::Aabb m_boundingVolume = AZ::Aabb::CreateNull();
         VisibilityNode* m_internalNode = nullptr;
         void* m_userData = nullptr;
         uint32_t m_internalNodeIndex = 0;
+        uint32_t m_internalPendingIndex = InvalidIndex; //!< Index into the pending updates of a visibility scene that defers updates.
         TypeFlags m_typeFlags = TYPE_None;
     };
 
+    //! Bounds of up to EntryCount VisibilityEntries stored as a structure of arrays, so a batch of entries can be tested
+    //! against a bounding volume with SIMD instructions. Entry i of a node is stored in lane (i % EntryCount) of batch (i / EntryCount).
+    struct alignas(16) VisibilityEntryBoundsBatch
+    {
+        static constexpr uint32_t EntryCount = 4;
+
+        //! Updates a single lane from the bounding volume of an entry.
+        void Set(uint32_t lane, const AZ::Aabb& bounds);
+
+        //! Copies a single lane from another batch.
+        void Copy(uint32_t lane, const VisibilityEntryBoundsBatch& source, uint32_t sourceLane);
+
+        //! Center and half extents of each entry's bounding volume.
+        //! @{
+        float m_centerX[EntryCount] = {};
+        float m_centerY[EntryCount] = {};
+        float m_centerZ[EntryCount] = {};
+        float m_halfExtentX[EntryCount] = {};
+        float m_halfExtentY[EntryCount] = {};
+        float m_halfExtentZ[EntryCount] = {};
+        //! @}
+    };
+
     //! @class IVisibilityScene
     //! @brief This is the interface for managing objects and visibility queries for a given scene.
     class IVisibilityScene
@@ -57,6 +83,9 @@ namespace AzFramework
         {
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
+            //! Optional copy of the entry bounds, ceil(m_entries.size() / EntryCount) batches in the same order as m_entries.
+            //! May be nullptr if the visibility scene implementation doesn't provide it.
+            const VisibilityEntryBoundsBatch* m_entryBounds = nullptr;
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
@@ -132,6 +161,29 @@ namespace AzFramework
         AZ_DISABLE_COPY_MOVE(IVisibilitySystem);
     };
 
+    inline void VisibilityEntryBoundsBatch::Set(uint32_t lane, const AZ::Aabb& bounds)
+    {
+        // Scale before adding so bounds at the FLT_MAX extremes can't overflow, a null aabb results in negative extents
+        const AZ::Vector3 center = (0.5f * bounds.GetMax()) + (0.5f * bounds.GetMin());
+        const AZ::Vector3 halfExtents = (0.5f * bounds.GetMax()) - (0.5f * bounds.GetMin());
+        m_centerX[lane] = center.GetX();
+        m_centerY[lane] = center.GetY();
+        m_centerZ[lane] = center.GetZ();
+        m_halfExtentX[lane] = halfExtents.GetX();
+        m_halfExtentY[lane] = halfExtents.GetY();
+        m_halfExtentZ[lane] = halfExtents.GetZ();
+    }
+
+    inline void VisibilityEntryBoundsBatch::Copy(uint32_t lane, const VisibilityEntryBoundsBatch& source, uint32_t sourceLane)
+    {
+        m_centerX[lane] = source.m_centerX[sourceLane];
+        m_centerY[lane] = source.m_centerY[sourceLane];
+        m_centerZ[lane] = source.m_centerZ[sourceLane];
+        m_halfExtentX[lane] = source.m_halfExtentX[sourceLane];
+        m_halfExtentY[lane] = source.m_halfExtentY[sourceLane];
+        m_halfExtentZ[lane] = source.m_halfExtentZ[sourceLane];
+    }
+
     // EBus wrapper for ScriptCanvas
     class IVisibilitySystemRequests
         : public AZ::EBusTraits
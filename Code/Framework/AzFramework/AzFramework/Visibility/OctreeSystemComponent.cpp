@@ -7,8 +7,17 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
 
 namespace AzFramework
 {
@@ -16,6 +25,9 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,          1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to the bounds of child nodes in the range [1, 2], 1 results in a regular octree. Only affects scenes created afterwards");
+    AZ_CVAR(bool,     bg_octreeDeferUpdates,      false, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, inserts and updates are queued and applied in a batch once per tick, or before the next query");
+    AZ_CVAR(uint32_t, bg_octreeRefitEntriesPerJob, 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of queued updates each job refits when applying deferred updates, smaller batches are refit on the calling thread");
 
 
     static uint32_t GetChildNodeCount()
@@ -26,8 +38,21 @@ namespace AzFramework
     }
 
 
+    //! Returns the index of the child node of a node with the provided bounds that contains the point, matching the child layout used in OctreeNode::Split.
+    static uint32_t GetChildIndexForPoint(const AZ::Aabb& bounds, const AZ::Vector3& point)
+    {
+        const AZ::Vector3 center = bounds.GetCenter();
+        uint32_t child = 0;
+        child |= (point.GetX() >= center.GetX()) ? 0x01 : 0;
+        child |= (point.GetY() >= center.GetY()) ? 0x02 : 0;
+        child |= (!bg_octreeUseQuadtree && (point.GetZ() >= center.GetZ())) ? 0x04 : 0;
+        return child;
+    }
+
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(bounds)
     {
         ;
     }
@@ -35,9 +60,11 @@ namespace AzFramework
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
+        , m_entryBounds(AZStd::move(rhs.m_entryBounds))
     {
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -50,9 +77,11 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
+        m_entryBounds = AZStd::move(rhs.m_entryBounds);
 
         // Correct internal node pointers
         for (VisibilityEntry* entry : m_entries)
@@ -68,17 +97,15 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
-        // If this is not a leaf node, try to insert into the child nodes
+        // If this is not a leaf node, try to insert into the child node containing the center of the entry
+        // This is the only child that can fit the entry in a regular octree, and the tightest fit in a loose octree
         if (m_children != nullptr)
         {
             const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            OctreeNode& child = m_children[GetChildIndexForPoint(m_bounds, boundingVolume.GetCenter())];
+            if (AZ::ShapeIntersection::Contains(child.m_looseBounds, boundingVolume))
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return child.Insert(octreeScene, entry);
             }
         }
 
@@ -92,9 +119,7 @@ namespace AzFramework
         }
         else
         {
-            m_entries.push_back(entry);
-            entry->m_internalNode = this;
-            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+            AddEntry(entry);
         }
     }
 
@@ -103,12 +128,9 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
-        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (TryRefit(entry))
         {
             // Entry moved, but is still fully contained within the current node
-            // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
-            // even when one of the child nodes would be an adequate fit, due to this early out check
             return;
         }
 
@@ -116,11 +138,12 @@ namespace AzFramework
         Remove(octreeScene, entry);
 
         // Traverse up our ancestor nodes to find the first node that fully contains the entry
+        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
         // This strategy assumes an entry will typically move a small distance relative to the total world
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -136,20 +159,43 @@ namespace AzFramework
         AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
 
         // Swap and pop the removed entry
+        constexpr uint32_t BatchEntryCount = VisibilityEntryBoundsBatch::EntryCount;
         const uint32_t removeIndex = entry->m_internalNodeIndex;
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
         m_entries[removeIndex]->m_internalNode = nullptr;
         m_entries[removeIndex]->m_internalNodeIndex = 0;
-        if (removeIndex < (m_entries.size() - 1))
+        if (removeIndex < lastIndex)
         {
             AZStd::swap(m_entries[removeIndex], m_entries.back());
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+            m_entryBounds[removeIndex / BatchEntryCount].Copy(removeIndex % BatchEntryCount, m_entryBounds[lastIndex / BatchEntryCount], lastIndex % BatchEntryCount);
         }
         m_entries.pop_back();
+        if ((lastIndex % BatchEntryCount) == 0)
+        {
+            m_entryBounds.pop_back();
+        }
 
         if (m_parent != nullptr)
         {
-            m_parent->TryMerge(octreeScene);
+            octreeScene.TryMerge(m_parent);
+        }
+    }
+
+
+    bool OctreeNode::TryRefit(VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == this, "TryRefit invoked for an entry bound to a different OctreeNode");
+
+        const AZ::Aabb& boundingVolume = entry->m_boundingVolume;
+        if (!CanKeepEntry(boundingVolume))
+        {
+            return false;
         }
+
+        const uint32_t entryIndex = entry->m_internalNodeIndex;
+        m_entryBounds[entryIndex / VisibilityEntryBoundsBatch::EntryCount].Set(entryIndex % VisibilityEntryBoundsBatch::EntryCount, boundingVolume);
+        return true;
     }
 
 
@@ -176,7 +222,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback(GetNodeData());
         }
 
         if (m_children != nullptr)
@@ -197,6 +243,12 @@ namespace AzFramework
     }
 
 
+    const AZStd::vector<VisibilityEntryBoundsBatch>& OctreeNode::GetEntryBounds() const
+    {
+        return m_entryBounds;
+    }
+
+
     OctreeNode* OctreeNode::GetChildren() const
     {
         return m_children;
@@ -209,6 +261,20 @@ namespace AzFramework
     }
 
 
+    const AZ::Aabb& OctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
+
+    bool OctreeNode::CanKeepEntry(const AZ::Aabb& boundingVolume) const
+    {
+        // We can only keep entries in leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
+        // even when one of the child nodes would be an adequate fit
+        return IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume);
+    }
+
+
     void OctreeNode::TryMerge(OctreeScene& octreeScene)
     {
         if (IsLeaf())
@@ -240,12 +306,12 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback(GetNodeData());
         }
 
         if (m_children != nullptr)
@@ -254,7 +320,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -298,12 +364,16 @@ namespace AzFramework
                 }
 
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].m_looseBounds = AZ::Aabb::CreateCenterHalfExtents(
+                    m_children[child].m_bounds.GetCenter(), childExtent * (0.5f * octreeScene.m_looseness));
                 m_children[child].m_parent = this;
             }
         }
 
         // Re-partition our entry set across ourself and our child nodes
         AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
+        m_entries.clear();
+        m_entryBounds.clear();
         for (VisibilityEntry* entry : entrySet)
         {
             entry->m_internalNode = nullptr;
@@ -323,11 +393,10 @@ namespace AzFramework
         {
             for (VisibilityEntry* childEntry : m_children[child].m_entries)
             {
-                childEntry->m_internalNode = this;
-                childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
-                m_entries.push_back(childEntry);
+                AddEntry(childEntry);
             }
             m_children[child].m_entries.clear();
+            m_children[child].m_entryBounds.clear();
         }
 
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
@@ -335,9 +404,31 @@ namespace AzFramework
         m_children = nullptr;
     }
 
+
+    void OctreeNode::AddEntry(VisibilityEntry* entry)
+    {
+        const uint32_t entryIndex = aznumeric_cast<uint32_t>(m_entries.size());
+        m_entries.push_back(entry);
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = entryIndex;
+
+        if ((entryIndex % VisibilityEntryBoundsBatch::EntryCount) == 0)
+        {
+            m_entryBounds.emplace_back();
+        }
+        m_entryBounds.back().Set(entryIndex % VisibilityEntryBoundsBatch::EntryCount, entry->m_boundingVolume);
+    }
+
+
+    IVisibilityScene::NodeData OctreeNode::GetNodeData() const
+    {
+        return { m_looseBounds, m_entries, m_entryBounds.data() };
+    }
+
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
         : m_sceneName(sceneName)
         , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
+        , m_looseness(AZ::GetClamp(static_cast<float>(bg_octreeLooseness), 1.0f, 2.0f))
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
     }
@@ -359,7 +450,19 @@ namespace AzFramework
 
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
+        if (bg_octreeDeferUpdates)
+        {
+            QueueUpdate(entry);
+            return;
+        }
+
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (m_hasPendingUpdates)
+        {
+            // Updates were deferred until recently, apply them first to preserve the update order
+            ApplyPendingUpdatesLocked();
+        }
+
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -374,6 +477,11 @@ namespace AzFramework
 
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
+        if (m_hasPendingUpdates)
+        {
+            RemovePendingUpdate(entry);
+        }
+
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
         if (entry.m_internalNode)
         {
@@ -385,6 +493,7 @@ namespace AzFramework
 
     void OctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyPendingUpdatesBeforeQuery();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(aabb, callback);
     }
@@ -392,6 +501,7 @@ namespace AzFramework
 
     void OctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyPendingUpdatesBeforeQuery();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(sphere, callback);
     }
@@ -399,6 +509,7 @@ namespace AzFramework
 
     void OctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyPendingUpdatesBeforeQuery();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.Enumerate(frustum, callback);
     }
@@ -406,6 +517,7 @@ namespace AzFramework
 
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
+        ApplyPendingUpdatesBeforeQuery();
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         m_root.EnumerateNoCull(callback);
     }
@@ -416,6 +528,17 @@ namespace AzFramework
         return m_entryCount;
     }
 
+
+    void OctreeScene::ApplyPendingUpdates()
+    {
+        if (m_hasPendingUpdates)
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+            ApplyPendingUpdatesLocked();
+        }
+    }
+
+
     uint32_t OctreeScene::GetNodeCount() const
     {
         return m_nodeCount;
@@ -441,6 +564,13 @@ namespace AzFramework
     }
 
 
+    uint32_t OctreeScene::GetPendingUpdateCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> pendingLock(m_pendingMutex);
+        return aznumeric_cast<uint32_t>(m_pendingUpdates.size());
+    }
+
+
     void OctreeScene::DumpStats()
     {
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
@@ -448,6 +578,8 @@ namespace AzFramework
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PendingUpdateCount = %u", GetName().GetCStr(), GetPendingUpdateCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::Looseness = %f", GetName().GetCStr(), m_looseness);
     }
 
 
@@ -525,6 +657,149 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::QueueUpdate(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::mutex> pendingLock(m_pendingMutex);
+        if (entry.m_internalPendingIndex == VisibilityEntry::InvalidIndex)
+        {
+            entry.m_internalPendingIndex = aznumeric_cast<uint32_t>(m_pendingUpdates.size());
+            m_pendingUpdates.push_back(&entry);
+            m_hasPendingUpdates = true;
+        }
+    }
+
+
+    void OctreeScene::RemovePendingUpdate(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::mutex> pendingLock(m_pendingMutex);
+        const uint32_t pendingIndex = entry.m_internalPendingIndex;
+        if (pendingIndex == VisibilityEntry::InvalidIndex)
+        {
+            return;
+        }
+
+        AZ_Assert(m_pendingUpdates[pendingIndex] == &entry, "Pending visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        m_pendingUpdates[pendingIndex] = m_pendingUpdates.back();
+        m_pendingUpdates[pendingIndex]->m_internalPendingIndex = pendingIndex;
+        m_pendingUpdates.pop_back();
+        entry.m_internalPendingIndex = VisibilityEntry::InvalidIndex;
+        m_hasPendingUpdates = !m_pendingUpdates.empty();
+    }
+
+
+    void OctreeScene::ApplyPendingUpdatesLocked()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> pendingLock(m_pendingMutex);
+            if (m_pendingUpdates.empty())
+            {
+                // Another thread applied the updates while we were waiting for the lock
+                return;
+            }
+
+            AZStd::swap(m_pendingUpdates, m_processingUpdates);
+            for (VisibilityEntry* entry : m_processingUpdates)
+            {
+                entry->m_internalPendingIndex = VisibilityEntry::InvalidIndex;
+            }
+            m_hasPendingUpdates = false;
+        }
+
+        // Refit the entries that still fit their current node, this doesn't modify the tree so it can be spread over multiple jobs
+        // Jobs are only used from regular threads, a query issued from within a job refits the entries inline
+        const size_t updateCount = m_processingUpdates.size();
+        const size_t entriesPerJob = AZStd::max<size_t>(bg_octreeRefitEntriesPerJob, 1);
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (updateCount > entriesPerJob && jobContext != nullptr && jobContext->GetJobManager().GetCurrentJob() == nullptr)
+        {
+            AZ::JobCompletion jobCompletion(jobContext);
+            for (size_t begin = 0; begin < updateCount; begin += entriesPerJob)
+            {
+                const size_t end = AZStd::min(begin + entriesPerJob, updateCount);
+                AZ::Job* job = AZ::CreateJobFunction([this, begin, end]() { RefitPendingUpdates(begin, end); }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            RefitPendingUpdates(0, updateCount);
+        }
+
+        // Insert new entries and move the entries that left their node
+        // Merges are deferred until the whole batch is applied, so nodes aren't repeatedly merged and split within a batch
+        m_deferMerges = true;
+        for (VisibilityEntry* entry : m_processingUpdates)
+        {
+            if (entry == nullptr)
+            {
+                continue;
+            }
+
+            if (entry->m_internalNode != nullptr)
+            {
+                static_cast<OctreeNode*>(entry->m_internalNode)->Update(*this, entry);
+            }
+            else
+            {
+                m_root.Insert(*this, entry);
+                ++m_entryCount;
+            }
+        }
+        m_deferMerges = false;
+        m_processingUpdates.clear();
+
+        // Nodes are never freed, so candidates that were released by an earlier merge are empty leaf nodes that TryMerge skips
+        AZStd::sort(m_mergeCandidates.begin(), m_mergeCandidates.end());
+        m_mergeCandidates.erase(AZStd::unique(m_mergeCandidates.begin(), m_mergeCandidates.end()), m_mergeCandidates.end());
+        for (OctreeNode* node : m_mergeCandidates)
+        {
+            node->TryMerge(*this);
+        }
+        m_mergeCandidates.clear();
+    }
+
+
+    void OctreeScene::RefitPendingUpdates(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            VisibilityEntry* entry = m_processingUpdates[i];
+            if ((entry->m_internalNode != nullptr) && static_cast<OctreeNode*>(entry->m_internalNode)->TryRefit(entry))
+            {
+                m_processingUpdates[i] = nullptr;
+            }
+        }
+    }
+
+
+    void OctreeScene::ApplyPendingUpdatesBeforeQuery() const
+    {
+        if (m_hasPendingUpdates)
+        {
+            const_cast<OctreeScene*>(this)->ApplyPendingUpdates();
+        }
+    }
+
+
+    void OctreeScene::TryMerge(OctreeNode* node)
+    {
+        if (m_deferMerges)
+        {
+            m_mergeCandidates.push_back(node);
+        }
+        else
+        {
+            node->TryMerge(*this);
+        }
+    }
+
+
     void OctreeSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -569,13 +844,30 @@ namespace AzFramework
 
     void OctreeSystemComponent::Activate()
     {
-        ;
+        AZ::TickBus::Handler::BusConnect();
     }
 
 
     void OctreeSystemComponent::Deactivate()
     {
-        ;
+        AZ::TickBus::Handler::BusDisconnect();
+    }
+
+
+    void OctreeSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        m_defaultScene->ApplyPendingUpdates();
+        for (OctreeScene* scene : m_scenes)
+        {
+            scene->ApplyPendingUpdates();
+        }
+    }
+
+
+    int OctreeSystemComponent::GetTickOrder()
+    {
+        // Apply the updates queued by everything else that ticks this frame in a single batch
+        return AZ::TICK_LAST;
     }
 
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
@@ -11,9 +11,12 @@
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
 namespace AzFramework
@@ -22,7 +25,9 @@ namespace AzFramework
     class OctreeScene;
 
     //! An internal node within the tree.
-    //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! It contains all objects that are *fully contained* by the node's loose bounds, if an object spans multiple child nodes that object will be stored in the parent.
+    //! The loose bounds are the node bounds grown around their center by the looseness of the scene (see bg_octreeLooseness), so
+    //! objects moving near the boundary of a node don't need to be moved between nodes.
     class OctreeNode
         : public VisibilityNode
     {
@@ -47,6 +52,11 @@ namespace AzFramework
         //! The provided entry must be bound to this node.
         void Remove(OctreeScene& octreeScene, VisibilityEntry* entry);
 
+        //! Refreshes the stored bounds of a VisibilityEntry bound to this OctreeNode if it still fits, without modifying the tree.
+        //! This can be called concurrently for different entries.
+        //! @return false if the entry needs to be moved to a different node with Update.
+        bool TryRefit(VisibilityEntry* entry);
+
         //! Recursively enumerates any OctreeNodes and their children that intersect the provided bounding volume.
         //! @{
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const;
@@ -60,12 +70,18 @@ namespace AzFramework
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
+        //! Returns the bounds of the entries bound to this node, stored in batches in the same order as GetEntries().
+        const AZStd::vector<VisibilityEntryBoundsBatch>& GetEntryBounds() const;
+
         //! Returns the array of child nodes for this OctreeNode, may be nullptr if this OctreeNode is a leaf node.
         OctreeNode* GetChildren() const;
 
         //! Returns true if this is a leaf node.
         bool IsLeaf() const;
 
+        //! Returns the loose bounds of this node, which contain every entry bound to this node or its children.
+        const AZ::Aabb& GetLooseBounds() const;
+
     private:
 
         void TryMerge(OctreeScene& octreeScene);
@@ -73,21 +89,34 @@ namespace AzFramework
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Returns true if an entry can stay in this node without being reinserted into the tree.
+        bool CanKeepEntry(const AZ::Aabb& boundingVolume) const;
+
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
+        //! Appends an entry to this node's entry set and entry bounds.
+        void AddEntry(VisibilityEntry* entry);
+        IVisibilityScene::NodeData GetNodeData() const;
+
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds;
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
+        AZStd::vector<VisibilityEntryBoundsBatch> m_entryBounds; //< Mirror of the bounding volumes of m_entries for batched culling
+
+        friend class OctreeScene; // For access to TryMerge when applying deferred merges
     };
 
     //! Implementation of the visibility system interface.
-    //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! This uses a simple adaptive loose octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! When bg_octreeDeferUpdates is enabled, inserts and updates are queued and applied in one batch, either once per tick by the
+    //! OctreeSystemComponent or before the next query, whichever comes first.
     class OctreeScene
         : public IVisibilityScene
     {
@@ -111,12 +140,17 @@ namespace AzFramework
         uint32_t GetEntryCount() const override;
         //! @}
 
+        //! Applies all queued inserts and updates.
+        //! Entries that still fit their current node are refit in parallel, the remaining entries are then moved serially.
+        void ApplyPendingUpdates();
+
         //! Stats
         //! @{
         uint32_t GetNodeCount() const;
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
+        uint32_t GetPendingUpdateCount() const;
         void DumpStats();
         //! @}
 
@@ -125,6 +159,17 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
+        void QueueUpdate(VisibilityEntry& entry);
+        void RemovePendingUpdate(VisibilityEntry& entry);
+        void ApplyPendingUpdatesLocked();
+        void RefitPendingUpdates(size_t begin, size_t end);
+
+        //! Queries are logically const, but need to see the result of any queued updates.
+        void ApplyPendingUpdatesBeforeQuery() const;
+
+        //! Queues a merge check of the node, or checks it right away if merges aren't currently deferred.
+        void TryMerge(OctreeNode* node);
+
         mutable AZStd::shared_mutex m_sharedMutex;
 
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
@@ -132,6 +177,15 @@ namespace AzFramework
 
         uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
         uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the octreeSystemComponent, at least one for the root node.
+        float m_looseness = 1.0f; //< Scale applied to the bounds of each child node, fixed for the lifetime of the scene.
+
+        mutable AZStd::mutex m_pendingMutex; // Guards m_pendingUpdates, which is modified without holding m_sharedMutex.
+        AZStd::vector<VisibilityEntry*> m_pendingUpdates; //< Entries queued for insertion or update.
+        AZStd::vector<VisibilityEntry*> m_processingUpdates; //< The pending updates being applied, kept to reuse its memory.
+        AZStd::atomic_bool m_hasPendingUpdates{ false };
+
+        bool m_deferMerges = false; //< Set while applying a batch of updates so nodes are only merged once the batch is done.
+        AZStd::vector<OctreeNode*> m_mergeCandidates; //< Parents of nodes that lost entries while merges were deferred.
 
         static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
         static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
@@ -148,6 +202,7 @@ namespace AzFramework
     class OctreeSystemComponent
         : public AZ::Component
         , public IVisibilitySystemRequestBus::Handler
+        , public AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
@@ -168,6 +223,12 @@ namespace AzFramework
         void Deactivate() override;
         //! @}
 
+        //! AZ::TickBus overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
         //! IVisibilitySystem overrides
         //! @{
         IVisibilityScene* GetDefaultVisibilityScene() override;
@@ -20,6 +20,8 @@ set(FILES
     Archive/ArchiveFileIO.h
     Archive/ArchiveFindData.cpp
     Archive/ArchiveFindData.h
+    Archive/ArchivePathIndex.cpp
+    Archive/ArchivePathIndex.h
     Archive/ArchiveVars.h
     Archive/Codec.h
     Archive/IArchive.h
@@ -127,6 +129,8 @@ set(FILES
     Components/ComponentAdapter.inl
     Components/ComponentAdapterHelpers.h
     Components/EditorEntityEvents.h
+    Components/DeferredTransformHierarchy.cpp
+    Components/DeferredTransformHierarchy.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
     Components/CameraBus.h
@@ -282,6 +286,8 @@ set(FILES
     Spawnable/Spawnable.h
     Spawnable/SpawnableAssetHandler.h
     Spawnable/SpawnableAssetHandler.cpp
+    Spawnable/SpawnableClonePlan.h
+    Spawnable/SpawnableClonePlan.cpp
     Spawnable/SpawnableEntitiesContainer.h
     Spawnable/SpawnableEntitiesContainer.cpp
     Spawnable/SpawnableEntitiesInterface.h
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/INestedArchive.h>
+
+#include <cinttypes>
+
+namespace Benchmark
+{
+    // Mounts a number of archives at the same bind root, the way bundles are mounted in a release build, and looks up files
+    // spread over all archives as well as files that aren't in any archive.
+    // Compares finding the files through the path index with scanning every mounted archive.
+    class ArchivePathIndexBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int64_t FilesPerArchive = 256;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_application = AZStd::make_unique<AzFramework::Application>();
+            AZ::SettingsRegistryInterface* registry = AZ::SettingsRegistry::Get();
+            auto projectPathKey =
+                AZ::SettingsRegistryInterface::FixedValueString(AZ::SettingsRegistryMergeUtils::BootstrapSettingsRootKey) + "/project_path";
+            registry->Set(projectPathKey, "AutomatedTesting");
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(*registry);
+            m_application->Start(AZ::ComponentApplication::Descriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+            fileIo->CreatePath("@usercache@/pathindexbenchmark");
+
+            constexpr AZStd::string_view fileData = "DATA";
+            const int64_t archiveCount = state.range(0);
+            for (int64_t archiveIndex = 0; archiveIndex < archiveCount; ++archiveIndex)
+            {
+                const auto archivePath = AZ::IO::FixedMaxPathString::format("@usercache@/pathindexbenchmark/bundle%04" PRId64 ".pak", archiveIndex);
+                fileIo->Remove(archivePath.c_str());
+
+                AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive =
+                    archive->OpenArchive(archivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+                for (int64_t fileIndex = 0; fileIndex < FilesPerArchive; ++fileIndex)
+                {
+                    const auto filePath = AZ::IO::FixedMaxPathString::format("bundle%04" PRId64 "/dir%02" PRId64 "/file%04" PRId64 ".txt",
+                        archiveIndex, fileIndex % 16, fileIndex);
+                    pArchive->UpdateFile(filePath, fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_STORE);
+
+                    // Look up every 16th file, half of them with a different extension so they aren't found
+                    if (fileIndex % 16 == 0)
+                    {
+                        m_filePaths.push_back(filePath);
+                        m_filePaths.push_back(filePath + ".missing");
+                    }
+                }
+                pArchive.reset();
+
+                archive->OpenPack("@assets@", archivePath);
+                m_archivePaths.push_back(archivePath);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+            for (const AZ::IO::FixedMaxPathString& archivePath : m_archivePaths)
+            {
+                archive->ClosePack(archivePath);
+                fileIo->Remove(archivePath.c_str());
+            }
+            m_archivePaths = {};
+            m_filePaths = {};
+
+            if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+            {
+                console->PerformCommand("az_archive_path_index", { "true" });
+            }
+            m_application->Stop();
+            m_application.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void FindFiles(::benchmark::State& state, const char* usePathIndex)
+        {
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("az_archive_path_index", { usePathIndex });
+
+            AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+            for ([[maybe_unused]] auto _ : state)
+            {
+                size_t foundCount = 0;
+                for (const AZ::IO::FixedMaxPathString& filePath : m_filePaths)
+                {
+                    foundCount += archive->IsFileExist(filePath, AZ::IO::IArchive::eFileLocation_InPak) ? 1 : 0;
+                }
+                benchmark::DoNotOptimize(foundCount);
+            }
+            state.SetItemsProcessed(state.iterations() * m_filePaths.size());
+        }
+
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        AZStd::vector<AZ::IO::FixedMaxPathString> m_archivePaths;
+        AZStd::vector<AZ::IO::FixedMaxPathString> m_filePaths;
+    };
+
+    BENCHMARK_DEFINE_F(ArchivePathIndexBenchmarkFixture, FindFiles_ArchiveScan)(benchmark::State& state)
+    {
+        FindFiles(state, "false");
+    }
+
+    BENCHMARK_DEFINE_F(ArchivePathIndexBenchmarkFixture, FindFiles_PathIndex)(benchmark::State& state)
+    {
+        FindFiles(state, "true");
+    }
+
+    BENCHMARK_REGISTER_F(ArchivePathIndexBenchmarkFixture, FindFiles_ArchiveScan)
+        ->Arg(8)->Arg(64)
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(ArchivePathIndexBenchmarkFixture, FindFiles_PathIndex)
+        ->Arg(8)->Arg(64)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif
@@ -586,6 +586,83 @@ namespace UnitTest
         fileIo->Remove(testArchivePath_withMountPoint);
     }
 
+    TEST_F(ArchiveTestFixture, FilesInArchive_PathIndexMatchesArchiveScan)
+    {
+        // Files in the mounted archives are found through the path index by default, the archive scan is used when it's disabled.
+        // Both need to pick the same archive when several contain a file and follow archives being disabled and closed.
+        AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
+        ASSERT_NE(nullptr, fileIo);
+
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        // archives mounted at the same bind root are ordered by name, the files in pathindex_b.pak take priority
+        constexpr const char* testArchivePathA = "@usercache@/pathindex_a.pak";
+        constexpr const char* testArchivePathB = "@usercache@/pathindex_b.pak";
+
+        auto createArchive = [archive, fileIo](const char* archivePath, AZStd::initializer_list<AZStd::pair<const char*, AZStd::string_view>> files)
+        {
+            archive->ClosePack(archivePath);
+            fileIo->Remove(archivePath);
+
+            AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(archivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+            ASSERT_NE(nullptr, pArchive);
+            for (const auto& [filePath, fileData] : files)
+            {
+                EXPECT_EQ(0, pArchive->UpdateFile(filePath, fileData.data(), fileData.size(), AZ::IO::INestedArchive::METHOD_STORE));
+            }
+        };
+        createArchive(testArchivePathA, { { "data\\shared.txt", "A" }, { "data\\onlya.txt", "A" } });
+        createArchive(testArchivePathB, { { "data\\shared.txt", "B" } });
+
+        auto readFile = [archive](const char* filePath) -> AZStd::string
+        {
+            AZStd::string fileData;
+            AZ::IO::HandleType fileHandle = archive->FOpen(filePath, "rb");
+            if (fileHandle != AZ::IO::InvalidHandle)
+            {
+                fileData.resize(archive->FGetSize(fileHandle));
+                archive->FReadRaw(fileData.data(), 1, fileData.size(), fileHandle);
+                archive->FClose(fileHandle);
+            }
+            return fileData;
+        };
+
+        CVarIntValueScope previousLocationPriority{ *console, "sys_pakPriority" };
+        console->PerformCommand("sys_PakPriority", { AZ::CVarFixedString::format("%d", aznumeric_cast<int>(AZ::IO::ArchiveLocationPriority::ePakPriorityPakOnly)) });
+
+        for (const char* usePathIndex : { "true", "false" })
+        {
+            console->PerformCommand("az_archive_path_index", { usePathIndex });
+
+            EXPECT_TRUE(archive->OpenPack("@assets@", testArchivePathA));
+            EXPECT_TRUE(archive->OpenPack("@assets@", testArchivePathB));
+
+            EXPECT_EQ("B", readFile("data/shared.txt"));
+            EXPECT_EQ("A", readFile("data/onlya.txt"));
+            EXPECT_TRUE(archive->IsFileExist("DATA\\Shared.txt", AZ::IO::IArchive::eFileLocation_InPak));
+            EXPECT_FALSE(archive->IsFileExist("data/missing.txt", AZ::IO::IArchive::eFileLocation_InPak));
+            EXPECT_FALSE(archive->IsFileExist("shared.txt", AZ::IO::IArchive::eFileLocation_InPak));
+
+            EXPECT_TRUE(archive->SetPackAccessible(false, testArchivePathB));
+            EXPECT_EQ("A", readFile("data/shared.txt"));
+            EXPECT_TRUE(archive->SetPackAccessible(true, testArchivePathB));
+            EXPECT_EQ("B", readFile("data/shared.txt"));
+
+            EXPECT_TRUE(archive->ClosePack(testArchivePathB));
+            EXPECT_EQ("A", readFile("data/shared.txt"));
+            EXPECT_TRUE(archive->ClosePack(testArchivePathA));
+            EXPECT_FALSE(archive->IsFileExist("data/shared.txt", AZ::IO::IArchive::eFileLocation_InPak));
+        }
+
+        console->PerformCommand("az_archive_path_index", { "true" });
+        fileIo->Remove(testArchivePathA);
+        fileIo->Remove(testArchivePathB);
+    }
+
     // test that ArchiveFileIO class works as expected
     TEST_F(ArchiveTestFixture, TestArchiveViaFileIO)
     {
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
@@ -107,6 +108,15 @@ namespace Benchmark
             }
         }
 
+        void MoveEntries(uint32_t entryCount, const AZ::Vector3& offset)
+        {
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume.Translate(offset);
+                m_visScene->InsertOrUpdateEntry(m_dataArray[i]);
+            }
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -328,6 +338,121 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    //! Runs the benchmarks with the octree configured by the second benchmark argument.
+    class BM_OctreeUpdate
+        : public BM_Octree
+    {
+    public:
+        enum UpdateMode : int64_t
+        {
+            Immediate,
+            Deferred,
+            DeferredLoose
+        };
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            BM_Octree::SetUp(state);
+
+            if (AZ::Interface<AZ::IConsole>::Get() == nullptr)
+            {
+                m_console = aznew AZ::Console();
+                AZ::Interface<AZ::IConsole>::Register(m_console);
+                m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            }
+
+            const UpdateMode updateMode = static_cast<UpdateMode>(state.range(1));
+            AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+            console->PerformCommand((updateMode == Immediate) ? "bg_octreeDeferUpdates false" : "bg_octreeDeferUpdates true");
+            console->PerformCommand((updateMode == DeferredLoose) ? "bg_octreeLooseness 2" : "bg_octreeLooseness 1");
+
+            // The looseness is fixed when a scene is created, so recreate the scene with the new configuration
+            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+            m_octreeScene = azdynamic_cast<AzFramework::OctreeScene*>(m_visScene);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+            console->PerformCommand("bg_octreeDeferUpdates false");
+            console->PerformCommand("bg_octreeLooseness 1");
+
+            if (m_console != nullptr)
+            {
+                AZ::Interface<AZ::IConsole>::Unregister(m_console);
+                delete m_console;
+                m_console = nullptr;
+            }
+
+            BM_Octree::TearDown(state);
+        }
+
+        AZ::Console* m_console = nullptr;
+        AzFramework::OctreeScene* m_octreeScene = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(BM_OctreeUpdate, Insert)(benchmark::State& state)
+    {
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(state.range(0));
+        for (auto _ : state)
+        {
+            InsertEntries(entryCount);
+            m_octreeScene->ApplyPendingUpdates();
+
+            state.PauseTiming();
+            RemoveEntries(entryCount);
+            state.ResumeTiming();
+        }
+    }
+
+    // Moves every entry by a small distance each iteration, as a scene full of moving objects would every frame
+    BENCHMARK_DEFINE_F(BM_OctreeUpdate, Update)(benchmark::State& state)
+    {
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(state.range(0));
+        InsertEntries(entryCount);
+        m_octreeScene->ApplyPendingUpdates();
+
+        float offset = 2.0f;
+        for (auto _ : state)
+        {
+            offset = -offset;
+            MoveEntries(entryCount, AZ::Vector3(offset));
+            m_octreeScene->ApplyPendingUpdates();
+        }
+        RemoveEntries(entryCount);
+    }
+
+    BENCHMARK_DEFINE_F(BM_OctreeUpdate, EnumerateFrustum)(benchmark::State& state)
+    {
+        const uint32_t entryCount = aznumeric_cast<uint32_t>(state.range(0));
+        InsertEntries(entryCount);
+        m_octreeScene->ApplyPendingUpdates();
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(entryCount);
+    }
+
+    static void OctreeUpdateArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int64_t entryCount : { 10000, 100000, 1000000 })
+        {
+            for (int64_t updateMode : { BM_OctreeUpdate::Immediate, BM_OctreeUpdate::Deferred, BM_OctreeUpdate::DeferredLoose })
+            {
+                benchmark->Args({ entryCount, updateMode });
+            }
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_OctreeUpdate, Insert)->Apply(OctreeUpdateArguments);
+    BENCHMARK_REGISTER_F(BM_OctreeUpdate, Update)->Apply(OctreeUpdateArguments);
+    BENCHMARK_REGISTER_F(BM_OctreeUpdate, EnumerateFrustum)->Apply(OctreeUpdateArguments);
 }
 
 #endif
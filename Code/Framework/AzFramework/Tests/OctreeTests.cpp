@@ -9,6 +9,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
@@ -38,6 +39,8 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
+            m_console->GetCvarValue("bg_octreeDeferUpdates", m_savedDeferUpdates);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
@@ -63,6 +66,10 @@ namespace UnitTest
             m_console->PerformCommand(commandString.c_str());
             commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
             m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeDeferUpdates %s", m_savedDeferUpdates ? "true" : "false");
+            m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
             delete m_octreeSystemComponent;
@@ -88,6 +95,8 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 1.0f;
+        bool m_savedDeferUpdates = false;
         AZ::Console* m_console;
     };
 
@@ -420,4 +429,148 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    void ValidateEntryBoundsMatchEntries(const IVisibilityScene* visScene)
+    {
+        visScene->EnumerateNoCull([](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            ASSERT_NE(nodeData.m_entryBounds, nullptr);
+            for (size_t i = 0; i < nodeData.m_entries.size(); ++i)
+            {
+                const AZ::Aabb& bounds = nodeData.m_entries[i]->m_boundingVolume;
+                const VisibilityEntryBoundsBatch& batch = nodeData.m_entryBounds[i / VisibilityEntryBoundsBatch::EntryCount];
+                const size_t lane = i % VisibilityEntryBoundsBatch::EntryCount;
+                EXPECT_NEAR(batch.m_centerX[lane], bounds.GetCenter().GetX(), 0.0001f);
+                EXPECT_NEAR(batch.m_centerY[lane], bounds.GetCenter().GetY(), 0.0001f);
+                EXPECT_NEAR(batch.m_centerZ[lane], bounds.GetCenter().GetZ(), 0.0001f);
+                EXPECT_NEAR(batch.m_halfExtentX[lane], 0.5f * bounds.GetXExtent(), 0.0001f);
+                EXPECT_NEAR(batch.m_halfExtentY[lane], 0.5f * bounds.GetYExtent(), 0.0001f);
+                EXPECT_NEAR(batch.m_halfExtentZ[lane], 0.5f * bounds.GetZExtent(), 0.0001f);
+            }
+        });
+    }
+
+    TEST_F(OctreeTests, EntryBoundsFollowInsertUpdateRemove)
+    {
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 8");
+        m_console->PerformCommand("bg_octreeNodeMinEntries 4");
+
+        constexpr uint32_t EntryCount = 64;
+        std::mt19937 randomGenerator(1234);
+        std::uniform_real_distribution<float> positionDistribution(-0.9f, 0.8f);
+        std::uniform_real_distribution<float> sizeDistribution(0.01f, 0.1f);
+        auto randomBounds = [&]()
+        {
+            const AZ::Vector3 min(positionDistribution(randomGenerator), positionDistribution(randomGenerator), positionDistribution(randomGenerator));
+            return AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(sizeDistribution(randomGenerator)));
+        };
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume = randomBounds();
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, EntryCount);
+        ValidateEntryBoundsMatchEntries(m_octreeScene);
+
+        // Move every other entry, some will stay within their node and some will move to a different node
+        for (uint32_t i = 0; i < EntryCount; i += 2)
+        {
+            visEntries[i].m_boundingVolume = randomBounds();
+            m_octreeScene->InsertOrUpdateEntry(visEntries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, EntryCount);
+        ValidateEntryBoundsMatchEntries(m_octreeScene);
+
+        // Remove most entries to force merges
+        for (uint32_t i = 0; i < EntryCount - 3; ++i)
+        {
+            m_octreeScene->RemoveEntry(visEntries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        ValidateEntryBoundsMatchEntries(m_octreeScene);
+
+        for (uint32_t i = EntryCount - 3; i < EntryCount; ++i)
+        {
+            m_octreeScene->RemoveEntry(visEntries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, DeferredUpdatesInLooseOctree)
+    {
+        m_console->PerformCommand("bg_octreeNodeMaxEntries 8");
+        m_console->PerformCommand("bg_octreeNodeMinEntries 4");
+        m_console->PerformCommand("bg_octreeLooseness 1.5");
+        m_console->PerformCommand("bg_octreeDeferUpdates true");
+
+        // The looseness is fixed when a scene is created
+        OctreeScene* looseScene = azdynamic_cast<OctreeScene*>(m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseUnitTestScene")));
+        ASSERT_NE(looseScene, nullptr);
+
+        constexpr uint32_t EntryCount = 64;
+        std::mt19937 randomGenerator(5678);
+        std::uniform_real_distribution<float> positionDistribution(-0.9f, 0.8f);
+        std::uniform_real_distribution<float> sizeDistribution(0.01f, 0.1f);
+        auto randomBounds = [&]()
+        {
+            const AZ::Vector3 min(positionDistribution(randomGenerator), positionDistribution(randomGenerator), positionDistribution(randomGenerator));
+            return AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(sizeDistribution(randomGenerator)));
+        };
+
+        auto validateEntriesFitTheirNode = [](const AZStd::vector<AzFramework::VisibilityEntry>& entries)
+        {
+            for (const AzFramework::VisibilityEntry& entry : entries)
+            {
+                if (entry.m_internalNode != nullptr)
+                {
+                    const OctreeNode* node = static_cast<const OctreeNode*>(entry.m_internalNode);
+                    EXPECT_TRUE(AZ::ShapeIntersection::Contains(node->GetLooseBounds(), entry.m_boundingVolume));
+                }
+            }
+        };
+
+        // Inserts are queued until the updates are applied
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume = randomBounds();
+            looseScene->InsertOrUpdateEntry(entry);
+            EXPECT_TRUE(entry.m_internalNode == nullptr);
+        }
+        EXPECT_EQ(looseScene->GetPendingUpdateCount(), EntryCount);
+
+        looseScene->ApplyPendingUpdates();
+        EXPECT_EQ(looseScene->GetPendingUpdateCount(), 0u);
+        ValidateEntryCountEqualsExpectedCount(looseScene, EntryCount);
+        ValidateEntryBoundsMatchEntries(looseScene);
+        validateEntriesFitTheirNode(visEntries);
+
+        // Move every other entry, then remove a moved entry and an entry that didn't move before the updates are applied
+        for (uint32_t i = 0; i < EntryCount; i += 2)
+        {
+            visEntries[i].m_boundingVolume = randomBounds();
+            looseScene->InsertOrUpdateEntry(visEntries[i]);
+        }
+        EXPECT_EQ(looseScene->GetPendingUpdateCount(), EntryCount / 2);
+        looseScene->RemoveEntry(visEntries[0]);
+        looseScene->RemoveEntry(visEntries[1]);
+        EXPECT_EQ(looseScene->GetPendingUpdateCount(), EntryCount / 2 - 1);
+        EXPECT_EQ(visEntries[0].m_internalPendingIndex, VisibilityEntry::InvalidIndex);
+
+        // Queries apply the pending updates first
+        ValidateEntryCountEqualsExpectedCount(looseScene, EntryCount - 2);
+        EXPECT_EQ(looseScene->GetPendingUpdateCount(), 0u);
+        ValidateEntryBoundsMatchEntries(looseScene);
+        validateEntriesFitTheirNode(visEntries);
+
+        for (uint32_t i = 2; i < EntryCount; ++i)
+        {
+            looseScene->RemoveEntry(visEntries[i]);
+        }
+        ValidateEntryCountEqualsExpectedCount(looseScene, 0);
+
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
 }
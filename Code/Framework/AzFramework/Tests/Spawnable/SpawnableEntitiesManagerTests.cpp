@@ -55,6 +55,33 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    // Test component that stores entity references in a container, which can't be patched by a spawnable clone plan.
+    class ComponentWithEntityReferenceList : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithEntityReferenceList, "{2F0C8D94-61B7-4E3A-A5D2-7C9E13B4F856}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithEntityReferenceList, AZ::Component>()
+                    ->Field("EntityReferences", &ComponentWithEntityReferenceList::m_entityReferences)
+                    ;
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> m_entityReferences;
+    };
+
     class SpawnableEntitiesManagerTest : public AllocatorsFixture
     {
     public:
@@ -66,6 +93,7 @@ namespace UnitTest
             AZ::ComponentApplication::Descriptor descriptor;
             m_application->Start(descriptor);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithEntityReferenceList::CreateDescriptor());
 
             // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
             // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
@@ -366,6 +394,93 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_WithClonePlan_EntityIdsAreMappedCorrectly)
+    {
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceThemselves, EntityReferenceScheme::AllReferenceNextCircular,
+                EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 4;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+            m_spawnable->BuildClonePlan(*m_application->GetSerializeContext());
+
+            const AzFramework::SpawnableClonePlan* clonePlan = m_spawnable->GetClonePlan();
+            ASSERT_NE(nullptr, clonePlan);
+            EXPECT_TRUE(clonePlan->IsFullyPatchable());
+
+            auto callback = [this, refScheme]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableClonePlan_Clone_PatchesReferencesToMappedEntitiesOnly)
+    {
+        constexpr size_t NumEntities = 2;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        const AZ::EntityId unmappedId = AZ::Entity::MakeId();
+        entities[0]->CreateComponent<ComponentWithEntityReference>()->m_entityReference = entities[1]->GetId();
+        entities[1]->CreateComponent<ComponentWithEntityReference>()->m_entityReference = unmappedId;
+
+        AzFramework::SpawnableClonePlan clonePlan(entities, *m_application->GetSerializeContext());
+        AzFramework::SpawnableClonePlan::EntityIdMap idMap;
+        idMap.emplace(entities[0]->GetId(), AZ::Entity::MakeId());
+        idMap.emplace(entities[1]->GetId(), AZ::Entity::MakeId());
+
+        AZStd::unique_ptr<AZ::Entity> first(clonePlan.Clone(*entities[0], idMap));
+        AZStd::unique_ptr<AZ::Entity> second(clonePlan.Clone(*entities[1], idMap));
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+
+        EXPECT_EQ(idMap[entities[0]->GetId()], first->GetId());
+        EXPECT_EQ(idMap[entities[1]->GetId()], second->GetId());
+        EXPECT_EQ(second->GetId(), first->FindComponent<ComponentWithEntityReference>()->m_entityReference);
+        EXPECT_EQ(unmappedId, second->FindComponent<ComponentWithEntityReference>()->m_entityReference);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableClonePlan_ReferencesInContainer_FallsBackToRemapping)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            auto component = entities[i]->CreateComponent<ComponentWithEntityReferenceList>();
+            component->m_entityReferences.push_back(entities[(i + 1) % NumEntities]->GetId());
+        }
+        m_spawnable->BuildClonePlan(*m_application->GetSerializeContext());
+
+        const AzFramework::SpawnableClonePlan* clonePlan = m_spawnable->GetClonePlan();
+        ASSERT_NE(nullptr, clonePlan);
+        EXPECT_FALSE(clonePlan->IsFullyPatchable());
+        EXPECT_FALSE(clonePlan->CanClone(*entities[0]));
+
+        auto callback = [](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ASSERT_EQ(NumEntities, entities.size());
+            for (size_t i = 0; i < NumEntities; ++i)
+            {
+                auto component = (*(entities.begin() + i))->FindComponent<ComponentWithEntityReferenceList>();
+                ASSERT_NE(nullptr, component);
+                ASSERT_EQ(1, component->m_entityReferences.size());
+                EXPECT_EQ((*(entities.begin() + ((i + 1) % NumEntities)))->GetId(), component->m_entityReferences[0]);
+            }
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, EntitySpawnTicket_Move_Works)
     {
         AzFramework::EntitySpawnTicket ticket1(*m_spawnableAsset);
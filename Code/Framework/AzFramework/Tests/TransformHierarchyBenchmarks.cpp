@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/DeferredTransformHierarchy.h>
+#include <AzFramework/Components/TransformComponent.h>
+
+namespace Benchmark
+{
+    // Moves the roots of a transform hierarchy several times per frame, the way gameplay code often sets a transform
+    // more than once per frame, and then reads back the world transforms of the leaves.
+    // Compares eager transform updates with the deferred transform hierarchy, which resolves the world transforms
+    // once per frame, for deep chains and for wide trees.
+    class TransformHierarchyBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int64_t ChainDepth = 64;
+        static constexpr int64_t TreeWidth = 32;
+        static constexpr int MovesPerFrame = 4;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_application = AZStd::make_unique<AzFramework::Application>();
+            m_application->Start(AZ::ComponentApplication::Descriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_hierarchy = AZ::Interface<AzFramework::DeferredTransformHierarchy>::Get();
+            m_entityCount = state.range(0);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            // Children first, so that no entity deactivates while its children are active
+            for (auto it = m_entities.rbegin(); it != m_entities.rend(); ++it)
+            {
+                delete *it;
+            }
+            m_entities = {};
+            m_roots = {};
+            m_leaves = {};
+
+            if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+            {
+                console->PerformCommand("az_deferredTransformHierarchy", { "false" });
+            }
+            m_application->Stop();
+            m_application.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZ::EntityId CreateTransformEntity(AZ::EntityId parentId)
+        {
+            auto* entity = aznew AZ::Entity();
+            entity->CreateComponent<AzFramework::TransformComponent>();
+            entity->Init();
+            entity->Activate();
+            m_entities.push_back(entity);
+
+            const AZ::EntityId entityId = entity->GetId();
+            if (parentId.IsValid())
+            {
+                AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetParentRelative, parentId);
+                AZ::TransformBus::Event(entityId, &AZ::TransformBus::Events::SetLocalTranslation, AZ::Vector3(0.0f, 1.0f, 0.0f));
+            }
+            return entityId;
+        }
+
+        void CreateHierarchy(bool deferred, bool deep)
+        {
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("az_deferredTransformHierarchy", { deferred ? "true" : "false" });
+
+            if (deep)
+            {
+                // Chains of ChainDepth entities
+                for (int64_t chainIndex = 0; chainIndex < m_entityCount / ChainDepth; ++chainIndex)
+                {
+                    AZ::EntityId entityId = CreateTransformEntity(AZ::EntityId());
+                    m_roots.push_back(entityId);
+                    for (int64_t depth = 1; depth < ChainDepth; ++depth)
+                    {
+                        entityId = CreateTransformEntity(entityId);
+                    }
+                    m_leaves.push_back(entityId);
+                }
+            }
+            else
+            {
+                // One root with TreeWidth children, which share the remaining entities as their children
+                const AZ::EntityId rootId = CreateTransformEntity(AZ::EntityId());
+                m_roots.push_back(rootId);
+                AZStd::vector<AZ::EntityId> branches;
+                for (int64_t branchIndex = 0; branchIndex < TreeWidth; ++branchIndex)
+                {
+                    branches.push_back(CreateTransformEntity(rootId));
+                }
+                for (int64_t leafIndex = 0; leafIndex < m_entityCount - TreeWidth - 1; ++leafIndex)
+                {
+                    m_leaves.push_back(CreateTransformEntity(branches[leafIndex % TreeWidth]));
+                }
+            }
+
+            ProcessTransformChanges();
+        }
+
+        void ProcessTransformChanges()
+        {
+            if (m_hierarchy)
+            {
+                m_hierarchy->ProcessTransformChanges();
+            }
+        }
+
+        void MoveRoots(::benchmark::State& state)
+        {
+            float offset = 0.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (int move = 0; move < MovesPerFrame; ++move)
+                {
+                    offset += 0.01f;
+                    for (const AZ::EntityId& rootId : m_roots)
+                    {
+                        AZ::TransformBus::Event(rootId, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(offset, 0.0f, 0.0f));
+                    }
+                }
+                ProcessTransformChanges();
+
+                AZ::Vector3 leafTranslationSum = AZ::Vector3::CreateZero();
+                for (const AZ::EntityId& leafId : m_leaves)
+                {
+                    AZ::Vector3 leafTranslation = AZ::Vector3::CreateZero();
+                    AZ::TransformBus::EventResult(leafTranslation, leafId, &AZ::TransformBus::Events::GetWorldTranslation);
+                    leafTranslationSum += leafTranslation;
+                }
+                benchmark::DoNotOptimize(leafTranslationSum);
+            }
+            state.SetItemsProcessed(state.iterations() * m_entityCount);
+            state.counters["Roots"] = aznumeric_cast<double>(m_roots.size());
+        }
+
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        AzFramework::DeferredTransformHierarchy* m_hierarchy = nullptr;
+        AZStd::vector<AZ::Entity*> m_entities;
+        AZStd::vector<AZ::EntityId> m_roots;
+        AZStd::vector<AZ::EntityId> m_leaves;
+        int64_t m_entityCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(TransformHierarchyBenchmarkFixture, DeepChains_Eager)(benchmark::State& state)
+    {
+        CreateHierarchy(false, true);
+        MoveRoots(state);
+    }
+
+    BENCHMARK_DEFINE_F(TransformHierarchyBenchmarkFixture, DeepChains_Deferred)(benchmark::State& state)
+    {
+        CreateHierarchy(true, true);
+        MoveRoots(state);
+    }
+
+    BENCHMARK_DEFINE_F(TransformHierarchyBenchmarkFixture, WideTree_Eager)(benchmark::State& state)
+    {
+        CreateHierarchy(false, false);
+        MoveRoots(state);
+    }
+
+    BENCHMARK_DEFINE_F(TransformHierarchyBenchmarkFixture, WideTree_Deferred)(benchmark::State& state)
+    {
+        CreateHierarchy(true, false);
+        MoveRoots(state);
+    }
+
+    BENCHMARK_REGISTER_F(TransformHierarchyBenchmarkFixture, DeepChains_Eager)
+        ->Arg(4096)->Arg(32768)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TransformHierarchyBenchmarkFixture, DeepChains_Deferred)
+        ->Arg(4096)->Arg(32768)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TransformHierarchyBenchmarkFixture, WideTree_Eager)
+        ->Arg(4096)->Arg(32768)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TransformHierarchyBenchmarkFixture, WideTree_Deferred)
+        ->Arg(4096)->Arg(32768)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif
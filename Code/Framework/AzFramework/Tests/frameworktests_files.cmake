@@ -9,6 +9,7 @@
 set(FILES
     ../../AzCore/Tests/Main.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
+    ArchiveBenchmarks.cpp
     ArchiveCompressionTests.cpp
     ArchiveTests.cpp
     BehaviorEntityTests.cpp
@@ -22,6 +23,7 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    TransformHierarchyBenchmarks.cpp
     AssetCatalog.cpp
     AssetProcessorConnection.cpp
     NativeWindow.cpp
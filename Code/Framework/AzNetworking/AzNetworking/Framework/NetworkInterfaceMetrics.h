@@ -32,18 +32,34 @@ namespace AzNetworking
         uint64_t m_sendCompressedPacketsNoGain = 0;
         //! Returns the delta gain of bytes saved (+) or lost (-) due to compression.
         int64_t m_sendBytesCompressedDelta = 0;
+        //! Returns the total number of packets passed to the compressor on this network interface.
+        uint64_t m_sendPacketsCompressed = 0;
+        //! Returns the total number of payload bytes passed to the compressor, divide by m_sendBytesPostCompression for the compression ratio.
+        uint64_t m_sendBytesPreCompression = 0;
+        //! Returns the total number of bytes produced by the compressor.
+        uint64_t m_sendBytesPostCompression = 0;
+        //! Returns the total number of microseconds spent compressing packets.
+        uint64_t m_compressTimeUs = 0;
         //! Returns the numbers of bytes added by encryption.
         uint64_t m_sendBytesEncryptionInflation = 0;
+        //! Returns the total number of system calls used to send batches of packets on this socket.
+        uint64_t m_sendBatches = 0;
         //! Returns the total number of packets that had to be resent on this network interface due to packet loss.
         uint64_t m_resentPackets = 0;
         //! Returns the total number of milliseconds spent processing received data on this network interface.
         AZ::TimeMs m_recvTimeMs = AZ::TimeMs{ 0 };
         //! Returns the total number of packets received on this socket.
         uint64_t m_recvPackets = 0;
+        //! Returns the total number of system calls that received packets on this socket.
+        uint64_t m_recvBatches = 0;
         //! Returns the total number of bytes received on this socket after compression.
         uint64_t m_recvBytes = 0;
         //! Returns the total number of bytes received on this socket before compression.
         uint64_t m_recvBytesUncompressed = 0;
+        //! Returns the total number of packets decompressed on this network interface.
+        uint64_t m_recvPacketsDecompressed = 0;
+        //! Returns the total number of microseconds spent decompressing packets.
+        uint64_t m_decompressTimeUs = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
     };
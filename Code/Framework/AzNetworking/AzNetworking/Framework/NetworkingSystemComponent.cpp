@@ -190,12 +190,23 @@ namespace AzNetworking
             AZLOG_INFO(" - Total send time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendTimeMs));
             AZLOG_INFO(" - Total sent packets: %llu", aznumeric_cast<AZ::s64>(metrics.m_sendPackets));
             AZLOG_INFO(" - Total sent bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytes));
+            AZLOG_INFO(" - Total sent packet batches: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBatches));
             AZLOG_INFO(" - Total sent bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBytesUncompressed));
             AZLOG_INFO(" - Total sent compressed packets without benefit: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendCompressedPacketsNoGain));
             AZLOG_INFO(" - Total gain from packet compression: %lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
+            if (metrics.m_sendPacketsCompressed > 0 && metrics.m_sendBytesPostCompression > 0)
+            {
+                AZLOG_INFO(" - Packet compression ratio: %.3f", aznumeric_cast<double>(metrics.m_sendBytesPreCompression) / aznumeric_cast<double>(metrics.m_sendBytesPostCompression));
+                AZLOG_INFO(" - Average compression time per packet in microseconds: %.3f", aznumeric_cast<double>(metrics.m_compressTimeUs) / aznumeric_cast<double>(metrics.m_sendPacketsCompressed));
+            }
+            if (metrics.m_recvPacketsDecompressed > 0)
+            {
+                AZLOG_INFO(" - Average decompression time per packet in microseconds: %.3f", aznumeric_cast<double>(metrics.m_decompressTimeUs) / aznumeric_cast<double>(metrics.m_recvPacketsDecompressed));
+            }
             AZLOG_INFO(" - Total packets resent: %llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
             AZLOG_INFO(" - Total receive time in milliseconds: %lld", aznumeric_cast<AZ::s64>(metrics.m_recvTimeMs));
             AZLOG_INFO(" - Total received packets: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvPackets));
+            AZLOG_INFO(" - Total received packet batches: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBatches));
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
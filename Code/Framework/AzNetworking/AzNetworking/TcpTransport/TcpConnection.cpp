@@ -17,6 +17,7 @@
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/time.h>
 
 namespace AzNetworking
 {
@@ -296,7 +297,9 @@ namespace AzNetworking
         {
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadBuffer.GetSize());
             AZStd::size_t compressionMemBytesUsed = 0;
+            const AZStd::sys_time_t compressStartTimeUs = AZStd::GetTimeNowMicroSecond();
             CompressorError compErr = m_compressor->Compress(payloadBuffer.GetBuffer(), payloadBuffer.GetSize(), writeBuffer.GetBuffer(), maxSizeNeeded, compressionMemBytesUsed);
+            m_networkInterface.GetMetrics().m_compressTimeUs += AZStd::GetTimeNowMicroSecond() - compressStartTimeUs;
 
             if (compErr != CompressorError::Ok)
             {
@@ -304,6 +307,10 @@ namespace AzNetworking
                 return false;
             }
 
+            m_networkInterface.GetMetrics().m_sendPacketsCompressed++;
+            m_networkInterface.GetMetrics().m_sendBytesPreCompression += payloadBuffer.GetSize();
+            m_networkInterface.GetMetrics().m_sendBytesPostCompression += compressionMemBytesUsed;
+
             if (compressionMemBytesUsed >= payloadSize)
             {
                 // Track how many packets are being sent with no compression gain
@@ -360,11 +367,15 @@ namespace AzNetworking
         const uint8_t* srcData = serializer.GetUnreadData();
         if (m_compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
         {
-            if (!DecompressPacket(srcData, packetSize, outBuffer))
+            const AZStd::sys_time_t decompressStartTimeUs = AZStd::GetTimeNowMicroSecond();
+            const bool decompressed = DecompressPacket(srcData, packetSize, outBuffer);
+            m_networkInterface.GetMetrics().m_decompressTimeUs += AZStd::GetTimeNowMicroSecond() - decompressStartTimeUs;
+            if (!decompressed)
             {
                 AZLOG_WARN("Failed to decompress packet!");
                 return false;
             }
+            m_networkInterface.GetMetrics().m_recvPacketsDecompressed++;
             srcData = outBuffer.GetBuffer();
             packetSize = aznumeric_cast<uint16_t>(outBuffer.GetSize());
         }
@@ -17,6 +17,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/time.h>
 
 namespace AzNetworking
 {
@@ -174,6 +175,9 @@ namespace AzNetworking
             return;
         }
 
+        // Acks, handshakes and resends generated during the update are handed to the OS together when the update completes
+        m_socket->BeginSendBatch();
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -243,11 +247,15 @@ namespace AzNetworking
             if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
             {
                 // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+                const AZStd::sys_time_t decompressStartTimeUs = AZStd::GetTimeNowMicroSecond();
+                const bool decompressed = DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer);
+                GetMetrics().m_decompressTimeUs += AZStd::GetTimeNowMicroSecond() - decompressStartTimeUs;
+                if (!decompressed)
                 {
                     AZLOG_WARN("Failed to decompress packet!");
                     continue;
                 }
+                GetMetrics().m_recvPacketsDecompressed++;
                 decodedPacketData = m_decompressBuffer.GetBuffer();
                 decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
             }
@@ -337,6 +345,8 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        m_socket->FlushSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -345,6 +355,8 @@ namespace AzNetworking
         GetMetrics().m_recvTimeMs += receiveTimeMs;
         GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
         GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        GetMetrics().m_sendBatches = m_socket->GetSentBatches();
+        GetMetrics().m_recvBatches = m_socket->GetRecvBatches();
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
@@ -582,7 +594,9 @@ namespace AzNetworking
             uint8_t* payload = buffer.GetBuffer() + flagSize;
             const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
+            const AZStd::sys_time_t compressStartTimeUs = AZStd::GetTimeNowMicroSecond();
             CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            GetMetrics().m_compressTimeUs += AZStd::GetTimeNowMicroSecond() - compressStartTimeUs;
 
             if (compErr != CompressorError::Ok)
             {
@@ -590,6 +604,10 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
+            GetMetrics().m_sendPacketsCompressed++;
+            GetMetrics().m_sendBytesPreCompression += payloadSize;
+            GetMetrics().m_sendBytesPostCompression += compressionMemBytesUsed;
+
             // Only use compression if there's actual gain
             if (compressionMemBytesUsed < payloadSize)
             {
@@ -597,8 +615,13 @@ namespace AzNetworking
                 packetSize = static_cast<uint32_t>(writeBuffer.GetSize());
                 packetData = writeBuffer.GetBuffer();
                 // Track byte delta caused by compression
-                GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
-            }        
+                GetMetrics().m_sendBytesCompressedDelta += (payloadSize - compressionMemBytesUsed);
+            }
+            else
+            {
+                // Track how many packets are being sent with no compression gain
+                GetMetrics().m_sendCompressedPacketsNoGain++;
+            }
         }
 
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,29 +177,72 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
+                // Each packet is received into its own slot, a coalesced receive may hold many packets in one slot
+                const uint32_t slotSize = socket->IsReceiveCoalescingEnabled() ? UdpSocket::MaxCoalescedReceiveSize : MaxUdpTransmissionUnit;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
-                if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
+                if (bufferHead + slotSize >= receiveBuffer.GetCapacity())
                 {
                     AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
-                        aznumeric_cast<int32_t>(bufferHead + MaxUdpTransmissionUnit - receiveBuffer.GetCapacity()));
+                        aznumeric_cast<int32_t>(bufferHead + slotSize - receiveBuffer.GetCapacity()));
                     break;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                if (receivedPackets.full())
+                {
+                    break;
+                }
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const uint32_t freeSlots = (static_cast<uint32_t>(receiveBuffer.GetCapacity()) - bufferHead - 1) / slotSize;
+                const uint32_t freePackets = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t slotCount = AZStd::min(AZStd::min(freeSlots, freePackets), UdpSocket::MaxBatchPacketCount);
+
+                UdpBatchPacket packets[UdpSocket::MaxBatchPacketCount];
+                uint8_t* dstData = receiveBuffer.GetBufferEnd();
+                for (uint32_t i = 0; i < slotCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    packets[i].m_data = dstData + i * slotSize;
+                    packets[i].m_size = slotSize;
                 }
-                else
+                receiveBuffer.Resize(bufferHead + slotCount * slotSize);
+
+                const int32_t receivedCount = socket->ReceiveBatch(packets, slotCount);
+                if (receivedCount <= 0)
                 {
                     receiveBuffer.Resize(bufferHead);
                     break;
                 }
+
+                // Compact the received packets so the unused tail of each slot is returned to the buffer
+                uint32_t writeOffset = bufferHead;
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    const UdpBatchPacket& packet = packets[i];
+                    uint8_t* packetData = receiveBuffer.GetBuffer() + writeOffset;
+                    if (packetData != packet.m_data)
+                    {
+                        memmove(packetData, packet.m_data, packet.m_size);
+                    }
+
+                    const uint32_t segmentSize = (packet.m_segmentSize > 0) ? packet.m_segmentSize : packet.m_size;
+                    for (uint32_t offset = 0; offset < packet.m_size; offset += segmentSize)
+                    {
+                        if (receivedPackets.full())
+                        {
+                            AZLOG_INFO("Received packet list full, dropping coalesced packets");
+                            break;
+                        }
+                        const uint32_t receivedBytes = AZStd::min(segmentSize, packet.m_size - offset);
+                        receivedPackets.push_back(ReceivedPacket(packet.m_address, packetData + offset, static_cast<int32_t>(receivedBytes)));
+                    }
+                    writeOffset += packet.m_size;
+                }
+                receiveBuffer.Resize(writeOffset);
+
+                if (static_cast<uint32_t>(receivedCount) < slotCount)
+                {
+                    // The socket has been drained
+                    break;
+                }
             }
         }
         m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
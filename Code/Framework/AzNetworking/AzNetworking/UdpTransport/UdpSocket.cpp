@@ -23,6 +23,17 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpUseBatchedIo, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets send and receive multiple packets per system call where the platform supports it");
+    AZ_CVAR(bool, net_UdpUseGso, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, batched sends of equally sized packets to the same address are segmented by the OS (UDP GSO) where supported");
+    AZ_CVAR(bool, net_UdpUseGro, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets opened afterwards let the OS coalesce received packets (UDP GRO) where supported, this requires larger receive buffers");
+
+    namespace Platform
+    {
+        bool SupportsBatchedIo();
+        bool SetReceiveCoalescing(SocketFd socketFd, bool enable);
+        int32_t SendBatch(SocketFd socketFd, const UdpBatchPacket* packets, uint32_t packetCount, bool& useSegmentation);
+        int32_t ReceiveBatch(SocketFd socketFd, UdpBatchPacket* packets, uint32_t packetCount);
+    }
 
     UdpSocket::~UdpSocket()
     {
@@ -93,13 +104,23 @@ namespace AzNetworking
             return false;
         }
 
+        m_receiveCoalescing = net_UdpUseBatchedIo && net_UdpUseGro && Platform::SupportsBatchedIo()
+            && Platform::SetReceiveCoalescing(m_socketFd, true);
+
         return true;
     }
 
     void UdpSocket::Close()
     {
+        if (m_sendQueue != nullptr)
+        {
+            FlushSendQueue();
+            m_sendQueue->m_active = false;
+        }
+
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
+        m_receiveCoalescing = false;
     }
 
     int32_t UdpSocket::Send
@@ -226,9 +247,152 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(UdpBatchPacket* packets, uint32_t packetCount) const
+    {
+        AZ_Assert(packets != nullptr, "NULL packet array passed to receive");
+
+        if (!IsOpen() || (packetCount == 0))
+        {
+            return 0;
+        }
+
+        packetCount = AZStd::min(packetCount, MaxBatchPacketCount);
+
+        if (!net_UdpUseBatchedIo || !Platform::SupportsBatchedIo())
+        {
+            // Fall back to one system call per packet, Receive handles error reporting and statistics
+            uint32_t receivedCount = 0;
+            for (; receivedCount < packetCount; ++receivedCount)
+            {
+                UdpBatchPacket& packet = packets[receivedCount];
+                const int32_t receivedBytes = Receive(packet.m_address, packet.m_data, packet.m_size);
+                if (receivedBytes <= 0)
+                {
+                    break;
+                }
+                packet.m_size = static_cast<uint32_t>(receivedBytes);
+                packet.m_segmentSize = 0;
+            }
+            return static_cast<int32_t>(receivedCount);
+        }
+
+        const int32_t receivedCount = Platform::ReceiveBatch(m_socketFd, packets, packetCount);
+
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                return 0;
+            }
+
+            bool ignoreForciblyClosedError = false;
+            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            {
+                return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+            }
+
+            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        if (receivedCount > 0)
+        {
+            ++m_recvBatches;
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                const UdpBatchPacket& packet = packets[i];
+                m_recvPackets += (packet.m_segmentSize > 0) ? (packet.m_size + packet.m_segmentSize - 1) / packet.m_segmentSize : 1;
+                m_recvBytes += packet.m_size;
+            }
+        }
+
+        return receivedCount;
+    }
+
+    void UdpSocket::BeginSendBatch() const
+    {
+        if (!IsOpen() || !net_UdpUseBatchedIo || !Platform::SupportsBatchedIo())
+        {
+            return;
+        }
+
+        if (m_sendQueue == nullptr)
+        {
+            m_sendQueue = AZStd::make_unique<SendQueue>();
+            for (uint32_t i = 0; i < MaxBatchPacketCount; ++i)
+            {
+                m_sendQueue->m_packets[i].m_data = m_sendQueue->m_buffers[i].data();
+            }
+        }
+
+        AZ_Assert(!m_sendQueue->m_active, "BeginSendBatch called while a send batch is already active");
+        m_sendQueue->m_active = true;
+        m_sendQueue->m_useSegmentation = net_UdpUseGso;
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        if (m_sendQueue == nullptr || !m_sendQueue->m_active)
+        {
+            return;
+        }
+
+        FlushSendQueue();
+        m_sendQueue->m_active = false;
+    }
+
+    int32_t UdpSocket::QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const
+    {
+        if (m_sendQueue->m_packetCount >= MaxBatchPacketCount)
+        {
+            FlushSendQueue();
+        }
+
+        UdpBatchPacket& packet = m_sendQueue->m_packets[m_sendQueue->m_packetCount++];
+        packet.m_address = address;
+        packet.m_size = size;
+        memcpy(packet.m_data, data, size);
+        return static_cast<int32_t>(size);
+    }
+
+    void UdpSocket::FlushSendQueue() const
+    {
+        const uint32_t packetCount = m_sendQueue->m_packetCount;
+        if (packetCount == 0 || !IsOpen())
+        {
+            m_sendQueue->m_packetCount = 0;
+            return;
+        }
+
+        m_sendQueue->m_packetCount = 0;
+        ++m_sentBatches;
+
+        const int32_t sentCount = Platform::SendBatch(m_socketFd, m_sendQueue->m_packets.data(), packetCount, m_sendQueue->m_useSegmentation);
+
+        if (sentCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+
+            if (!ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+        }
+
+        // Packets the OS didn't accept are dropped the same way a single send hitting a full send buffer is,
+        // reliability is handled by the layers above
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if ((m_sendQueue != nullptr) && m_sendQueue->m_active && (size <= MaxUdpTransmissionUnit))
+        {
+            return QueueSend(address, data, size);
+        }
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -13,7 +13,9 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -30,6 +32,18 @@ namespace AzNetworking
     // Forwards
     struct ConnectionQuality;
 
+    //! A single datagram moved by one of the batched socket operations.
+    struct UdpBatchPacket
+    {
+        IpAddress m_address;
+        uint8_t* m_data = nullptr;
+        //! Size of the buffer pointed to by m_data on input to a receive, size of the datagram on output.
+        uint32_t m_size = 0;
+        //! If non-zero, the received datagram is a coalesced run of datagrams from the same sender that all have this
+        //! size, except for the last one which may be smaller.
+        uint32_t m_segmentSize = 0;
+    };
+
     //! @class UdpSocket
     //! @brief wrapper class for managing UDP sockets.
     class UdpSocket
@@ -42,6 +56,12 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of datagrams moved by a single batched send or receive.
+        static constexpr uint32_t MaxBatchPacketCount = 64;
+
+        //! Maximum size of a coalesced receive, large enough for any single UDP datagram.
+        static constexpr uint32_t MaxCoalescedReceiveSize = 64 * 1024;
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +113,23 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to packetCount payloads from the UDP socket with as few system calls as the platform allows.
+        //! @param packets     array of packets, each providing the buffer and buffer size to receive into
+        //! @param packetCount number of entries in packets, at most MaxBatchPacketCount are filled per call
+        //! @return number of packets received, < 0 on error
+        int32_t ReceiveBatch(UdpBatchPacket* packets, uint32_t packetCount) const;
+
+        //! Starts queuing sends so they can be handed to the OS together, ended by FlushSendBatch.
+        //! Has no effect if batched IO is disabled or unsupported on this platform.
+        void BeginSendBatch() const;
+
+        //! Transmits all sends queued since BeginSendBatch and returns to sending immediately.
+        void FlushSendBatch() const;
+
+        //! Returns true if received datagrams may be coalesced by the OS, in which case receive buffers must be MaxCoalescedReceiveSize.
+        //! @return boolean true if receive coalescing is enabled on this socket
+        bool IsReceiveCoalescingEnabled() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -121,6 +158,14 @@ namespace AzNetworking
         //! @return the total number of bytes received on this socket
         uint32_t GetRecvBytes() const;
 
+        //! Returns the total number of system calls used to send batches of packets on this socket.
+        //! @return the total number of system calls used to send batches of packets on this socket
+        uint32_t GetSentBatches() const;
+
+        //! Returns the total number of system calls that received packets on this socket.
+        //! @return the total number of system calls that received packets on this socket
+        uint32_t GetRecvBatches() const;
+
     protected:
 
         mutable uint32_t m_sentPacketsEncrypted = 0;
@@ -135,6 +180,24 @@ namespace AzNetworking
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
+        mutable uint32_t m_sentBatches = 0;
+        mutable uint32_t m_recvBatches = 0;
+        bool m_receiveCoalescing = false;
+
+        //! Sends queued between BeginSendBatch and FlushSendBatch, allocated the first time a batch is started.
+        struct SendQueue
+        {
+            AZStd::array<UdpBatchPacket, MaxBatchPacketCount> m_packets;
+            AZStd::array<AZStd::array<uint8_t, MaxUdpTransmissionUnit>, MaxBatchPacketCount> m_buffers;
+            uint32_t m_packetCount = 0;
+            bool m_active = false;
+            bool m_useSegmentation = false;
+        };
+
+        int32_t QueueSend(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+        void FlushSendQueue() const;
+
+        mutable AZStd::unique_ptr<SendQueue> m_sendQueue;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
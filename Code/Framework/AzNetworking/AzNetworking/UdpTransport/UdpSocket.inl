@@ -49,4 +49,19 @@ namespace AzNetworking
     {
         return m_recvBytes;
     }
+
+    inline uint32_t UdpSocket::GetSentBatches() const
+    {
+        return m_sentBatches;
+    }
+
+    inline uint32_t UdpSocket::GetRecvBatches() const
+    {
+        return m_recvBatches;
+    }
+
+    inline bool UdpSocket::IsReceiveCoalescingEnabled() const
+    {
+        return m_receiveCoalescing;
+    }
 }
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+
+namespace AzNetworking
+{
+    namespace Platform
+    {
+        bool SupportsBatchedIo()
+        {
+            // No multi-message socket calls, UdpSocket sends and receives one packet per system call
+            return false;
+        }
+
+        bool SetReceiveCoalescing(SocketFd, bool)
+        {
+            return false;
+        }
+
+        int32_t SendBatch(SocketFd socketFd, const UdpBatchPacket* packets, uint32_t packetCount, bool& useSegmentation)
+        {
+            useSegmentation = false;
+
+            for (uint32_t i = 0; i < packetCount; ++i)
+            {
+                const UdpBatchPacket& packet = packets[i];
+
+                sockaddr_in destAddr;
+                memset(&destAddr, 0, sizeof(destAddr));
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_addr.s_addr = packet.m_address.GetAddress(ByteOrder::Network);
+                destAddr.sin_port = packet.m_address.GetPort(ByteOrder::Network);
+
+                if (sendto(static_cast<int32_t>(socketFd), reinterpret_cast<const char*>(packet.m_data), packet.m_size, 0, (sockaddr*)&destAddr, sizeof(destAddr)) < 0)
+                {
+                    return (i > 0) ? static_cast<int32_t>(i) : SocketOpResultError;
+                }
+            }
+
+            return static_cast<int32_t>(packetCount);
+        }
+
+        int32_t ReceiveBatch(SocketFd socketFd, UdpBatchPacket* packets, uint32_t packetCount)
+        {
+            for (uint32_t i = 0; i < packetCount; ++i)
+            {
+                UdpBatchPacket& packet = packets[i];
+
+                sockaddr_in from;
+                socklen_t   fromLen = sizeof(from);
+
+                const int32_t receivedBytes = recvfrom(static_cast<int32_t>(socketFd), reinterpret_cast<char*>(packet.m_data), static_cast<int32_t>(packet.m_size), 0, (sockaddr*)&from, &fromLen);
+                if (receivedBytes < 0)
+                {
+                    return (i > 0) ? static_cast<int32_t>(i) : SocketOpResultError;
+                }
+
+                packet.m_address = IpAddress(ByteOrder::Network, from.sin_addr.s_addr, from.sin_port);
+                packet.m_size = static_cast<uint32_t>(receivedBytes);
+                packet.m_segmentSize = 0;
+            }
+
+            return static_cast<int32_t>(packetCount);
+        }
+    }
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkIncludes.h>
+#include <AzCore/std/algorithm.h>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <errno.h>
+#include <string.h>
+
+// Older kernel headers don't define the UDP segmentation offload options
+#ifndef SOL_UDP
+#   define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#   define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#   define UDP_GRO 104
+#endif
+
+namespace AzNetworking
+{
+    namespace Platform
+    {
+        // Kernel limit on the number of segments in a single UDP_SEGMENT send
+        static constexpr uint32_t MaxSegmentsPerSend = 64;
+        // Largest UDP payload that fits in a single IPv4 datagram
+        static constexpr uint32_t MaxSegmentedSendSize = 65507;
+
+        union SegmentControl
+        {
+            char m_buffer[CMSG_SPACE(sizeof(uint16_t))];
+            cmsghdr m_align;
+        };
+
+        union CoalesceControl
+        {
+            char m_buffer[CMSG_SPACE(sizeof(int))];
+            cmsghdr m_align;
+        };
+
+        static void FillAddress(sockaddr_in& outAddr, const IpAddress& address)
+        {
+            memset(&outAddr, 0, sizeof(outAddr));
+            outAddr.sin_family = AF_INET;
+            outAddr.sin_addr.s_addr = address.GetAddress(ByteOrder::Network);
+            outAddr.sin_port = address.GetPort(ByteOrder::Network);
+        }
+
+        // Returns the number of packets starting at firstPacket that can be sent as one segmented datagram.
+        // All segments must go to the same address and have the same size, only the last one may be smaller.
+        static uint32_t GetSegmentRunLength(const UdpBatchPacket* packets, uint32_t firstPacket, uint32_t packetCount, uint32_t maxRunLength)
+        {
+            const UdpBatchPacket& first = packets[firstPacket];
+            uint32_t runLength = 1;
+            uint32_t runSize = first.m_size;
+
+            while ((firstPacket + runLength < packetCount) && (runLength < maxRunLength))
+            {
+                const UdpBatchPacket& previous = packets[firstPacket + runLength - 1];
+                const UdpBatchPacket& next = packets[firstPacket + runLength];
+                if ((previous.m_size != first.m_size) || (next.m_size > first.m_size) || (next.m_address != first.m_address)
+                    || (runSize + next.m_size > MaxSegmentedSendSize))
+                {
+                    break;
+                }
+                runSize += next.m_size;
+                ++runLength;
+            }
+
+            return runLength;
+        }
+
+        bool SupportsBatchedIo()
+        {
+            return true;
+        }
+
+        bool SetReceiveCoalescing(SocketFd socketFd, bool enable)
+        {
+            int value = enable ? 1 : 0;
+            return setsockopt(int32_t(socketFd), SOL_UDP, UDP_GRO, &value, sizeof(value)) == 0;
+        }
+
+        int32_t SendBatch(SocketFd socketFd, const UdpBatchPacket* packets, uint32_t packetCount, bool& useSegmentation)
+        {
+            mmsghdr messages[UdpSocket::MaxBatchPacketCount];
+            iovec vectors[UdpSocket::MaxBatchPacketCount];
+            sockaddr_in addresses[UdpSocket::MaxBatchPacketCount];
+            SegmentControl controls[UdpSocket::MaxBatchPacketCount];
+            uint32_t packetsPerMessage[UdpSocket::MaxBatchPacketCount];
+
+            uint32_t sentCount = 0;
+            while (sentCount < packetCount)
+            {
+                // Build up to MaxBatchPacketCount messages, each being either a single packet or a run of segments
+                uint32_t messageCount = 0;
+                uint32_t vectorCount = 0;
+                bool segmented = false;
+                for (uint32_t packetIndex = sentCount; (packetIndex < packetCount) && (vectorCount < UdpSocket::MaxBatchPacketCount);)
+                {
+                    const uint32_t runLength = useSegmentation
+                        ? GetSegmentRunLength(packets, packetIndex, packetCount, AZStd::min(MaxSegmentsPerSend, UdpSocket::MaxBatchPacketCount - vectorCount))
+                        : 1;
+
+                    for (uint32_t i = 0; i < runLength; ++i)
+                    {
+                        vectors[vectorCount + i].iov_base = packets[packetIndex + i].m_data;
+                        vectors[vectorCount + i].iov_len = packets[packetIndex + i].m_size;
+                    }
+                    FillAddress(addresses[messageCount], packets[packetIndex].m_address);
+
+                    msghdr& header = messages[messageCount].msg_hdr;
+                    memset(&header, 0, sizeof(header));
+                    header.msg_name = &addresses[messageCount];
+                    header.msg_namelen = sizeof(sockaddr_in);
+                    header.msg_iov = &vectors[vectorCount];
+                    header.msg_iovlen = runLength;
+
+                    if (runLength > 1)
+                    {
+                        header.msg_control = controls[messageCount].m_buffer;
+                        header.msg_controllen = sizeof(controls[messageCount].m_buffer);
+                        cmsghdr* control = CMSG_FIRSTHDR(&header);
+                        control->cmsg_level = SOL_UDP;
+                        control->cmsg_type = UDP_SEGMENT;
+                        control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                        const uint16_t segmentSize = static_cast<uint16_t>(packets[packetIndex].m_size);
+                        memcpy(CMSG_DATA(control), &segmentSize, sizeof(segmentSize));
+                        segmented = true;
+                    }
+
+                    packetsPerMessage[messageCount++] = runLength;
+                    vectorCount += runLength;
+                    packetIndex += runLength;
+                }
+
+                const int32_t sentMessages = sendmmsg(int32_t(socketFd), messages, messageCount, 0);
+                if (sentMessages < 0)
+                {
+                    const int32_t error = errno;
+                    if (segmented && ((error == EIO) || (error == EINVAL) || (error == ENOPROTOOPT) || (error == EOPNOTSUPP)))
+                    {
+                        // The kernel or device doesn't support segmentation offload, resend this batch without it
+                        useSegmentation = false;
+                        continue;
+                    }
+                    return (sentCount > 0) ? static_cast<int32_t>(sentCount) : SocketOpResultError;
+                }
+
+                for (int32_t i = 0; i < sentMessages; ++i)
+                {
+                    sentCount += packetsPerMessage[i];
+                }
+
+                if (static_cast<uint32_t>(sentMessages) < messageCount)
+                {
+                    // Send buffer is full, the remaining packets are dropped
+                    break;
+                }
+            }
+
+            return static_cast<int32_t>(sentCount);
+        }
+
+        int32_t ReceiveBatch(SocketFd socketFd, UdpBatchPacket* packets, uint32_t packetCount)
+        {
+            mmsghdr messages[UdpSocket::MaxBatchPacketCount];
+            iovec vectors[UdpSocket::MaxBatchPacketCount];
+            sockaddr_in addresses[UdpSocket::MaxBatchPacketCount];
+            CoalesceControl controls[UdpSocket::MaxBatchPacketCount];
+
+            packetCount = AZStd::min(packetCount, UdpSocket::MaxBatchPacketCount);
+            for (uint32_t i = 0; i < packetCount; ++i)
+            {
+                vectors[i].iov_base = packets[i].m_data;
+                vectors[i].iov_len = packets[i].m_size;
+
+                msghdr& header = messages[i].msg_hdr;
+                memset(&header, 0, sizeof(header));
+                header.msg_name = &addresses[i];
+                header.msg_namelen = sizeof(sockaddr_in);
+                header.msg_iov = &vectors[i];
+                header.msg_iovlen = 1;
+                header.msg_control = controls[i].m_buffer;
+                header.msg_controllen = sizeof(controls[i].m_buffer);
+                messages[i].msg_len = 0;
+            }
+
+            const int32_t receivedCount = recvmmsg(int32_t(socketFd), messages, packetCount, 0, nullptr);
+            if (receivedCount < 0)
+            {
+                return SocketOpResultError;
+            }
+
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                UdpBatchPacket& packet = packets[i];
+                msghdr& header = messages[i].msg_hdr;
+
+                packet.m_address = IpAddress(ByteOrder::Network, addresses[i].sin_addr.s_addr, addresses[i].sin_port);
+                packet.m_size = (header.msg_flags & MSG_TRUNC) ? 0 : messages[i].msg_len;
+                packet.m_segmentSize = 0;
+
+                for (cmsghdr* control = CMSG_FIRSTHDR(&header); control != nullptr; control = CMSG_NXTHDR(&header, control))
+                {
+                    if ((control->cmsg_level == SOL_UDP) && (control->cmsg_type == UDP_GRO))
+                    {
+                        int segmentSize = 0;
+                        memcpy(&segmentSize, CMSG_DATA(control), sizeof(segmentSize));
+                        if ((segmentSize > 0) && (static_cast<uint32_t>(segmentSize) < packet.m_size))
+                        {
+                            packet.m_segmentSize = static_cast<uint32_t>(segmentSize);
+                        }
+                    }
+                }
+            }
+
+            return receivedCount;
+        }
+    }
+}
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -299,4 +300,72 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestBatchedSendAndReceive)
+    {
+        constexpr uint32_t NumTestPackets = 100;
+        constexpr uint32_t NumEqualSizePackets = 80;
+        constexpr uint16_t TestPort = 12346;
+
+        auto getPacketSize = [](uint32_t index) { return (index < NumEqualSizePackets) ? 512u : 100u + index; };
+
+        UdpSocket receiveSocket;
+        UdpSocket sendSocket;
+        ASSERT_TRUE(receiveSocket.Open(TestPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        // Equal sized packets to the same address are eligible for segmented sends, the rest go out as individual messages
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        const IpAddress address(127, 0, 0, 1, TestPort);
+        AZStd::array<uint8_t, MaxUdpTransmissionUnit> sendBuffer;
+        sendSocket.BeginSendBatch();
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            sendBuffer.fill(static_cast<uint8_t>(i));
+            EXPECT_EQ(sendSocket.Send(address, sendBuffer.data(), getPacketSize(i), false, dtlsEndpoint, connectionQuality), static_cast<int32_t>(getPacketSize(i)));
+        }
+        sendSocket.FlushSendBatch();
+        EXPECT_EQ(sendSocket.GetSentPackets(), NumTestPackets);
+
+        AZStd::vector<AZStd::array<uint8_t, MaxUdpTransmissionUnit>> receiveBuffers(UdpSocket::MaxBatchPacketCount);
+        AZStd::vector<uint32_t> receivedSizes;
+        AZStd::vector<uint8_t> receivedValues;
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 5000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedSizes.size() < NumTestPackets) && (AZ::GetElapsedTimeMs() - startTimeMs < TotalIterationTimeMs))
+        {
+            UdpBatchPacket packets[UdpSocket::MaxBatchPacketCount];
+            for (uint32_t i = 0; i < UdpSocket::MaxBatchPacketCount; ++i)
+            {
+                packets[i].m_data = receiveBuffers[i].data();
+                packets[i].m_size = MaxUdpTransmissionUnit;
+            }
+
+            const int32_t receivedCount = receiveSocket.ReceiveBatch(packets, UdpSocket::MaxBatchPacketCount);
+            ASSERT_GE(receivedCount, 0);
+            if (receivedCount == 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                continue;
+            }
+
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                EXPECT_EQ(packets[i].m_segmentSize, 0u);
+                receivedSizes.push_back(packets[i].m_size);
+                receivedValues.push_back(packets[i].m_data[packets[i].m_size - 1]);
+            }
+        }
+
+        ASSERT_EQ(receivedSizes.size(), NumTestPackets);
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            EXPECT_EQ(receivedSizes[i], getPacketSize(i));
+            EXPECT_EQ(receivedValues[i], static_cast<uint8_t>(i));
+        }
+        EXPECT_EQ(receiveSocket.GetRecvPackets(), NumTestPackets);
+        EXPECT_LE(receiveSocket.GetRecvBatches(), NumTestPackets);
+    }
 }
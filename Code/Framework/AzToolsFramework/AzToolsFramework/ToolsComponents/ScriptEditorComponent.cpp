@@ -1042,6 +1042,8 @@ namespace AzToolsFramework
                         ->DataElement(0, &AzFramework::ScriptComponent::m_script, "Asset", "")
                             ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::Hide)
                             ->Attribute(AZ::Edit::Attributes::SliceFlags, AZ::Edit::SliceFlags::NotPushable) // Only the editor-component's script asset needs to be slice-pushable.
+                        ->DataElement(0, &AzFramework::ScriptComponent::m_threadSafeTick, "Thread safe tick",
+                            "Run the script in a pooled script context and call its OnTick function in parallel with other thread safe scripts")
                         ;
 
                     ec->Class<AzFramework::ScriptPropertyGroup>("Script Property group", "This is a script property group")->
@@ -542,6 +542,14 @@ namespace AzToolsFramework
             SetWorldTM(newWorldTransform);
         }
 
+        void TransformComponent::SetWorldRotationQuaternionAndTranslation(const AZ::Quaternion& rotation, const AZ::Vector3& translation)
+        {
+            AZ::Transform newWorldTransform = GetWorldTM();
+            newWorldTransform.SetRotation(rotation);
+            newWorldTransform.SetTranslation(translation);
+            SetWorldTM(newWorldTransform);
+        }
+
         AZ::Vector3 TransformComponent::GetWorldRotation()
         {
             return GetWorldTM().GetRotation().GetEulerRadians();
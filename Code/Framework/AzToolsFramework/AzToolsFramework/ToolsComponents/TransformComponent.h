@@ -98,6 +98,7 @@ namespace AzToolsFramework
 
             // Rotation modifiers
             void SetWorldRotationQuaternion(const AZ::Quaternion& quaternion) override;
+            void SetWorldRotationQuaternionAndTranslation(const AZ::Quaternion& rotation, const AZ::Vector3& translation) override;
 
             AZ::Vector3 GetWorldRotation() override;
             AZ::Quaternion GetWorldRotationQuaternion() override;
@@ -9,6 +9,8 @@
 
 #include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
 
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzFramework/Spawnable/SpawnableClonePlan.h>
 #include <AzToolsFramework/Prefab/Spawnable/SpawnableUtils.h>
 
 namespace Benchmark
@@ -48,6 +50,87 @@ namespace Benchmark
         ->Range(100, 10000)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    class BM_SpawnableClone
+        : public BM_Prefab
+    {
+    protected:
+        // Clones all entities in a spawnable with a chain of parented entities the same way the SpawnableEntitiesManager does.
+        void CloneEntities(::benchmark::State& state, bool useClonePlan)
+        {
+            const unsigned int numEntities = static_cast<unsigned int>(state.range());
+
+            AZStd::vector<AZ::Entity*> entities;
+            CreateEntities(numEntities, entities);
+            for (unsigned int entityIndex = 1; entityIndex < numEntities; ++entityIndex)
+            {
+                SetEntityParent(entities[entityIndex]->GetId(), entities[entityIndex - 1]->GetId());
+            }
+
+            AZStd::unique_ptr<Instance> instance = m_prefabSystemComponent->CreatePrefab(entities, {}, m_pathString);
+            auto& prefabDom = m_prefabSystemComponent->FindTemplateDom(instance->GetTemplateId());
+
+            AzFramework::Spawnable spawnable;
+            AzToolsFramework::Prefab::SpawnableUtils::CreateSpawnable(spawnable, prefabDom);
+
+            AZ::SerializeContext* serializeContext = m_app->GetSerializeContext();
+            if (useClonePlan)
+            {
+                spawnable.BuildClonePlan(*serializeContext);
+            }
+            const AzFramework::SpawnableClonePlan* clonePlan = spawnable.GetClonePlan();
+
+            const AzFramework::Spawnable::EntityList& templates = spawnable.GetEntities();
+            AzFramework::SpawnableClonePlan::EntityIdMap idMap;
+            idMap.reserve(templates.size());
+            for (const AZStd::unique_ptr<AZ::Entity>& entityTemplate : templates)
+            {
+                idMap.emplace(entityTemplate->GetId(), AZ::Entity::MakeId());
+            }
+
+            AZStd::vector<AZStd::unique_ptr<AZ::Entity>> clones;
+            clones.reserve(templates.size());
+            for (auto _ : state)
+            {
+                for (const AZStd::unique_ptr<AZ::Entity>& entityTemplate : templates)
+                {
+                    AZ::Entity* clone = clonePlan ? clonePlan->Clone(*entityTemplate, idMap) : nullptr;
+                    if (!clone)
+                    {
+                        clone = AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                            entityTemplate.get(), idMap, serializeContext);
+                    }
+                    clones.emplace_back(clone);
+                }
+
+                state.PauseTiming();
+                clones.clear();
+                state.ResumeTiming();
+            }
+
+            state.SetComplexityN(numEntities);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClone, CloneSpawnable_Remapper)(::benchmark::State& state)
+    {
+        CloneEntities(state, false);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClone, CloneSpawnable_Remapper)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_SpawnableClone, CloneSpawnable_ClonePlan)(::benchmark::State& state)
+    {
+        CloneEntities(state, true);
+    }
+    BENCHMARK_REGISTER_F(BM_SpawnableClone, CloneSpawnable_ClonePlan)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 }
 
 #endif
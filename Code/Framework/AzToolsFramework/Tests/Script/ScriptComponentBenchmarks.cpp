@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Asset/AssetManagerComponent.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Memory/MemoryComponent.h>
+#include <AzCore/Script/ScriptAsset.h>
+#include <AzCore/Script/ScriptSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Script/ScriptComponent.h>
+
+namespace Benchmark
+{
+    // Ticks a number of scripted entities that all run the same small simulation in OnTick.
+    // Compares scripts that connect to the TickBus themselves and run one after the other in the default script context,
+    // with thread safe scripts that run in the pooled script contexts and tick in parallel.
+    class ScriptComponentTickBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        using ::benchmark::Fixture::SetUp, ::benchmark::Fixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 512 * 1024 * 1024;
+            AZ::Entity* systemEntity = m_app.Create(appDesc);
+
+            systemEntity->CreateComponent<AZ::MemoryComponent>();
+            systemEntity->CreateComponent("{CAE3A025-FAC9-4537-B39E-0A800A2326DF}"); // JobManager component
+            systemEntity->CreateComponent<AZ::StreamerComponent>();
+            systemEntity->CreateComponent<AZ::AssetManagerComponent>();
+            systemEntity->CreateComponent<AZ::ScriptSystemComponent>();
+
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            AZ::SerializeContext* serializeContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            AzFramework::ScriptComponent::CreateDescriptor(); // descriptor is deleted by app
+            AzFramework::ScriptComponent::Reflect(serializeContext);
+
+            m_entityCount = state.range(0);
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            for (AZ::Entity* entity : m_entities)
+            {
+                delete entity;
+            }
+            m_entities = {};
+            m_scriptAsset.Reset();
+
+            m_app.Destroy();
+        }
+
+    protected:
+        void CreateScriptedEntities(bool threadSafeTick)
+        {
+            // Scripts in the default context have to connect to the TickBus, the pooled contexts call OnTick of thread safe scripts
+            const AZStd::string script = AZStd::string::format(
+                "local mover = { Properties = { Speed = { default = 2.0 } } }\n"
+                "function mover:OnActivate()\n"
+                "  self.position = 0.0\n"
+                "  %s\n"
+                "end\n"
+                "function mover:OnDeactivate()\n"
+                "  if self.tickBusHandler then self.tickBusHandler:Disconnect() end\n"
+                "end\n"
+                "function mover:OnTick(deltaTime, timePoint)\n"
+                "  local position = self.position\n"
+                "  for i = 1, 32 do\n"
+                "    position = position + math.sin(position + deltaTime) * self.Properties.Speed * deltaTime\n"
+                "  end\n"
+                "  self.position = position\n"
+                "end\n"
+                "return mover\n",
+                threadSafeTick ? "" : "self.tickBusHandler = TickBus.Connect(self)");
+
+            m_scriptAsset = AZ::Data::AssetManager::Instance().CreateAsset<AZ::ScriptAsset>(AZ::Uuid::CreateRandom());
+            m_scriptAsset.Get()->CreateWriteStream().Write(script.size(), script.data());
+            AZ::Data::AssetManagerBus::Broadcast(&AZ::Data::AssetManagerBus::Events::OnAssetReady, m_scriptAsset);
+            m_app.Tick();
+            m_app.TickSystem();
+
+            m_entities.reserve(m_entityCount);
+            for (int64_t entityIndex = 0; entityIndex < m_entityCount; ++entityIndex)
+            {
+                auto* entity = aznew AZ::Entity(AZ::EntityId(entityIndex + 1));
+                auto* scriptComponent = entity->CreateComponent<AzFramework::ScriptComponent>();
+                scriptComponent->SetScript(m_scriptAsset);
+                scriptComponent->SetThreadSafeTick(threadSafeTick);
+                entity->Init();
+                entity->Activate();
+                m_entities.push_back(entity);
+            }
+        }
+
+        void TickEntities(::benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 1.0f / 60.0f, AZ::ScriptTimePoint());
+            }
+            state.SetItemsProcessed(state.iterations() * m_entityCount);
+        }
+
+        AZ::ComponentApplication m_app;
+        AZ::Data::Asset<AZ::ScriptAsset> m_scriptAsset;
+        AZStd::vector<AZ::Entity*> m_entities;
+        int64_t m_entityCount = 0;
+    };
+
+    BENCHMARK_DEFINE_F(ScriptComponentTickBenchmarkFixture, TickScripts_DefaultContext)(benchmark::State& state)
+    {
+        CreateScriptedEntities(false);
+        TickEntities(state);
+    }
+
+    BENCHMARK_DEFINE_F(ScriptComponentTickBenchmarkFixture, TickScripts_PooledContexts)(benchmark::State& state)
+    {
+        CreateScriptedEntities(true);
+        TickEntities(state);
+    }
+
+    BENCHMARK_REGISTER_F(ScriptComponentTickBenchmarkFixture, TickScripts_DefaultContext)
+        ->Arg(1000)->Arg(10000)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ScriptComponentTickBenchmarkFixture, TickScripts_PooledContexts)
+        ->Arg(1000)->Arg(10000)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif
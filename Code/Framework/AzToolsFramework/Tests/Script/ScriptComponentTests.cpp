@@ -221,4 +221,76 @@ namespace UnitTest
 
         EXPECT_NE(scriptComponent->GetScriptProperty("myNum"), nullptr);
     }
+
+    TEST_F(ScriptComponentTest, ThreadSafeTick_ScriptsRunInPooledContexts_OnTickIsCalledEveryTick)
+    {
+        const AZStd::string script = "local ticker = {}\
+                                    function ticker:OnTick(deltaTime, timePoint)\
+                                      tickCount = (tickCount or 0) + 1\
+                                    end\
+                                    return ticker";
+
+        const Data::Asset<ScriptAsset> scriptAsset = CreateAndLoadScriptAsset(script);
+
+        // The entity id picks the pooled context, use consecutive ids so the entities usually end up in different contexts
+        constexpr int EntityCount = 4;
+        AZStd::vector<Entity*> entities;
+        AZStd::vector<ScriptContext*> contexts;
+        for (int entityIndex = 0; entityIndex < EntityCount; ++entityIndex)
+        {
+            auto* entity = aznew Entity(EntityId(static_cast<AZ::u64>(entityIndex) + 1));
+            auto* scriptComponent = entity->CreateComponent<ScriptComponent>();
+            scriptComponent->SetScript(scriptAsset);
+            scriptComponent->SetThreadSafeTick(true);
+
+            entity->Init();
+            entity->Activate();
+
+            ScriptContext* context = scriptComponent->GetScriptContext();
+            ASSERT_NE(context, nullptr);
+            EXPECT_GE(context->GetId(), static_cast<ScriptContextId>(FirstPooledScriptContextId));
+            if (AZStd::find(contexts.begin(), contexts.end(), context) == contexts.end())
+            {
+                contexts.push_back(context);
+            }
+            entities.push_back(entity);
+        }
+
+        auto getTickCount = [&contexts]()
+        {
+            int tickCount = 0;
+            for (ScriptContext* context : contexts)
+            {
+                lua_State* lua = context->NativeContext();
+                lua_getglobal(lua, "tickCount");
+                tickCount += lua_isnumber(lua, -1) ? static_cast<int>(lua_tonumber(lua, -1)) : 0;
+                lua_pop(lua, 1);
+            }
+            return tickCount;
+        };
+
+        m_app.Tick();
+        EXPECT_EQ(EntityCount, getTickCount());
+        m_app.Tick();
+        EXPECT_EQ(2 * EntityCount, getTickCount());
+
+        // Globals of the pooled contexts aren't visible in the default context
+        lua_State* defaultLua = m_scriptContext->NativeContext();
+        lua_getglobal(defaultLua, "tickCount");
+        EXPECT_TRUE(lua_isnil(defaultLua, -1));
+        lua_pop(defaultLua, 1);
+
+        // Deactivated entities stop ticking
+        for (Entity* entity : entities)
+        {
+            entity->Deactivate();
+        }
+        m_app.Tick();
+        EXPECT_EQ(2 * EntityCount, getTickCount());
+
+        for (Entity* entity : entities)
+        {
+            delete entity;
+        }
+    }
 } // namespace UnitTest
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
@@ -15,6 +16,7 @@
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 
 #include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/DeferredTransformHierarchy.h>
 #include <AzFramework/Components/TransformComponent.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
@@ -722,6 +724,107 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Parent and child transforms resolved by the deferred transform hierarchy.
+    class DeferredTransformComponentHierarchy
+        : public TransformComponentApplication
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("az_deferredTransformHierarchy", { "true" });
+
+            m_hierarchy = AZ::Interface<DeferredTransformHierarchy>::Get();
+            ASSERT_NE(m_hierarchy, nullptr);
+
+            m_parentEntity = aznew Entity("Parent");
+            m_parentId = m_parentEntity->GetId();
+            m_parentEntity->Init();
+            m_parentEntity->CreateComponent<TransformComponent>();
+
+            m_childEntity = aznew Entity("Child");
+            m_childId = m_childEntity->GetId();
+            m_childEntity->Init();
+            m_childEntity->CreateComponent<TransformComponent>();
+
+            m_parentEntity->Activate();
+            m_childEntity->Activate();
+            TransformBus::Event(m_childId, &TransformBus::Events::SetParentRelative, m_parentId);
+            m_hierarchy->ProcessTransformChanges();
+
+            m_childEntity->GetTransform()->BindTransformChangedEventHandler(m_childChangedHandler);
+        }
+
+        void TearDown() override
+        {
+            m_childChangedHandler.Disconnect();
+            m_childEntity->Deactivate();
+            m_parentEntity->Deactivate();
+            delete m_childEntity;
+            delete m_parentEntity;
+
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("az_deferredTransformHierarchy", { "false" });
+            TransformComponentApplication::TearDown();
+        }
+
+        DeferredTransformHierarchy* m_hierarchy = nullptr;
+        Entity* m_parentEntity = nullptr;
+        EntityId m_parentId = EntityId();
+        Entity* m_childEntity = nullptr;
+        EntityId m_childId = EntityId();
+
+        int m_childChangedCount = 0;
+        Transform m_childChangedWorldTM = Transform::CreateIdentity();
+        TransformChangedEvent::Handler m_childChangedHandler{ [this](const Transform&, const Transform& worldTM)
+            {
+                ++m_childChangedCount;
+                m_childChangedWorldTM = worldTM;
+            } };
+    };
+
+    TEST_F(DeferredTransformComponentHierarchy, MoveParentSeveralTimes_ChildNotifiedOnce)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, Vector3(1.0f, 0.0f, 0.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, Vector3(10.0f, 0.0f, 0.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, Vector3(20.0f, 0.0f, 0.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, Vector3(30.0f, 0.0f, 0.0f));
+        EXPECT_EQ(m_childChangedCount, 0);
+
+        m_hierarchy->ProcessTransformChanges();
+        EXPECT_EQ(m_childChangedCount, 1);
+        EXPECT_THAT(m_childChangedWorldTM.GetTranslation(), IsClose(Vector3(31.0f, 0.0f, 0.0f)));
+
+        m_hierarchy->ProcessTransformChanges();
+        EXPECT_EQ(m_childChangedCount, 1);
+    }
+
+    TEST_F(DeferredTransformComponentHierarchy, GetWorldTranslation_PendingParentMove_ReturnsResolvedTranslation)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, Vector3(0.0f, 2.0f, 0.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalRotationQuaternion, Quaternion::CreateRotationZ(Constants::HalfPi));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, Vector3(5.0f, 0.0f, 0.0f));
+
+        Vector3 childWorldPos = Vector3::CreateZero();
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(Vector3(3.0f, 0.0f, 0.0f)));
+        EXPECT_EQ(m_childChangedCount, 0);
+    }
+
+    TEST_F(DeferredTransformComponentHierarchy, SetParent_Null_PendingParentMove_KeepsResolvedWorldTransform)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, Vector3(0.0f, 0.0f, 4.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 6.0f, 0.0f));
+
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, EntityId());
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 12.0f, 0.0f));
+        m_hierarchy->ProcessTransformChanges();
+
+        Vector3 childWorldPos = Vector3::CreateZero();
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(Vector3(0.0f, 6.0f, 4.0f)));
+        EXPECT_THAT(m_childChangedWorldTM.GetTranslation(), IsClose(Vector3(0.0f, 6.0f, 4.0f)));
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
@@ -10,6 +10,7 @@
 
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI/CpuProfilerImpl.h>
+#include <Atom/RHI/CpuProfilingCapture.h>
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI.Reflect/CpuTimingStatistics.h>
@@ -560,13 +561,23 @@ namespace AZ
         bool SerializeCpuProfilingData(const AZStd::ring_buffer<RHI::CpuProfiler::TimeRegionMap>& data, AZStd::string outputFilePath, bool wasEnabled)
         {
             AZ_TracePrintf("ProfilingCaptureSystemComponent", "Beginning serialization of %zu frames of profiling data\n", data.size());
-            JsonSerializerSettings serializationSettings;
-            serializationSettings.m_keepDefaults = true;
 
-            RHI::CpuProfilingStatisticsSerializer serializer(data);
+            Outcome<void, AZStd::string> saveResult = Success();
+            if (RHI::CpuProfilingCapture::IsBinaryFile(outputFilePath) || RHI::CpuProfilingCapture::IsChromeTraceFile(outputFilePath))
+            {
+                // Streamed formats that don't need the whole capture to be converted to a json document first
+                saveResult = RHI::CpuProfilingCapture::SaveToFile(outputFilePath.c_str(), data);
+            }
+            else
+            {
+                JsonSerializerSettings serializationSettings;
+                serializationSettings.m_keepDefaults = true;
 
-            const auto saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
-                outputFilePath, (RHI::CpuProfilingStatisticsSerializer*)nullptr, &serializationSettings);
+                RHI::CpuProfilingStatisticsSerializer serializer(data);
+
+                saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
+                    outputFilePath, (RHI::CpuProfilingStatisticsSerializer*)nullptr, &serializationSettings);
+            }
 
             AZStd::string captureInfo = outputFilePath;
             if (!saveResult.IsSuccess())
@@ -13,8 +13,8 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
-#include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_refcount.h>
@@ -26,7 +26,8 @@ namespace AZ
     {
         //! Thread local class to keep track of the thread's cached time regions.
         //! Each thread keeps track of its own time regions, which is communicated from the CpuProfilerImpl.
-        //! The CpuProfilerImpl is able to request the cached time regions from the CpuTimingLocalStorage.
+        //! Completed regions are stored in a fixed-size ring that's only written by the owning thread and only read by the
+        //! CpuProfilerImpl when it collects the regions, so recording a region doesn't require any locks or allocations.
         class CpuTimingLocalStorage :
             public AZStd::intrusive_refcount<AZStd::atomic_uint>
         {
@@ -35,6 +36,10 @@ namespace AZ
         public:
             AZ_CLASS_ALLOCATOR(CpuTimingLocalStorage, AZ::OSAllocator, 0);
 
+            //! Maximum number of completed regions that can be stored until the profiler collects them, must be a power of two.
+            //! Regions that complete while the ring is full are dropped.
+            static constexpr uint32_t EventRingSize = 16384u;
+
             CpuTimingLocalStorage();
             ~CpuTimingLocalStorage();
 
@@ -48,37 +53,37 @@ namespace AZ
             // Pops a region from the stack, gets called each time a region ends
             void RegionStackPopBack();
 
-            // Add a new cached time region. If the stack is empty, flush all entries to the cached map
-            void AddCachedRegion(CachedTimeRegion&& timeRegionCached);
+            // Adds a completed region to the event ring. Only called from the owning thread.
+            void PushEvent(const CachedTimeRegion& timeRegionCached);
+
+            // Moves all completed regions from the event ring to the map. Only called from the thread collecting the regions.
+            void FlushEvents(CpuProfiler::ThreadTimeRegionMap& cachedRegionMap);
 
-            // Tries to flush the map to the passed parameter, only if the thread's mutex is unlocked
-            void TryFlushCachedMap(CpuProfiler::ThreadTimeRegionMap& cachedRegionMap);
+            // Drops all completed regions in the event ring. Only called from the thread collecting the regions.
+            void DiscardEvents();
 
             AZStd::thread_id m_executingThreadId;
             // Keeps track of the current thread's stack depth
             uint32_t m_stackLevel = 0u;
 
-            // Cached region map, will be flushed to the system's map when the system requests it
-            CpuProfiler::ThreadTimeRegionMap m_cachedTimeRegionMap;
-
             // Use fixed vectors to avoid re-allocating new elements
             // Keeps track of the regions that added and removed using the macro
             AZStd::fixed_vector<TimeRegion*, TimeRegionStackSize> m_timeRegionStack;
 
-            // Keeps track of regions that completed (i.e regions that was pushed and popped from the stack)
-            // Intermediate storage point for the CachedTimeRegions, when the stack is empty, all entries will be
-            // copied to the map.
-            AZStd::fixed_vector<CachedTimeRegion, TimeRegionStackSize> m_cachedTimeRegions;
-            AZStd::mutex m_cachedTimeRegionMutex;
+            // Completed regions waiting to be collected. The indices only ever increase and are wrapped when accessing the ring.
+            // The write index is only advanced by the owning thread and the read index only by the collecting thread.
+            AZStd::vector<CachedTimeRegion, AZ::OSStdAllocator> m_eventRing;
+            AZStd::atomic<uint64_t> m_eventWriteIndex = 0;
+            AZStd::atomic<uint64_t> m_eventReadIndex = 0;
+
+            // Number of regions that were dropped because the ring was full since the last time the regions were collected
+            AZStd::atomic<uint64_t> m_droppedEventCount = 0;
 
             // Dirty flag which is set when the CpuProfiler's enabled state is set from false to true
             AZStd::atomic_bool m_clearContainers = false;
 
             // When the thread is terminated, it will flag itself for deletion
             AZStd::atomic_bool m_deleteFlag = false;
-
-            // Keep track of the regions that have hit the size limit so we don't have to lock to check
-            AZStd::map<AZStd::string, bool> m_hitSizeLimitMap;
         };
 
         //! CpuProfiler will keep track of the registered threads, and
@@ -140,7 +145,8 @@ namespace AZ
             // String pool for storing region names submitted at runtime. Each call to AZ_ATOM_PROFILE_DYNAMIC will either construct
             // a string in this pool or use an already-existing entry.
             AZStd::unordered_set<AZStd::string> m_regionNameStringPool;
-            AZStd::mutex m_dynamicNameMutex;
+            // Names are looked up far more often than they're added, so lookups only take a shared lock
+            AZStd::shared_mutex m_dynamicNameMutex;
 
             // Thread local storage, gets lazily allocated when a thread is created
             static thread_local CpuTimingLocalStorage* ms_threadLocalStorage;
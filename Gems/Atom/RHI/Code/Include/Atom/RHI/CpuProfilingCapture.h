@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/CpuProfiler.h>
+#include <Atom/RHI/CpuProfilerImpl.h>
+#include <Atom/RHI.Reflect/Base.h>
+
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    namespace RHI
+    {
+        //! Writers and readers for captured cpu profiling data that stream the regions instead of building a document in memory.
+        //!
+        //! The binary format starts with a header followed by a sequence of records. The group and region names of a region are
+        //! written once, the first time they're used, and referred to by index afterwards, so every region takes a fixed 31 bytes.
+        //! Captures can also be exported to the Chrome trace event format, which can be opened in chrome://tracing and the Perfetto UI.
+        class CpuProfilingCapture final
+        {
+        public:
+            //! Extension of binary captures.
+            static constexpr const char* BinaryFileExtension = ".cpucapture";
+            //! Suffix of captures in the Chrome trace event format.
+            static constexpr const char* ChromeTraceFileSuffix = ".trace.json";
+            //! Version of the binary format, captures written with a different version are rejected.
+            static constexpr uint32_t BinaryFormatVersion = 1;
+
+            using Frames = AZStd::ring_buffer<CpuProfiler::TimeRegionMap>;
+            using Entries = AZStd::vector<CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry>;
+
+            //! Writes the frames as a binary capture.
+            static bool WriteBinary(IO::GenericStream& stream, const Frames& frames);
+
+            //! Reads all regions of a binary capture. Ticks are converted to the tick rate of the current machine.
+            static bool ReadBinary(IO::GenericStream& stream, Entries& entries);
+
+            //! Writes the frames in the Chrome trace event format.
+            static bool WriteChromeTrace(IO::GenericStream& stream, const Frames& frames);
+
+            //! Converts a binary capture to the Chrome trace event format one region at a time.
+            static bool ConvertBinaryToChromeTrace(IO::GenericStream& binaryStream, IO::GenericStream& traceStream);
+
+            //! Returns true if the file is a binary capture or Chrome trace based on its name.
+            static bool IsBinaryFile(AZStd::string_view filePath);
+            static bool IsChromeTraceFile(AZStd::string_view filePath);
+
+            //! Saves the frames to a file as a binary capture or Chrome trace based on the name of the file.
+            static MessageOutcome SaveToFile(const char* filePath, const Frames& frames);
+        };
+    } // namespace RHI
+} // namespace AZ
@@ -213,10 +213,12 @@ namespace AZ
             // Set the dirty flag in all the TLS to clear the caches
             if (enabled)
             {
-                // Iterate through all the threads, and set the clearing flag
+                // Iterate through all the threads, and set the clearing flag. Regions that completed before the profiler was
+                // disabled haven't been collected, so drop them as well.
                 for (auto& threadLocal : m_registeredThreads)
                 {
                     threadLocal->m_clearContainers = true;
+                    threadLocal->DiscardEvents();
                 }
 
                 m_enabled = true;
@@ -234,7 +236,20 @@ namespace AZ
 
         const CachedTimeRegion::GroupRegionName& CpuProfilerImpl::InsertDynamicName(const char* groupName, const AZStd::string& regionName)
         {
-            AZStd::scoped_lock lock(m_dynamicNameMutex);
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_dynamicNameMutex);
+                if (auto regionNameItr = m_regionNameStringPool.find(regionName); regionNameItr != m_regionNameStringPool.end())
+                {
+                    auto groupRegionNameItr =
+                        m_dynamicGroupRegionNamePool.find(CachedTimeRegion::GroupRegionName(groupName, regionNameItr->c_str()));
+                    if (groupRegionNameItr != m_dynamicGroupRegionNamePool.end())
+                    {
+                        return *groupRegionNameItr;
+                    }
+                }
+            }
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_dynamicNameMutex);
             AZ_Warning("CpuProfiler", m_regionNameStringPool.size() < MaxRegionStringPoolSize,
                 "Stored dynamic region names are accumulating. Consider removing a AZ_ATOM_PROFILE_DYNAMIC invocation.");
             auto [regionNameItr, wasRegionInserted] =  m_regionNameStringPool.insert(regionName);
@@ -272,7 +287,7 @@ namespace AZ
             for (auto& threadLocal : m_registeredThreads)
             {
                 ThreadTimeRegionMap& threadMapEntry = newMap[threadLocal->m_executingThreadId];
-                threadLocal->TryFlushCachedMap(threadMapEntry);
+                threadLocal->FlushEvents(threadMapEntry);
             }
 
             // Clear all TLS that flagged themselves to be deleted, meaning that the thread is already terminated
@@ -299,7 +314,10 @@ namespace AZ
 
         CpuTimingLocalStorage::CpuTimingLocalStorage()
         {
+            static_assert((EventRingSize & (EventRingSize - 1)) == 0, "The size of the event ring must be a power of two.");
+
             m_executingThreadId = AZStd::this_thread::get_id();
+            m_eventRing.resize(EventRingSize);
         }
 
         CpuTimingLocalStorage::~CpuTimingLocalStorage()
@@ -309,15 +327,13 @@ namespace AZ
 
         void CpuTimingLocalStorage::RegionStackPushBack(TimeRegion& timeRegion)
         {
-            // If it was (re)enabled, clear the lists first
+            // If it was (re)enabled, clear the stack first. The event ring is cleared by the profiler when it's enabled.
             if (m_clearContainers)
             {
                 m_clearContainers = false;
 
                 m_stackLevel = 0;
-                m_cachedTimeRegionMap.clear();
                 m_timeRegionStack.clear();
-                m_cachedTimeRegions.clear();
             }
 
             timeRegion.m_stackDepth = static_cast<uint16_t>(m_stackLevel);
@@ -343,7 +359,6 @@ namespace AZ
             // Get the end timestamp here, to avoid the minor overhead
             const AZStd::sys_time_t endRegionTime = AZStd::GetTimeNowTicks();
 
-            AZ_Assert(!m_timeRegionStack.empty(), "Trying to pop an element in the stack, but it's empty.");
             TimeRegion* back = m_timeRegionStack.back();
             m_timeRegionStack.pop_back();
 
@@ -353,61 +368,56 @@ namespace AZ
             // Decrement the stack
             m_stackLevel--;
 
-            // Add an entry to the cached region
-            AddCachedRegion(CachedTimeRegion(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick));
+            // Add an entry to the event ring
+            PushEvent(CachedTimeRegion(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick));
         }
 
-        // Gets called when region ends and all data is set
-        void CpuTimingLocalStorage::AddCachedRegion(CachedTimeRegion&& timeRegionCached)
+        void CpuTimingLocalStorage::PushEvent(const CachedTimeRegion& timeRegionCached)
         {
-            if (m_hitSizeLimitMap[timeRegionCached.m_groupRegionName->m_regionName])
+            // The write index is only changed by this thread, the read index is changed by the profiler when the events are collected
+            const uint64_t writeIndex = m_eventWriteIndex.load(AZStd::memory_order_relaxed);
+            if (writeIndex - m_eventReadIndex.load(AZStd::memory_order_acquire) >= EventRingSize)
             {
+                m_droppedEventCount.fetch_add(1, AZStd::memory_order_relaxed);
                 return;
             }
-            // Add an entry to the cached region
-            m_cachedTimeRegions.push_back(timeRegionCached);
-
-            // If the stack is empty, add it to the local cache map. Only gets called when the stack is empty
-            // NOTE: this is where the largest overhead will be, but due to it only being called when the stack is empty
-            // (i.e when the root region ended), this overhead won't affect any time regions.
-            // The exception being for functions that are being profiled and create/spawn threads that are also profiled. Unfortunately, in this
-            // case, the overhead of the profiled threads will be added to the main thread.
-            if (m_timeRegionStack.empty())
-            {
-                AZStd::unique_lock<AZStd::mutex> lock(m_cachedTimeRegionMutex);
-
-                // Add the cached regions to the map
-                for (auto& cachedTimeRegion : m_cachedTimeRegions)
-                {
-                    const AZStd::string regionName = cachedTimeRegion.m_groupRegionName->m_regionName;
-                    AZStd::vector<CachedTimeRegion>& regionVec = m_cachedTimeRegionMap[regionName];
-                    regionVec.push_back(cachedTimeRegion);
-                    if (regionVec.size() >= TimeRegionStackSize)
-                    {
-                        m_hitSizeLimitMap[cachedTimeRegion.m_groupRegionName->m_regionName] = true;
-                    }
-                }
 
-                // Clear the cached regions
-                m_cachedTimeRegions.clear();
-            }
+            m_eventRing[writeIndex & (EventRingSize - 1)] = timeRegionCached;
+            // Publish the event to the profiler
+            m_eventWriteIndex.store(writeIndex + 1, AZStd::memory_order_release);
         }
 
-        void CpuTimingLocalStorage::TryFlushCachedMap(CpuProfiler::ThreadTimeRegionMap& cachedTimeRegionMap)
+        void CpuTimingLocalStorage::FlushEvents(CpuProfiler::ThreadTimeRegionMap& cachedTimeRegionMap)
         {
-            // Try to lock, if it's already in use (the cached regions in the array are being copied to the map)
-            // it'll show up in the next iteration when the user requests it.
-            if (m_cachedTimeRegionMutex.try_lock())
+            uint64_t readIndex = m_eventReadIndex.load(AZStd::memory_order_relaxed);
+            const uint64_t writeIndex = m_eventWriteIndex.load(AZStd::memory_order_acquire);
+
+            // Look up the region vectors by the address of the static names to avoid creating a string for every region
+            AZStd::unordered_map<const CachedTimeRegion::GroupRegionName*, AZStd::vector<CachedTimeRegion>*> regionVectors;
+            for (; readIndex != writeIndex; ++readIndex)
             {
-                // Only flush cached time regions if there are entries available
-                if (!m_cachedTimeRegionMap.empty())
+                const CachedTimeRegion& cachedTimeRegion = m_eventRing[readIndex & (EventRingSize - 1)];
+                AZStd::vector<CachedTimeRegion>*& regionVec = regionVectors[cachedTimeRegion.m_groupRegionName];
+                if (!regionVec)
                 {
-                    cachedTimeRegionMap = AZStd::move(m_cachedTimeRegionMap);
-                    m_cachedTimeRegionMap.clear();
-                    m_hitSizeLimitMap.clear();
+                    regionVec = &cachedTimeRegionMap[cachedTimeRegion.m_groupRegionName->m_regionName];
                 }
-                m_cachedTimeRegionMutex.unlock();
+                regionVec->push_back(cachedTimeRegion);
             }
+
+            // Hand the slots back to the owning thread
+            m_eventReadIndex.store(writeIndex, AZStd::memory_order_release);
+
+            const uint64_t droppedEventCount = m_droppedEventCount.exchange(0, AZStd::memory_order_relaxed);
+            AZ_Warning("CpuProfiler", droppedEventCount == 0,
+                "%llu time regions were dropped because more than %u regions completed on a thread in a single frame.",
+                static_cast<unsigned long long>(droppedEventCount), EventRingSize);
+        }
+
+        void CpuTimingLocalStorage::DiscardEvents()
+        {
+            m_eventReadIndex.store(m_eventWriteIndex.load(AZStd::memory_order_acquire), AZStd::memory_order_release);
+            m_droppedEventCount.store(0, AZStd::memory_order_relaxed);
         }
 
         // --- CpuProfilingStatisticsSerializer ---
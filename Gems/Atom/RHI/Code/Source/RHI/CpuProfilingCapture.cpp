@@ -0,0 +1,532 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RHI/CpuProfilingCapture.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+#include <cstdio>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        namespace CpuProfilingCaptureInternal
+        {
+            static constexpr char BinaryMagic[4] = { 'O', '3', 'C', 'P' };
+            static constexpr size_t StreamBufferSize = 64 * 1024;
+
+            enum class RecordType : uint8_t
+            {
+                Name = 1,   //!< u32 name index, u16 group length, u16 region length, group characters, region characters
+                Region = 2, //!< u32 name index, u16 stack depth, u64 thread id, i64 start tick, i64 end tick
+                FrameEnd = 3
+            };
+
+            struct RegionRecord
+            {
+                uint32_t m_nameIndex = 0;
+                uint16_t m_stackDepth = 0;
+                uint64_t m_threadId = 0;
+                int64_t m_startTick = 0;
+                int64_t m_endTick = 0;
+            };
+
+            // Collects small writes into larger blocks before passing them to the stream.
+            class StreamWriter
+            {
+            public:
+                explicit StreamWriter(IO::GenericStream& stream)
+                    : m_stream(stream)
+                {
+                    m_buffer.reserve(StreamBufferSize);
+                }
+
+                template<typename T>
+                void Write(const T& value)
+                {
+                    Write(&value, sizeof(T));
+                }
+
+                void Write(const void* data, size_t size)
+                {
+                    if (m_buffer.size() + size > StreamBufferSize)
+                    {
+                        Flush();
+                    }
+                    const char* bytes = reinterpret_cast<const char*>(data);
+                    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+                }
+
+                void Write(AZStd::string_view text)
+                {
+                    Write(text.data(), text.size());
+                }
+
+                bool Flush()
+                {
+                    if (!m_buffer.empty())
+                    {
+                        const IO::SizeType written = m_stream.Write(m_buffer.size(), m_buffer.data());
+                        m_failed = m_failed || written != m_buffer.size();
+                        m_buffer.clear();
+                    }
+                    return !m_failed;
+                }
+
+            private:
+                IO::GenericStream& m_stream;
+                AZStd::vector<char> m_buffer;
+                bool m_failed = false;
+            };
+
+            // Reads from the stream in larger blocks.
+            class StreamReader
+            {
+            public:
+                explicit StreamReader(IO::GenericStream& stream)
+                    : m_stream(stream)
+                {
+                    m_buffer.resize_no_construct(StreamBufferSize);
+                }
+
+                template<typename T>
+                bool Read(T& value)
+                {
+                    return Read(&value, sizeof(T));
+                }
+
+                bool Read(void* data, size_t size)
+                {
+                    char* bytes = reinterpret_cast<char*>(data);
+                    while (size > 0)
+                    {
+                        if (m_position == m_size)
+                        {
+                            m_position = 0;
+                            m_size = m_stream.Read(m_buffer.size(), m_buffer.data());
+                            if (m_size == 0)
+                            {
+                                return false;
+                            }
+                        }
+                        const size_t count = AZStd::min(size, static_cast<size_t>(m_size - m_position));
+                        memcpy(bytes, m_buffer.data() + m_position, count);
+                        m_position += count;
+                        bytes += count;
+                        size -= count;
+                    }
+                    return true;
+                }
+
+                bool IsAtEnd()
+                {
+                    if (m_position == m_size)
+                    {
+                        m_position = 0;
+                        m_size = m_stream.Read(m_buffer.size(), m_buffer.data());
+                    }
+                    return m_size == 0;
+                }
+
+            private:
+                IO::GenericStream& m_stream;
+                AZStd::vector<char> m_buffer;
+                IO::SizeType m_position = 0;
+                IO::SizeType m_size = 0;
+            };
+
+            static void WriteRegionRecord(StreamWriter& writer, const RegionRecord& record)
+            {
+                writer.Write(RecordType::Region);
+                writer.Write(record.m_nameIndex);
+                writer.Write(record.m_stackDepth);
+                writer.Write(record.m_threadId);
+                writer.Write(record.m_startTick);
+                writer.Write(record.m_endTick);
+            }
+
+            // Calls the name callback for every name record and the region callback for every region record in a binary capture.
+            template<typename NameCallback, typename RegionCallback>
+            static bool ReadBinaryCapture(
+                IO::GenericStream& stream, int64_t& ticksPerSecond, NameCallback&& nameCallback, RegionCallback&& regionCallback)
+            {
+                StreamReader reader(stream);
+
+                char magic[4];
+                uint32_t version = 0;
+                if (!reader.Read(magic, sizeof(magic)) || memcmp(magic, BinaryMagic, sizeof(magic)) != 0)
+                {
+                    AZ_Error("CpuProfilingCapture", false, "The stream doesn't contain a cpu profiling capture.");
+                    return false;
+                }
+                if (!reader.Read(version) || version != CpuProfilingCapture::BinaryFormatVersion)
+                {
+                    AZ_Error("CpuProfilingCapture", false, "Cpu profiling capture has version %u, but only version %u is supported.",
+                        version, CpuProfilingCapture::BinaryFormatVersion);
+                    return false;
+                }
+                if (!reader.Read(ticksPerSecond) || ticksPerSecond <= 0)
+                {
+                    AZ_Error("CpuProfilingCapture", false, "Cpu profiling capture has an invalid header.");
+                    return false;
+                }
+
+                AZStd::string groupName;
+                AZStd::string regionName;
+                uint32_t nameCount = 0;
+                while (!reader.IsAtEnd())
+                {
+                    RecordType type;
+                    if (!reader.Read(type))
+                    {
+                        return false;
+                    }
+
+                    bool success = true;
+                    switch (type)
+                    {
+                    case RecordType::Name:
+                    {
+                        uint32_t nameIndex = 0;
+                        uint16_t groupLength = 0;
+                        uint16_t regionLength = 0;
+                        success = reader.Read(nameIndex) && reader.Read(groupLength) && reader.Read(regionLength) && nameIndex == nameCount;
+                        if (success)
+                        {
+                            groupName.resize_no_construct(groupLength);
+                            regionName.resize_no_construct(regionLength);
+                            success = reader.Read(groupName.data(), groupLength) && reader.Read(regionName.data(), regionLength);
+                        }
+                        if (success)
+                        {
+                            nameCallback(groupName, regionName);
+                            ++nameCount;
+                        }
+                        break;
+                    }
+                    case RecordType::Region:
+                    {
+                        RegionRecord record;
+                        success = reader.Read(record.m_nameIndex) && reader.Read(record.m_stackDepth) && reader.Read(record.m_threadId) &&
+                            reader.Read(record.m_startTick) && reader.Read(record.m_endTick) && record.m_nameIndex < nameCount;
+                        if (success)
+                        {
+                            regionCallback(record);
+                        }
+                        break;
+                    }
+                    case RecordType::FrameEnd:
+                        break;
+                    default:
+                        success = false;
+                        break;
+                    }
+
+                    if (!success)
+                    {
+                        AZ_Error("CpuProfilingCapture", false, "Cpu profiling capture is truncated or corrupted.");
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            // Returns the string as a json string value, including the quotes.
+            static AZStd::string EscapeJsonString(AZStd::string_view text)
+            {
+                AZStd::string escaped;
+                escaped.reserve(text.size() + 2);
+                escaped.push_back('"');
+                for (char character : text)
+                {
+                    switch (character)
+                    {
+                    case '"':
+                        escaped += "\\\"";
+                        break;
+                    case '\\':
+                        escaped += "\\\\";
+                        break;
+                    case '\n':
+                        escaped += "\\n";
+                        break;
+                    case '\t':
+                        escaped += "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(character) < 0x20)
+                        {
+                            escaped += AZStd::string::format("\\u%04x", static_cast<unsigned int>(character));
+                        }
+                        else
+                        {
+                            escaped.push_back(character);
+                        }
+                        break;
+                    }
+                }
+                escaped.push_back('"');
+                return escaped;
+            }
+
+            // Writes the Chrome trace events one region at a time.
+            class ChromeTraceWriter
+            {
+            public:
+                ChromeTraceWriter(IO::GenericStream& stream, int64_t ticksPerSecond)
+                    : m_writer(stream)
+                    , m_microsecondsPerTick(1000000.0 / static_cast<double>(ticksPerSecond))
+                {
+                    m_writer.Write(AZStd::string_view("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+                }
+
+                void AddName(AZStd::string_view groupName, AZStd::string_view regionName)
+                {
+                    // Store the names already escaped so they can be copied as-is for every region
+                    StreamNames names;
+                    names.m_group = EscapeJsonString(groupName);
+                    names.m_region = EscapeJsonString(regionName);
+                    m_names.push_back(AZStd::move(names));
+                }
+
+                void AddRegion(const RegionRecord& record)
+                {
+                    const StreamNames& names = m_names[record.m_nameIndex];
+                    char numbers[128];
+                    const int length = azsnprintf(numbers, sizeof(numbers), ",\"ph\":\"X\",\"pid\":0,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f}",
+                        static_cast<unsigned long long>(record.m_threadId),
+                        static_cast<double>(record.m_startTick) * m_microsecondsPerTick,
+                        static_cast<double>(record.m_endTick - record.m_startTick) * m_microsecondsPerTick);
+
+                    if (!m_isFirstEvent)
+                    {
+                        m_writer.Write(',');
+                    }
+                    m_isFirstEvent = false;
+                    m_writer.Write(AZStd::string_view("{\"name\":"));
+                    m_writer.Write(AZStd::string_view(names.m_region));
+                    m_writer.Write(AZStd::string_view(",\"cat\":"));
+                    m_writer.Write(AZStd::string_view(names.m_group));
+                    m_writer.Write(numbers, static_cast<size_t>(length));
+                }
+
+                bool Finish()
+                {
+                    m_writer.Write(AZStd::string_view("]}"));
+                    return m_writer.Flush();
+                }
+
+            private:
+                struct StreamNames
+                {
+                    AZStd::string m_group;
+                    AZStd::string m_region;
+                };
+
+                StreamWriter m_writer;
+                AZStd::vector<StreamNames> m_names;
+                double m_microsecondsPerTick;
+                bool m_isFirstEvent = true;
+            };
+
+            // Calls the region callback for every region in the frames and the name callback the first time a name is used, which
+            // assigns the next index to the name.
+            template<typename NameCallback, typename RegionCallback, typename FrameEndCallback>
+            static void EnumerateFrames(const CpuProfilingCapture::Frames& frames, NameCallback&& nameCallback,
+                RegionCallback&& regionCallback, FrameEndCallback&& frameEndCallback)
+            {
+                AZStd::unordered_map<const CachedTimeRegion::GroupRegionName*, uint32_t> nameIndices;
+                for (const CpuProfiler::TimeRegionMap& timeRegionMap : frames)
+                {
+                    for (const auto& [threadId, regionMap] : timeRegionMap)
+                    {
+                        const uint64_t threadIdHash = AZStd::hash<AZStd::thread_id>{}(threadId);
+                        for (const auto& [regionName, regionVec] : regionMap)
+                        {
+                            for (const CachedTimeRegion& region : regionVec)
+                            {
+                                auto [nameIt, inserted] = nameIndices.emplace(region.m_groupRegionName, aznumeric_cast<uint32_t>(nameIndices.size()));
+                                if (inserted)
+                                {
+                                    nameCallback(region.m_groupRegionName->m_groupName, region.m_groupRegionName->m_regionName);
+                                }
+
+                                RegionRecord record;
+                                record.m_nameIndex = nameIt->second;
+                                record.m_stackDepth = region.m_stackDepth;
+                                record.m_threadId = threadIdHash;
+                                record.m_startTick = region.m_startTick;
+                                record.m_endTick = region.m_endTick;
+                                regionCallback(record);
+                            }
+                        }
+                    }
+                    frameEndCallback();
+                }
+            }
+        } // namespace CpuProfilingCaptureInternal
+
+        bool CpuProfilingCapture::WriteBinary(IO::GenericStream& stream, const Frames& frames)
+        {
+            using namespace CpuProfilingCaptureInternal;
+
+            StreamWriter writer(stream);
+            writer.Write(BinaryMagic, sizeof(BinaryMagic));
+            writer.Write(BinaryFormatVersion);
+            writer.Write(static_cast<int64_t>(AZStd::GetTimeTicksPerSecond()));
+
+            uint32_t nameCount = 0;
+            auto writeName = [&writer, &nameCount](AZStd::string_view groupName, AZStd::string_view regionName)
+            {
+                const uint16_t groupLength = aznumeric_cast<uint16_t>(AZStd::min<size_t>(groupName.size(), AZStd::numeric_limits<uint16_t>::max()));
+                const uint16_t regionLength = aznumeric_cast<uint16_t>(AZStd::min<size_t>(regionName.size(), AZStd::numeric_limits<uint16_t>::max()));
+                writer.Write(RecordType::Name);
+                writer.Write(nameCount++);
+                writer.Write(groupLength);
+                writer.Write(regionLength);
+                writer.Write(groupName.data(), groupLength);
+                writer.Write(regionName.data(), regionLength);
+            };
+
+            EnumerateFrames(frames, writeName,
+                [&writer](const RegionRecord& record)
+                {
+                    WriteRegionRecord(writer, record);
+                },
+                [&writer]()
+                {
+                    writer.Write(RecordType::FrameEnd);
+                });
+
+            return writer.Flush();
+        }
+
+        bool CpuProfilingCapture::ReadBinary(IO::GenericStream& stream, Entries& entries)
+        {
+            using namespace CpuProfilingCaptureInternal;
+
+            struct EntryNames
+            {
+                Name m_group;
+                Name m_region;
+            };
+            AZStd::vector<EntryNames> names;
+
+            int64_t ticksPerSecond = 0;
+            const int64_t localTicksPerSecond = static_cast<int64_t>(AZStd::GetTimeTicksPerSecond());
+            auto readName = [&names](AZStd::string_view groupName, AZStd::string_view regionName)
+            {
+                names.push_back({ Name(groupName), Name(regionName) });
+            };
+            auto readRegion = [&names, &entries, &ticksPerSecond, localTicksPerSecond](const RegionRecord& record)
+            {
+                CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializerEntry& entry = entries.emplace_back();
+                entry.m_groupName = names[record.m_nameIndex].m_group;
+                entry.m_regionName = names[record.m_nameIndex].m_region;
+                entry.m_stackDepth = record.m_stackDepth;
+                entry.m_threadId = static_cast<size_t>(record.m_threadId);
+                if (ticksPerSecond == localTicksPerSecond)
+                {
+                    entry.m_startTick = record.m_startTick;
+                    entry.m_endTick = record.m_endTick;
+                }
+                else
+                {
+                    // The header has been read by the time regions are found, so the tick rate of the capture is known
+                    const double tickScale = static_cast<double>(localTicksPerSecond) / static_cast<double>(ticksPerSecond);
+                    entry.m_startTick = static_cast<AZStd::sys_time_t>(static_cast<double>(record.m_startTick) * tickScale);
+                    entry.m_endTick = static_cast<AZStd::sys_time_t>(static_cast<double>(record.m_endTick) * tickScale);
+                }
+            };
+            return ReadBinaryCapture(stream, ticksPerSecond, readName, readRegion);
+        }
+
+        bool CpuProfilingCapture::WriteChromeTrace(IO::GenericStream& stream, const Frames& frames)
+        {
+            using namespace CpuProfilingCaptureInternal;
+
+            ChromeTraceWriter traceWriter(stream, static_cast<int64_t>(AZStd::GetTimeTicksPerSecond()));
+            EnumerateFrames(frames,
+                [&traceWriter](AZStd::string_view groupName, AZStd::string_view regionName)
+                {
+                    traceWriter.AddName(groupName, regionName);
+                },
+                [&traceWriter](const RegionRecord& record)
+                {
+                    traceWriter.AddRegion(record);
+                },
+                []()
+                {
+                });
+            return traceWriter.Finish();
+        }
+
+        bool CpuProfilingCapture::ConvertBinaryToChromeTrace(IO::GenericStream& binaryStream, IO::GenericStream& traceStream)
+        {
+            using namespace CpuProfilingCaptureInternal;
+
+            AZStd::unique_ptr<ChromeTraceWriter> traceWriter;
+            int64_t ticksPerSecond = 0;
+            const bool result = ReadBinaryCapture(binaryStream, ticksPerSecond,
+                [&traceWriter, &ticksPerSecond, &traceStream](AZStd::string_view groupName, AZStd::string_view regionName)
+                {
+                    if (!traceWriter)
+                    {
+                        traceWriter = AZStd::make_unique<ChromeTraceWriter>(traceStream, ticksPerSecond);
+                    }
+                    traceWriter->AddName(groupName, regionName);
+                },
+                [&traceWriter](const RegionRecord& record)
+                {
+                    traceWriter->AddRegion(record);
+                });
+            if (!result)
+            {
+                return false;
+            }
+
+            // A capture without any regions still results in a valid trace
+            if (!traceWriter)
+            {
+                traceWriter = AZStd::make_unique<ChromeTraceWriter>(traceStream, ticksPerSecond);
+            }
+            return traceWriter->Finish();
+        }
+
+        bool CpuProfilingCapture::IsBinaryFile(AZStd::string_view filePath)
+        {
+            return filePath.ends_with(BinaryFileExtension);
+        }
+
+        bool CpuProfilingCapture::IsChromeTraceFile(AZStd::string_view filePath)
+        {
+            return filePath.ends_with(ChromeTraceFileSuffix);
+        }
+
+        MessageOutcome CpuProfilingCapture::SaveToFile(const char* filePath, const Frames& frames)
+        {
+            IO::FileIOStream stream(filePath, IO::OpenMode::ModeWrite | IO::OpenMode::ModeBinary | IO::OpenMode::ModeCreatePath);
+            if (!stream.IsOpen())
+            {
+                return AZ::Failure(AZStd::string::format("Failed to open '%s' for writing.", filePath));
+            }
+
+            const bool result = IsChromeTraceFile(filePath) ? WriteChromeTrace(stream, frames) : WriteBinary(stream, frames);
+            if (!result)
+            {
+                return AZ::Failure(AZStd::string::format("Failed to write the cpu profiling capture to '%s'.", filePath));
+            }
+            return AZ::Success();
+        }
+    } // namespace RHI
+} // namespace AZ
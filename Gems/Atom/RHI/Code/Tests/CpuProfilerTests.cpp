@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Atom/RHI/CpuProfilerImpl.h>
+#include <Atom/RHI/CpuProfilingCapture.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace RHI;
+
+    class CpuProfilerTests
+        : public RHITestFixture
+    {
+    protected:
+        static const CachedTimeRegion::GroupRegionName* GetOuterName()
+        {
+            static const CachedTimeRegion::GroupRegionName name("TestGroup", "OuterRegion");
+            return &name;
+        }
+
+        static const CachedTimeRegion::GroupRegionName* GetInnerName()
+        {
+            static const CachedTimeRegion::GroupRegionName name("TestGroup", "Inner \"quoted\" Region");
+            return &name;
+        }
+
+        static CpuProfilingCapture::Frames CreateFrames()
+        {
+            const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+
+            CpuProfilingCapture::Frames frames;
+            frames.set_capacity(2);
+
+            CpuProfiler::TimeRegionMap firstFrame;
+            firstFrame[threadId][GetOuterName()->m_regionName].emplace_back(GetOuterName(), uint16_t(0), 100, 400);
+            firstFrame[threadId][GetInnerName()->m_regionName].emplace_back(GetInnerName(), uint16_t(1), 150, 250);
+            frames.push_back(AZStd::move(firstFrame));
+
+            CpuProfiler::TimeRegionMap secondFrame;
+            secondFrame[threadId][GetOuterName()->m_regionName].emplace_back(GetOuterName(), uint16_t(0), 500, 900);
+            frames.push_back(AZStd::move(secondFrame));
+            return frames;
+        }
+
+        static AZStd::string ToString(const AZStd::vector<char>& buffer)
+        {
+            return AZStd::string(buffer.data(), buffer.size());
+        }
+    };
+
+    TEST_F(CpuProfilerTests, BinaryCapture_WriteAndRead_RegionsArePreserved)
+    {
+        const CpuProfilingCapture::Frames frames = CreateFrames();
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        EXPECT_TRUE(CpuProfilingCapture::WriteBinary(stream, frames));
+
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        CpuProfilingCapture::Entries entries;
+        ASSERT_TRUE(CpuProfilingCapture::ReadBinary(stream, entries));
+        ASSERT_EQ(3, entries.size());
+
+        const size_t threadIdHash = AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id());
+        size_t outerCount = 0;
+        for (const auto& entry : entries)
+        {
+            EXPECT_EQ(Name("TestGroup"), entry.m_groupName);
+            EXPECT_EQ(threadIdHash, entry.m_threadId);
+            if (entry.m_regionName == Name(GetOuterName()->m_regionName))
+            {
+                ++outerCount;
+                EXPECT_EQ(0, entry.m_stackDepth);
+                EXPECT_EQ(entry.m_startTick == 100 ? 400 : 900, entry.m_endTick);
+            }
+            else
+            {
+                EXPECT_EQ(Name(GetInnerName()->m_regionName), entry.m_regionName);
+                EXPECT_EQ(1, entry.m_stackDepth);
+                EXPECT_EQ(150, entry.m_startTick);
+                EXPECT_EQ(250, entry.m_endTick);
+            }
+        }
+        EXPECT_EQ(2, outerCount);
+    }
+
+    TEST_F(CpuProfilerTests, BinaryCapture_ReadInvalidData_Fails)
+    {
+        AZStd::vector<char> buffer = { 'n', 'o', 't', ' ', 'a', ' ', 'c', 'a', 'p', 't', 'u', 'r', 'e' };
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+
+        CpuProfilingCapture::Entries entries;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(CpuProfilingCapture::ReadBinary(stream, entries));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(CpuProfilerTests, ChromeTrace_Write_ContainsEscapedCompleteEvents)
+    {
+        const CpuProfilingCapture::Frames frames = CreateFrames();
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        EXPECT_TRUE(CpuProfilingCapture::WriteChromeTrace(stream, frames));
+
+        const AZStd::string trace = ToString(buffer);
+        EXPECT_TRUE(trace.starts_with("{"));
+        EXPECT_TRUE(trace.ends_with("]}"));
+        EXPECT_NE(AZStd::string::npos, trace.find(R"("name":"OuterRegion","cat":"TestGroup","ph":"X")"));
+        EXPECT_NE(AZStd::string::npos, trace.find(R"("name":"Inner \"quoted\" Region")"));
+    }
+
+    TEST_F(CpuProfilerTests, ChromeTrace_ConvertFromBinary_MatchesDirectExport)
+    {
+        const CpuProfilingCapture::Frames frames = CreateFrames();
+
+        AZStd::vector<char> binaryBuffer;
+        IO::ByteContainerStream<AZStd::vector<char>> binaryStream(&binaryBuffer);
+        EXPECT_TRUE(CpuProfilingCapture::WriteBinary(binaryStream, frames));
+        binaryStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+        AZStd::vector<char> convertedBuffer;
+        IO::ByteContainerStream<AZStd::vector<char>> convertedStream(&convertedBuffer);
+        EXPECT_TRUE(CpuProfilingCapture::ConvertBinaryToChromeTrace(binaryStream, convertedStream));
+
+        AZStd::vector<char> directBuffer;
+        IO::ByteContainerStream<AZStd::vector<char>> directStream(&directBuffer);
+        EXPECT_TRUE(CpuProfilingCapture::WriteChromeTrace(directStream, frames));
+
+        // The thread id is written as a hash in both cases, so the output is identical
+        EXPECT_EQ(ToString(directBuffer), ToString(convertedBuffer));
+    }
+
+    TEST_F(CpuProfilerTests, CpuProfilerImpl_RegionsOnThread_CollectedOnSystemTick)
+    {
+        static constexpr uint32_t RegionCount = 100;
+
+        CpuProfilerImpl profiler;
+        profiler.Init();
+        profiler.SetProfilerEnabled(true);
+
+        // Record on a new thread so it gets its own thread local storage
+        AZStd::thread_id recordingThreadId;
+        AZStd::thread recordingThread(
+            [&recordingThreadId]()
+            {
+                recordingThreadId = AZStd::this_thread::get_id();
+                for (uint32_t i = 0; i < RegionCount; ++i)
+                {
+                    TimeRegion outer(GetOuterName());
+                    TimeRegion inner(GetInnerName());
+                }
+            });
+        recordingThread.join();
+
+        profiler.OnSystemTick();
+
+        const CpuProfiler::TimeRegionMap& timeRegionMap = profiler.GetTimeRegionMap();
+        auto threadIt = timeRegionMap.find(recordingThreadId);
+        ASSERT_NE(timeRegionMap.end(), threadIt);
+
+        auto outerIt = threadIt->second.find(GetOuterName()->m_regionName);
+        auto innerIt = threadIt->second.find(GetInnerName()->m_regionName);
+        ASSERT_NE(threadIt->second.end(), outerIt);
+        ASSERT_NE(threadIt->second.end(), innerIt);
+        EXPECT_EQ(RegionCount, outerIt->second.size());
+        EXPECT_EQ(RegionCount, innerIt->second.size());
+        for (const CachedTimeRegion& region : innerIt->second)
+        {
+            EXPECT_EQ(1, region.m_stackDepth);
+            EXPECT_LE(region.m_startTick, region.m_endTick);
+        }
+
+        profiler.Shutdown();
+    }
+
+    TEST_F(CpuProfilerTests, CpuProfilerImpl_EventRingFull_DropsNewRegions)
+    {
+        static constexpr uint32_t ExtraRegionCount = 10;
+
+        CpuProfilerImpl profiler;
+        profiler.Init();
+        profiler.SetProfilerEnabled(true);
+
+        AZStd::thread_id recordingThreadId;
+        AZStd::thread recordingThread(
+            [&recordingThreadId]()
+            {
+                recordingThreadId = AZStd::this_thread::get_id();
+                for (uint32_t i = 0; i < CpuTimingLocalStorage::EventRingSize + ExtraRegionCount; ++i)
+                {
+                    TimeRegion region(GetOuterName());
+                }
+            });
+        recordingThread.join();
+
+        profiler.OnSystemTick();
+
+        const CpuProfiler::TimeRegionMap& timeRegionMap = profiler.GetTimeRegionMap();
+        auto threadIt = timeRegionMap.find(recordingThreadId);
+        ASSERT_NE(timeRegionMap.end(), threadIt);
+        auto regionIt = threadIt->second.find(GetOuterName()->m_regionName);
+        ASSERT_NE(threadIt->second.end(), regionIt);
+        EXPECT_EQ(CpuTimingLocalStorage::EventRingSize, regionIt->second.size());
+
+        profiler.Shutdown();
+    }
+} // namespace UnitTest
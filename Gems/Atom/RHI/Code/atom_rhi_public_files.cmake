@@ -200,5 +200,7 @@ set(FILES
     Include/Atom/RHI/CpuProfiler.h
     Include/Atom/RHI/CpuProfilerImpl.h
     Source/RHI/CpuProfilerImpl.cpp
+    Include/Atom/RHI/CpuProfilingCapture.h
+    Source/RHI/CpuProfilingCapture.cpp
     Include/Atom/RHI/TagRegistry.h
 )
@@ -55,6 +55,7 @@ namespace AZ
                 AzFramework::VisibilityEntry m_visibilityEntry;
 
                 //! World-space bounding sphere
+                //! Batched culling selects lods using the center of m_visibilityEntry.m_boundingVolume, so the sphere is expected to share that center
                 AZ::Sphere m_boundingSphere;
                 //! World-space bouding oriented-bounding-box
                 AZ::Obb m_boundingObb;
@@ -215,6 +216,9 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Selects an lod using an already computed screen coverage (see ModelLodUtils::ApproxScreenPercentage) and adds the appropriate DrawPackets to the view.
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view);
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
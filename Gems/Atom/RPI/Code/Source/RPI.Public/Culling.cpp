@@ -18,6 +18,7 @@
 
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/Casting/numeric_cast.h>
@@ -44,6 +45,118 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(bool, r_CullBatched, true, nullptr, ConsoleFunctorFlags::Null, "Cull the objects of each octree node in SIMD batches using the entry bounds provided by the visibility scene");
+
+        namespace
+        {
+            using EntryBoundsBatch = AzFramework::VisibilityEntryBoundsBatch;
+            static_assert(EntryBoundsBatch::EntryCount == Simd::Vec4::ElementCount, "Entry bounds batches must match the SIMD width");
+
+            //! Frustum planes and lod selection parameters of a view splatted across SIMD lanes,
+            //! so one instruction processes every lane of an EntryBoundsBatch.
+            struct BatchCullParameters
+            {
+                BatchCullParameters(const Frustum& frustum, const View& view)
+                {
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        const Plane plane = frustum.GetPlane(planeId);
+                        const Vector3 normal = plane.GetNormal();
+                        m_planeNormalX[planeId] = Simd::Vec4::Splat(normal.GetX());
+                        m_planeNormalY[planeId] = Simd::Vec4::Splat(normal.GetY());
+                        m_planeNormalZ[planeId] = Simd::Vec4::Splat(normal.GetZ());
+                        m_planeDistance[planeId] = Simd::Vec4::Splat(plane.GetDistance());
+                        m_planeNormalAbsX[planeId] = Simd::Vec4::Splat(fabsf(normal.GetX()));
+                        m_planeNormalAbsY[planeId] = Simd::Vec4::Splat(fabsf(normal.GetY()));
+                        m_planeNormalAbsZ[planeId] = Simd::Vec4::Splat(fabsf(normal.GetZ()));
+                    }
+
+                    // Same parameters as AddLodDataToView and ModelLodUtils::ApproxScreenPercentage
+                    const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+                    const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+                    m_cameraX = Simd::Vec4::Splat(cameraPos.GetX());
+                    m_cameraY = Simd::Vec4::Splat(cameraPos.GetY());
+                    m_cameraZ = Simd::Vec4::Splat(cameraPos.GetZ());
+                    m_yScale = Simd::Vec4::Splat(viewToClip.GetElement(1, 1));
+                    m_isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                }
+
+                Simd::Vec4::FloatType m_planeNormalX[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_planeNormalY[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_planeNormalZ[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_planeDistance[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_planeNormalAbsX[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_planeNormalAbsY[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_planeNormalAbsZ[Frustum::PlaneId::MAX];
+                Simd::Vec4::FloatType m_cameraX;
+                Simd::Vec4::FloatType m_cameraY;
+                Simd::Vec4::FloatType m_cameraZ;
+                Simd::Vec4::FloatType m_yScale;
+                bool m_isPerspective = true;
+            };
+
+            uint32_t GetLaneMask(Simd::Vec4::FloatArgType comparison)
+            {
+                alignas(16) int32_t lanes[EntryBoundsBatch::EntryCount];
+                Simd::Vec4::StoreAligned(lanes, Simd::Vec4::CastToInt(comparison));
+                return (lanes[0] ? 0x1 : 0) | (lanes[1] ? 0x2 : 0) | (lanes[2] ? 0x4 : 0) | (lanes[3] ? 0x8 : 0);
+            }
+
+            //! Classifies a batch of entry bounds against the frustum, with the same results as ShapeIntersection::Overlaps and
+            //! ShapeIntersection::Contains for each entry's aabb. In the same pass, computes the factor that turns a lod selection
+            //! radius centered on the entry bounds into an approximate screen coverage (see ModelLodUtils::ApproxScreenPercentage).
+            void CullEntryBoundsBatch(const BatchCullParameters& params, const EntryBoundsBatch& batch, bool testFrustum,
+                uint32_t& outOverlapsMask, uint32_t& outContainedMask, float* outCoverageScale)
+            {
+                const Simd::Vec4::FloatType centerX = Simd::Vec4::LoadAligned(batch.m_centerX);
+                const Simd::Vec4::FloatType centerY = Simd::Vec4::LoadAligned(batch.m_centerY);
+                const Simd::Vec4::FloatType centerZ = Simd::Vec4::LoadAligned(batch.m_centerZ);
+
+                if (testFrustum)
+                {
+                    const Simd::Vec4::FloatType halfExtentX = Simd::Vec4::LoadAligned(batch.m_halfExtentX);
+                    const Simd::Vec4::FloatType halfExtentY = Simd::Vec4::LoadAligned(batch.m_halfExtentY);
+                    const Simd::Vec4::FloatType halfExtentZ = Simd::Vec4::LoadAligned(batch.m_halfExtentZ);
+                    const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+
+                    Simd::Vec4::FloatType exterior = zero;
+                    Simd::Vec4::FloatType contained = Simd::Vec4::CmpEq(zero, zero);
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        // Center-to-plane distance compared against the projection interval radius of the aabb onto the plane normal
+                        const Simd::Vec4::FloatType distance = Simd::Vec4::Madd(centerX, params.m_planeNormalX[planeId],
+                            Simd::Vec4::Madd(centerY, params.m_planeNormalY[planeId],
+                            Simd::Vec4::Madd(centerZ, params.m_planeNormalZ[planeId], params.m_planeDistance[planeId])));
+                        const Simd::Vec4::FloatType radius = Simd::Vec4::Madd(halfExtentX, params.m_planeNormalAbsX[planeId],
+                            Simd::Vec4::Madd(halfExtentY, params.m_planeNormalAbsY[planeId],
+                            Simd::Vec4::Mul(halfExtentZ, params.m_planeNormalAbsZ[planeId])));
+
+                        exterior = Simd::Vec4::Or(exterior, Simd::Vec4::CmpLtEq(Simd::Vec4::Add(distance, radius), zero));
+                        contained = Simd::Vec4::And(contained, Simd::Vec4::CmpGtEq(Simd::Vec4::Sub(distance, radius), zero));
+                    }
+
+                    outOverlapsMask = ~GetLaneMask(exterior) & 0xF;
+                    outContainedMask = GetLaneMask(contained);
+                }
+                else
+                {
+                    outOverlapsMask = 0xF;
+                    outContainedMask = 0xF;
+                }
+
+                Simd::Vec4::FloatType coverageScale = params.m_yScale;
+                if (params.m_isPerspective)
+                {
+                    const Simd::Vec4::FloatType toCameraX = Simd::Vec4::Sub(params.m_cameraX, centerX);
+                    const Simd::Vec4::FloatType toCameraY = Simd::Vec4::Sub(params.m_cameraY, centerY);
+                    const Simd::Vec4::FloatType toCameraZ = Simd::Vec4::Sub(params.m_cameraZ, centerZ);
+                    const Simd::Vec4::FloatType distanceSq = Simd::Vec4::Madd(toCameraX, toCameraX,
+                        Simd::Vec4::Madd(toCameraY, toCameraY, Simd::Vec4::Mul(toCameraZ, toCameraZ)));
+                    coverageScale = Simd::Vec4::Div(params.m_yScale, Simd::Vec4::Sqrt(distanceSq));
+                }
+                Simd::Vec4::StoreAligned(outCoverageScale, coverageScale);
+            }
+        }
 
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -306,6 +419,9 @@ namespace AZ
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
 
+                const bool cullBatched = r_CullBatched;
+                const BatchCullParameters batchCullParameters(m_jobData->m_frustum, *m_jobData->m_view);
+
                 for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
                 {
                     //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
@@ -316,7 +432,12 @@ namespace AZ
                         m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
 #endif
 
-                    if (nodeIsContainedInFrustum || !m_jobData->m_debugCtx->m_enableFrustumCulling)
+                    if (cullBatched && nodeData.m_entryBounds != nullptr)
+                    {
+                        const bool testFrustum = !nodeIsContainedInFrustum && m_jobData->m_debugCtx->m_enableFrustumCulling;
+                        ProcessEntriesBatched(nodeData, batchCullParameters, testFrustum, numDrawPackets, numVisibleCullables);
+                    }
+                    else if (nodeIsContainedInFrustum || !m_jobData->m_debugCtx->m_enableFrustumCulling)
                     {
                         //Add all objects within this node to the view, without any extra culling
                         for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
@@ -447,6 +568,71 @@ namespace AZ
                 }
             }
 
+            //! Culls the entries of a node in batches using the entry bounds provided by the visibility scene. Entries outside of the
+            //! frustum are rejected without touching their Cullable, entries crossing a frustum plane get the same fine grained test as above.
+            void ProcessEntriesBatched(const AzFramework::IVisibilityScene::NodeData& nodeData, const BatchCullParameters& batchCullParameters,
+                bool testFrustum, uint32_t& numDrawPackets, uint32_t& numVisibleCullables)
+            {
+                const View::UsageFlags viewFlags = m_jobData->m_view->GetUsageFlags();
+                const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
+
+                const size_t entryCount = nodeData.m_entries.size();
+                alignas(16) float coverageScale[EntryBoundsBatch::EntryCount];
+                for (size_t batchStart = 0; batchStart < entryCount; batchStart += EntryBoundsBatch::EntryCount)
+                {
+                    uint32_t overlapsMask = 0;
+                    uint32_t containedMask = 0;
+                    CullEntryBoundsBatch(batchCullParameters, nodeData.m_entryBounds[batchStart / EntryBoundsBatch::EntryCount], testFrustum,
+                        overlapsMask, containedMask, coverageScale);
+
+                    const size_t laneCount = AZStd::min<size_t>(EntryBoundsBatch::EntryCount, entryCount - batchStart);
+                    for (size_t lane = 0; lane < laneCount; ++lane)
+                    {
+                        const uint32_t laneBit = 1u << lane;
+                        if ((overlapsMask & laneBit) == 0)
+                        {
+                            continue;
+                        }
+
+                        AzFramework::VisibilityEntry* visibleEntry = nodeData.m_entries[batchStart + lane];
+                        if ((visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable) == 0)
+                        {
+                            continue;
+                        }
+
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+
+                        if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                            c->m_cullData.m_hideFlags & viewFlags ||
+                            c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                            c->m_isHidden)
+                        {
+                            continue;
+                        }
+
+                        if ((containedMask & laneBit) == 0)
+                        {
+                            IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
+                            if (res == IntersectResult::Exterior ||
+                                (res != IntersectResult::Interior && !ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb)))
+                            {
+                                continue;
+                            }
+                        }
+
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+                        if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+#endif
+                        {
+                            const float approxScreenPercentage = AZStd::GetMin(coverageScale[lane] * c->m_lodData.m_lodSelectionRadius, 1.0f);
+                            numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, approxScreenPercentage, *m_jobData->m_view);
+                            ++numVisibleCullables;
+                            c->m_isVisible = true;
+                        }
+                    }
+                }
+            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling::CullingResult TestOcclusionCulling(AzFramework::VisibilityEntry* visibleEntry)
             {
@@ -658,6 +844,11 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, lodData, approxScreenPercentage, view);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view)
+        {
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
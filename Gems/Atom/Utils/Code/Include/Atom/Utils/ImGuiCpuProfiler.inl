@@ -10,6 +10,7 @@
 #include <Atom/RHI.Reflect/CpuTimingStatistics.h>
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI/CpuProfilerImpl.h>
+#include <Atom/RHI/CpuProfilingCapture.h>
 #include <Atom/RPI.Edit/Common/JsonUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 
@@ -50,6 +51,25 @@ namespace AZ
                     return Failure(AZStd::string::format("Could not resolve the path to file %s, is the path correct?", resolvedPath));
                 }
 
+                // Binary captures are streamed straight into the entries
+                if (RHI::CpuProfilingCapture::IsBinaryFile(resolvedPath))
+                {
+                    IO::FileIOStream stream(resolvedPath, IO::OpenMode::ModeRead | IO::OpenMode::ModeBinary);
+                    if (!stream.IsOpen())
+                    {
+                        return Failure(AZStd::string::format("Could not open file %s, is the path correct?\n", resolvedPath));
+                    }
+
+                    DeserializedCpuData entries;
+                    if (!RHI::CpuProfilingCapture::ReadBinary(stream, entries) || entries.empty())
+                    {
+                        return Failure(AZStd::string::format("Error in loading binary capture %s\n", resolvedPath));
+                    }
+
+                    AZ_TracePrintf("JsonUtils", "Successfully loaded CPU profiling data with %zu profiling entries.\n", entries.size());
+                    return Success(AZStd::move(entries));
+                }
+
                 u64 captureSizeBytes;
                 const IO::Result fileSizeResult = base->Size(resolvedPath, captureSizeBytes);
                 if (!fileSizeResult)
@@ -211,9 +231,10 @@ namespace AZ
                     AZStd::to_string(timeString, timeNow);
                     u64 currentTick = AZ::RPI::RPISystemInterface::Get()->GetCurrentTick();
                     const AZStd::string frameDataFilePath = AZStd::string::format(
-                        "@user@/CpuProfiler/%s_%llu.json",
+                        "@user@/CpuProfiler/%s_%llu%s",
                         timeString.c_str(),
-                        currentTick);
+                        currentTick,
+                        RHI::CpuProfilingCapture::BinaryFileExtension);
                     char resolvedPath[AZ::IO::MaxPathLength];
                     AZ::IO::FileIOBase::GetInstance()->ResolvePath(frameDataFilePath.c_str(), resolvedPath, AZ::IO::MaxPathLength);
                     m_lastCapturedFilePath = resolvedPath;
@@ -239,14 +260,17 @@ namespace AZ
                 const AZStd::string defaultSavedCapturePath = "@user@/CpuProfiler";
 
                 m_cachedCapturePaths.clear();
-                base->FindFiles(
-                    defaultSavedCapturePath.c_str(), "*.json",
-                    [&paths = m_cachedCapturePaths](const char* path) -> bool
+                auto addCapturePath = [&paths = m_cachedCapturePaths](const char* path) -> bool
+                {
+                    // Chrome traces are meant for external viewers and can't be loaded back
+                    if (!RHI::CpuProfilingCapture::IsChromeTraceFile(path))
                     {
-                        auto foundPath = IO::Path(path);
-                        paths.push_back(foundPath);
-                        return true;
-                    });
+                        paths.push_back(IO::Path(path));
+                    }
+                    return true;
+                };
+                base->FindFiles(defaultSavedCapturePath.c_str(), "*.json", addCapturePath);
+                base->FindFiles(defaultSavedCapturePath.c_str(), "*.cpucapture", addCapturePath);
 
                 // Sort by decreasing modification time (most recent at the top)
                 AZStd::sort(m_cachedCapturePaths.begin(), m_cachedCapturePaths.end(),
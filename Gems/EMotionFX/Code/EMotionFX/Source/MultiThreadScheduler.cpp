@@ -13,6 +13,8 @@
 #include "AnimGraphInstance.h"
 #include "Attachment.h"
 #include "EMotionFXManager.h"
+#include "Recorder.h"
+#include "TransformData.h"
 #include <EMotionFX/Source/Allocators.h>
 #include <MCore/Source/LogManager.h>
 
@@ -20,6 +22,8 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
 
 
 namespace EMotionFX
@@ -53,6 +57,7 @@ namespace EMotionFX
     {
         Lock();
         m_steps.clear();
+        m_updateRateLodInstances.clear();
         Unlock();
     }
 
@@ -85,6 +90,27 @@ namespace EMotionFX
         }
 
         AZ_Printf("EMotionFX", "---------");
+
+        if (m_updateRateLodSettings.m_enabled)
+        {
+            for (size_t level = 0; level < UpdateRateLodSettings::s_numLevels; ++level)
+            {
+                AZ_Printf("EMotionFX", "UPDATE RATE LOD %zu (every %u frames) - %zu instances, %zu full updates", level,
+                    m_updateRateLodSettings.m_updateIntervals[level], m_updateRateLodStatistics.m_numInstances[level],
+                    m_updateRateLodStatistics.m_numFullUpdates[level]);
+            }
+            AZ_Printf("EMotionFX", "Interpolated: %zu, deferred by budget: %zu, average full update: %.3f ms",
+                m_updateRateLodStatistics.m_numInterpolated, m_updateRateLodStatistics.m_numDeferredByBudget,
+                m_updateRateLodStatistics.m_averageFullUpdateTimeInMs);
+            AZ_Printf("EMotionFX", "---------");
+        }
+    }
+
+
+    void MultiThreadScheduler::SetUpdateRateLodSettings(const UpdateRateLodSettings& settings)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_updateRateLodSettings = settings;
     }
 
 
@@ -146,6 +172,18 @@ namespace EMotionFX
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
+        // pick the update rates, the recorder samples every actor instance every frame while it plays back
+        if (m_updateRateLodSettings.m_enabled && !GetRecorder().GetIsInPlayMode())
+        {
+            ScheduleUpdateRateLod();
+        }
+        else if (!m_updateRateLodInstances.empty())
+        {
+            m_updateRateLodInstances.clear();
+            m_updateRateLodStatistics = UpdateRateLodStatistics();
+        }
+        m_updateRateLodTicks.store(0, AZStd::memory_order_relaxed);
+
         for (const ScheduleStep& currentStep : m_steps)
         {
             if (currentStep.m_actorInstances.empty())
@@ -162,8 +200,18 @@ namespace EMotionFX
                     continue;
                 }
 
+                UpdateRateLodInstance* lodInstance = nullptr;
+                if (!m_updateRateLodInstances.empty())
+                {
+                    const auto lodIterator = m_updateRateLodInstances.find(actorInstance);
+                    if (lodIterator != m_updateRateLodInstances.end())
+                    {
+                        lodInstance = lodIterator->second.get();
+                    }
+                }
+
                 AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance, lodInstance]()
                 {
                     AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
@@ -176,6 +224,12 @@ namespace EMotionFX
                         m_numVisible.Increment();
                     }
 
+                    if (lodInstance)
+                    {
+                        UpdateWithUpdateRateLod(actorInstance, *lodInstance, timePassedInSeconds);
+                        return;
+                    }
+
                     // check if we want to sample motions
                     bool sampleMotions = false;
                     actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
@@ -202,6 +256,212 @@ namespace EMotionFX
 
             jobCompletion.StartAndWaitForCompletion();
         } // for all steps
+
+        // keep a running average of the full update cost, which the budget is based on
+        size_t numFullUpdates = 0;
+        for (size_t levelFullUpdates : m_updateRateLodStatistics.m_numFullUpdates)
+        {
+            numFullUpdates += levelFullUpdates;
+        }
+        if (!m_updateRateLodInstances.empty() && numFullUpdates > 0)
+        {
+            const float updateTimeInMs = static_cast<float>(m_updateRateLodTicks.load(AZStd::memory_order_relaxed)) * 1000.0f /
+                static_cast<float>(AZStd::GetTimeTicksPerSecond()) / static_cast<float>(numFullUpdates);
+            float& averageTimeInMs = m_updateRateLodStatistics.m_averageFullUpdateTimeInMs;
+            averageTimeInMs = (averageTimeInMs > 0.0f) ? AZ::Lerp(averageTimeInMs, updateTimeInMs, 0.1f) : updateTimeInMs;
+        }
+    }
+
+
+    bool MultiThreadScheduler::IsUpdateRateLodEligible(const ActorInstance* actorInstance) const
+    {
+        // attachments are updated by their parent, and motion extraction would only move the entity on full updates
+        return actorInstance->GetIsVisible() &&
+            actorInstance->GetNumAttachments() == 0 &&
+            !(actorInstance->GetMotionExtractionEnabled() && actorInstance->GetActor()->GetMotionExtractionNode());
+    }
+
+
+    void MultiThreadScheduler::ScheduleUpdateRateLod()
+    {
+        AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::ScheduleUpdateRateLod");
+
+        const UpdateRateLodSettings& settings = m_updateRateLodSettings;
+        UpdateRateLodStatistics& statistics = m_updateRateLodStatistics;
+        statistics.m_numInstances = {};
+        statistics.m_numFullUpdates = {};
+        statistics.m_numInterpolated = 0;
+        statistics.m_numDeferredByBudget = 0;
+
+        const float tanHalfFieldOfView = AZStd::max(MCore::Math::Tan(settings.m_fieldOfView * 0.5f), AZ::Constants::FloatEpsilon);
+
+        m_updateRateLodCandidates.clear();
+        size_t numForcedUpdates = 0;
+
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* actorInstance = actorManager.GetRootActorInstance(i);
+            if (!actorInstance->GetIsEnabled() || !IsUpdateRateLodEligible(actorInstance))
+            {
+                m_updateRateLodInstances.erase(actorInstance);
+                continue;
+            }
+
+            AZStd::unique_ptr<UpdateRateLodInstance>& lodInstancePtr = m_updateRateLodInstances[actorInstance];
+            if (!lodInstancePtr)
+            {
+                lodInstancePtr.reset(aznew UpdateRateLodInstance());
+                lodInstancePtr->m_fromPose.LinkToActorInstance(actorInstance);
+                lodInstancePtr->m_toPose.LinkToActorInstance(actorInstance);
+            }
+            UpdateRateLodInstance& lodInstance = *lodInstancePtr;
+
+            // the screen size is the fraction of the screen height covered by the bounding sphere, as of the last update
+            const AZ::Aabb& aabb = actorInstance->GetAabb();
+            const float radius = aabb.IsValid() ? aabb.GetExtents().GetLength() * 0.5f : 1.0f;
+            const float distance = AZStd::max(actorInstance->GetWorldSpaceTransform().m_position.GetDistance(settings.m_viewPosition), AZ::Constants::FloatEpsilon);
+            lodInstance.m_screenSize = radius / (distance * tanHalfFieldOfView);
+
+            uint8 level = 0;
+            while (level < UpdateRateLodSettings::s_numLevels - 1 && lodInstance.m_screenSize < settings.m_minScreenSizes[level])
+            {
+                ++level;
+            }
+            lodInstance.m_level = level;
+            lodInstance.m_updateInterval = AZStd::max<uint32>(settings.m_updateIntervals[level], 1);
+            statistics.m_numInstances[level]++;
+
+            // instances due for a full update are candidates, ones that have been deferred for too long have to update
+            lodInstance.m_fullUpdate = false;
+            if (!lodInstance.m_hasPoses || lodInstance.m_framesSinceUpdate + 1 >= lodInstance.m_updateInterval * 2)
+            {
+                lodInstance.m_fullUpdate = true;
+                numForcedUpdates++;
+            }
+            else if (lodInstance.m_framesSinceUpdate + 1 >= lodInstance.m_updateInterval)
+            {
+                const float priority = static_cast<float>(lodInstance.m_framesSinceUpdate + 1) / static_cast<float>(lodInstance.m_updateInterval) + lodInstance.m_screenSize;
+                m_updateRateLodCandidates.emplace_back(priority, &lodInstance);
+            }
+        }
+
+        // the number of full updates that fit in the budget, based on the measured cost of a full update
+        size_t maxNumFullUpdates = numForcedUpdates + m_updateRateLodCandidates.size();
+        if (settings.m_frameBudgetInMs > 0.0f && statistics.m_averageFullUpdateTimeInMs > 0.0f)
+        {
+            const size_t numThreads = AZStd::max<size_t>(AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads(), 1);
+            const size_t budgetedFullUpdates = static_cast<size_t>(settings.m_frameBudgetInMs * static_cast<float>(numThreads) / statistics.m_averageFullUpdateTimeInMs);
+            maxNumFullUpdates = AZStd::min(maxNumFullUpdates, AZStd::max<size_t>(budgetedFullUpdates, 1));
+        }
+
+        // the most overdue and largest instances go first
+        const size_t numCandidateUpdates = (maxNumFullUpdates > numForcedUpdates) ? maxNumFullUpdates - numForcedUpdates : 0;
+        if (numCandidateUpdates < m_updateRateLodCandidates.size())
+        {
+            AZStd::sort(m_updateRateLodCandidates.begin(), m_updateRateLodCandidates.end(),
+                [](const AZStd::pair<float, UpdateRateLodInstance*>& a, const AZStd::pair<float, UpdateRateLodInstance*>& b)
+                {
+                    return a.first > b.first;
+                });
+            statistics.m_numDeferredByBudget = m_updateRateLodCandidates.size() - numCandidateUpdates;
+            m_updateRateLodCandidates.resize(numCandidateUpdates);
+        }
+        for (const AZStd::pair<float, UpdateRateLodInstance*>& candidate : m_updateRateLodCandidates)
+        {
+            candidate.second->m_fullUpdate = true;
+        }
+
+        for (const auto& lodInstanceItem : m_updateRateLodInstances)
+        {
+            const UpdateRateLodInstance& lodInstance = *lodInstanceItem.second;
+            if (lodInstance.m_fullUpdate)
+            {
+                statistics.m_numFullUpdates[lodInstance.m_level]++;
+            }
+            else
+            {
+                statistics.m_numInterpolated++;
+            }
+        }
+    }
+
+
+    void MultiThreadScheduler::UpdateWithUpdateRateLod(ActorInstance* actorInstance, UpdateRateLodInstance& lodInstance, float timePassedInSeconds)
+    {
+        if (!lodInstance.m_fullUpdate)
+        {
+            lodInstance.m_skippedTimeInSeconds += timePassedInSeconds;
+            lodInstance.m_framesSinceUpdate++;
+            InterpolateUpdateRateLodPose(actorInstance, lodInstance);
+            return;
+        }
+
+        const AZStd::sys_time_t updateStart = AZStd::GetTimeNowTicks();
+
+        // the anim graph catches up with the time of the skipped frames
+        const float updateTimeInSeconds = timePassedInSeconds + lodInstance.m_skippedTimeInSeconds;
+        lodInstance.m_skippedTimeInSeconds = 0.0f;
+
+        Pose* currentPose = actorInstance->GetTransformData()->GetCurrentPose();
+        if (lodInstance.m_hasPoses)
+        {
+            lodInstance.m_fromPose.InitFromPose(currentPose);
+        }
+
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimeInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+            m_numSampled.Increment();
+        }
+
+        actorInstance->UpdateTransformations(updateTimeInSeconds, true, sampleMotions);
+        lodInstance.m_toPose.InitFromPose(currentPose);
+
+        if (lodInstance.m_hasPoses)
+        {
+            lodInstance.m_framesSinceUpdate = 0;
+            InterpolateUpdateRateLodPose(actorInstance, lodInstance);
+        }
+        else
+        {
+            // start interpolating from the first sampled pose, staggered so that instances with the same interval update in different frames
+            lodInstance.m_fromPose.InitFromPose(currentPose);
+            lodInstance.m_framesSinceUpdate = actorInstance->GetID() % lodInstance.m_updateInterval;
+            lodInstance.m_hasPoses = true;
+        }
+
+        m_updateRateLodTicks.fetch_add(AZStd::GetTimeNowTicks() - updateStart, AZStd::memory_order_relaxed);
+    }
+
+
+    void MultiThreadScheduler::InterpolateUpdateRateLodPose(ActorInstance* actorInstance, UpdateRateLodInstance& lodInstance)
+    {
+        actorInstance->UpdateWorldTransform();
+
+        Pose* currentPose = actorInstance->GetTransformData()->GetCurrentPose();
+        const float weight = static_cast<float>(lodInstance.m_framesSinceUpdate + 1) / static_cast<float>(lodInstance.m_updateInterval);
+        if (weight < 1.0f)
+        {
+            currentPose->InitFromPose(&lodInstance.m_fromPose);
+            currentPose->Blend(&lodInstance.m_toPose, weight);
+        }
+        else
+        {
+            currentPose->InitFromPose(&lodInstance.m_toPose);
+        }
+        currentPose->InvalidateAllModelSpaceTransforms();
+        currentPose->ApplyMorphWeightsToActorInstance();
+        actorInstance->UpdateSkinningMatrices();
+
+        if (actorInstance->GetBoundsUpdateEnabled() && actorInstance->GetBoundsUpdateType() == ActorInstance::BOUNDS_STATIC_BASED)
+        {
+            actorInstance->UpdateBounds(actorInstance->GetLODLevel(), ActorInstance::BOUNDS_STATIC_BASED);
+        }
     }
 
 
@@ -289,6 +549,7 @@ namespace EMotionFX
     size_t MultiThreadScheduler::RemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
     {
         MCore::LockGuardRecursive guard(m_mutex);
+        m_updateRateLodInstances.erase(actorInstance);
 
         // for all scheduler steps, starting from the specified start step number
         const size_t numSteps = m_steps.size();
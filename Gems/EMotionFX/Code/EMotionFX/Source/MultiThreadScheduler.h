@@ -12,6 +12,14 @@
 #include "EMotionFXConfig.h"
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
+#include "Pose.h"
+#include <EMotionFX/Source/Allocators.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <MCore/Source/MultiThreadManager.h>
 
 namespace EMotionFX
@@ -54,6 +62,38 @@ namespace EMotionFX
             AZStd::vector<ActorInstance*>       m_actorInstances;    /**< The actor instances used inside this step. Each array entry will execute in another thread. */
         };
 
+        /**
+         * The update rate LOD settings.
+         * Visible root actor instances without attachments and without motion extraction get an update interval in frames, based on
+         * the fraction of the screen height they cover, which shrinks with their distance to the view.
+         * In the frames between two full updates their pose is interpolated between the last two sampled poses, which costs far less
+         * than updating the anim graph. The interpolated pose trails the sampled one by one interval.
+         * Full updates are staggered over the frames, so that instances with the same interval don't all update in the same frame.
+         */
+        struct EMFX_API UpdateRateLodSettings
+        {
+            static constexpr size_t s_numLevels = 4;
+
+            bool                                    m_enabled = false;                                      /**< Update every actor instance every frame when disabled. */
+            AZ::Vector3                             m_viewPosition = AZ::Vector3::CreateZero();             /**< The world space position of the camera. */
+            float                                   m_fieldOfView = AZ::DegToRad(60.0f);                    /**< The vertical field of view of the camera, in radians. */
+            AZStd::array<float, s_numLevels - 1>    m_minScreenSizes = {{ 0.3f, 0.1f, 0.04f }};             /**< The minimum screen size of the first levels, as fraction of the screen height. Smaller instances use the last level. */
+            AZStd::array<uint32, s_numLevels>       m_updateIntervals = {{ 1, 2, 4, 8 }};                   /**< The number of frames between two full updates for every level. */
+            float                                   m_frameBudgetInMs = 0.0f;                               /**< The time all threads together may spend on full updates of LOD instances per frame, 0 for no budget. Instances deferred by the budget update at the latest after twice their interval. */
+        };
+
+        /**
+         * The update rate LOD statistics of the last executed frame.
+         */
+        struct EMFX_API UpdateRateLodStatistics
+        {
+            AZStd::array<size_t, UpdateRateLodSettings::s_numLevels> m_numInstances = {};         /**< The number of LOD instances per level. */
+            AZStd::array<size_t, UpdateRateLodSettings::s_numLevels> m_numFullUpdates = {};       /**< The number of LOD instances per level that got a full update. */
+            size_t  m_numInterpolated = 0;                                                         /**< The number of LOD instances whose pose got interpolated. */
+            size_t  m_numDeferredByBudget = 0;                                                     /**< The number of LOD instances that were due for a full update but got interpolated to stay within the budget. */
+            float   m_averageFullUpdateTimeInMs = 0.0f;                                            /**< The running average of the time a full update of an LOD instance takes. */
+        };
+
         /**
          * The constructor.
          */
@@ -122,11 +162,66 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(size_t index) const { return m_steps[index]; }
         size_t GetNumScheduleSteps() const { return m_steps.size(); }
 
+        void SetUpdateRateLodSettings(const UpdateRateLodSettings& settings);
+        const UpdateRateLodSettings& GetUpdateRateLodSettings() const { return m_updateRateLodSettings; }
+        const UpdateRateLodStatistics& GetUpdateRateLodStatistics() const { return m_updateRateLodStatistics; }
+
     protected:
+        /**
+         * The update rate LOD state of an actor instance.
+         */
+        struct UpdateRateLodInstance
+        {
+            AZ_CLASS_ALLOCATOR(UpdateRateLodInstance, ActorUpdateAllocator, 0)
+
+            Pose    m_fromPose;                     /**< The pose shown when the last full update happened. */
+            Pose    m_toPose;                       /**< The pose sampled by the last full update. */
+            float   m_skippedTimeInSeconds = 0.0f;  /**< The time passed since the last full update, passed on to the next full update. */
+            float   m_screenSize = 0.0f;
+            uint32  m_framesSinceUpdate = 0;
+            uint32  m_updateInterval = 1;
+            uint8   m_level = 0;
+            bool    m_hasPoses = false;             /**< Set after the first full update. */
+            bool    m_fullUpdate = true;            /**< Set when the actor instance gets a full update in the current frame. */
+        };
+
         AZStd::vector< ScheduleStep >    m_steps;         /**< An array of update steps, that together form the schedule. */
         float                           m_cleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           m_mutex;
 
+        UpdateRateLodSettings           m_updateRateLodSettings;
+        UpdateRateLodStatistics         m_updateRateLodStatistics;
+        AZStd::unordered_map<const ActorInstance*, AZStd::unique_ptr<UpdateRateLodInstance>> m_updateRateLodInstances;
+        AZStd::vector<AZStd::pair<float, UpdateRateLodInstance*>> m_updateRateLodCandidates;     /**< The LOD instances due for a full update, with their priority. */
+        AZStd::atomic<AZ::u64>          m_updateRateLodTicks{ 0 };       /**< The time spent in full updates of LOD instances in the current frame. */
+
+        /**
+         * Pick the update rate LOD level of every eligible actor instance and decide which ones get a full update this frame.
+         */
+        void ScheduleUpdateRateLod();
+
+        /**
+         * Update an actor instance that has an update rate LOD level, either fully or by interpolating its pose.
+         * @param actorInstance The actor instance to update.
+         * @param lodInstance The update rate LOD state of the actor instance.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateWithUpdateRateLod(ActorInstance* actorInstance, UpdateRateLodInstance& lodInstance, float timePassedInSeconds);
+
+        /**
+         * Set the current pose of an actor instance to the interpolated pose for the current frame and update its skinning matrices.
+         * @param actorInstance The actor instance to interpolate.
+         * @param lodInstance The update rate LOD state of the actor instance.
+         */
+        void InterpolateUpdateRateLodPose(ActorInstance* actorInstance, UpdateRateLodInstance& lodInstance);
+
+        /**
+         * Check if an actor instance can be updated at a lower rate.
+         * @param actorInstance The root actor instance to check.
+         * @result Returns true when the actor instance is visible, and has no attachments and no motion extraction.
+         */
+        bool IsUpdateRateLodEligible(const ActorInstance* actorInstance) const;
+
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
         /**
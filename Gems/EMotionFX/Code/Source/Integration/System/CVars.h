@@ -15,5 +15,7 @@ namespace EMotionFX::Integration
     public:
         static inline int emfx_updateEnabled = 1;
         static inline int emfx_actorRenderEnabled = 1;
+        static inline int emfx_updateRateLodEnabled = 0;
+        static inline float emfx_updateRateLodBudgetMs = 0.0f;
     };
 };
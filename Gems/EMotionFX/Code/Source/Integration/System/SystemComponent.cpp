@@ -13,11 +13,13 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Utils/Utils.h>
 
+#include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/AnimGraphManager.h>
 #include <EMotionFX/Source/AnimGraphObjectFactory.h>
@@ -590,6 +592,10 @@ namespace EMotionFX
 
             REGISTER_CVAR2("emfx_updateEnabled", &CVars::emfx_updateEnabled, 1, VF_DEV_ONLY, "Enable main EMFX update");
             REGISTER_CVAR2("emfx_actorRenderEnabled", &CVars::emfx_actorRenderEnabled, 1, VF_DEV_ONLY, "Enable ActorRenderNode rendering");
+            REGISTER_CVAR2("emfx_updateRateLodEnabled", &CVars::emfx_updateRateLodEnabled, 0, VF_NULL,
+                "Update actor instances that cover a small part of the screen less often and interpolate their poses in between");
+            REGISTER_CVAR2("emfx_updateRateLodBudgetMs", &CVars::emfx_updateRateLodBudgetMs, 0.0f, VF_NULL,
+                "Time in milliseconds all threads together may spend on full actor instance updates per frame when the update rate LOD is enabled, 0 for no budget");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -597,6 +603,8 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_actorRenderEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateRateLodEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateRateLodBudgetMs");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
@@ -628,6 +636,36 @@ namespace EMotionFX
         }
 #endif
 
+        //////////////////////////////////////////////////////////////////////////
+        void SystemComponent::UpdateRateLodSettingsFromActiveCamera()
+        {
+            ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+            if (!baseScheduler || baseScheduler->GetType() != MultiThreadScheduler::TYPE_ID)
+            {
+                return;
+            }
+
+            // The update rates depend on the screen size of the actor instances, so they need a game camera.
+            MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+            MultiThreadScheduler::UpdateRateLodSettings settings = scheduler->GetUpdateRateLodSettings();
+            settings.m_enabled = CVars::emfx_updateRateLodEnabled != 0 && Camera::ActiveCameraRequestBus::HasHandlers();
+            settings.m_frameBudgetInMs = CVars::emfx_updateRateLodBudgetMs;
+            if (settings.m_enabled)
+            {
+                AZ::Transform cameraTransform = AZ::Transform::CreateIdentity();
+                Camera::ActiveCameraRequestBus::BroadcastResult(cameraTransform, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraTransform);
+                Camera::Configuration cameraConfiguration;
+                Camera::ActiveCameraRequestBus::BroadcastResult(cameraConfiguration, &Camera::ActiveCameraRequestBus::Events::GetActiveCameraConfiguration);
+
+                settings.m_viewPosition = cameraTransform.GetTranslation();
+                if (cameraConfiguration.m_fovRadians > 0.0f)
+                {
+                    settings.m_fieldOfView = cameraConfiguration.m_fovRadians;
+                }
+            }
+            scheduler->SetUpdateRateLodSettings(settings);
+        }
+
         //////////////////////////////////////////////////////////////////////////
         void SystemComponent::OnTick(float delta, AZ::ScriptTimePoint timePoint)
         {
@@ -643,6 +681,7 @@ namespace EMotionFX
             if (CVars::emfx_updateEnabled)
             {
                 // Main EMotionFX runtime update.
+                UpdateRateLodSettingsFromActiveCamera();
                 GetEMotionFX().Update(realDelta);
             }
 
@@ -671,6 +710,7 @@ namespace EMotionFX
             if (CVars::emfx_updateEnabled)
             {
                 // Main EMotionFX runtime update.
+                UpdateRateLodSettingsFromActiveCamera();
                 GetEMotionFX().Update(delta);
             }
 #endif
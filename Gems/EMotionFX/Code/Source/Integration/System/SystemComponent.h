@@ -106,6 +106,7 @@ namespace EMotionFX
 
             void RegisterAssetTypesAndHandlers();
             void SetMediaRoot(const char* alias);
+            void UpdateRateLodSettingsFromActiveCamera();
 
 #if defined (EMOTIONFXANIMATION_EDITOR)
             void UpdateAnimationEditorPlugins(float delta);
@@ -42,4 +42,91 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_FarInstanceInterpolatedBetweenFullUpdates)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* nearInstance = ActorInstance::Create(actor.get());
+        nearInstance->SetLocalSpacePosition(AZ::Vector3(0.0f, 2.0f, 0.0f));
+        ActorInstance* farInstance = ActorInstance::Create(actor.get());
+        farInstance->SetLocalSpacePosition(AZ::Vector3(0.0f, 10000.0f, 0.0f));
+
+        MultiThreadScheduler::UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        scheduler->SetUpdateRateLodSettings(settings);
+
+        // The first frame positions the actor instances.
+        scheduler->Execute(1.0f / 60.0f);
+
+        const size_t lastLevel = MultiThreadScheduler::UpdateRateLodSettings::s_numLevels - 1;
+        const uint32 numFrames = settings.m_updateIntervals[lastLevel] * 4;
+        size_t numNearFullUpdates = 0;
+        size_t numFarFullUpdates = 0;
+        size_t numInterpolated = 0;
+        for (uint32 frame = 0; frame < numFrames; ++frame)
+        {
+            scheduler->Execute(1.0f / 60.0f);
+
+            const MultiThreadScheduler::UpdateRateLodStatistics& statistics = scheduler->GetUpdateRateLodStatistics();
+            EXPECT_EQ(statistics.m_numInstances[0], 1);
+            EXPECT_EQ(statistics.m_numInstances[lastLevel], 1);
+            numNearFullUpdates += statistics.m_numFullUpdates[0];
+            numFarFullUpdates += statistics.m_numFullUpdates[lastLevel];
+            numInterpolated += statistics.m_numInterpolated;
+        }
+
+        EXPECT_EQ(numNearFullUpdates, numFrames) << "The near actor instance should be updated every frame.";
+        EXPECT_EQ(numFarFullUpdates, 4) << "The far actor instance should be updated once per update interval.";
+        EXPECT_EQ(numInterpolated, numFrames - 4) << "The far actor instance should be interpolated in the other frames.";
+
+        settings.m_enabled = false;
+        scheduler->SetUpdateRateLodSettings(settings);
+        farInstance->Destroy();
+        nearInstance->Destroy();
+    }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_FrameBudgetDefersFullUpdates)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            actorInstances.emplace_back(ActorInstance::Create(actor.get()));
+        }
+
+        // Every instance is due every frame, but the budget only fits a single full update.
+        MultiThreadScheduler::UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        settings.m_updateIntervals = {{ 1, 1, 1, 1 }};
+        settings.m_frameBudgetInMs = 0.0001f;
+        scheduler->SetUpdateRateLodSettings(settings);
+
+        // The first frame updates all instances, which measures the cost of a full update.
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetUpdateRateLodStatistics().m_numDeferredByBudget, 0);
+        ASSERT_GT(scheduler->GetUpdateRateLodStatistics().m_averageFullUpdateTimeInMs, 0.0f);
+
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetUpdateRateLodStatistics().m_numDeferredByBudget, 3);
+        EXPECT_EQ(scheduler->GetUpdateRateLodStatistics().m_numInterpolated, 3);
+
+        // Deferred instances update at the latest after twice their interval.
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetUpdateRateLodStatistics().m_numInterpolated, 1);
+
+        settings.m_enabled = false;
+        scheduler->SetUpdateRateLodSettings(settings);
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // namespace EMotionFX
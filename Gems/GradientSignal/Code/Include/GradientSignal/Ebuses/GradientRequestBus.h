@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -49,6 +50,25 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them. This has the same thread-safety requirements as GetValue.
+        * Sampling a whole region at once lets gradients lock, look up their inputs and branch on their settings once per batch
+        * instead of once per point, so gradients should override this with a tight loop over the positions when they can.
+        * @param positions The positions to generate values for
+        * @param outValues The generated values, this needs to be the same size as positions
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "The outValues vector needs to be the same size as the positions vector");
+
+            GradientSampleParams sampleParams;
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                sampleParams.m_position = positions[index];
+                outValues[index] = GetValue(sampleParams);
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -16,6 +16,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/algorithm.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Util.h>
@@ -34,6 +35,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Samples the gradient at all positions with a single request to the gradient, outValues needs to be the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -147,4 +151,81 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The outValues vector needs to be the same size as the positions vector");
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        //apply transform if set, the positions are only copied when they need to change
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool transformPositions = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (transformPositions)
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.resize_no_construct(positions.size());
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                transformedPositions[index] = matrix3x4 * positions[index];
+            }
+        }
+
+        {
+            // See GetValue for why the surface data mutex is locked before checking "isRequestInProgress"
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            // Handlers are expected to fill every value, this default covers an entity without a gradient
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues,
+                transformPositions ? transformedPositions : positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        // The settings are checked once up front so that the loops below stay branch free
+        if (m_invertInput)
+        {
+            for (float& value : outValues)
+            {
+                value = 1.0f - value;
+            }
+        }
+
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            for (float& value : outValues)
+            {
+                value = GetLevels(value, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+        }
+
+        if (m_opacity != 1.0f)
+        {
+            for (float& value : outValues)
+            {
+                value *= m_opacity;
+            }
+        }
+    }
 }
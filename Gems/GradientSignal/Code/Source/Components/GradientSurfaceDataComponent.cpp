@@ -261,6 +261,69 @@ namespace GradientSignal
         }
     }
 
+    void GradientSurfaceDataComponent::ModifySurfacePointsFromList(
+        SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (!m_configuration.m_modifierTags.empty())
+        {
+            // See ModifySurfacePoints() for why the shape bounds are copied.
+            bool validShapeBounds = false;
+            AZ::Aabb shapeConstraintBounds;
+            if (m_validShapeBounds)
+            {
+                AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+                shapeConstraintBounds = m_cachedShapeConstraintBounds;
+                validShapeBounds = m_cachedShapeConstraintBounds.IsValid();
+            }
+
+            // Collect the points that pass the entity and shape checks first, so that the gradient can be sampled for all of them
+            // with a single GetValues call.
+            const AZ::EntityId entityId = GetEntityId();
+            AZStd::vector<size_t> samplePointIndices;
+            AZStd::vector<AZ::Vector3> samplePositions;
+            samplePointIndices.reserve(pointIndices.size());
+            samplePositions.reserve(pointIndices.size());
+            for (size_t pointIndex : pointIndices)
+            {
+                if (surfacePoints.m_entityIds[pointIndex] != entityId)
+                {
+                    const AZ::Vector3& position = surfacePoints.m_positions[pointIndex];
+                    bool inBounds = true;
+                    if (validShapeBounds)
+                    {
+                        inBounds = false;
+                        if (shapeConstraintBounds.Contains(position))
+                        {
+                            LmbrCentral::ShapeComponentRequestsBus::EventResult(inBounds, m_configuration.m_shapeConstraintEntityId,
+                                                                                &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, position);
+                        }
+                    }
+
+                    if (inBounds)
+                    {
+                        samplePointIndices.push_back(pointIndex);
+                        samplePositions.push_back(position);
+                    }
+                }
+            }
+
+            AZStd::vector<float> values(samplePositions.size());
+            m_gradientSampler.GetValues(samplePositions, values);
+
+            for (size_t sampleIndex = 0; sampleIndex < samplePointIndices.size(); ++sampleIndex)
+            {
+                const float value = values[sampleIndex];
+                if (value >= m_configuration.m_thresholdMin &&
+                    value <= m_configuration.m_thresholdMax)
+                {
+                    SurfaceData::AddMaxValueForMasks(surfacePoints.m_masks[samplePointIndices[sampleIndex]], m_configuration.m_modifierTags, value);
+                }
+            }
+        }
+    }
+
     void GradientSurfaceDataComponent::OnCompositionChanged()
     {
         AZ_PROFILE_FUNCTION(Entity);
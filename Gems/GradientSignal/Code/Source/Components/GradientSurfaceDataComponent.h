@@ -73,6 +73,7 @@ namespace GradientSignal
         ////////////////////////////////////////////////////////////////////////
         // SurfaceData::SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsFromList(SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // LmbrCentral::DependencyNotificationBus
@@ -327,7 +327,29 @@ namespace GradientSignal
         AZ_PROFILE_FUNCTION(Entity);
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        TransformPositionToUVWNoLock(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs,
+        const bool shouldNormalizeOutput, AZStd::vector<bool>& wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(inPositions.size() == outUVWs.size() && inPositions.size() == wasPointRejected.size(),
+            "The output vectors need to be the same size as the input positions");
 
+        // The cached shape data is locked once for the whole batch instead of once per position
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            bool rejected = false;
+            TransformPositionToUVWNoLock(inPositions[index], outUVWs[index], shouldNormalizeOutput, rejected);
+            wasPointRejected[index] = rejected;
+        }
+    }
+
+    void GradientTransformComponent::TransformPositionToUVWNoLock(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
@@ -14,6 +14,22 @@
 
 namespace GradientSignal
 {
+    namespace MixedGradientUtil
+    {
+        // Combines the unpremultiplied layer values into the accumulated results and blends by the layer opacity, see GetValue.
+        // The operation is passed in as a functor so that each operation gets its own branch free loop.
+        template<typename Operation>
+        void BlendLayer(AZStd::vector<float>& results, const AZStd::vector<float>& layerValues, float opacity, Operation operation)
+        {
+            const float inverseOpacity = 1.0f - opacity;
+            for (size_t index = 0; index < results.size(); ++index)
+            {
+                const float currentUnpremultiplied = layerValues[index] / opacity;
+                results[index] = (results[index] * inverseOpacity) + (operation(results[index], currentUnpremultiplied) * opacity);
+            }
+        }
+    }
+
     void MixedGradientLayer::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -313,6 +329,71 @@ namespace GradientSignal
         return AZ::GetClamp(result, 0.0f, 1.0f);
     }
 
+    void MixedGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The outValues vector needs to be the same size as the positions vector");
+
+        // Every layer is sampled for the whole batch and then combined into the results one operation at a time
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        AZStd::vector<float> layerValues(positions.size());
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            const float opacity = layer.m_gradientSampler.m_opacity;
+            if (!layer.m_enabled || opacity == 0.0f)
+            {
+                continue;
+            }
+
+            layer.m_gradientSampler.GetValues(positions, layerValues);
+
+            switch (layer.m_operation)
+            {
+            default:
+            case MixedGradientLayer::MixingOperation::Initialize:
+                //reset the result of the mixed/combined layers before blending in the current value
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float, float current) { return current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Multiply:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float result, float current) { return result * current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Add:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float result, float current) { return result + current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float result, float current) { return result - current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Min:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float result, float current) { return AZStd::min(current, result); });
+                break;
+            case MixedGradientLayer::MixingOperation::Max:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float result, float current) { return AZStd::max(current, result); });
+                break;
+            case MixedGradientLayer::MixingOperation::Average:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float result, float current) { return (result + current) / 2.0f; });
+                break;
+            case MixedGradientLayer::MixingOperation::Normal:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity, [](float, float current) { return current; });
+                break;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                MixedGradientUtil::BlendLayer(outValues, layerValues, opacity,
+                    [](float result, float current)
+                    {
+                        return (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - current))) : (2.0f * result * current);
+                    });
+                break;
+            }
+        }
+
+        for (float& value : outValues)
+        {
+            value = AZ::GetClamp(value, 0.0f, 1.0f);
+        }
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
@@ -181,6 +181,40 @@ namespace GradientSignal
         return AZ::GetClamp(output, 0.0f, 1.0f);
     }
 
+    void PosterizeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+
+        // The mode is the same for all values, so pick the band offset and divisor once instead of switching per value.
+        // See GetValue for what each of the modes produces.
+        float bandOffset = 0.0f;
+        float bandDivisor = bands;
+        switch (m_configuration.m_mode)
+        {
+            default:
+            case PosterizeGradientConfig::ModeType::Floor:
+                break;
+            case PosterizeGradientConfig::ModeType::Round:
+                bandOffset = 0.5f;
+                break;
+            case PosterizeGradientConfig::ModeType::Ceiling:
+                bandOffset = 1.0f;
+                break;
+            case PosterizeGradientConfig::ModeType::Ps:
+                bandDivisor = bands - 1.0f;
+                break;
+        }
+
+        for (float& value : outValues)
+        {
+            const float input = AZ::GetClamp(value, 0.0f, 1.0f);
+            const float band = AZ::GetClamp(floorf(input * bands), 0.0f, bands - 1.0f);
+            value = AZ::GetClamp((band + bandOffset) / bandDivisor, 0.0f, 1.0f);
+        }
+    }
+
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -165,6 +165,38 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void RandomGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The outValues vector needs to be the same size as the positions vector");
+
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        const AZStd::size_t seed = m_configuration.m_randomSeed + AZStd::size_t(2); // See GetValue for why 2 is added
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            if (wasPointRejected[index])
+            {
+                outValues[index] = 0.0f;
+                continue;
+            }
+
+            const float x = uvws[index].GetX();
+            const float y = uvws[index].GetY();
+            AZStd::size_t result = 0;
+            AZStd::hash_combine<float>(result, x * seed + y);
+            AZStd::hash_combine<float>(result, y * seed + x);
+            AZStd::hash_combine<float>(result, x * y * seed);
+
+            outValues[index] = static_cast<float>(result % std::numeric_limits<AZ::u8>::max()) / static_cast<float>(std::numeric_limits<AZ::u8>::max());
+        }
+    }
+
     int RandomGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
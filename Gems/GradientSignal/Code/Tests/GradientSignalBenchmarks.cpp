@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <GradientSignal/GradientSampler.h>
+#include <SurfaceData/Tests/SurfaceDataTestMocks.h>
+
+#include <Source/Components/GradientTransformComponent.h>
+#include <Source/Components/LevelsGradientComponent.h>
+#include <Source/Components/MixedGradientComponent.h>
+#include <Source/Components/PerlinGradientComponent.h>
+#include <Source/Components/RandomGradientComponent.h>
+
+namespace UnitTest
+{
+    // Samples a square region from a typical gradient stack, a Mixed gradient that multiplies a leveled Perlin gradient with a
+    // Random gradient, either one point at a time with GetValue or all at once with GetValues.
+    class GradientSignalBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        using ::benchmark::Fixture::SetUp, ::benchmark::Fixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 128 * 1024 * 1024;
+            m_systemEntity = m_app.Create(appDesc);
+            m_app.AddEntity(m_systemEntity);
+
+            const float regionSize = aznumeric_cast<float>(state.range(0));
+            const AZ::Aabb shapeBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3(regionSize));
+
+            GradientSignal::PerlinGradientConfig perlinConfig;
+            perlinConfig.m_octave = 4;
+            perlinConfig.m_frequency = 0.05f;
+            m_perlinEntity = CreateGeneratorEntity<GradientSignal::PerlinGradientComponent>(perlinConfig, shapeBounds, m_perlinShape);
+
+            GradientSignal::RandomGradientConfig randomConfig;
+            m_randomEntity = CreateGeneratorEntity<GradientSignal::RandomGradientComponent>(randomConfig, shapeBounds, m_randomShape);
+
+            GradientSignal::LevelsGradientConfig levelsConfig;
+            levelsConfig.m_gradientSampler.m_gradientId = m_perlinEntity->GetId();
+            levelsConfig.m_inputMin = 0.2f;
+            levelsConfig.m_inputMax = 0.8f;
+            m_levelsEntity = CreateEntity<GradientSignal::LevelsGradientComponent>(levelsConfig);
+
+            GradientSignal::MixedGradientConfig mixedConfig;
+            GradientSignal::MixedGradientLayer layer;
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Initialize;
+            layer.m_gradientSampler.m_gradientId = m_levelsEntity->GetId();
+            mixedConfig.m_layers.push_back(layer);
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Multiply;
+            layer.m_gradientSampler.m_gradientId = m_randomEntity->GetId();
+            layer.m_gradientSampler.m_opacity = 0.5f;
+            mixedConfig.m_layers.push_back(layer);
+            m_mixedEntity = CreateEntity<GradientSignal::MixedGradientComponent>(mixedConfig);
+
+            m_sampler.m_gradientId = m_mixedEntity->GetId();
+
+            const int64_t pointsPerSide = state.range(0);
+            m_positions.reserve(pointsPerSide * pointsPerSide);
+            for (int64_t y = 0; y < pointsPerSide; ++y)
+            {
+                for (int64_t x = 0; x < pointsPerSide; ++x)
+                {
+                    m_positions.emplace_back(aznumeric_cast<float>(x), aznumeric_cast<float>(y), 0.0f);
+                }
+            }
+            m_values.resize(m_positions.size());
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            m_positions = {};
+            m_values = {};
+
+            m_mixedEntity.reset();
+            m_levelsEntity.reset();
+            m_randomEntity.reset();
+            m_perlinEntity.reset();
+            m_randomShape.reset();
+            m_perlinShape.reset();
+
+            m_app.Destroy();
+            m_systemEntity = nullptr;
+        }
+
+    protected:
+        template<typename Component, typename Configuration>
+        AZStd::unique_ptr<AZ::Entity> CreateEntity(const Configuration& config)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            m_app.RegisterComponentDescriptor(Component::CreateDescriptor());
+            entity->CreateComponent<Component>(config);
+            entity->Init();
+            entity->Activate();
+            return entity;
+        }
+
+        template<typename Component, typename Configuration>
+        AZStd::unique_ptr<AZ::Entity> CreateGeneratorEntity(
+            const Configuration& config, const AZ::Aabb& shapeBounds, AZStd::unique_ptr<MockShapeComponentHandler>& shapeHandler)
+        {
+            auto entity = AZStd::make_unique<AZ::Entity>();
+            m_app.RegisterComponentDescriptor(Component::CreateDescriptor());
+            m_app.RegisterComponentDescriptor(GradientSignal::GradientTransformComponent::CreateDescriptor());
+            m_app.RegisterComponentDescriptor(MockShapeComponent::CreateDescriptor());
+            entity->CreateComponent<Component>(config);
+            entity->CreateComponent<GradientSignal::GradientTransformComponent>(GradientSignal::GradientTransformConfig());
+            entity->CreateComponent<MockShapeComponent>();
+
+            shapeHandler = AZStd::make_unique<MockShapeComponentHandler>(entity->GetId());
+            shapeHandler->m_GetLocalBounds = shapeBounds;
+            shapeHandler->m_GetEncompassingAabb = shapeBounds;
+
+            entity->Init();
+            entity->Activate();
+            return entity;
+        }
+
+        AZ::ComponentApplication m_app;
+        AZ::Entity* m_systemEntity = nullptr;
+
+        AZStd::unique_ptr<MockShapeComponentHandler> m_perlinShape;
+        AZStd::unique_ptr<MockShapeComponentHandler> m_randomShape;
+        AZStd::unique_ptr<AZ::Entity> m_perlinEntity;
+        AZStd::unique_ptr<AZ::Entity> m_randomEntity;
+        AZStd::unique_ptr<AZ::Entity> m_levelsEntity;
+        AZStd::unique_ptr<AZ::Entity> m_mixedEntity;
+
+        GradientSignal::GradientSampler m_sampler;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<float> m_values;
+    };
+
+    BENCHMARK_DEFINE_F(GradientSignalBenchmarkFixture, PointSampling)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            GradientSignal::GradientSampleParams sampleParams;
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                sampleParams.m_position = m_positions[index];
+                m_values[index] = m_sampler.GetValue(sampleParams);
+            }
+            benchmark::DoNotOptimize(m_values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(GradientSignalBenchmarkFixture, BatchSampling)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_sampler.GetValues(m_positions, m_values);
+            benchmark::DoNotOptimize(m_values.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(GradientSignalBenchmarkFixture, PointSampling)
+        ->Arg(64)->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(GradientSignalBenchmarkFixture, BatchSampling)
+        ->Arg(64)->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+}
+
+#endif
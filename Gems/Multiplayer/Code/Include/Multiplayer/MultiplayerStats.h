@@ -93,5 +93,47 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! A record made while recording was deferred, see DeferredRecordScope.
+        struct DeferredRecord
+        {
+            enum class Type : uint8_t
+            {
+                EntitySerializeStart,
+                ComponentSerializeEnd,
+                EntitySerializeStop,
+                PropertySent,
+                PropertyReceived,
+                RpcSent,
+                RpcReceived
+            };
+
+            Type m_type;
+            AzNetworking::SerializerMode m_mode = AzNetworking::SerializerMode::ReadFromObject;
+            AZ::EntityId m_entityId;
+            const char* m_entityName = nullptr;
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            uint16_t m_index = 0; //!< Property or rpc index.
+            uint32_t m_totalBytes = 0;
+        };
+        using DeferredRecords = AZStd::vector<DeferredRecord>;
+
+        //! While a scope is alive, records made on the thread that created it are stored in the provided container instead of being
+        //! applied to the stats. This allows entity updates to be serialized in jobs, the records are applied afterwards on the main
+        //! thread with ApplyDeferredRecords in the same order as they would've been made when serializing on the main thread.
+        class DeferredRecordScope
+        {
+        public:
+            explicit DeferredRecordScope(DeferredRecords& records);
+            ~DeferredRecordScope();
+
+        private:
+            AZ_DISABLE_COPY_MOVE(DeferredRecordScope);
+
+            DeferredRecords* m_previousRecords;
+        };
+
+        //! Applies records that were stored by a DeferredRecordScope and signals the matching events.
+        void ApplyDeferredRecords(const DeferredRecords& records);
     };
 }
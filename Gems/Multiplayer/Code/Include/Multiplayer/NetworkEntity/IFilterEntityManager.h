@@ -39,6 +39,8 @@ namespace Multiplayer
         //! Return true if a given entity should be filtered out, false otherwise.
         //! Important: this method is a hot code path, it will be called over all entities around each player frequently.
         //! Ideally, this method should be implemented as a quick look up.
+        //! When sv_ParallelReplication is enabled, this method is called from multiple jobs at the same time, one per connection,
+        //! so implementations must not modify shared state without synchronization.
         //!
         //! @param entity the entity to be considered for filtering
         //! @param controllerEntity player's entity for the associated connection
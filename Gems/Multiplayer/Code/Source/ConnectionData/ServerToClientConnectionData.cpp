@@ -7,7 +7,13 @@
  */
 
 #include <Source/ConnectionData/ServerToClientConnectionData.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzFramework/Components/DeferredTransformHierarchy.h>
 
 namespace Multiplayer
 {
@@ -16,6 +22,8 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_ClientMaxRemoteEntitiesPendingCreationCountPostInit, AZStd::numeric_limits<uint32_t>::max(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of entities that we will send to clients after gameplay has begun");
     AZ_CVAR(AZ::TimeMs, sv_ClientEntityReplicatorPendingRemovalTimeMs, AZ::TimeMs{ 10000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "How long should wait prior to removing an entity for the client through a change in the replication window, entity deletes are still immediate");
     AZ_CVAR(bool, sv_removeDefaultPlayerSpawnableOnDisconnect, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether to remove player's default spawnable when a player disconnects");
+    AZ_CVAR(bool, sv_ParallelReplication, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether to evaluate replication windows and serialize entity updates for client connections in jobs");
+    AZ_CVAR(uint32_t, sv_ParallelReplicationMinConnections, 4, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Minimum number of client connections before replication is done in jobs");
 
     ServerToClientConnectionData::ServerToClientConnectionData
     (
@@ -67,6 +75,86 @@ namespace Multiplayer
     }
 
     void ServerToClientConnectionData::Update(AZ::TimeMs hostTimeMs)
+    {
+        if (PreUpdate())
+        {
+            m_entityReplicationManager.SendUpdates(hostTimeMs);
+        }
+    }
+
+    void ServerToClientConnectionData::UpdateConnections(const AZStd::vector<ServerToClientConnectionData*>& connections, AZ::TimeMs hostTimeMs)
+    {
+        AZ::JobContext* jobContext = nullptr;
+        if (sv_ParallelReplication && connections.size() >= sv_ParallelReplicationMinConnections)
+        {
+            jobContext = AZ::JobContext::GetGlobalContext();
+            // Don't fan out from a job, the jobs could end up waiting on each other
+            if (jobContext != nullptr && jobContext->GetJobManager().GetCurrentJob() != nullptr)
+            {
+                jobContext = nullptr;
+            }
+        }
+
+        if (jobContext == nullptr)
+        {
+            for (ServerToClientConnectionData* connectionData : connections)
+            {
+                connectionData->UpdateDeferredReplicationWindow();
+                connectionData->Update(hostTimeMs);
+            }
+            return;
+        }
+
+        // Activating entities changes network entity state, so it has to be done for all connections before the jobs start
+        const size_t connectionCount = connections.size();
+        AZStd::vector<bool> sendUpdates(connectionCount);
+        for (size_t i = 0; i < connectionCount; ++i)
+        {
+            sendUpdates[i] = connections[i]->PreUpdate();
+        }
+
+        // The jobs read world transforms, so transforms that are still pending, including those of the entities activated above,
+        // are written to the transform components here
+        if (auto* transformHierarchy = AZ::Interface<AzFramework::DeferredTransformHierarchy>::Get())
+        {
+            transformHierarchy->SyncWorldTransforms();
+        }
+
+        AZStd::vector<MultiplayerStats::DeferredRecords> deferredRecords(connectionCount);
+        {
+            AZ::JobCompletion completion(jobContext);
+            for (size_t i = 0; i < connectionCount; ++i)
+            {
+                ServerToClientConnectionData* connectionData = connections[i];
+                MultiplayerStats::DeferredRecords* records = &deferredRecords[i];
+                const bool sendUpdate = sendUpdates[i];
+                AZ::Job* job = AZ::CreateJobFunction([connectionData, records, sendUpdate, hostTimeMs]()
+                    {
+                        connectionData->UpdateDeferredReplicationWindow();
+                        if (sendUpdate)
+                        {
+                            MultiplayerStats::DeferredRecordScope recordScope(*records);
+                            connectionData->m_entityReplicationManager.PrepareUpdates(hostTimeMs);
+                        }
+                    }, true, jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+
+        MultiplayerStats& stats = AZ::Interface<IMultiplayer>::Get()->GetStats();
+        for (size_t i = 0; i < connectionCount; ++i)
+        {
+            stats.ApplyDeferredRecords(deferredRecords[i]);
+            if (sendUpdates[i])
+            {
+                connections[i]->m_entityReplicationManager.FlushUpdates();
+            }
+        }
+    }
+
+    bool ServerToClientConnectionData::PreUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
 
@@ -74,10 +162,17 @@ namespace Multiplayer
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
-            if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
-            {
-                m_entityReplicationManager.SendUpdates(hostTimeMs);
-            }
+            return netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority);
+        }
+        return false;
+    }
+
+    void ServerToClientConnectionData::UpdateDeferredReplicationWindow()
+    {
+        // Only server to client windows are ever set on this connection's replication manager
+        if (IReplicationWindow* replicationWindow = m_entityReplicationManager.GetReplicationWindow())
+        {
+            static_cast<ServerToClientReplicationWindow*>(replicationWindow)->UpdateDeferredWindow();
         }
     }
 
@@ -40,7 +40,17 @@ namespace Multiplayer
         const AZStd::string& GetProviderTicket() const;
         void SetProviderTicket(const AZStd::string&);
 
+        //! Updates a set of connections to clients, equivalent to calling Update on each of them.
+        //! When sv_ParallelReplication is enabled and there are enough connections, the replication windows are evaluated and the entity
+        //! updates are serialized from jobs, one connection per job at a time. Pending entities are activated before and the packets are
+        //! sent after the jobs complete, on the calling thread and in the order of the provided connections.
+        static void UpdateConnections(const AZStd::vector<ServerToClientConnectionData*>& connections, AZ::TimeMs hostTimeMs);
+
     private:
+        //! Activates pending entities and returns true if entity updates should be sent to the client.
+        bool PreUpdate();
+        void UpdateDeferredReplicationWindow();
+
         void OnControlledEntityRemove();
         void OnControlledEntityMigration(const ConstNetworkEntityHandle& entityHandle, HostId remoteHostId, AzNetworking::ConnectionId connectionId);
         void OnGameplayStarted();
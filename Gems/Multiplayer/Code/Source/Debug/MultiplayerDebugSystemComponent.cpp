@@ -295,6 +295,21 @@ namespace Multiplayer
                     ImGui::TableNextColumn();
                     ImGui::Text("%lld", aznumeric_cast<AZ::s64>(metrics.m_sendBytesCompressedDelta));
                     ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Packet compression ratio");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", metrics.m_sendBytesPostCompression > 0
+                        ? aznumeric_cast<double>(metrics.m_sendBytesPreCompression) / aznumeric_cast<double>(metrics.m_sendBytesPostCompression) : 0.0);
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Average compression time per packet (us)");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", metrics.m_sendPacketsCompressed > 0
+                        ? aznumeric_cast<double>(metrics.m_compressTimeUs) / aznumeric_cast<double>(metrics.m_sendPacketsCompressed) : 0.0);
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
+                    ImGui::Text("Average decompression time per packet (us)");
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", metrics.m_recvPacketsDecompressed > 0
+                        ? aznumeric_cast<double>(metrics.m_decompressTimeUs) / aznumeric_cast<double>(metrics.m_recvPacketsDecompressed) : 0.0);
+                    ImGui::TableNextRow(); ImGui::TableNextColumn();
                     ImGui::Text("Total packets resent");
                     ImGui::TableNextColumn();
                     ImGui::Text("%llu", aznumeric_cast<AZ::u64>(metrics.m_resentPackets));
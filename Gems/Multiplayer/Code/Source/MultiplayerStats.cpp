@@ -10,6 +10,19 @@
 
 namespace Multiplayer
 {
+    // Records made on this thread are stored here instead of being applied while a DeferredRecordScope is alive
+    static thread_local MultiplayerStats::DeferredRecords* s_deferredRecords = nullptr;
+
+    static bool DeferRecord(const MultiplayerStats::DeferredRecord& record)
+    {
+        if (s_deferredRecords != nullptr)
+        {
+            s_deferredRecords->push_back(record);
+            return true;
+        }
+        return false;
+    }
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -31,21 +44,42 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (DeferRecord({ DeferredRecord::Type::EntitySerializeStart, mode, entityId, entityName }))
+        {
+            return;
+        }
+
         m_events.m_entitySerializeStart.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
     {
+        if (DeferRecord({ DeferredRecord::Type::ComponentSerializeEnd, mode, AZ::EntityId(), nullptr, netComponentId }))
+        {
+            return;
+        }
+
         m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
     }
 
     void MultiplayerStats::RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
+        if (DeferRecord({ DeferredRecord::Type::EntitySerializeStop, mode, entityId, entityName }))
+        {
+            return;
+        }
+
         m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
     }
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (DeferRecord({ DeferredRecord::Type::PropertySent, AzNetworking::SerializerMode::ReadFromObject, AZ::EntityId(), nullptr,
+            netComponentId, aznumeric_cast<uint16_t>(propertyId), totalBytes }))
+        {
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
@@ -58,6 +92,12 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
+        if (DeferRecord({ DeferredRecord::Type::PropertyReceived, AzNetworking::SerializerMode::WriteToObject, AZ::EntityId(), nullptr,
+            netComponentId, aznumeric_cast<uint16_t>(propertyId), totalBytes }))
+        {
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
         m_componentStats[netComponentIndex].m_propertyUpdatesRecv[propertyIndex].m_totalCalls++;
@@ -70,6 +110,12 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        if (DeferRecord({ DeferredRecord::Type::RpcSent, AzNetworking::SerializerMode::ReadFromObject, entityId, entityName,
+            netComponentId, aznumeric_cast<uint16_t>(rpcId), totalBytes }))
+        {
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         m_componentStats[netComponentIndex].m_rpcsSent[rpcIndex].m_totalCalls++;
@@ -82,6 +128,12 @@ namespace Multiplayer
 
     void MultiplayerStats::RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
     {
+        if (DeferRecord({ DeferredRecord::Type::RpcReceived, AzNetworking::SerializerMode::WriteToObject, entityId, entityName,
+            netComponentId, aznumeric_cast<uint16_t>(rpcId), totalBytes }))
+        {
+            return;
+        }
+
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t rpcIndex = aznumeric_cast<uint16_t>(rpcId);
         m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_totalCalls++;
@@ -220,4 +272,46 @@ namespace Multiplayer
         handlers.m_rpcSent.Connect(m_events.m_rpcSent);
         handlers.m_rpcReceived.Connect(m_events.m_rpcReceived);
     }
+
+    MultiplayerStats::DeferredRecordScope::DeferredRecordScope(DeferredRecords& records)
+        : m_previousRecords(s_deferredRecords)
+    {
+        s_deferredRecords = &records;
+    }
+
+    MultiplayerStats::DeferredRecordScope::~DeferredRecordScope()
+    {
+        s_deferredRecords = m_previousRecords;
+    }
+
+    void MultiplayerStats::ApplyDeferredRecords(const DeferredRecords& records)
+    {
+        for (const DeferredRecord& record : records)
+        {
+            switch (record.m_type)
+            {
+            case DeferredRecord::Type::EntitySerializeStart:
+                RecordEntitySerializeStart(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::ComponentSerializeEnd:
+                RecordComponentSerializeEnd(record.m_mode, record.m_netComponentId);
+                break;
+            case DeferredRecord::Type::EntitySerializeStop:
+                RecordEntitySerializeStop(record.m_mode, record.m_entityId, record.m_entityName);
+                break;
+            case DeferredRecord::Type::PropertySent:
+                RecordPropertySent(record.m_netComponentId, aznumeric_cast<PropertyIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::PropertyReceived:
+                RecordPropertyReceived(record.m_netComponentId, aznumeric_cast<PropertyIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::RpcSent:
+                RecordRpcSent(record.m_entityId, record.m_entityName, record.m_netComponentId, aznumeric_cast<RpcIndex>(record.m_index), record.m_totalBytes);
+                break;
+            case DeferredRecord::Type::RpcReceived:
+                RecordRpcReceived(record.m_entityId, record.m_entityName, record.m_netComponentId, aznumeric_cast<RpcIndex>(record.m_index), record.m_totalBytes);
+                break;
+            }
+        }
+    }
 }
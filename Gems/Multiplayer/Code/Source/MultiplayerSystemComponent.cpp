@@ -347,24 +347,28 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
-            auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
+            // Connections to clients are updated together so their updates can be serialized in parallel
+            AZStd::vector<ServerToClientConnectionData*> clientConnections;
+            auto sendNetworkUpdates = [hostTimeMs, &stats, &clientConnections](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
                 {
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
-                    connectionData->Update(hostTimeMs);
                     if (connectionData->GetConnectionDataType() == ConnectionDataType::ServerToClient)
                     {
+                        clientConnections.push_back(static_cast<ServerToClientConnectionData*>(connectionData));
                         stats.m_clientConnectionCount++;
                     }
                     else
                     {
+                        connectionData->Update(hostTimeMs);
                         stats.m_serverConnectionCount++;
                     }
                 }
             };
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            ServerToClientConnectionData::UpdateConnections(clientConnections, hostTimeMs);
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -94,9 +94,20 @@ namespace Multiplayer
     }
 
     void EntityReplicationManager::SendUpdates(AZ::TimeMs hostTimeMs)
+    {
+        PrepareUpdates(hostTimeMs);
+        FlushUpdates();
+    }
+
+    void EntityReplicationManager::PrepareUpdates(AZ::TimeMs hostTimeMs)
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
-        SendEntityUpdates(hostTimeMs);
+        PrepareEntityUpdates(hostTimeMs);
+    }
+
+    void EntityReplicationManager::FlushUpdates()
+    {
+        SendPreparedEntityUpdates();
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
@@ -116,17 +127,17 @@ namespace Multiplayer
         );
     }
 
-    void EntityReplicationManager::SendEntityUpdatesPacketHelper
+    void EntityReplicationManager::PrepareEntityUpdatesPacket
     (
         AZ::TimeMs hostTimeMs,
         EntityReplicatorList& toSendList,
-        uint32_t maxPayloadSize,
-        AzNetworking::IConnection& connection
+        uint32_t maxPayloadSize
     )
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        MultiplayerPackets::EntityUpdates entityUpdatePacket;
+        PreparedEntityUpdates& preparedUpdates = m_preparedEntityUpdates.emplace_back();
+        EntityReplicatorList& replicatorUpdatedList = preparedUpdates.m_replicators;
+        MultiplayerPackets::EntityUpdates& entityUpdatePacket = preparedUpdates.m_packet;
         entityUpdatePacket.SetHostTimeMs(hostTimeMs);
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         // Serialize everything
@@ -165,14 +176,21 @@ namespace Multiplayer
                 break;
             }
         }
+    }
 
-        const AzNetworking::PacketId sentId = connection.SendUnreliablePacket(entityUpdatePacket);
-
-        // Update the sent things with the packet id
-        for (EntityReplicator* replicator : replicatorUpdatedList)
+    void EntityReplicationManager::SendPreparedEntityUpdates()
+    {
+        for (PreparedEntityUpdates& preparedUpdates : m_preparedEntityUpdates)
         {
-            replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
+            const AzNetworking::PacketId sentId = m_connection.SendUnreliablePacket(preparedUpdates.m_packet);
+
+            // Update the sent things with the packet id
+            for (EntityReplicator* replicator : preparedUpdates.m_replicators)
+            {
+                replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
+            }
         }
+        m_preparedEntityUpdates.clear();
     }
 
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
@@ -246,7 +264,7 @@ namespace Multiplayer
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs hostTimeMs)
+    void EntityReplicationManager::PrepareEntityUpdates(AZ::TimeMs hostTimeMs)
     {
         EntityReplicatorList toSendList = GenerateEntityUpdateList();
     
@@ -259,9 +277,10 @@ namespace Multiplayer
         }
     
         // While our to send list is not empty, build up another packet to send
+        AZ_Assert(m_preparedEntityUpdates.empty(), "Entity updates were prepared twice without sending them");
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
+            PrepareEntityUpdatesPacket(hostTimeMs, toSendList, m_maxPayloadSize);
         } while (!toSendList.empty());
     }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -59,6 +60,15 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates(AZ::TimeMs hostTimeMs);
+
+        //! SendUpdates split in two, so the entity updates of multiple connections can be serialized at the same time.
+        //! PrepareUpdates serializes the entity updates into packets without sending them. It only modifies state owned by this
+        //! replication manager and only reads network entity state, so it can be called from a job while network entities aren't changed.
+        //! FlushUpdates sends the prepared packets and the deferred rpcs and has to be called from the main thread.
+        //! @{
+        void PrepareUpdates(AZ::TimeMs hostTimeMs);
+        void FlushUpdates();
+        //! @}
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -117,9 +127,10 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        void PrepareEntityUpdatesPacket(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize);
 
-        void SendEntityUpdates(AZ::TimeMs hostTimeMs);
+        void PrepareEntityUpdates(AZ::TimeMs hostTimeMs);
+        void SendPreparedEntityUpdates();
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -185,6 +196,14 @@ namespace Multiplayer
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
 
+        //! Entity update packets that were serialized by PrepareUpdates but haven't been sent yet
+        struct PreparedEntityUpdates
+        {
+            MultiplayerPackets::EntityUpdates m_packet;
+            EntityReplicatorList m_replicators;
+        };
+        AZStd::vector<PreparedEntityUpdates> m_preparedEntityUpdates;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
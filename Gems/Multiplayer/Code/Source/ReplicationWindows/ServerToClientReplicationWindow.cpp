@@ -23,6 +23,7 @@ namespace Multiplayer
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR_EXTERNED(bool, sv_ParallelReplication);
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -57,7 +58,7 @@ namespace Multiplayer
         , m_connection(connection)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
-        , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to client replication window update event"))
+        , m_updateWindowEvent([this]() { OnUpdateWindowEvent(); }, AZ::Name("Server to client replication window update event"))
     {
         AZ::Entity* entity = m_controlledEntity.GetEntity();
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
@@ -104,6 +105,28 @@ namespace Multiplayer
         return false;
     }
 
+    void ServerToClientReplicationWindow::UpdateDeferredWindow()
+    {
+        if (m_isWindowUpdateDeferred)
+        {
+            m_isWindowUpdateDeferred = false;
+            UpdateWindow();
+        }
+    }
+
+    void ServerToClientReplicationWindow::OnUpdateWindowEvent()
+    {
+        if (sv_ParallelReplication)
+        {
+            // The MultiplayerSystemComponent updates the windows of all connections together before it sends the entity updates
+            m_isWindowUpdateDeferred = true;
+        }
+        else
+        {
+            UpdateWindow();
+        }
+    }
+
     void ServerToClientReplicationWindow::UpdateWindow()
     {
         // clear the candidate queue, we're going to rebuild it
@@ -50,7 +50,13 @@ namespace Multiplayer
         void DebugDraw() const override;
         //! @}
 
+        //! Runs the window update if the scheduled update was deferred, see sv_ParallelReplication.
+        //! Only modifies the state of this window and reads network entity state, so the windows of different connections can be
+        //! updated from jobs at the same time.
+        void UpdateDeferredWindow();
+
     private:
+        void OnUpdateWindowEvent();
         void OnEntityActivated(AZ::Entity* entity);
         void OnEntityDeactivated(AZ::Entity* entity);
 
@@ -77,6 +83,9 @@ namespace Multiplayer
 
         const AzNetworking::IConnection* m_connection = nullptr;
 
+        // Set when the scheduled window update was deferred to be run in parallel with other windows
+        bool m_isWindowUpdateDeferred = false;
+
         // Cached values to detect a poor network connection
         uint32_t m_lastCheckedSentPackets = 0;
         uint32_t m_lastCheckedLostPackets = 0;
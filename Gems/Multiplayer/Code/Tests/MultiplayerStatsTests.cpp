@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class MultiplayerStatsTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr Multiplayer::NetComponentId TestNetComponentId = Multiplayer::NetComponentId{ 1 };
+        static constexpr Multiplayer::PropertyIndex TestPropertyIndex = Multiplayer::PropertyIndex{ 2 };
+        static constexpr Multiplayer::RpcIndex TestRpcIndex = Multiplayer::RpcIndex{ 0 };
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_stats.ReserveComponentStats(TestNetComponentId, 3, 1);
+        }
+
+        Multiplayer::MultiplayerStats m_stats;
+    };
+
+    TEST_F(MultiplayerStatsTests, DeferredRecordScope_RecordsAreStoredUntilApplied)
+    {
+        uint32_t sentBytes = 0;
+        AZ::Event<Multiplayer::NetComponentId, Multiplayer::PropertyIndex, uint32_t>::Handler propertySentHandler(
+            [&sentBytes](Multiplayer::NetComponentId, Multiplayer::PropertyIndex, uint32_t totalBytes) { sentBytes += totalBytes; });
+        propertySentHandler.Connect(m_stats.m_events.m_propertySent);
+
+        Multiplayer::MultiplayerStats::DeferredRecords records;
+        {
+            Multiplayer::MultiplayerStats::DeferredRecordScope recordScope(records);
+            m_stats.RecordPropertySent(TestNetComponentId, TestPropertyIndex, 10);
+            m_stats.RecordRpcSent(AZ::EntityId(), "Entity", TestNetComponentId, TestRpcIndex, 5);
+        }
+        EXPECT_EQ(2, records.size());
+        EXPECT_EQ(0, sentBytes);
+        EXPECT_EQ(0, m_stats.CalculateTotalPropertyUpdateSentMetrics().m_totalBytes);
+
+        m_stats.ApplyDeferredRecords(records);
+        EXPECT_EQ(10, sentBytes);
+        EXPECT_EQ(10, m_stats.CalculateTotalPropertyUpdateSentMetrics().m_totalBytes);
+        EXPECT_EQ(5, m_stats.CalculateTotalRpcsSentMetrics().m_totalBytes);
+
+        // Records made after the scope ends are applied immediately
+        m_stats.RecordPropertySent(TestNetComponentId, TestPropertyIndex, 1);
+        EXPECT_EQ(11, sentBytes);
+    }
+
+    TEST_F(MultiplayerStatsTests, DeferredRecordScope_OnlyDefersRecordsOfOwningThread)
+    {
+        Multiplayer::MultiplayerStats::DeferredRecords threadRecords;
+        AZStd::thread recordingThread(
+            [this, &threadRecords]()
+            {
+                Multiplayer::MultiplayerStats::DeferredRecordScope recordScope(threadRecords);
+                m_stats.RecordPropertySent(TestNetComponentId, TestPropertyIndex, 7);
+            });
+        recordingThread.join();
+
+        EXPECT_EQ(1, threadRecords.size());
+        m_stats.RecordPropertySent(TestNetComponentId, TestPropertyIndex, 3);
+        EXPECT_EQ(3, m_stats.CalculateTotalPropertyUpdateSentMetrics().m_totalBytes);
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/sort.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+
+namespace Multiplayer::Benchmarks
+{
+    // Approximates the per connection work of a server send tick: the replication window sorts the entities around the player by
+    // priority and the replication manager serializes the most relevant ones into update packets. Measures how that work scales
+    // with the number of client connections when done serially and when done from jobs, as ServerToClientConnectionData does
+    // when sv_ParallelReplication is enabled.
+    class ReplicationBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 2000;
+        static constexpr uint32_t MaxEntitiesPerUpdate = 256;
+        static constexpr uint32_t PacketCapacity = 1200;
+        static constexpr NetComponentId BenchmarkNetComponentId = NetComponentId{ 0 };
+        static constexpr PropertyIndex BenchmarkPropertyIndex = PropertyIndex{ 0 };
+
+        struct Candidate
+        {
+            float m_priority;
+            uint32_t m_entityIndex;
+        };
+
+        struct Connection
+        {
+            AZ::Vector3 m_playerPosition;
+            AZStd::vector<Candidate> m_candidates;
+            AZStd::vector<uint8_t> m_packetBuffer;
+            uint32_t m_packetCount = 0;
+        };
+
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            const uint32_t workerCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u);
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = aznew AZ::JobManager(jobManagerDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+
+            AZ::SimpleLcgRandom random;
+            m_entityPositions.resize(EntityCount);
+            for (AZ::Vector3& position : m_entityPositions)
+            {
+                position = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 1000.0f;
+            }
+
+            m_connections.resize(aznumeric_cast<size_t>(state.range(0)));
+            for (Connection& connection : m_connections)
+            {
+                connection.m_playerPosition = m_entityPositions[random.GetRandom() % EntityCount];
+                connection.m_candidates.reserve(EntityCount);
+                // Every entity fits in a packet, so this is enough for the worst case
+                connection.m_packetBuffer.resize(MaxEntitiesPerUpdate * PacketCapacity);
+            }
+
+            m_stats.ReserveComponentStats(BenchmarkNetComponentId, 1, 0);
+        }
+
+        void TearDown(benchmark::State& state) override
+        {
+            m_connections = {};
+            m_entityPositions = {};
+            m_stats = {};
+
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void PrepareConnection(Connection& connection)
+        {
+            connection.m_candidates.clear();
+            for (uint32_t i = 0; i < EntityCount; ++i)
+            {
+                const float distanceSq = connection.m_playerPosition.GetDistanceSq(m_entityPositions[i]);
+                connection.m_candidates.push_back({ 1.0f / (1.0f + distanceSq), i });
+            }
+            AZStd::sort(connection.m_candidates.begin(), connection.m_candidates.end(),
+                [](const Candidate& lhs, const Candidate& rhs) { return lhs.m_priority > rhs.m_priority; });
+
+            connection.m_packetCount = 0;
+            const uint32_t sendCount = AZStd::min(MaxEntitiesPerUpdate, EntityCount);
+            uint32_t candidateIndex = 0;
+            while (candidateIndex < sendCount)
+            {
+                uint8_t* packet = connection.m_packetBuffer.data() + connection.m_packetCount++ * PacketCapacity;
+                AzNetworking::NetworkInputSerializer inputSerializer(packet, PacketCapacity);
+                AzNetworking::ISerializer& serializer = inputSerializer;
+                for (; candidateIndex < sendCount; ++candidateIndex)
+                {
+                    const uint32_t entityIndex = connection.m_candidates[candidateIndex].m_entityIndex;
+                    const uint32_t sizeBefore = inputSerializer.GetSize();
+                    AZ::Vector3 position = m_entityPositions[entityIndex];
+                    uint32_t netEntityId = entityIndex;
+                    if (!serializer.Serialize(netEntityId, "NetEntityId") || !serializer.Serialize(position, "Position"))
+                    {
+                        break;
+                    }
+                    m_stats.RecordPropertySent(BenchmarkNetComponentId, BenchmarkPropertyIndex, inputSerializer.GetSize() - sizeBefore);
+                }
+            }
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        AZStd::vector<AZ::Vector3> m_entityPositions;
+        AZStd::vector<Connection> m_connections;
+        MultiplayerStats m_stats;
+    };
+
+    BENCHMARK_DEFINE_F(ReplicationBenchmarkFixture, SerialConnectionUpdates)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (Connection& connection : m_connections)
+            {
+                PrepareConnection(connection);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(ReplicationBenchmarkFixture, ParallelConnectionUpdates)(benchmark::State& state)
+    {
+        AZStd::vector<MultiplayerStats::DeferredRecords> deferredRecords(m_connections.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::JobCompletion completion(m_jobContext);
+            for (size_t i = 0; i < m_connections.size(); ++i)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, i, &deferredRecords]()
+                    {
+                        MultiplayerStats::DeferredRecordScope recordScope(deferredRecords[i]);
+                        PrepareConnection(m_connections[i]);
+                    }, true, m_jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+
+            for (MultiplayerStats::DeferredRecords& records : deferredRecords)
+            {
+                m_stats.ApplyDeferredRecords(records);
+                records.clear();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(ReplicationBenchmarkFixture, SerialConnectionUpdates)
+        ->Arg(16)->Arg(64)->Arg(128)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ReplicationBenchmarkFixture, ParallelConnectionUpdates)
+        ->Arg(16)->Arg(64)->Arg(128)
+        ->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -9,7 +9,9 @@
 set(FILES
     Tests/Main.cpp
     Tests/IMultiplayerConnectionMock.h
+    Tests/MultiplayerStatsTests.cpp
     Tests/MultiplayerSystemTests.cpp
+    Tests/ReplicationBenchmarks.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
 )
@@ -9,10 +9,14 @@
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Compression level of zstd packet compression, higher levels trade compression time for smaller packets");
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path of a dictionary trained with net_ZstdTrainDictionary to compress packets with, must be the same on both ends of a connection");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +26,27 @@ namespace MultiplayerCompression
     {
         return m_name;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerZstdCompressionFactory::Create()
+    {
+        const AZ::CVarFixedString dictionaryPath = net_ZstdDictionaryPath;
+        if (m_dictionaryPath != dictionaryPath.c_str())
+        {
+            m_dictionaryPath = dictionaryPath.c_str();
+            m_dictionary = m_dictionaryPath.empty() ? nullptr : ZstdDictionary::LoadFromFile(m_dictionaryPath.c_str(), net_ZstdCompressionLevel);
+            AZ_TracePrintf("Multiplayer Compressor", "Using zstd dictionary %u loaded from '%s'\n", m_dictionary ? m_dictionary->GetId() : 0,
+                m_dictionaryPath.c_str());
+        }
+        return AZStd::make_unique<ZstdCompressor>(net_ZstdCompressionLevel, m_dictionary, &m_packetCapture);
+    }
+
+    AZ::Name MultiplayerZstdCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
+
+    ZstdPacketCapture& MultiplayerZstdCompressionFactory::GetPacketCapture()
+    {
+        return m_packetCapture;
+    }
 }
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Framework/ICompressor.h>
+#include <ZstdCompressor.h>
 
 namespace MultiplayerCompression
 {
@@ -29,4 +30,28 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    //! Creates zstd compressors, select with net_UdpCompressor or net_TcpCompressor set to MultiplayerZstdCompressor.
+    //! The dictionary set by net_ZstdDictionaryPath is loaded once and shared by all compressors created afterwards.
+    class MultiplayerZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+        //! Capture shared by all compressors created by this factory, used to record traffic to train a dictionary from.
+        ZstdPacketCapture& GetPacketCapture();
+
+    private:
+        const AZ::Name m_name = AZ::Name("MultiplayerZstdCompressor");
+        AZStd::shared_ptr<ZstdDictionary> m_dictionary;
+        AZStd::string m_dictionaryPath;
+        ZstdPacketCapture m_packetCapture;
+    };
 }
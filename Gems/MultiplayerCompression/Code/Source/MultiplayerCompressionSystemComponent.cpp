@@ -51,11 +51,58 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        m_multiplayerZstdCompressionFactory = new MultiplayerZstdCompressionFactory();
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerZstdCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerZstdCompressionFactory->GetFactoryName());
+        delete m_multiplayerZstdCompressionFactory;
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
+
+    void MultiplayerCompressionSystemComponent::net_ZstdCapturePackets(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t packetCount = 0;
+        if (arguments.empty() || !AZ::ConsoleTypeHelpers::StringToValue(packetCount, arguments.front()))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "net_ZstdCapturePackets requires the number of packets to record");
+            return;
+        }
+
+        m_multiplayerZstdCompressionFactory->GetPacketCapture().Start(packetCount);
+        AZ_TracePrintf("Multiplayer Compressor", "Recording the next %u packets compressed with zstd\n", packetCount);
+    }
+
+    void MultiplayerCompressionSystemComponent::net_ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        static constexpr uint32_t DefaultMaxDictionarySize = 16 * 1024;
+
+        if (arguments.empty())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "net_ZstdTrainDictionary requires the path of the file to write the dictionary to");
+            return;
+        }
+
+        uint32_t maxDictionarySize = DefaultMaxDictionarySize;
+        if (arguments.size() > 1 && !AZ::ConsoleTypeHelpers::StringToValue(maxDictionarySize, arguments[1]))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Invalid maximum dictionary size");
+            return;
+        }
+
+        ZstdPacketCapture& packetCapture = m_multiplayerZstdCompressionFactory->GetPacketCapture();
+        packetCapture.Stop();
+        const PacketSamples samples = packetCapture.TakeSamples();
+
+        AZStd::vector<uint8_t> dictionary;
+        const AZ::CVarFixedString filePath(arguments.front());
+        if (ZstdDictionary::Train(samples, maxDictionarySize, dictionary) && ZstdDictionary::SaveToFile(filePath.c_str(), dictionary))
+        {
+            AZ_TracePrintf("Multiplayer Compressor", "Wrote %zu B zstd dictionary trained from %zu packets to '%s'\n",
+                dictionary.size(), samples.size(), filePath.c_str());
+        }
+    }
 }
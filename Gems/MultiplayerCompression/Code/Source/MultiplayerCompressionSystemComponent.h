@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
@@ -40,6 +41,15 @@ namespace MultiplayerCompression
         void Deactivate() override {}
         ////////////////////////////////////////////////////////////////////////
     private:
+        //! Records the payloads of the next packets sent with zstd compression, to train a dictionary from.
+        void net_ZstdCapturePackets(const AZ::ConsoleCommandContainer& arguments);
+        //! Trains a dictionary from the recorded payloads and writes it to a file that net_ZstdDictionaryPath can be set to.
+        void net_ZstdTrainDictionary(const AZ::ConsoleCommandContainer& arguments);
+
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, net_ZstdCapturePackets, AZ::ConsoleFunctorFlags::DontReplicate, "Records the payloads of the next N packets compressed by MultiplayerZstdCompressor, usage: net_ZstdCapturePackets <packetCount>");
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, net_ZstdTrainDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a zstd dictionary from the recorded packets, usage: net_ZstdTrainDictionary <filePath> [maxDictionarySize]");
+
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        MultiplayerZstdCompressionFactory* m_multiplayerZstdCompressionFactory;
     };
 }
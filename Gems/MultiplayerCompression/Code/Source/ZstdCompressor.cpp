@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+#include <zdict.h>
+#include <zstd_errors.h>
+
+namespace MultiplayerCompression
+{
+    ZstdDictionary::ZstdDictionary(const void* dictionaryData, size_t dictionarySize, int compressionLevel)
+    {
+        // Both digested dictionaries copy the dictionary content, so the provided data doesn't have to outlive this
+        m_compressionDictionary = ZSTD_createCDict(dictionaryData, dictionarySize, compressionLevel);
+        m_decompressionDictionary = ZSTD_createDDict(dictionaryData, dictionarySize);
+        m_id = ZSTD_getDictID_fromDict(dictionaryData, dictionarySize);
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    bool ZstdDictionary::IsValid() const
+    {
+        return m_compressionDictionary != nullptr && m_decompressionDictionary != nullptr;
+    }
+
+    uint32_t ZstdDictionary::GetId() const
+    {
+        return m_id;
+    }
+
+    const ZSTD_CDict_s* ZstdDictionary::GetCompressionDictionary() const
+    {
+        return m_compressionDictionary;
+    }
+
+    const ZSTD_DDict_s* ZstdDictionary::GetDecompressionDictionary() const
+    {
+        return m_decompressionDictionary;
+    }
+
+    AZStd::shared_ptr<ZstdDictionary> ZstdDictionary::LoadFromFile(const char* filePath, int compressionLevel)
+    {
+        AZ::Outcome<AZStd::vector<uint8_t>, AZStd::string> readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(filePath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd dictionary: %s", readResult.GetError().c_str());
+            return nullptr;
+        }
+
+        const AZStd::vector<uint8_t>& dictionaryData = readResult.GetValue();
+        auto dictionary = AZStd::make_shared<ZstdDictionary>(dictionaryData.data(), dictionaryData.size(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create zstd dictionary from '%s'", filePath);
+            return nullptr;
+        }
+        return dictionary;
+    }
+
+    bool ZstdDictionary::Train(const PacketSamples& samples, size_t maxDictionarySize, AZStd::vector<uint8_t>& outDictionary)
+    {
+        // The trainer takes all samples as a single buffer along with the size of every sample
+        AZStd::vector<uint8_t> samplesBuffer;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const AZStd::vector<uint8_t>& sample : samples)
+        {
+            samplesBuffer.insert(samplesBuffer.end(), sample.begin(), sample.end());
+            sampleSizes.push_back(sample.size());
+        }
+
+        outDictionary.resize(maxDictionarySize);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(outDictionary.data(), outDictionary.size(),
+            samplesBuffer.data(), sampleSizes.data(), aznumeric_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to train zstd dictionary from %zu samples: %s",
+                samples.size(), ZDICT_getErrorName(dictionarySize));
+            outDictionary.clear();
+            return false;
+        }
+
+        outDictionary.resize(dictionarySize);
+        return true;
+    }
+
+    bool ZstdDictionary::SaveToFile(const char* filePath, const AZStd::vector<uint8_t>& dictionary)
+    {
+        AZ::Outcome<void, AZStd::string> writeResult = AZ::Utils::WriteFile(
+            AZStd::string_view(reinterpret_cast<const char*>(dictionary.data()), dictionary.size()), filePath);
+        AZ_Warning("Multiplayer Compressor", writeResult.IsSuccess(), "Failed to write zstd dictionary: %s",
+            writeResult.IsSuccess() ? "" : writeResult.GetError().c_str());
+        return writeResult.IsSuccess();
+    }
+
+    void ZstdPacketCapture::Start(uint32_t sampleCount)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_samples.clear();
+        m_samples.reserve(sampleCount);
+        m_remainingSamples = sampleCount;
+    }
+
+    void ZstdPacketCapture::Stop()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_remainingSamples = 0;
+    }
+
+    bool ZstdPacketCapture::IsCapturing() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_remainingSamples > 0;
+    }
+
+    void ZstdPacketCapture::Capture(const void* payload, size_t payloadSize)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_remainingSamples > 0)
+        {
+            const uint8_t* payloadBytes = reinterpret_cast<const uint8_t*>(payload);
+            m_samples.emplace_back(payloadBytes, payloadBytes + payloadSize);
+            --m_remainingSamples;
+        }
+    }
+
+    PacketSamples ZstdPacketCapture::TakeSamples()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return AZStd::move(m_samples);
+    }
+
+    ZstdCompressor::ZstdCompressor(int compressionLevel, AZStd::shared_ptr<ZstdDictionary> dictionary, ZstdPacketCapture* capture)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_capture(capture)
+        , m_compressionLevel(compressionLevel)
+    {
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        // The packaged zstd is 1.3.5, the frame format and parameters are only available through its experimental API
+        if (m_compressionContext == nullptr)
+        {
+            m_compressionContext = ZSTD_createCCtx();
+            if (m_compressionContext != nullptr)
+            {
+                // The magic number and dictionary id are the same for every packet, so they're left out of the frames
+                ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_p_format, ZSTD_f_zstd1_magicless);
+                ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_p_contentSizeFlag, 1);
+                ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_p_checksumFlag, 0);
+                ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_p_dictIDFlag, 0);
+                if (m_dictionary)
+                {
+                    ZSTD_CCtx_refCDict(m_compressionContext, m_dictionary->GetCompressionDictionary());
+                }
+                else
+                {
+                    // Negative levels are passed as unsigned values
+                    ZSTD_CCtx_setParameter(m_compressionContext, ZSTD_p_compressionLevel, static_cast<unsigned>(m_compressionLevel));
+                }
+            }
+        }
+        if (m_decompressionContext == nullptr)
+        {
+            m_decompressionContext = ZSTD_createDCtx();
+            if (m_decompressionContext != nullptr)
+            {
+                ZSTD_DCtx_setFormat(m_decompressionContext, ZSTD_f_zstd1_magicless);
+                if (m_dictionary)
+                {
+                    ZSTD_DCtx_refDDict(m_decompressionContext, m_dictionary->GetDecompressionDictionary());
+                }
+            }
+        }
+        return m_compressionContext != nullptr && m_decompressionContext != nullptr;
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create zstd contexts");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_capture != nullptr)
+        {
+            m_capture->Capture(uncompData, uncompSize);
+        }
+
+        ZSTD_inBuffer input = { uncompData, uncompSize, 0 };
+        ZSTD_outBuffer output = { compData, compDataSize, 0 };
+        const size_t remaining = ZSTD_compress_generic(m_compressionContext, &output, &input, ZSTD_e_end);
+        if (ZSTD_isError(remaining) || remaining != 0)
+        {
+            // Drop the partially written frame so the next packet starts a new one
+            ZSTD_CCtx_reset(m_compressionContext);
+
+            // A frame that couldn't be completed ran out of room in the output buffer
+            const bool isBufferTooSmall = !ZSTD_isError(remaining) || ZSTD_getErrorCode(remaining) == ZSTD_error_dstSize_tooSmall;
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B): %s",
+                uncompSize, compDataSize, ZSTD_isError(remaining) ? ZSTD_getErrorName(remaining) : "Destination buffer is too small");
+            return isBufferTooSmall ? AzNetworking::CompressorError::InsufficientBuffer : AzNetworking::CompressorError::CorruptData;
+        }
+        compSize = output.pos;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create zstd contexts");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        // A previous packet may have failed half way through its frame, start decoding a new one
+        ZSTD_resetDStream(m_decompressionContext);
+
+        ZSTD_inBuffer input = { compData, compDataSize, 0 };
+        ZSTD_outBuffer output = { uncompData, uncompDataSize, 0 };
+        const size_t remaining = ZSTD_decompress_generic(m_decompressionContext, &output, &input);
+        consumedSizeOut = input.pos;
+
+        if (ZSTD_isError(remaining) || remaining != 0)
+        {
+            // A frame that isn't complete after all input was consumed is either truncated or didn't fit in the output buffer
+            const bool isBufferTooSmall = ZSTD_isError(remaining)
+                ? ZSTD_getErrorCode(remaining) == ZSTD_error_dstSize_tooSmall
+                : output.pos == output.size;
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B): %s",
+                compDataSize, uncompDataSize, ZSTD_isError(remaining) ? ZSTD_getErrorName(remaining) : "Incomplete frame");
+            return isBufferTooSmall ? AzNetworking::CompressorError::InsufficientBuffer : AzNetworking::CompressorError::CorruptData;
+        }
+        uncompSizeOut = output.pos;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+}
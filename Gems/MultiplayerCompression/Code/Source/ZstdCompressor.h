@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    using PacketSamples = AZStd::vector<AZStd::vector<uint8_t>>;
+
+    //! A zstd dictionary digested for compression and decompression.
+    //! Packets are too small for a compressor to build up any history, a dictionary trained on captured traffic provides that
+    //! history up front. The digested dictionaries are read only, so a single instance is shared by all compressors.
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator, 0);
+
+        ZstdDictionary(const void* dictionaryData, size_t dictionarySize, int compressionLevel);
+        ~ZstdDictionary();
+
+        bool IsValid() const;
+        //! Returns the id stored in the dictionary, or 0 for dictionaries that weren't created by the zstd trainer.
+        uint32_t GetId() const;
+
+        const ZSTD_CDict_s* GetCompressionDictionary() const;
+        const ZSTD_DDict_s* GetDecompressionDictionary() const;
+
+        //! Loads a dictionary written by SaveToFile or the zstd command line tool, returns nullptr on failure.
+        static AZStd::shared_ptr<ZstdDictionary> LoadFromFile(const char* filePath, int compressionLevel);
+
+        //! Trains a dictionary of at most maxDictionarySize bytes from captured packet payloads.
+        //! The trainer needs a few hundred samples at least, ideally around a hundred times as many bytes as the dictionary size.
+        static bool Train(const PacketSamples& samples, size_t maxDictionarySize, AZStd::vector<uint8_t>& outDictionary);
+
+        static bool SaveToFile(const char* filePath, const AZStd::vector<uint8_t>& dictionary);
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ZstdDictionary);
+
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressionDictionary = nullptr;
+        uint32_t m_id = 0;
+    };
+
+    //! Collects packet payloads from all zstd compressors to train a dictionary from.
+    class ZstdPacketCapture
+    {
+    public:
+        //! Starts capturing the next sampleCount payloads, dropping any previously captured payloads.
+        void Start(uint32_t sampleCount);
+        void Stop();
+        bool IsCapturing() const;
+
+        //! Stores a copy of the payload if the capture is running.
+        void Capture(const void* payload, size_t payloadSize);
+
+        //! Moves the captured payloads out of the capture.
+        PacketSamples TakeSamples();
+
+    private:
+        mutable AZStd::mutex m_mutex;
+        PacketSamples m_samples;
+        uint32_t m_remainingSamples = 0;
+    };
+
+    //! Implements a zstd compressor for use with the Multiplayer Gem.
+    //! Frames are written without the magic number and dictionary id, those are identical for every packet since both endpoints
+    //! have to be configured with the same dictionary. Without a dictionary this behaves like a regular zstd compressor.
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator, 0);
+
+        ZstdCompressor(int compressionLevel, AZStd::shared_ptr<ZstdDictionary> dictionary, ZstdPacketCapture* capture = nullptr);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; }
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ZstdCompressor);
+
+        AZStd::shared_ptr<ZstdDictionary> m_dictionary;
+        ZstdPacketCapture* m_capture = nullptr;
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        int m_compressionLevel;
+    };
+}
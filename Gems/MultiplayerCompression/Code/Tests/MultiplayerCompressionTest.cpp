@@ -10,8 +10,11 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
 
 #include <AzCore/Compression/Compression.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/chrono/clocks.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
@@ -126,4 +129,175 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+class MultiplayerZstdCompressionTest
+    : public MultiplayerCompressionTest
+{
+protected:
+    static constexpr uint32_t TrainingPacketCount = 2000;
+    static constexpr uint32_t TestPacketCount = 200;
+    static constexpr size_t MaxDictionarySize = 8 * 1024;
+    static constexpr int CompressionLevel = 3;
+
+    // Creates a packet laid out like an EntityUpdates packet, a list of entity update messages that each hold the entity id,
+    // the update type, the prefab name, the dirty bits of the properties and the values of the dirty properties
+    static AZStd::vector<uint8_t> CreateEntityUpdatesPacket(AZ::SimpleLcgRandom& random)
+    {
+        static const char* PrefabNames[] = { "Player.spawnable", "Projectile.spawnable", "Pickup.spawnable", "Door.spawnable" };
+
+        AZStd::vector<uint8_t> packet(1200);
+        AzNetworking::NetworkInputSerializer inputSerializer(packet.data(), aznumeric_cast<uint32_t>(packet.size()));
+        AzNetworking::ISerializer& serializer = inputSerializer;
+
+        uint32_t hostFrameId = 1000 + random.GetRandom() % 100;
+        serializer.Serialize(hostFrameId, "HostFrameId");
+        const uint32_t messageCount = 4 + random.GetRandom() % 8;
+        for (uint32_t i = 0; i < messageCount; ++i)
+        {
+            uint64_t netEntityId = random.GetRandom() % 64;
+            uint8_t updateType = 1;
+            AZStd::string prefabName = PrefabNames[netEntityId % AZ_ARRAY_SIZE(PrefabNames)];
+            uint32_t dirtyBits = 0x0F0F0F0F & random.GetRandom();
+            AZ::Vector3 position(aznumeric_cast<float>(netEntityId), 10.0f + random.GetRandomFloat(), 0.0f);
+            uint16_t health = 100;
+            serializer.Serialize(netEntityId, "NetEntityId");
+            serializer.Serialize(updateType, "UpdateType");
+            serializer.Serialize(prefabName, "PrefabName");
+            serializer.Serialize(dirtyBits, "DirtyBits");
+            serializer.Serialize(position, "Position");
+            serializer.Serialize(health, "Health");
+        }
+        packet.resize(inputSerializer.GetSize());
+        return packet;
+    }
+
+    // Compresses and decompresses every packet, returns the total compressed size
+    static size_t CompressPackets(AzNetworking::ICompressor& compressor, const MultiplayerCompression::PacketSamples& packets)
+    {
+        size_t totalCompressedSize = 0;
+        AZStd::vector<uint8_t> compressed;
+        AZStd::vector<uint8_t> decompressed;
+        for (const AZStd::vector<uint8_t>& packet : packets)
+        {
+            compressed.resize(compressor.GetMaxCompressedBufferSize(packet.size()));
+            size_t compressedSize = 0;
+            EXPECT_EQ(AzNetworking::CompressorError::Ok,
+                compressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize));
+
+            decompressed.resize(packet.size());
+            size_t consumedSize = 0;
+            size_t decompressedSize = 0;
+            EXPECT_EQ(AzNetworking::CompressorError::Ok,
+                compressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, decompressedSize));
+            EXPECT_EQ(compressedSize, consumedSize);
+            EXPECT_EQ(packet, decompressed);
+
+            totalCompressedSize += compressedSize;
+        }
+        return totalCompressedSize;
+    }
+};
+
+TEST_F(MultiplayerZstdCompressionTest, MultiplayerZstdCompression_CompressWithoutDictionary)
+{
+    AZ::SimpleLcgRandom random;
+    MultiplayerCompression::PacketSamples packets;
+    for (uint32_t i = 0; i < TestPacketCount; ++i)
+    {
+        packets.push_back(CreateEntityUpdatesPacket(random));
+    }
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(CompressionLevel, nullptr);
+    ASSERT_TRUE(zstdCompressor.Init());
+    CompressPackets(zstdCompressor, packets);
+}
+
+TEST_F(MultiplayerZstdCompressionTest, MultiplayerZstdCompression_TrainedDictionaryImprovesRatio)
+{
+    // Capture training traffic the same way net_ZstdCapturePackets does
+    AZ::SimpleLcgRandom random;
+    MultiplayerCompression::ZstdPacketCapture capture;
+    capture.Start(TrainingPacketCount);
+    {
+        MultiplayerCompression::ZstdCompressor capturingCompressor(CompressionLevel, nullptr, &capture);
+        AZStd::vector<uint8_t> compressed;
+        for (uint32_t i = 0; i < TrainingPacketCount; ++i)
+        {
+            const AZStd::vector<uint8_t> packet = CreateEntityUpdatesPacket(random);
+            compressed.resize(capturingCompressor.GetMaxCompressedBufferSize(packet.size()));
+            size_t compressedSize = 0;
+            capturingCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize);
+        }
+    }
+    EXPECT_FALSE(capture.IsCapturing());
+    const MultiplayerCompression::PacketSamples trainingPackets = capture.TakeSamples();
+    ASSERT_EQ(TrainingPacketCount, trainingPackets.size());
+
+    AZStd::vector<uint8_t> dictionaryData;
+    ASSERT_TRUE(MultiplayerCompression::ZstdDictionary::Train(trainingPackets, MaxDictionarySize, dictionaryData));
+    EXPECT_LE(dictionaryData.size(), MaxDictionarySize);
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(dictionaryData.data(), dictionaryData.size(), CompressionLevel);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::PacketSamples testPackets;
+    size_t totalUncompressedSize = 0;
+    for (uint32_t i = 0; i < TestPacketCount; ++i)
+    {
+        testPackets.push_back(CreateEntityUpdatesPacket(random));
+        totalUncompressedSize += testPackets.back().size();
+    }
+
+    MultiplayerCompression::LZ4Compressor lz4Compressor;
+    MultiplayerCompression::ZstdCompressor zstdCompressor(CompressionLevel, nullptr);
+    MultiplayerCompression::ZstdCompressor zstdDictionaryCompressor(CompressionLevel, dictionary);
+    ASSERT_TRUE(zstdCompressor.Init());
+    ASSERT_TRUE(zstdDictionaryCompressor.Init());
+
+    const size_t lz4Size = CompressPackets(lz4Compressor, testPackets);
+    const size_t zstdSize = CompressPackets(zstdCompressor, testPackets);
+    AZStd::chrono::system_clock::time_point startTime = AZStd::chrono::system_clock::now();
+    const size_t zstdDictionarySize = CompressPackets(zstdDictionaryCompressor, testPackets);
+    const AZ::u64 roundTripTime = AZStd::chrono::microseconds(AZStd::chrono::system_clock::now() - startTime).count();
+
+    EXPECT_LT(zstdDictionarySize, zstdSize);
+    EXPECT_LT(zstdDictionarySize, lz4Size);
+
+    AZ_TracePrintf("Multiplayer Compression Test", "Uncompressed:(%zu B) LZ4:(%zu B) Zstd:(%zu B) Zstd with dictionary:(%zu B) ratio:(%.2f)\n",
+        totalUncompressedSize, lz4Size, zstdSize, zstdDictionarySize, aznumeric_cast<double>(totalUncompressedSize) / zstdDictionarySize);
+    AZ_TracePrintf("Multiplayer Compression Test", "Zstd with dictionary round trip time per packet:(%.2f mcs)\n",
+        aznumeric_cast<double>(roundTripTime) / TestPacketCount);
+}
+
+TEST_F(MultiplayerZstdCompressionTest, MultiplayerZstdCompression_CorruptDataTest)
+{
+    uint8_t corruptData[64];
+    memset(corruptData, 0xAB, sizeof(corruptData));
+    uint8_t buffer[256];
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(CompressionLevel, nullptr);
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(corruptData, sizeof(corruptData), buffer, sizeof(buffer), consumedSize, uncompressedSize);
+    EXPECT_EQ(AzNetworking::CompressorError::CorruptData, decompressStatus);
+}
+
+TEST_F(MultiplayerZstdCompressionTest, MultiplayerZstdCompression_UndersizeDecompressTest)
+{
+    AZ::SimpleLcgRandom random;
+    const AZStd::vector<uint8_t> packet = CreateEntityUpdatesPacket(random);
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(CompressionLevel, nullptr);
+    AZStd::vector<uint8_t> compressed(zstdCompressor.GetMaxCompressedBufferSize(packet.size()));
+    size_t compressedSize = 0;
+    ASSERT_EQ(AzNetworking::CompressorError::Ok,
+        zstdCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize));
+
+    AZStd::vector<uint8_t> decompressed(packet.size() / 2);
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(),
+        decompressed.size(), consumedSize, decompressedSize);
+    EXPECT_EQ(AzNetworking::CompressorError::InsufficientBuffer, decompressStatus);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -12,6 +12,7 @@
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <PhysX/ColliderComponentBus.h>
@@ -235,25 +236,31 @@ namespace PhysX
             return;
         }
 
-        AzPhysics::SimulatedBody* rigidBody =
-            sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
-        if (rigidBody == nullptr)
-        {
-            AZ_Error("RigidBodyComponent", false, "Unable to retrieve simulated rigid body");
-            return;
-        }
-        
-        AZ::Transform transform = rigidBody->GetTransform();
+        // The scene writes the pose back to the entity when the motion isn't interpolated, see GetTransformSyncTarget.
         if (m_configuration.m_interpolateMotion)
         {
+            AzPhysics::SimulatedBody* rigidBody =
+                sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
+            if (rigidBody == nullptr)
+            {
+                AZ_Error("RigidBodyComponent", false, "Unable to retrieve simulated rigid body");
+                return;
+            }
+
+            AZ::Transform transform = rigidBody->GetTransform();
             m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
         }
-        else
+        m_isLastMovementFromKinematicSource = false;
+    }
+
+    AZ::TransformInterface* RigidBodyComponent::GetTransformSyncTarget()
+    {
+        // Same rules as PostPhysicsTick, which runs after the scene wrote the pose back
+        if (m_configuration.m_interpolateMotion || (IsKinematic() && !m_isLastMovementFromKinematicSource))
         {
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldRotationQuaternion, rigidBody->GetOrientation());
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTranslation, rigidBody->GetPosition());
+            return nullptr;
         }
-        m_isLastMovementFromKinematicSource = false;
+        return GetEntity()->GetTransform();
     }
 
     void RigidBodyComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
@@ -298,6 +305,15 @@ namespace PhysX
             m_rigidBodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &m_configuration);
         }
 
+        // Let the scene write the pose back after each simulation step in which the body moved
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            if (auto* physXScene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_attachedSceneHandle)))
+            {
+                physXScene->SetTransformSyncHandler(m_rigidBodyHandle, this);
+            }
+        }
+
         // Listen to the PhysX system for events concerning this entity.
         if (sceneInterface != nullptr)
         {
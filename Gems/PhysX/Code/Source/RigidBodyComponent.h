@@ -17,6 +17,7 @@
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipServiceBus.h>
+#include <Scene/PhysXScene.h>
 
 namespace AzPhysics
 {
@@ -35,6 +36,7 @@ namespace PhysX
         , public AZ::TickBus::Handler
         , public AzFramework::SliceGameEntityOwnershipServiceNotificationBus::Handler
         , protected AZ::TransformNotificationBus::MultiHandler
+        , private TransformSyncHandler
     {
     public:
         AZ_COMPONENT(RigidBodyComponent, "{D4E52A70-BDE1-4819-BD3C-93AB3F4F3BE3}");
@@ -144,6 +146,9 @@ namespace PhysX
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
 
     private:
+        // TransformSyncHandler
+        AZ::TransformInterface* GetTransformSyncTarget() override;
+
         void SetupConfiguration();
         void CreatePhysics();
         void InitPhysicsTickHandler();
@@ -7,10 +7,18 @@
  */
 #include <Scene/PhysXScene.h>
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/time.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
@@ -39,6 +47,13 @@ namespace PhysX
     /*static*/ thread_local AZStd::vector<physx::PxSweepHit> PhysXScene::s_sweepBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxOverlapHit> PhysXScene::s_overlapBuffer;
 
+    struct PhysXScene::SceneQueryBuffers
+    {
+        AZStd::vector<physx::PxRaycastHit> m_raycastBuffer;
+        AZStd::vector<physx::PxSweepHit> m_sweepBuffer;
+        AZStd::vector<physx::PxOverlapHit> m_overlapBuffer;
+    };
+
     namespace Internal
     {
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
@@ -67,10 +82,9 @@ namespace PhysX
                 sceneDesc.filterShader = Collision::DefaultFilterShader;
             }
             
-            if (config.m_enableActiveActors)
-            {
-                sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
-            }
+            // The active actors are always needed to write the poses of the moved bodies back to their entities,
+            // SceneConfiguration::m_enableActiveActors only controls whether they are reported through the scene event.
+            sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
     
             if (config.m_enablePcm)
             {
@@ -452,6 +466,36 @@ namespace PhysX
             }
             return results;
         }
+
+        //! Batches with fewer requests than this are queried on the calling thread.
+        constexpr size_t MinSceneQueriesPerJob = 64;
+        //! Steps that moved fewer bodies than this read their poses on the simulation thread.
+        constexpr size_t MinTransformSyncBodiesPerJob = 256;
+
+        //! Returns how many jobs the items are split over, one job per worker thread at most.
+        size_t GetJobCount(size_t itemCount, size_t minItemsPerJob, const AZ::JobContext& jobContext)
+        {
+            const size_t workerCount = AZStd::max<size_t>(jobContext.GetJobManager().GetNumWorkerThreads(), 1);
+            return AZStd::min(workerCount, (itemCount + minItemsPerJob - 1) / minItemsPerJob);
+        }
+
+        //! Copies a request so that an asynchronous query doesn't depend on the lifetime of the caller's request.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CopySceneQueryRequest(const AzPhysics::SceneQueryRequest& request)
+        {
+            if (const auto* raycastRequest = azrtti_cast<const AzPhysics::RayCastRequest*>(&request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*raycastRequest);
+            }
+            if (const auto* shapecastRequest = azrtti_cast<const AzPhysics::ShapeCastRequest*>(&request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*shapecastRequest);
+            }
+            if (const auto* overlapRequest = azrtti_cast<const AzPhysics::OverlapRequest*>(&request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*overlapRequest);
+            }
+            return nullptr;
+        }
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -494,6 +538,13 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // The jobs of asynchronous queries use the scene, wait for them and call the callbacks of the queries that were accepted.
+        while (m_pendingAsyncQueryCount.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+        DispatchCompletedAsyncQueries();
+
         s_overlapBuffer.swap({});
         s_rayCastBuffer.swap({});
         s_sweepBuffer.swap({});
@@ -512,6 +563,7 @@ namespace PhysX
             }
         }
         m_simulatedBodies.clear();
+        m_transformSyncHandlers.clear();
 
         ClearDeferedDeletions();
 
@@ -544,6 +596,11 @@ namespace PhysX
 
         m_currentDeltaTime = deltatime;
 
+        if (auto* physXSystem = GetPhysXSystem(); physXSystem && physXSystem->GetPhysXCpuDispatcher())
+        {
+            m_dispatcherStatisticsAtStart = physXSystem->GetPhysXCpuDispatcher()->GetStatistics();
+        }
+
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
     }
@@ -568,39 +625,45 @@ namespace PhysX
             m_pxScene->checkResults(true);
         }
 
-        bool activeActorsEnabled = false;
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::FetchResults");
             PHYSX_SCENE_WRITE_LOCK(m_pxScene);
 
-            activeActorsEnabled = m_pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
-
             // Swap the buffers, invoke callbacks, build the list of active actors.
             m_pxScene->fetchResults(true);
         }
-        
-        if (activeActorsEnabled)
-        {
-            AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
 
+        physx::PxU32 numActiveActors = 0;
+        physx::PxActor** activeActors = nullptr;
+        {
             PHYSX_SCENE_READ_LOCK(m_pxScene);
+            activeActors = m_pxScene->getActiveActors(numActiveActors);
+        }
+
+        if (m_config.m_enableActiveActors)
+        {
+            AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
 
-            physx::PxU32 numActiveActors = 0;
-            physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
             activeBodyHandles.reserve(numActiveActors);
-            for (physx::PxU32 i = 0; i < numActiveActors; ++i)
             {
-                if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
+                PHYSX_SCENE_READ_LOCK(m_pxScene);
+                for (physx::PxU32 i = 0; i < numActiveActors; ++i)
                 {
-                    activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+                    if (ActorData* actorData = Utils::GetUserData(activeActors[i]))
+                    {
+                        activeBodyHandles.emplace_back(actorData->GetBodyHandle());
+                    }
                 }
             }
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
 
+        SyncActiveBodyTransforms(activeActors, numActiveActors);
+
         FlushQueuedEvents();
         ClearDeferedDeletions();
+        DispatchCompletedAsyncQueries();
 
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
@@ -770,11 +833,32 @@ namespace PhysX
             m_deferredDeletions.push_back(m_simulatedBodies[index].second);
             m_simulatedBodies[index] = AZStd::make_pair(AZ::Crc32(), nullptr);
             m_freeSceneSlots.push(index);
+            if (index < m_transformSyncHandlers.size())
+            {
+                m_transformSyncHandlers[index] = nullptr;
+            }
 
             bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
         }
     }
 
+    void PhysXScene::SetTransformSyncHandler(AzPhysics::SimulatedBodyHandle bodyHandle, TransformSyncHandler* handler)
+    {
+        AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(bodyHandle);
+        if (body == nullptr)
+        {
+            AZ_Warning("PhysXScene", handler == nullptr, "SetTransformSyncHandler: the body isn't in the scene.");
+            return;
+        }
+
+        const AzPhysics::SimulatedBodyIndex index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (index >= m_transformSyncHandlers.size())
+        {
+            m_transformSyncHandlers.resize(m_simulatedBodies.size(), nullptr);
+        }
+        m_transformSyncHandlers[index] = handler;
+    }
+
     void PhysXScene::RemoveSimulatedBodies(AzPhysics::SimulatedBodyHandleList& bodyHandles)
     {
         for (auto& handle: bodyHandles)
@@ -916,6 +1000,14 @@ namespace PhysX
     }
 
     AzPhysics::SceneQueryHits PhysXScene::QueryScene(const AzPhysics::SceneQueryRequest* request)
+    {
+        return QuerySceneWithBuffers(request, s_rayCastBuffer, s_sweepBuffer, s_overlapBuffer);
+    }
+
+    AzPhysics::SceneQueryHits PhysXScene::QuerySceneWithBuffers(const AzPhysics::SceneQueryRequest* request,
+        AZStd::vector<physx::PxRaycastHit>& raycastBuffer,
+        AZStd::vector<physx::PxSweepHit>& sweepBuffer,
+        AZStd::vector<physx::PxOverlapHit>& overlapBuffer)
     {
         if (request == nullptr)
         {
@@ -929,17 +1021,17 @@ namespace PhysX
         if (azrtti_istypeof<AzPhysics::RayCastRequest>(request))
         {
             return Internal::RayCast(azdynamic_cast<const AzPhysics::RayCastRequest*>(request),
-                s_rayCastBuffer, m_pxScene, queryData, m_raycastBufferSize);
+                raycastBuffer, m_pxScene, queryData, m_raycastBufferSize);
         }
         else if (azrtti_istypeof<AzPhysics::ShapeCastRequest>(request))
         {
             return Internal::ShapeCast(azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request),
-                s_sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize);
+                sweepBuffer, m_pxScene, queryData, m_shapecastBufferSize);
         }
         else if (azrtti_istypeof<AzPhysics::OverlapRequest>(request))
         {
             return Internal::OverlapQuery(azdynamic_cast<const AzPhysics::OverlapRequest*>(request),
-                s_overlapBuffer, m_pxScene, queryData, m_overlapBufferSize);
+                overlapBuffer, m_pxScene, queryData, m_overlapBufferSize);
         }
         else
         {
@@ -948,29 +1040,243 @@ namespace PhysX
         return AzPhysics::SceneQueryHits();
     }
 
+    AZStd::vector<PhysXScene::SceneQueryBuffers> PhysXScene::CreateSceneQueryBuffers(size_t jobCount) const
+    {
+        AZStd::vector<SceneQueryBuffers> buffers(jobCount);
+        for (SceneQueryBuffers& jobBuffers : buffers)
+        {
+            jobBuffers.m_raycastBuffer.resize(m_raycastBufferSize);
+            jobBuffers.m_sweepBuffer.resize(m_shapecastBufferSize);
+            jobBuffers.m_overlapBuffer.resize(m_overlapBufferSize);
+        }
+        return buffers;
+    }
+
+    void PhysXScene::StartSceneQueryJobs(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results,
+        AZStd::vector<SceneQueryBuffers>& buffers, AZ::JobContext* jobContext, AZ::Job* dependentJob)
+    {
+        const size_t requestsPerJob = (requests.size() + buffers.size() - 1) / buffers.size();
+        for (size_t jobIndex = 0; jobIndex < buffers.size(); ++jobIndex)
+        {
+            const size_t requestBegin = jobIndex * requestsPerJob;
+            const size_t requestEnd = AZStd::min(requestBegin + requestsPerJob, requests.size());
+            if (requestBegin >= requestEnd)
+            {
+                break;
+            }
+
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this, &requests, &results, &jobBuffers = buffers[jobIndex], requestBegin, requestEnd]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "PhysXScene::SceneQueryJob");
+                    for (size_t requestIndex = requestBegin; requestIndex < requestEnd; ++requestIndex)
+                    {
+                        results[requestIndex] = QuerySceneWithBuffers(requests[requestIndex].get(),
+                            jobBuffers.m_raycastBuffer, jobBuffers.m_sweepBuffer, jobBuffers.m_overlapBuffer);
+                    }
+                },
+                true, jobContext);
+            job->SetDependent(dependentJob);
+            job->Start();
+        }
+    }
+
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_FUNCTION(Physics);
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        // Each query only reads the scene, so large batches are split over jobs that each use their own hit buffers.
+        // A batch issued from within a job is queried inline to avoid waiting on other jobs from a worker thread.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t jobCount = jobContext ? Internal::GetJobCount(requests.size(), Internal::MinSceneQueriesPerJob, *jobContext) : 0;
+        if (jobCount > 1 && jobContext->GetJobManager().GetCurrentJob() == nullptr)
         {
-            results.emplace_back(QueryScene(request.get()));
+            AZStd::vector<SceneQueryBuffers> buffers = CreateSceneQueryBuffers(jobCount);
+            AZ::JobCompletion jobCompletion(jobContext);
+            StartSceneQueryJobs(requests, results, buffers, jobContext, &jobCompletion);
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex)
+            {
+                results[requestIndex] = QueryScene(requests[requestIndex].get());
+            }
         }
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CopySceneQueryRequest(*request);
+        if (!requestCopy)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        return QuerySceneAsyncBatch(requestId, { AZStd::move(requestCopy) },
+            [callback = AZStd::move(callback)](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHitsList hits)
+            {
+                callback(id, AZStd::move(hits.front()));
+            });
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        // Owns everything the jobs of the batch use until its hits are handed to the callback.
+        struct AsyncBatch
+        {
+            AzPhysics::SceneQueryRequests m_requests;
+            AzPhysics::SceneQueryHitsList m_results;
+            AZStd::vector<SceneQueryBuffers> m_buffers;
+        };
+        auto batch = AZStd::make_shared<AsyncBatch>();
+        batch->m_requests = requests;
+        batch->m_results.resize(requests.size());
+
+        ++m_pendingAsyncQueryCount;
+        auto completeBatch = [this, batch, requestId, callback = AZStd::move(callback)]() mutable
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+                m_completedAsyncQueries.push_back(
+                    [batch, requestId, callback = AZStd::move(callback)]()
+                    {
+                        callback(requestId, AZStd::move(batch->m_results));
+                    });
+            }
+            --m_pendingAsyncQueryCount;
+        };
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr)
+        {
+            // Without a job system the queries run right away, the callback is still called when the scene finishes simulating.
+            for (size_t requestIndex = 0; requestIndex < batch->m_requests.size(); ++requestIndex)
+            {
+                batch->m_results[requestIndex] = QueryScene(batch->m_requests[requestIndex].get());
+            }
+            completeBatch();
+            return true;
+        }
+
+        AZ::Job* completionJob = AZ::CreateJobFunction(AZStd::move(completeBatch), true, jobContext);
+        const size_t jobCount = AZStd::max<size_t>(Internal::GetJobCount(batch->m_requests.size(), Internal::MinSceneQueriesPerJob, *jobContext), 1);
+        batch->m_buffers = CreateSceneQueryBuffers(jobCount);
+        StartSceneQueryJobs(batch->m_requests, batch->m_results, batch->m_buffers, jobContext, completionJob);
+        completionJob->Start();
+        return true;
+    }
+
+    void PhysXScene::DispatchCompletedAsyncQueries()
+    {
+        AZStd::vector<AZStd::function<void()>> completedQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+            completedQueries.swap(m_completedAsyncQueries);
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::DispatchCompletedAsyncQueries");
+        for (AZStd::function<void()>& completedQuery : completedQueries)
+        {
+            completedQuery();
+        }
+    }
+
+    void PhysXScene::SyncActiveBodyTransforms(physx::PxActor** activeActors, AZ::u32 activeActorCount)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::SyncActiveBodyTransforms");
+
+        m_transformSyncEntries.clear();
+        if (m_transformSyncHandlers.empty())
+        {
+            return;
+        }
+
+        // Gather the moved bodies whose handlers want their pose written back this step.
+        // Bodies removed since the step are skipped, their slot no longer refers to them.
+        for (AZ::u32 actorIndex = 0; actorIndex < activeActorCount; ++actorIndex)
+        {
+            physx::PxRigidActor* rigidActor = activeActors[actorIndex]->is<physx::PxRigidActor>();
+            ActorData* actorData = rigidActor ? Utils::GetUserData(rigidActor) : nullptr;
+            if (actorData == nullptr)
+            {
+                continue;
+            }
+
+            const AzPhysics::SimulatedBodyIndex bodyIndex = AZStd::get<AzPhysics::HandleTypeIndex::Index>(actorData->GetBodyHandle());
+            if (bodyIndex >= m_transformSyncHandlers.size() || m_transformSyncHandlers[bodyIndex] == nullptr
+                || m_simulatedBodies[bodyIndex].second != actorData->GetSimulatedBody())
+            {
+                continue;
+            }
+
+            if (AZ::TransformInterface* target = m_transformSyncHandlers[bodyIndex]->GetTransformSyncTarget())
+            {
+                m_transformSyncEntries.push_back({ target, rigidActor, AZ::Quaternion::CreateIdentity(), AZ::Vector3::CreateZero() });
+            }
+        }
+
+        // Reading the poses only needs the scene read lock, so they are read in parallel when many bodies moved.
+        auto readPoses = [this](size_t entryBegin, size_t entryEnd)
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+            for (size_t entryIndex = entryBegin; entryIndex < entryEnd; ++entryIndex)
+            {
+                TransformSyncEntry& entry = m_transformSyncEntries[entryIndex];
+                const physx::PxTransform pose = entry.m_actor->getGlobalPose();
+                entry.m_rotation = PxMathConvert(pose.q);
+                entry.m_translation = PxMathConvert(pose.p);
+            }
+        };
+
+        const size_t entryCount = m_transformSyncEntries.size();
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t jobCount = jobContext ? Internal::GetJobCount(entryCount, Internal::MinTransformSyncBodiesPerJob, *jobContext) : 0;
+        if (jobCount > 1 && jobContext->GetJobManager().GetCurrentJob() == nullptr)
+        {
+            AZ::JobCompletion jobCompletion(jobContext);
+            const size_t entriesPerJob = (entryCount + jobCount - 1) / jobCount;
+            for (size_t entryBegin = 0; entryBegin < entryCount; entryBegin += entriesPerJob)
+            {
+                const size_t entryEnd = AZStd::min(entryBegin + entriesPerJob, entryCount);
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&readPoses, entryBegin, entryEnd]()
+                    {
+                        AZ_PROFILE_SCOPE(Physics, "PhysXScene::TransformSyncJob");
+                        readPoses(entryBegin, entryEnd);
+                    },
+                    true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            readPoses(0, entryCount);
+        }
+
+        // Transform components aren't thread safe, the poses are applied on the simulation thread with one update per entity.
+        for (const TransformSyncEntry& entry : m_transformSyncEntries)
+        {
+            entry.m_target->SetWorldRotationQuaternionAndTranslation(entry.m_rotation, entry.m_translation);
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1252,5 +1558,22 @@ namespace PhysX
         AZ_PROFILE_DATAPOINT(Physics, stats.nbNewTouches, RootCategory, CollisionsSubCategory, "NewTouches");
         AZ_PROFILE_DATAPOINT(Physics, stats.nbLostTouches, RootCategory, CollisionsSubCategory, "LostTouches");
         AZ_PROFILE_DATAPOINT(Physics, stats.nbPartitions, RootCategory, CollisionsSubCategory, "Partitions");
+
+        // Tasks dispatched during this step. Scenes are simulated one after the other, so they are the tasks of this scene.
+        if (auto* physXSystem = GetPhysXSystem(); physXSystem && physXSystem->GetPhysXCpuDispatcher())
+        {
+            const PhysXCpuDispatcherStatistics dispatcherStats = physXSystem->GetPhysXCpuDispatcher()->GetStatistics();
+            [[maybe_unused]] const AZ::u64 submitMicroseconds =
+                (dispatcherStats.m_submitTicks - m_dispatcherStatisticsAtStart.m_submitTicks) * 1000000 / AZStd::GetTimeTicksPerSecond();
+
+            [[maybe_unused]] const char* DispatcherSubCategory = "Dispatcher";
+            AZ_PROFILE_DATAPOINT(Physics, dispatcherStats.m_submittedTasks - m_dispatcherStatisticsAtStart.m_submittedTasks,
+                RootCategory, DispatcherSubCategory, "SubmittedTasks");
+            AZ_PROFILE_DATAPOINT(Physics, dispatcherStats.m_pooledTasks - m_dispatcherStatisticsAtStart.m_pooledTasks,
+                RootCategory, DispatcherSubCategory, "PooledTasks");
+            AZ_PROFILE_DATAPOINT(Physics, dispatcherStats.m_allocatedJobs - m_dispatcherStatisticsAtStart.m_allocatedJobs,
+                RootCategory, DispatcherSubCategory, "AllocatedJobs");
+            AZ_PROFILE_DATAPOINT(Physics, submitMicroseconds, RootCategory, DispatcherSubCategory, "SubmitTimeMicroseconds");
+        }
     }
 }
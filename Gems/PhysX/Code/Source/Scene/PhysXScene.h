@@ -12,22 +12,49 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
+#include <System/PhysXCpuDispatcher.h>
 
 namespace physx
 {
+    class PxActor;
     class PxControllerManager;
     struct PxOverlapHit;
     struct PxRaycastHit;
+    class PxRigidActor;
     class PxScene;
     struct PxSweepHit;
 }
 
+namespace AZ
+{
+    class Job;
+    class JobContext;
+    class TransformInterface;
+}
+
 namespace PhysX
 {
+    //! Implemented by the owners of simulated bodies whose pose is written back to an entity by the scene,
+    //! see PhysXScene::SetTransformSyncHandler.
+    class TransformSyncHandler
+    {
+    public:
+        virtual ~TransformSyncHandler() = default;
+
+        //! Returns the transform the pose of the body is written to after a simulation step in which PhysX moved the body,
+        //! or nullptr to leave the transform alone for this step. Called on the simulation thread.
+        virtual AZ::TransformInterface* GetTransformSyncTarget() = 0;
+    };
+
     //! PhysX implementation of the AzPhysics::Scene.
+    //! Batches of scene queries are split over the job system and asynchronous queries run in jobs.
+    //! The callbacks of asynchronous queries are called on the simulation thread when the scene finishes its next simulation step.
+    //! After each step the poses of the bodies PhysX moved are read in parallel and written back to their entities in one pass.
     class PhysXScene
         : public AzPhysics::Scene
     {
@@ -75,6 +102,10 @@ namespace PhysX
         AzPhysics::SceneHandle GetSceneHandle() const { return m_sceneHandle; }
         const AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>>& GetSimulatedBodyList() const { return m_simulatedBodies; }
 
+        //! Sets the handler that decides where the pose of the body is written to after each simulation step in which it moved,
+        //! or stops writing back the pose of the body when the handler is nullptr. The handler is cleared when the body is removed.
+        void SetTransformSyncHandler(AzPhysics::SimulatedBodyHandle bodyHandle, TransformSyncHandler* handler);
+
         void* GetNativePointer() const override;
 
         physx::PxControllerManager* GetOrCreateControllerManager();
@@ -90,10 +121,41 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Hit buffers for the queries of one job.
+        struct SceneQueryBuffers;
+
+        //! Runs a scene query using the given hit buffers, so queries running in parallel don't share buffers.
+        AzPhysics::SceneQueryHits QuerySceneWithBuffers(const AzPhysics::SceneQueryRequest* request,
+            AZStd::vector<physx::PxRaycastHit>& raycastBuffer,
+            AZStd::vector<physx::PxSweepHit>& sweepBuffer,
+            AZStd::vector<physx::PxOverlapHit>& overlapBuffer);
+        //! Creates hit buffers for the given number of jobs, sized for the largest queries the scene allows.
+        AZStd::vector<SceneQueryBuffers> CreateSceneQueryBuffers(size_t jobCount) const;
+        //! Starts one job per hit buffer that runs a part of the requests and stores the hits in the results.
+        //! The requests, results and buffers need to stay alive until the dependent job runs after all the jobs finished.
+        void StartSceneQueryJobs(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results,
+            AZStd::vector<SceneQueryBuffers>& buffers, AZ::JobContext* jobContext, AZ::Job* dependentJob);
+        //! Calls the callbacks of the asynchronous queries that finished since the last call.
+        void DispatchCompletedAsyncQueries();
+
+        //! Writes the poses of the active actors of the last simulation step back to the transforms of their entities.
+        void SyncActiveBodyTransforms(physx::PxActor** activeActors, AZ::u32 activeActorCount);
+
+        //! A body whose pose is written back to an entity after the current simulation step.
+        struct TransformSyncEntry
+        {
+            AZ::TransformInterface* m_target = nullptr;
+            physx::PxRigidActor* m_actor = nullptr;
+            AZ::Quaternion m_rotation;
+            AZ::Vector3 m_translation;
+        };
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
         float m_currentDeltaTime = 0.0f;
+        //! Dispatcher counts when the current step started, to report the tasks dispatched during the step.
+        PhysXCpuDispatcherStatistics m_dispatcherStatisticsAtStart;
 
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>> m_simulatedBodies; //this will become a SimulatedBody with LYN-1334
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
@@ -103,6 +165,9 @@ namespace PhysX
         AZStd::vector<AzPhysics::Joint*> m_deferredDeletionsJoints;
         AZStd::queue<AzPhysics::JointIndex> m_freeJointSlots;
 
+        AZStd::vector<TransformSyncHandler*> m_transformSyncHandlers; //!< Indexed like m_simulatedBodies, nullptr for bodies without a handler.
+        AZStd::vector<TransformSyncEntry> m_transformSyncEntries; //!< Kept between steps so that the write-back doesn't allocate.
+
         AzPhysics::SystemEvents::OnConfigurationChangedEvent::Handler m_physicsSystemConfigChanged;
 
         static thread_local AZStd::vector<physx::PxRaycastHit> s_rayCastBuffer; //!< thread local structure to hold hits for a single raycast or shapecast.
@@ -112,6 +177,10 @@ namespace PhysX
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        AZStd::mutex m_asyncQueryMutex; //!< Guards m_completedAsyncQueries, asynchronous queries finish on job threads.
+        AZStd::vector<AZStd::function<void()>> m_completedAsyncQueries; //!< Callbacks of the finished asynchronous queries, bound to their hits.
+        AZStd::atomic<AZ::u32> m_pendingAsyncQueryCount{ 0 }; //!< Number of asynchronous queries whose jobs haven't finished yet.
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
@@ -8,6 +8,9 @@
 
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/time.h>
 
 namespace PhysX
 {
@@ -16,15 +19,114 @@ namespace PhysX
         return aznew PhysXCpuDispatcher();
     }
 
+    PhysXCpuDispatcher* PhysXCpuDispatcherCreate(AZ::u32 workerCount, AZ::u32 cpuMask)
+    {
+        return aznew PhysXCpuDispatcher(workerCount, cpuMask);
+    }
+
+    PhysXCpuDispatcher::PooledTask::PooledTask(PhysXCpuDispatcher& dispatcher, const AZ::TaskDescriptor& descriptor)
+        : m_task(descriptor, [&dispatcher, this]() { dispatcher.RunPooledTask(*this); })
+    {
+    }
+
+    PhysXCpuDispatcher::PhysXCpuDispatcher() = default;
+
+    PhysXCpuDispatcher::PhysXCpuDispatcher(AZ::u32 workerCount, AZ::u32 cpuMask)
+        : m_taskExecutor(aznew AZ::TaskExecutor(workerCount))
+    {
+        const AZ::TaskDescriptor descriptor{ "PhysX Task", "Physics", AZ::TaskPriority::HIGH, cpuMask };
+
+        // The tasks are created in place because each one refers to its own slot in the pool
+        m_taskPool = reinterpret_cast<PooledTask*>(azmalloc(TaskPoolSize * sizeof(PooledTask), alignof(PooledTask)));
+        for (AZ::u32 i = 0; i < TaskPoolSize; ++i)
+        {
+            new (m_taskPool + i) PooledTask(*this, descriptor);
+        }
+    }
+
+    PhysXCpuDispatcher::~PhysXCpuDispatcher()
+    {
+        // Joins the workers, PhysX has finished all its tasks once the scenes are released
+        m_taskExecutor.reset();
+
+        if (m_taskPool)
+        {
+            for (AZ::u32 i = 0; i < TaskPoolSize; ++i)
+            {
+                AZ_Assert(!m_taskPool[i].m_inUse.load(), "PhysX task is still running while the CPU dispatcher is destroyed");
+                m_taskPool[i].~PooledTask();
+            }
+            azfree(m_taskPool);
+            m_taskPool = nullptr;
+        }
+    }
+
+    PhysXCpuDispatcherStatistics PhysXCpuDispatcher::GetStatistics() const
+    {
+        PhysXCpuDispatcherStatistics statistics;
+        statistics.m_submittedTasks = m_submittedTasks.load(AZStd::memory_order_relaxed);
+        statistics.m_pooledTasks = m_pooledTasks.load(AZStd::memory_order_relaxed);
+        statistics.m_allocatedJobs = m_allocatedJobs.load(AZStd::memory_order_relaxed);
+        statistics.m_submitTicks = m_submitTicks.load(AZStd::memory_order_relaxed);
+        return statistics;
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        const AZStd::sys_time_t submitStart = AZStd::GetTimeNowTicks();
+
+        PooledTask* pooledTask = m_taskExecutor ? AcquirePooledTask() : nullptr;
+        if (pooledTask)
+        {
+            pooledTask->m_pxTask = &task;
+            m_taskExecutor->Submit(pooledTask->m_task);
+            m_pooledTasks.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+        else
+        {
+            auto azJob = aznew PhysXJob(task);
+            azJob->Start();
+            m_allocatedJobs.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+
+        m_submittedTasks.fetch_add(1, AZStd::memory_order_relaxed);
+        m_submitTicks.fetch_add(AZStd::GetTimeNowTicks() - submitStart, AZStd::memory_order_relaxed);
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
+        if (m_taskExecutor)
+        {
+            return m_taskExecutor->GetThreadCount();
+        }
         return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
     }
-} // namespace PhysX
 
+    PhysXCpuDispatcher::PooledTask* PhysXCpuDispatcher::AcquirePooledTask()
+    {
+        // Start at a different slot for every task so that concurrent submits rarely compete for the same slot
+        const AZ::u32 firstSlot = m_nextPooledTask.fetch_add(1, AZStd::memory_order_relaxed);
+        for (AZ::u32 i = 0; i < TaskPoolSize; ++i)
+        {
+            PooledTask& pooledTask = m_taskPool[(firstSlot + i) % TaskPoolSize];
+            if (!pooledTask.m_inUse.load(AZStd::memory_order_relaxed) && !pooledTask.m_inUse.exchange(true, AZStd::memory_order_acquire))
+            {
+                return &pooledTask;
+            }
+        }
+        return nullptr;
+    }
+
+    void PhysXCpuDispatcher::RunPooledTask(PooledTask& pooledTask)
+    {
+        physx::PxBaseTask& pxTask = *pooledTask.m_pxTask;
+        {
+            AZ_PROFILE_SCOPE(Physics, pxTask.getName());
+            pxTask.run();
+            pxTask.release();
+        }
+
+        // The executor doesn't touch a task without a graph once it has run, so the slot can be reused right away
+        pooledTask.m_inUse.store(false, AZStd::memory_order_release);
+    }
+} // namespace PhysX
@@ -5,6 +5,9 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -23,6 +26,14 @@
 
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_cpuDispatcherUseTaskExecutor, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run the tasks submitted by PhysX on a task executor with recycled task objects instead of allocating a job for each task. "
+        "Takes effect when the PhysX SDK is initialized.");
+    AZ_CVAR(uint32_t, physx_cpuDispatcherWorkerCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of task executor workers that run PhysX tasks, 0 to use the number of job manager workers.");
+    AZ_CVAR(uint32_t, physx_cpuDispatcherCpuMask, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Restricts PhysX tasks to the task executor workers with a set bit, 0 to allow all workers.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator, 0);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -417,13 +428,27 @@ namespace PhysX
         m_physXSdk.m_cooking = PxCreateCooking(PX_PHYSICS_VERSION, *m_physXSdk.m_foundation, cookingParams);
 
         // Set up CPU dispatcher
+        if (physx_cpuDispatcherUseTaskExecutor)
+        {
+            AZ::u32 workerCount = physx_cpuDispatcherWorkerCount;
+            if (workerCount == 0)
+            {
+                workerCount = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+            }
+            m_physXCpuDispatcher = PhysXCpuDispatcherCreate(workerCount, physx_cpuDispatcherCpuMask);
+            m_cpuDispatcher = m_physXCpuDispatcher;
+        }
+        else
+        {
 #if defined(AZ_PLATFORM_LINUX)
-        // Temporary workaround for linux. At the moment using AzPhysXCpuDispatcher results in an assert at
-        // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
-        m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(0);
+            // Temporary workaround for linux. At the moment using AzPhysXCpuDispatcher results in an assert at
+            // PhysX mutex indicating it must be unlocked only by the thread that has already acquired lock.
+            m_cpuDispatcher = physx::PxDefaultCpuDispatcherCreate(0);
 #else
-        m_cpuDispatcher = PhysXCpuDispatcherCreate();
+            m_physXCpuDispatcher = PhysXCpuDispatcherCreate();
+            m_cpuDispatcher = m_physXCpuDispatcher;
 #endif
+        }
 
         PxSetProfilerCallback(&m_pxAzProfilerCallback);
     }
@@ -432,6 +457,7 @@ namespace PhysX
     {
         delete m_cpuDispatcher;
         m_cpuDispatcher = nullptr;
+        m_physXCpuDispatcher = nullptr;
 
         m_physXSdk.m_cooking->release();
         m_physXSdk.m_cooking = nullptr;
@@ -33,6 +33,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXCpuDispatcher;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
         , private AzFramework::AssetCatalogEventBus::Handler
@@ -80,6 +82,8 @@ namespace PhysX
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        //! Returns the Open 3D Engine CPU dispatcher, or nullptr if PhysX uses its default dispatcher.
+        const PhysXCpuDispatcher* GetPhysXCpuDispatcher() const { return m_physXCpuDispatcher; }
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
@@ -113,6 +117,7 @@ namespace PhysX
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXCpuDispatcher* m_physXCpuDispatcher = nullptr; //!< Same object as m_cpuDispatcher unless the default PhysX dispatcher is used.
 
         enum class State : AZ::u8
         {
@@ -10,6 +10,8 @@
 #include <benchmark/benchmark.h>
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 
@@ -27,6 +29,10 @@ namespace PhysX::Benchmarks
         //! Controls the simulation length of the test. 30secs at 60fps
         static const int GameFramesToSimulate = 1800;
 
+        //! Controls the simulation length of the transform write-back test. 2secs at 60fps, the bodies don't reach the ground.
+        static const int WriteBackFramesToSimulate = 120;
+        static const float WriteBackSpawnHeight = 200.0f;
+
         //! The size of safe the test region, used for spawning Rigid bodies
         static const float TestRadius = 250.0f;
 
@@ -465,6 +471,77 @@ namespace PhysX::Benchmarks
         state.counters["Collisions-End"] = static_cast<double>(m_collisionEndCount);
     }
 
+    //! BM_RigidBody_TransformWriteBack - This test will spawn the requested number of rigid body entities high above the ground
+    //! and let them fall, so the pose of every body is written back to its entity after every simulation step.
+    //! The test will run the simulation for ~120 game frames at 60fps, and also reports the transform updates per entity and frame.
+    BENCHMARK_DEFINE_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)(benchmark::State& state)
+    {
+        //get the request number of rigid bodies and prepare to spawn them
+        const int numRigidBodies = static_cast<int>(state.range(0));
+
+        const float boxSizeWithSpacing = RigidBodyConstants::RigidBodys::BoxSize + 2.0f;
+        const int boxesPerCol = static_cast<const int>(RigidBodyConstants::TerrainSize / boxSizeWithSpacing) - 1;
+        const AZ::Vector3 boxDimensions(RigidBodyConstants::RigidBodys::BoxSize);
+
+        //count the transform changes of the entities, a body that moved should update its entity once per frame
+        AZ::u64 transformUpdateCount = 0;
+        AZ::TransformChangedEvent::Handler transformChangedHandler(
+            [&transformUpdateCount]([[maybe_unused]] const AZ::Transform& local, [[maybe_unused]] const AZ::Transform& world)
+            {
+                transformUpdateCount++;
+            });
+
+        //setup the sub tick tracker
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //setup the frame timer tracker
+        Types::TimeList tickTimes;
+        for (auto _ : state)
+        {
+            //spawn the rigid body entities outside of the timed section
+            state.PauseTiming();
+            AZStd::vector<EntityPtr> entities;
+            AZStd::vector<AZ::TransformChangedEvent::Handler> transformChangedHandlers(numRigidBodies, transformChangedHandler);
+            entities.reserve(numRigidBodies);
+            for (int i = 0; i < numRigidBodies; i++)
+            {
+                const AZ::Vector3 position(
+                    boxSizeWithSpacing + (boxSizeWithSpacing * (i % boxesPerCol)),
+                    boxSizeWithSpacing + (boxSizeWithSpacing * (i / boxesPerCol)),
+                    RigidBodyConstants::WriteBackSpawnHeight);
+                entities.emplace_back(PhysX::TestUtils::CreateBoxEntity(m_testSceneHandle, position, boxDimensions));
+                entities.back()->GetTransform()->BindTransformChangedEventHandler(transformChangedHandlers[i]);
+            }
+            state.ResumeTiming();
+
+            for (AZ::u32 i = 0; i < RigidBodyConstants::WriteBackFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+
+            //object clean up
+            state.PauseTiming();
+            transformChangedHandlers.clear();
+            entities.clear();
+            state.ResumeTiming();
+        }
+        subTickTracker.Stop();
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+
+        //add the transform updates
+        const double entityFrames = static_cast<double>(state.iterations()) * numRigidBodies * RigidBodyConstants::WriteBackFramesToSimulate;
+        state.counters["TransformUpdatesPerEntityFrame"] = static_cast<double>(transformUpdateCount) / entityFrames;
+    }
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_AtRest)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
@@ -479,6 +556,13 @@ namespace PhysX::Benchmarks
         ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
         ;
 
+    BENCHMARK_REGISTER_F(PhysXRigidbodyBenchmarkFixture, BM_RigidBody_TransformWriteBack)
+        ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(RigidBodyConstants::BenchmarkSettings::NumIterations)
+        ;
+
     BENCHMARK_REGISTER_F(PhysXRigidbodyCollisionsBenchmarkFixture, BM_RigidBody_MovingAndColliding_CollisionHandlers)
         ->RangeMultiplier(RigidBodyConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({ {RigidBodyConstants::BenchmarkSettings::StartRange, RigidBodyConstants::BenchmarkSettings::EndRange}, {RigidBodyConstants::BenchmarkSettings::AllCollisionHanders, RigidBodyConstants::BenchmarkSettings::AllCollisionHanders} })
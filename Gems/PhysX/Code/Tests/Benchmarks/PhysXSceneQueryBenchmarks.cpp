@@ -12,6 +12,7 @@
 #include <AzCore/Math/Random.h>
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
 #include <Tests/PhysXGenericTestFixture.h>
 #include <Tests/PhysXTestCommon.h>
@@ -40,6 +41,10 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        // {boxes, max radius, queries} for the benchmarks that run many queries per iteration
+        static const std::vector<int64_t> BatchBenchmarkSmall = {512, 32, 1000};
+        static const std::vector<int64_t> BatchBenchmarkLarge = {512, 32, 10000};
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -108,6 +113,22 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        //! Creates raycast requests towards the boxes, \state.range(2) is the number of requests.
+        AzPhysics::SceneQueryRequests CreateRaycastRequests(const ::benchmark::State& state)
+        {
+            AzPhysics::SceneQueryRequests requests;
+            requests.reserve(state.range(2));
+            for (int64_t i = 0; i < state.range(2); ++i)
+            {
+                auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3::CreateZero();
+                request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+                request->m_distance = 2000.0f;
+                requests.emplace_back(AZStd::move(request));
+            }
+            return requests;
+        }
+
         std::vector<EntityPtr> m_entities;
         std::vector<AZ::Vector3> m_boxes;
         AZ::u32 m_numBoxes = 0;
@@ -209,6 +230,78 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes_Serial)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequests(state);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            for (const auto& request : requests)
+            {
+                AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, request.get());
+                benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequests(state);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! Runs the batch and then a simulation step, the way a game frame would with blocking queries.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes_WithSimulation)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequests(state);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    //! Queues the batch and simulates until its callback is called, the queries overlap with the simulation.
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes_WithSimulation)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequests(state);
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AZ::u32 simulationSteps = 0;
+        for (auto _ : state)
+        {
+            bool completed = false;
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&completed](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    benchmark::DoNotOptimize(results);
+                    completed = true;
+                });
+            AZ_Assert(queued, "Failed to queue the asynchronous scene queries.");
+
+            while (queued && !completed)
+            {
+                TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+                ++simulationSteps;
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * requests.size());
+        state.counters["SimulationSteps"] = benchmark::Counter(aznumeric_cast<double>(simulationSteps), benchmark::Counter::kAvgIterations);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -233,5 +326,25 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes_Serial)
+        ->Args(SceneQueryConstants::BatchBenchmarkSmall)
+        ->Args(SceneQueryConstants::BatchBenchmarkLarge)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->Args(SceneQueryConstants::BatchBenchmarkSmall)
+        ->Args(SceneQueryConstants::BatchBenchmarkLarge)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes_WithSimulation)
+        ->Args(SceneQueryConstants::BatchBenchmarkSmall)
+        ->Args(SceneQueryConstants::BatchBenchmarkLarge)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes_WithSimulation)
+        ->Args(SceneQueryConstants::BatchBenchmarkSmall)
+        ->Args(SceneQueryConstants::BatchBenchmarkLarge)
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
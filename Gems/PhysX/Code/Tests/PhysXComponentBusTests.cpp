@@ -6,10 +6,12 @@
  *
  */
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Configuration/SystemConfiguration.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
 #include <AZTestShared/Utils/Utils.h>
 
 #include <Tests/PhysXGenericTestFixture.h>
@@ -286,6 +288,34 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysicsComponentBusTest, TransformWriteBack_FallingSphere_EntityUpdatedOncePerStep)
+    {
+        EntityPtr sphere = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 10.0f), 0.5f);
+
+        int transformChangedCount = 0;
+        AZ::Transform lastWorldTransform = AZ::Transform::CreateIdentity();
+        AZ::TransformChangedEvent::Handler transformChangedHandler(
+            [&transformChangedCount, &lastWorldTransform]([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
+            {
+                transformChangedCount++;
+                lastWorldTransform = world;
+            });
+        sphere->GetTransform()->BindTransformChangedEventHandler(transformChangedHandler);
+
+        const int numSteps = 10;
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, numSteps);
+
+        // the rotation and translation of a moving body are written back with a single transform change per step
+        EXPECT_EQ(transformChangedCount, numSteps);
+
+        AzPhysics::RigidBody* rigidBody = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(rigidBody, sphere->GetId(), &Physics::RigidBodyRequests::GetRigidBody);
+        ASSERT_NE(rigidBody, nullptr);
+        EXPECT_THAT(lastWorldTransform.GetTranslation(), UnitTest::IsClose(rigidBody->GetPosition()));
+        EXPECT_THAT(lastWorldTransform.GetRotation(), UnitTest::IsClose(rigidBody->GetOrientation()));
+        EXPECT_LT(lastWorldTransform.GetTranslation().GetZ(), 10.0f);
+    }
+
     TEST_F(PhysicsComponentBusTest, SetSleepThreshold_RollingSpheres_LowerThresholdSphereTravelsFurther)
     {
         EntityPtr sphereA = TestUtils::CreateSphereEntity(m_testSceneHandle, AZ::Vector3(0.0f, -5.0f, 1.0f), 0.5f);
@@ -940,6 +940,139 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_ManyRequests_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //create enough raycast requests for the batch to be split over jobs
+        constexpr size_t requestCount = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result from each request has the expected targeted simulated body
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits& requestResult = results[i];
+            ASSERT_EQ(requestResult.m_hits.size(), 1);
+            EXPECT_TRUE(requestResult.m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackCalledAfterSimulation_ReturnsExpectedHit)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle boxHandle = TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f));
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX();
+        request.m_distance = 200.0f;
+
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHits result;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 42, &request,
+            [&callbackCalled, &result](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(id, 42);
+                callbackCalled = true;
+                result = AZStd::move(hits);
+            });
+        ASSERT_TRUE(queued);
+
+        // the callback is only called when the scene finishes simulating
+        EXPECT_FALSE(callbackCalled);
+        for (int step = 0; step < 100 && !callbackCalled; ++step)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_TRUE(result.m_hits[0].m_bodyHandle == boxHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackCalledAfterSimulation_ReturnsExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddStaticBoxToScene(m_testSceneHandle, pos));
+        }
+
+        constexpr size_t requestCount = 300;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHitsList results;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 7, requests,
+            [&callbackCalled, &results](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHitsList hits)
+            {
+                EXPECT_EQ(id, 7);
+                callbackCalled = true;
+                results = AZStd::move(hits);
+            });
+        ASSERT_TRUE(queued);
+
+        for (int step = 0; step < 100 && !callbackCalled; ++step)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
     TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_MultipleHits_ReturnsExpectedHits)
     {
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
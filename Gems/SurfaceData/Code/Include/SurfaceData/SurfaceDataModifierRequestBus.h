@@ -32,6 +32,29 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Modifies many surface points with a single call. Only the masks of the points listed in pointIndices may be changed.
+        //! Modifiers that can process many points more efficiently than through a SurfacePointList should override this.
+        virtual void ModifySurfacePointsFromList(SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+        {
+            SurfacePointList surfacePointList;
+            surfacePointList.reserve(pointIndices.size());
+            for (size_t pointIndex : pointIndices)
+            {
+                SurfacePoint& point = surfacePointList.emplace_back();
+                point.m_entityId = surfacePoints.m_entityIds[pointIndex];
+                point.m_position = surfacePoints.m_positions[pointIndex];
+                point.m_normal = surfacePoints.m_normals[pointIndex];
+                point.m_masks = AZStd::move(surfacePoints.m_masks[pointIndex]);
+            }
+
+            ModifySurfacePoints(surfacePointList);
+
+            for (size_t listIndex = 0; listIndex < pointIndices.size(); ++listIndex)
+            {
+                surfacePoints.m_masks[pointIndices[listIndex]] = AZStd::move(surfacePointList[listIndex].m_masks);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
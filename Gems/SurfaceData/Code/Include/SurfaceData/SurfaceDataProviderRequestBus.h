@@ -31,6 +31,23 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Gets the surface points for a whole list of positions with a single call. Every point is appended to surfacePoints
+        //! together with the index of the position in inPositions that it belongs to, the input positions of surfacePoints aren't used.
+        //! Providers that can process many positions more efficiently than one at a time should override this.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+        {
+            SurfacePointList surfacePointList;
+            for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+            {
+                surfacePointList.clear();
+                GetSurfacePoints(inPositions[inputIndex], surfacePointList);
+                for (SurfacePoint& point : surfacePointList)
+                {
+                    surfacePoints.AddSurfacePoint(inputIndex, AZStd::move(point));
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
@@ -41,6 +41,30 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Same as GetSurfacePointsFromRegion, but the results are returned in flat arrays instead of one list per input position.
+        // The input positions are stored in row major order, and the points of every input position are grouped and sorted in decreasing Z order.
+        virtual void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                     SurfacePointBuffer& surfacePoints) const
+        {
+            SurfacePointListPerPosition surfacePointListPerPosition;
+            GetSurfacePointsFromRegion(inRegion, stepSize, desiredTags, surfacePointListPerPosition);
+
+            surfacePoints.Clear();
+            surfacePoints.m_inputPositions.reserve(surfacePointListPerPosition.size());
+            surfacePoints.m_pointOffsets.reserve(surfacePointListPerPosition.size() + 1);
+            for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+            {
+                const size_t inputIndex = surfacePoints.m_inputPositions.size();
+                surfacePoints.m_inputPositions.push_back(surfacePointListAndPoint.first);
+                surfacePoints.m_pointOffsets.push_back(surfacePoints.GetPointCount());
+                for (SurfacePoint& point : surfacePointListAndPoint.second)
+                {
+                    surfacePoints.AddSurfacePoint(inputIndex, AZStd::move(point));
+                }
+            }
+            surfacePoints.m_pointOffsets.push_back(surfacePoints.GetPointCount());
+        }
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
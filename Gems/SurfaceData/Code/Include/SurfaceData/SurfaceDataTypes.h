@@ -13,6 +13,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <SurfaceData/SurfaceTag.h>
 
 namespace SurfaceData
@@ -36,6 +37,99 @@ namespace SurfaceData
     using SurfacePointList = AZStd::vector<SurfacePoint>;
     using SurfacePointListPerPosition = AZStd::vector<AZStd::pair<AZ::Vector3, SurfacePointList>>;
 
+    //! Surface points for a list of input positions, stored as one flat array per point attribute instead of one SurfacePointList
+    //! per input position.
+    //! Every point stores the index of the input position it was generated for. Points are appended in any order by surface
+    //! providers, once the points are grouped the points of input position i are in [m_pointOffsets[i], m_pointOffsets[i + 1]).
+    struct SurfacePointBuffer final
+    {
+        AZ_CLASS_ALLOCATOR(SurfacePointBuffer, AZ::SystemAllocator, 0);
+
+        //! Removes all input positions and points, the memory is kept for reuse.
+        void Clear()
+        {
+            m_inputPositions.clear();
+            m_pointOffsets.clear();
+            ClearPoints();
+        }
+
+        //! Removes all points but keeps the input positions.
+        void ClearPoints()
+        {
+            m_inputIndices.clear();
+            m_entityIds.clear();
+            m_positions.clear();
+            m_normals.clear();
+            m_masks.clear();
+        }
+
+        void ReservePoints(size_t pointCount)
+        {
+            m_inputIndices.reserve(pointCount);
+            m_entityIds.reserve(pointCount);
+            m_positions.reserve(pointCount);
+            m_normals.reserve(pointCount);
+            m_masks.reserve(pointCount);
+        }
+
+        void AddSurfacePoint(size_t inputIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal, SurfaceTagWeightMap&& masks)
+        {
+            m_inputIndices.push_back(inputIndex);
+            m_entityIds.push_back(entityId);
+            m_positions.push_back(position);
+            m_normals.push_back(normal);
+            m_masks.push_back(AZStd::move(masks));
+        }
+
+        void AddSurfacePoint(size_t inputIndex, SurfacePoint&& point)
+        {
+            AddSurfacePoint(inputIndex, point.m_entityId, point.m_position, point.m_normal, AZStd::move(point.m_masks));
+        }
+
+        size_t GetInputPositionCount() const
+        {
+            return m_inputPositions.size();
+        }
+
+        size_t GetPointCount() const
+        {
+            return m_positions.size();
+        }
+
+        //! Number of points for one input position, only valid once the points are grouped.
+        size_t GetPointCount(size_t inputIndex) const
+        {
+            return m_pointOffsets[inputIndex + 1] - m_pointOffsets[inputIndex];
+        }
+
+        //! Copies the points of one input position into an array of structures, only valid once the points are grouped.
+        void GetSurfacePointList(size_t inputIndex, SurfacePointList& surfacePointList) const
+        {
+            surfacePointList.clear();
+            surfacePointList.reserve(GetPointCount(inputIndex));
+            for (size_t pointIndex = m_pointOffsets[inputIndex]; pointIndex < m_pointOffsets[inputIndex + 1]; ++pointIndex)
+            {
+                SurfacePoint& point = surfacePointList.emplace_back();
+                point.m_entityId = m_entityIds[pointIndex];
+                point.m_position = m_positions[pointIndex];
+                point.m_normal = m_normals[pointIndex];
+                point.m_masks = m_masks[pointIndex];
+            }
+        }
+
+        // Per input position
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+        //! Index of the first point of every input position, followed by the total point count. Empty until the points are grouped.
+        AZStd::vector<size_t> m_pointOffsets;
+
+        // Per point
+        AZStd::vector<size_t> m_inputIndices;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<SurfaceTagWeightMap> m_masks;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
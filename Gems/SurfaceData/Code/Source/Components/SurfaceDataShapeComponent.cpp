@@ -166,6 +166,34 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            // Look up the shape once for the whole list instead of dispatching a shape request per position
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(GetEntityId(), [this, &inPositions, &surfacePoints](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+                for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+                {
+                    const AZ::Vector3 rayOrigin = AZ::Vector3(inPositions[inputIndex].GetX(), inPositions[inputIndex].GetY(), m_shapeBounds.GetMax().GetZ());
+                    float intersectionDistance = 0.0f;
+                    if (shape->IntersectRay(rayOrigin, rayDirection, intersectionDistance))
+                    {
+                        SurfaceTagWeightMap masks;
+                        AddMaxValueForMasks(masks, m_configuration.m_providerTags, 1.0f);
+                        surfacePoints.AddSurfacePoint(inputIndex, GetEntityId(), rayOrigin + intersectionDistance * rayDirection, AZ::Vector3::CreateAxisZ(), AZStd::move(masks));
+                    }
+                }
+                return false;
+            });
+        }
+    }
+
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -190,6 +218,30 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::ModifySurfacePointsFromList(SurfacePointBuffer& surfacePoints, const AZStd::vector<size_t>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(entityId, [this, &entityId, &surfacePoints, &pointIndices](LmbrCentral::ShapeComponentRequests* shape)
+            {
+                for (size_t pointIndex : pointIndices)
+                {
+                    const AZ::Vector3& position = surfacePoints.m_positions[pointIndex];
+                    if (surfacePoints.m_entityIds[pointIndex] != entityId && m_shapeBounds.Contains(position) && shape->IsPointInside(position))
+                    {
+                        AddMaxValueForMasks(surfacePoints.m_masks[pointIndex], m_configuration.m_modifierTags, 1.0f);
+                    }
+                }
+                return false;
+            });
+        }
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
@@ -7,6 +7,10 @@
  */
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -23,6 +27,39 @@
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // Smallest number of surface points worth combining and filtering in a separate job
+        constexpr size_t MinSurfacePointsPerJob = 1024;
+
+        void SwapSurfacePoints(SurfacePointBuffer& surfacePoints, size_t pointIndexA, size_t pointIndexB)
+        {
+            AZStd::swap(surfacePoints.m_inputIndices[pointIndexA], surfacePoints.m_inputIndices[pointIndexB]);
+            AZStd::swap(surfacePoints.m_entityIds[pointIndexA], surfacePoints.m_entityIds[pointIndexB]);
+            AZStd::swap(surfacePoints.m_positions[pointIndexA], surfacePoints.m_positions[pointIndexB]);
+            AZStd::swap(surfacePoints.m_normals[pointIndexA], surfacePoints.m_normals[pointIndexB]);
+            AZStd::swap(surfacePoints.m_masks[pointIndexA], surfacePoints.m_masks[pointIndexB]);
+        }
+
+        void MoveSurfacePoint(SurfacePointBuffer& surfacePoints, size_t sourcePointIndex, size_t targetPointIndex)
+        {
+            surfacePoints.m_inputIndices[targetPointIndex] = surfacePoints.m_inputIndices[sourcePointIndex];
+            surfacePoints.m_entityIds[targetPointIndex] = surfacePoints.m_entityIds[sourcePointIndex];
+            surfacePoints.m_positions[targetPointIndex] = surfacePoints.m_positions[sourcePointIndex];
+            surfacePoints.m_normals[targetPointIndex] = surfacePoints.m_normals[sourcePointIndex];
+            surfacePoints.m_masks[targetPointIndex] = AZStd::move(surfacePoints.m_masks[sourcePointIndex]);
+        }
+
+        void EraseSurfacePoints(SurfacePointBuffer& surfacePoints, size_t firstPointIndex)
+        {
+            surfacePoints.m_inputIndices.erase(surfacePoints.m_inputIndices.begin() + firstPointIndex, surfacePoints.m_inputIndices.end());
+            surfacePoints.m_entityIds.erase(surfacePoints.m_entityIds.begin() + firstPointIndex, surfacePoints.m_entityIds.end());
+            surfacePoints.m_positions.erase(surfacePoints.m_positions.begin() + firstPointIndex, surfacePoints.m_positions.end());
+            surfacePoints.m_normals.erase(surfacePoints.m_normals.begin() + firstPointIndex, surfacePoints.m_normals.end());
+            surfacePoints.m_masks.erase(surfacePoints.m_masks.begin() + firstPointIndex, surfacePoints.m_masks.end());
+        }
+    }
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -231,27 +268,70 @@ namespace SurfaceData
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        SurfacePointBuffer surfacePoints;
+        GetSurfacePointBufferFromRegion(inRegion, stepSize, desiredTags, surfacePoints);
 
         surfacePointListPerPosition.clear();
-        surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+        surfacePointListPerPosition.reserve(surfacePoints.GetInputPositionCount());
+        for (size_t inputIndex = 0; inputIndex < surfacePoints.GetInputPositionCount(); ++inputIndex)
+        {
+            SurfacePointList& surfacePointList =
+                surfacePointListPerPosition.emplace_back(surfacePoints.m_inputPositions[inputIndex], SurfacePointList{}).second;
+            surfacePointList.reserve(surfacePoints.GetPointCount(inputIndex));
+            for (size_t pointIndex = surfacePoints.m_pointOffsets[inputIndex]; pointIndex < surfacePoints.m_pointOffsets[inputIndex + 1]; ++pointIndex)
+            {
+                SurfacePoint& point = surfacePointList.emplace_back();
+                point.m_entityId = surfacePoints.m_entityIds[pointIndex];
+                point.m_position = surfacePoints.m_positions[pointIndex];
+                point.m_normal = surfacePoints.m_normals[pointIndex];
+                point.m_masks = AZStd::move(surfacePoints.m_masks[pointIndex]);
+            }
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        surfacePoints.Clear();
+        surfacePoints.m_inputPositions.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
 
-        // Initialize our list-per-position list with every input position to query from the region.
+        // Initialize the input positions with every position to query from the region, in row major order.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
+        size_t rowLength = 0;
+        for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+        {
+            ++rowLength;
+        }
         for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
         {
             for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                surfacePoints.m_inputPositions.emplace_back(x, y, AZ::Constants::FloatMax);
             }
         }
 
+        const size_t inputCount = surfacePoints.GetInputPositionCount();
+        if (inputCount == 0)
+        {
+            surfacePoints.m_pointOffsets.push_back(0);
+            return;
+        }
+
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
-        // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // Loop through each data provider, and query all the points for each one with a single call.  This allows us to check the tags
+        // and the overall AABB bounds just once per provider, and lets providers process the whole list of positions at once.
+        // Providers append their points in any order, so the points are gathered here and grouped per input position afterwards.
+        SurfacePointBuffer gatheredPoints;
+        SurfacePointBuffer providerPoints;
+        AZStd::vector<AZ::Vector3> providerPositions;
+        AZStd::vector<size_t> providerInputIndices;
+        providerPositions.reserve(inputCount);
+        providerInputIndices.reserve(inputCount);
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -261,24 +341,71 @@ namespace SurfaceData
                 ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                providerPositions.clear();
+                providerInputIndices.clear();
+                for (size_t inputIndex = 0; inputIndex < inputCount; ++inputIndex)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                    if (alwaysApplies || entry.m_bounds.Contains(point3d))
+                    const AZ::Vector3& point2d = surfacePoints.m_inputPositions[inputIndex];
+                    if (alwaysApplies || AabbContains2D(entry.m_bounds, point2d))
+                    {
+                        providerPositions.emplace_back(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
+                        providerInputIndices.push_back(inputIndex);
+                    }
+                }
+
+                if (!providerPositions.empty())
+                {
+                    providerPoints.ClearPoints();
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, providerPositions, providerPoints);
+
+                    gatheredPoints.ReservePoints(gatheredPoints.GetPointCount() + providerPoints.GetPointCount());
+                    for (size_t pointIndex = 0; pointIndex < providerPoints.GetPointCount(); ++pointIndex)
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        gatheredPoints.AddSurfacePoint(providerInputIndices[providerPoints.m_inputIndices[pointIndex]],
+                            providerPoints.m_entityIds[pointIndex], providerPoints.m_positions[pointIndex], providerPoints.m_normals[pointIndex],
+                            AZStd::move(providerPoints.m_masks[pointIndex]));
                     }
                 }
             }
         }
 
+        // Group the points by input position with a counting sort, which keeps the order the providers added the points in.
+        AZStd::vector<size_t>& pointOffsets = surfacePoints.m_pointOffsets;
+        pointOffsets.resize(inputCount + 1, 0);
+        for (size_t inputIndex : gatheredPoints.m_inputIndices)
+        {
+            ++pointOffsets[inputIndex + 1];
+        }
+        for (size_t inputIndex = 1; inputIndex <= inputCount; ++inputIndex)
+        {
+            pointOffsets[inputIndex] += pointOffsets[inputIndex - 1];
+        }
+
+        const size_t gatheredPointCount = gatheredPoints.GetPointCount();
+        AZStd::vector<size_t> sourcePointIndices(gatheredPointCount);
+        {
+            AZStd::vector<size_t> nextPointIndex(pointOffsets.begin(), pointOffsets.end() - 1);
+            for (size_t pointIndex = 0; pointIndex < gatheredPointCount; ++pointIndex)
+            {
+                sourcePointIndices[nextPointIndex[gatheredPoints.m_inputIndices[pointIndex]]++] = pointIndex;
+            }
+        }
+
+        surfacePoints.ReservePoints(gatheredPointCount);
+        for (size_t sourcePointIndex : sourcePointIndices)
+        {
+            surfacePoints.AddSurfacePoint(gatheredPoints.m_inputIndices[sourcePointIndex], gatheredPoints.m_entityIds[sourcePointIndex],
+                gatheredPoints.m_positions[sourcePointIndex], gatheredPoints.m_normals[sourcePointIndex],
+                AZStd::move(gatheredPoints.m_masks[sourcePointIndex]));
+        }
+
         // Once we have our list of surface points created, run through the list of surface data modifiers to potentially add
         // surface tags / values onto each point.  The difference between this and the above loop is that surface data *providers*
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
+        AZStd::vector<size_t> modifierPointIndices;
+        modifierPointIndices.reserve(gatheredPointCount);
         for (const auto& entryPair : m_registeredSurfaceDataModifiers)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -286,19 +413,23 @@ namespace SurfaceData
 
             if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                modifierPointIndices.clear();
+                for (size_t inputIndex = 0; inputIndex < inputCount; ++inputIndex)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    if (pointOffsets[inputIndex] != pointOffsets[inputIndex + 1] &&
+                        (alwaysApplies || AabbContains2D(entry.m_bounds, surfacePoints.m_inputPositions[inputIndex])))
                     {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                        if (alwaysApplies || entry.m_bounds.Contains(point3d))
+                        for (size_t pointIndex = pointOffsets[inputIndex]; pointIndex < pointOffsets[inputIndex + 1]; ++pointIndex)
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            modifierPointIndices.push_back(pointIndex);
                         }
                     }
                 }
+
+                if (!modifierPointIndices.empty())
+                {
+                    SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsFromList, surfacePoints, modifierPointIndices);
+                }
             }
         }
 
@@ -306,14 +437,110 @@ namespace SurfaceData
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
         // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+        // The rows of the region don't share any points, so they are spread over multiple jobs. Jobs are only used from regular threads,
+        // a query issued from within a job processes all the rows inline.
+        AZStd::vector<size_t> pointCounts(inputCount, 0);
+        const size_t rowCount = inputCount / rowLength;
+        const size_t rowsPerJob = AZStd::max<size_t>(MinSurfacePointsPerJob / rowLength, 1);
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (rowCount > rowsPerJob && gatheredPointCount >= MinSurfacePointsPerJob && jobContext != nullptr &&
+            jobContext->GetJobManager().GetCurrentJob() == nullptr)
+        {
+            AZ::JobCompletion jobCompletion(jobContext);
+            for (size_t firstRow = 0; firstRow < rowCount; firstRow += rowsPerJob)
+            {
+                const size_t inputBegin = firstRow * rowLength;
+                const size_t inputEnd = AZStd::min(firstRow + rowsPerJob, rowCount) * rowLength;
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&surfacePoints, inputBegin, inputEnd, hasDesiredTags, &desiredTags, &pointCounts]()
+                    {
+                        CombineSortAndFilterNeighboringPoints(surfacePoints, inputBegin, inputEnd, hasDesiredTags, desiredTags, pointCounts);
+                    },
+                    true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            CombineSortAndFilterNeighboringPoints(surfacePoints, 0, inputCount, hasDesiredTags, desiredTags, pointCounts);
+        }
+
+        // Close the gaps left by the points that were combined or filtered out.
+        size_t targetPointIndex = 0;
+        for (size_t inputIndex = 0; inputIndex < inputCount; ++inputIndex)
         {
-            auto& surfacePointList = surfacePointListAndPoint.second;
-            if (!surfacePointList.empty())
+            const size_t sourcePointBegin = pointOffsets[inputIndex];
+            pointOffsets[inputIndex] = targetPointIndex;
+            for (size_t pointIndex = sourcePointBegin; pointIndex < sourcePointBegin + pointCounts[inputIndex]; ++pointIndex)
             {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
+                if (pointIndex != targetPointIndex)
+                {
+                    MoveSurfacePoint(surfacePoints, pointIndex, targetPointIndex);
+                }
+                ++targetPointIndex;
             }
         }
+        pointOffsets[inputCount] = targetPointIndex;
+        EraseSurfacePoints(surfacePoints, targetPointIndex);
+    }
+
+    void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointBuffer& surfacePoints, size_t inputBegin, size_t inputEnd,
+        bool hasDesiredTags, const SurfaceTagVector& desiredTags, AZStd::vector<size_t>& pointCounts)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        for (size_t inputIndex = inputBegin; inputIndex < inputEnd; ++inputIndex)
+        {
+            const size_t pointBegin = surfacePoints.m_pointOffsets[inputIndex];
+            const size_t pointEnd = surfacePoints.m_pointOffsets[inputIndex + 1];
+
+            //sort by depth/distance before combining points
+            //positions rarely have more than a few points, so the attributes are insertion sorted in place instead of sorting an index list
+            for (size_t sortIndex = pointBegin + 1; sortIndex < pointEnd; ++sortIndex)
+            {
+                for (size_t pointIndex = sortIndex;
+                     pointIndex > pointBegin && surfacePoints.m_positions[pointIndex - 1].GetZ() < surfacePoints.m_positions[pointIndex].GetZ();
+                     --pointIndex)
+                {
+                    SwapSurfacePoints(surfacePoints, pointIndex - 1, pointIndex);
+                }
+            }
+
+            //efficient point consolidation requires the points to be pre-sorted so we are only comparing/combining neighbors
+            size_t targetPointEnd = pointBegin;
+            for (size_t sourcePointIndex = pointBegin; sourcePointIndex < pointEnd; ++sourcePointIndex)
+            {
+                if (hasDesiredTags && !HasMatchingTags(surfacePoints.m_masks[sourcePointIndex], desiredTags))
+                {
+                    continue;
+                }
+
+                if (targetPointEnd != pointBegin)
+                {
+                    const size_t targetPointIndex = targetPointEnd - 1;
+
+                    // [LY-90907] need to add a configurable tolerance for comparison
+                    if (surfacePoints.m_positions[targetPointIndex].IsClose(surfacePoints.m_positions[sourcePointIndex]) &&
+                        surfacePoints.m_normals[targetPointIndex].IsClose(surfacePoints.m_normals[sourcePointIndex]))
+                    {
+                        //consolidate points with similar attributes by adding masks to the target point and ignoring the source
+                        AddMaxValueForMasks(surfacePoints.m_masks[targetPointIndex], surfacePoints.m_masks[sourcePointIndex]);
+                        continue;
+                    }
+                }
+
+                //if the points were too different, we have to add a new target point to compare against
+                if (sourcePointIndex != targetPointEnd)
+                {
+                    MoveSurfacePoint(surfacePoints, sourcePointIndex, targetPointEnd);
+                }
+                ++targetPointEnd;
+            }
+
+            pointCounts[inputIndex] = targetPointEnd - pointBegin;
+        }
     }
 
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <SurfaceDataSystemComponent.h>
+#include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <SurfaceData/SurfaceDataProviderRequestBus.h>
+#include <SurfaceData/Utility/SurfaceDataUtility.h>
+
+namespace UnitTest
+{
+    // Procedural surface provider or modifier, so that the benchmark only measures the surface data system and not the surfaces.
+    // Providers create one point per position at a height computed from the position, modifiers add their tags to every point below
+    // a given height. Neither overrides the list methods, like most existing providers and modifiers.
+    class BenchmarkSurface
+        : private SurfaceData::SurfaceDataProviderRequestBus::Handler
+        , private SurfaceData::SurfaceDataModifierRequestBus::Handler
+    {
+    public:
+        BenchmarkSurface(bool isProvider, const AZ::Aabb& bounds, AZ::Crc32 tag, float baseHeight, AZ::EntityId entityId)
+            : m_isProvider(isProvider)
+            , m_baseHeight(baseHeight)
+            , m_entityId(entityId)
+        {
+            SurfaceData::SurfaceDataRegistryEntry registryEntry;
+            registryEntry.m_entityId = m_entityId;
+            registryEntry.m_bounds = bounds;
+            registryEntry.m_tags.push_back(SurfaceData::SurfaceTag(tag));
+            m_tags = registryEntry.m_tags;
+
+            if (m_isProvider)
+            {
+                SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(m_handle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataProvider, registryEntry);
+                SurfaceData::SurfaceDataProviderRequestBus::Handler::BusConnect(m_handle);
+            }
+            else
+            {
+                SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(m_handle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataModifier, registryEntry);
+                SurfaceData::SurfaceDataModifierRequestBus::Handler::BusConnect(m_handle);
+            }
+        }
+
+        ~BenchmarkSurface()
+        {
+            if (m_isProvider)
+            {
+                SurfaceData::SurfaceDataProviderRequestBus::Handler::BusDisconnect();
+                SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataProvider, m_handle);
+            }
+            else
+            {
+                SurfaceData::SurfaceDataModifierRequestBus::Handler::BusDisconnect();
+                SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataModifier, m_handle);
+            }
+        }
+
+    private:
+        float GetHeight(float x, float y) const
+        {
+            return m_baseHeight + (8.0f * sinf(x * 0.05f) * cosf(y * 0.05f));
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // SurfaceDataProviderRequestBus
+        void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            SurfaceData::SurfacePoint point;
+            point.m_entityId = m_entityId;
+            point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), GetHeight(inPosition.GetX(), inPosition.GetY()));
+            point.m_normal = AZ::Vector3::CreateAxisZ();
+            SurfaceData::AddMaxValueForMasks(point.m_masks, m_tags, 1.0f);
+            surfacePointList.push_back(point);
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // SurfaceDataModifierRequestBus
+        void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            for (auto& point : surfacePointList)
+            {
+                if (point.m_position.GetZ() < m_baseHeight)
+                {
+                    SurfaceData::AddMaxValueForMasks(point.m_masks, m_tags, 1.0f);
+                }
+            }
+        }
+
+        SurfaceData::SurfaceTagVector m_tags;
+        SurfaceData::SurfaceDataRegistryHandle m_handle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+        bool m_isProvider = true;
+        float m_baseHeight = 0.0f;
+        AZ::EntityId m_entityId;
+    };
+
+    // Queries a square region of a scene set up like a typical vegetation level: terrain covering the whole region, two overlapping
+    // meshes that each cover a part of it, and a water volume that marks the points below the water level.
+    // Compares querying every position separately, the per position list API and the flat buffer API.
+    class SurfaceDataBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        using ::benchmark::Fixture::SetUp, ::benchmark::Fixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AZ::ComponentApplication::Descriptor appDesc;
+            appDesc.m_memoryBlocksByteSize = 256 * 1024 * 1024;
+            m_systemEntity = m_app.Create(appDesc);
+            m_app.RegisterComponentDescriptor(SurfaceData::SurfaceDataSystemComponent::CreateDescriptor());
+            m_systemEntity->CreateComponent<SurfaceData::SurfaceDataSystemComponent>();
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            const uint32_t workerCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u);
+            for (uint32_t i = 0; i < workerCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = aznew AZ::JobManager(jobManagerDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+
+            const float regionSize = aznumeric_cast<float>(state.range(0));
+            m_region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(regionSize));
+            const AZ::Aabb firstMeshBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(regionSize * 0.5f, regionSize, 64.0f));
+            const AZ::Aabb secondMeshBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(regionSize * 0.25f, 0.0f, 0.0f), AZ::Vector3(regionSize, regionSize * 0.75f, 64.0f));
+
+            m_surfaces.push_back(AZStd::make_unique<BenchmarkSurface>(true, AZ::Aabb::CreateNull(), AZ::Crc32("terrain"), 16.0f, AZ::EntityId(1)));
+            m_surfaces.push_back(AZStd::make_unique<BenchmarkSurface>(true, firstMeshBounds, AZ::Crc32("rock"), 32.0f, AZ::EntityId(2)));
+            m_surfaces.push_back(AZStd::make_unique<BenchmarkSurface>(true, secondMeshBounds, AZ::Crc32("cliff"), 48.0f, AZ::EntityId(3)));
+            m_surfaces.push_back(AZStd::make_unique<BenchmarkSurface>(false, AZ::Aabb::CreateNull(), AZ::Crc32("underwater"), 12.0f, AZ::EntityId(4)));
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            m_surfaces = {};
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            m_app.Destroy();
+            m_systemEntity = nullptr;
+        }
+
+    protected:
+        AZ::ComponentApplication m_app;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+
+        AZStd::vector<AZStd::unique_ptr<BenchmarkSurface>> m_surfaces;
+        AZ::Aabb m_region;
+        const AZ::Vector2 m_stepSize = AZ::Vector2(1.0f);
+    };
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmarkFixture, SurfacePointsPerPosition)(benchmark::State& state)
+    {
+        SurfaceData::SurfacePointList surfacePoints;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (float y = m_region.GetMin().GetY(); y < m_region.GetMax().GetY(); y += m_stepSize.GetY())
+            {
+                for (float x = m_region.GetMin().GetX(); x < m_region.GetMax().GetX(); x += m_stepSize.GetX())
+                {
+                    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints, AZ::Vector3(x, y, 0.0f),
+                        SurfaceData::SurfaceTagVector(), surfacePoints);
+                    benchmark::DoNotOptimize(surfacePoints.data());
+                }
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmarkFixture, SurfacePointsFromRegion)(benchmark::State& state)
+    {
+        SurfaceData::SurfacePointListPerPosition surfacePoints;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, m_region, m_stepSize,
+                SurfaceData::SurfaceTagVector(), surfacePoints);
+            benchmark::DoNotOptimize(surfacePoints.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmarkFixture, SurfacePointBufferFromRegion)(benchmark::State& state)
+    {
+        SurfaceData::SurfacePointBuffer surfacePoints;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+                &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion, m_region, m_stepSize,
+                SurfaceData::SurfaceTagVector(), surfacePoints);
+            benchmark::DoNotOptimize(surfacePoints.m_positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmarkFixture, SurfacePointsPerPosition)
+        ->Arg(64)->Arg(256)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmarkFixture, SurfacePointsFromRegion)
+        ->Arg(64)->Arg(256)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmarkFixture, SurfacePointBufferFromRegion)
+        ->Arg(64)->Arg(256)
+        ->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -743,4 +743,65 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_MatchesSurfacePointsFromRegion)
+{
+    // This test verifies that the flat buffer version of the region query returns the same points as the list per position version,
+    // grouped per input position and sorted in decreasing Z order.
+
+    // Create two mock Surface Providers with points at similar and dissimilar heights, and a Surface Modifier covering part of them.
+    SurfaceData::SurfaceTagVector provider1Tags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider1(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, provider1Tags,
+                                      AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f),
+                                      AZ::EntityId(0x11111111));
+
+    SurfaceData::SurfaceTagVector provider2Tags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockProvider2(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, provider2Tags,
+                                      AZ::Vector3(2.0f, 2.0f, 2.0f), AZ::Vector3(6.0f, 6.0f, 6.0f + (AZ::Constants::Tolerance / 2.0f)),
+                                      AZ::Vector3(0.25f, 0.25f, 2.0f + (AZ::Constants::Tolerance / 2.0f)),
+                                      AZ::EntityId(0x22222222));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurfaceNoMatchCrc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(4.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(8.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, testTags, availablePointsPerPosition);
+
+    SurfaceData::SurfacePointBuffer availablePoints;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, testTags, availablePoints);
+
+    ASSERT_EQ(availablePointsPerPosition.size(), availablePoints.GetInputPositionCount());
+    ASSERT_EQ(availablePoints.GetInputPositionCount() + 1, availablePoints.m_pointOffsets.size());
+    EXPECT_EQ(availablePoints.GetPointCount(), availablePoints.m_pointOffsets.back());
+
+    for (size_t inputIndex = 0; inputIndex < availablePoints.GetInputPositionCount(); ++inputIndex)
+    {
+        const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[inputIndex].second;
+        EXPECT_TRUE(availablePointsPerPosition[inputIndex].first.IsClose(availablePoints.m_inputPositions[inputIndex]));
+        ASSERT_EQ(pointList.size(), availablePoints.GetPointCount(inputIndex));
+
+        const size_t pointBegin = availablePoints.m_pointOffsets[inputIndex];
+        for (size_t listIndex = 0; listIndex < pointList.size(); ++listIndex)
+        {
+            const size_t pointIndex = pointBegin + listIndex;
+            EXPECT_EQ(inputIndex, availablePoints.m_inputIndices[pointIndex]);
+            EXPECT_EQ(pointList[listIndex].m_entityId, availablePoints.m_entityIds[pointIndex]);
+            EXPECT_TRUE(pointList[listIndex].m_position.IsClose(availablePoints.m_positions[pointIndex]));
+            EXPECT_EQ(pointList[listIndex].m_masks.size(), availablePoints.m_masks[pointIndex].size());
+            if (listIndex > 0)
+            {
+                EXPECT_GE(availablePoints.m_positions[pointIndex - 1].GetZ(), availablePoints.m_positions[pointIndex].GetZ());
+            }
+        }
+    }
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
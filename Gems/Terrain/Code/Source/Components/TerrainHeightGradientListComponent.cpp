@@ -172,6 +172,34 @@ namespace Terrain
         outPosition.SetZ(height);
     }
 
+    void TerrainHeightGradientListComponent::GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, [[maybe_unused]] Sampler sampleFilter)
+    {
+        // Same as GetHeight(x, y), but each gradient is sampled for all positions with a single request
+        AZStd::vector<AZ::Vector3> gradientPositions(inOutPositions.size());
+        for (size_t index = 0; index < inOutPositions.size(); ++index)
+        {
+            gradientPositions[index] = AZ::Vector3(inOutPositions[index].GetX(), inOutPositions[index].GetY(), 0.0f);
+        }
+
+        AZStd::vector<float> maxSamples(inOutPositions.size(), 0.0f);
+        AZStd::vector<float> samples(inOutPositions.size());
+        for (auto& gradientId : m_configuration.m_gradientEntities)
+        {
+            AZStd::fill(samples.begin(), samples.end(), 0.0f);
+            GradientSignal::GradientRequestBus::Event(gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, gradientPositions, samples);
+            for (size_t index = 0; index < samples.size(); ++index)
+            {
+                maxSamples[index] = AZ::GetMax(maxSamples[index], samples[index]);
+            }
+        }
+
+        for (size_t index = 0; index < inOutPositions.size(); ++index)
+        {
+            const float height = AZ::Lerp(m_cachedShapeBounds.GetMin().GetZ(), m_cachedShapeBounds.GetMax().GetZ(), maxSamples[index]);
+            inOutPositions[index].SetZ(AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight));
+        }
+    }
+
     void TerrainHeightGradientListComponent::GetNormal(
         const AZ::Vector3& inPosition, AZ::Vector3& outNormal, [[maybe_unused]] Sampler sampleFilter = Sampler::DEFAULT)
     {
@@ -66,6 +66,7 @@ namespace Terrain
 
         void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, Sampler sampleFilter) override;
         void GetNormal(const AZ::Vector3& inPosition, AZ::Vector3& outNormal, Sampler sampleFilter) override;
+        void GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, Sampler sampleFilter) override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
@@ -168,6 +168,55 @@ namespace Terrain
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        if (m_terrainBoundsIsValid)
+        {
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+
+                AZStd::vector<AZ::Vector3> positions;
+                AZStd::vector<size_t> inputIndices;
+                positions.reserve(inPositions.size());
+                inputIndices.reserve(inPositions.size());
+                for (size_t inputIndex = 0; inputIndex < inPositions.size(); ++inputIndex)
+                {
+                    if (terrainAabb.Contains(inPositions[inputIndex]))
+                    {
+                        positions.push_back(inPositions[inputIndex]);
+                        inputIndices.push_back(inputIndex);
+                    }
+                }
+
+                // Query the heights and normals of all the positions with one call each, instead of two terrain requests per position
+                AZStd::vector<float> heights(positions.size());
+                AZStd::vector<AZ::Vector3> normals(positions.size());
+                AZStd::vector<bool> terrainExists(positions.size());
+                terrain->GetHeights(positions, heights, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &terrainExists);
+                terrain->GetNormals(positions, normals);
+
+                surfacePoints.ReservePoints(surfacePoints.GetPointCount() + positions.size());
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    const bool isHole = !terrainExists[index];
+                    const AZ::Crc32 terrainTag =
+                        isHole ? SurfaceData::Constants::s_terrainHoleTagCrc : SurfaceData::Constants::s_terrainTagCrc;
+                    SurfaceData::SurfaceTagWeightMap masks;
+                    SurfaceData::AddMaxValueForMasks(masks, terrainTag, 1.0f);
+                    surfacePoints.AddSurfacePoint(inputIndices[index], GetEntityId(),
+                        AZ::Vector3(positions[index].GetX(), positions[index].GetY(), heights[index]), normals[index], AZStd::move(masks));
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainHeightCache.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace Terrain
+{
+    TerrainHeightCache::TerrainHeightCache(HeightQueryFunction heightQuery, size_t maxTiles)
+        : m_heightQuery(AZStd::move(heightQuery))
+        , m_maxTiles(maxTiles)
+    {
+        AZ_Assert(m_heightQuery, "TerrainHeightCache needs a height query function");
+        AZ_Assert(m_maxTiles > 0, "TerrainHeightCache needs to be able to hold at least one tile");
+    }
+
+    void TerrainHeightCache::SetGridResolution(const AZ::Vector2& gridResolution)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        if (gridResolution != m_gridResolution)
+        {
+            m_gridResolution = gridResolution;
+            ++m_generation;
+            m_tiles.clear();
+            m_tileOrder.clear();
+        }
+    }
+
+    AZ::Vector2 TerrainHeightCache::GetGridResolution() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return m_gridResolution;
+    }
+
+    void TerrainHeightCache::Invalidate(const AZ::Aabb& dirtyRegion)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        ++m_generation;
+
+        if (!dirtyRegion.IsValid())
+        {
+            m_tiles.clear();
+            m_tileOrder.clear();
+            return;
+        }
+
+        const float tileExtentX = TileSize * m_gridResolution.GetX();
+        const float tileExtentY = TileSize * m_gridResolution.GetY();
+        for (auto tileIt = m_tiles.begin(); tileIt != m_tiles.end();)
+        {
+            const int32_t tileX = static_cast<int32_t>(tileIt->first >> 32);
+            const int32_t tileY = static_cast<int32_t>(tileIt->first & 0xFFFFFFFF);
+            const float tileMinX = tileX * tileExtentX;
+            const float tileMinY = tileY * tileExtentY;
+
+            // Tiles include the grid points on their max edges, so a region touching those edges invalidates them as well
+            const bool overlaps = tileMinX <= dirtyRegion.GetMax().GetX() && tileMinX + tileExtentX >= dirtyRegion.GetMin().GetX() &&
+                tileMinY <= dirtyRegion.GetMax().GetY() && tileMinY + tileExtentY >= dirtyRegion.GetMin().GetY();
+            tileIt = overlaps ? m_tiles.erase(tileIt) : AZStd::next(tileIt);
+        }
+
+        // Drop the order entries of erased tiles once they make up most of the queue, so frequent small invalidations don't grow it
+        if (m_tileOrder.size() > 2 * m_tiles.size())
+        {
+            AZStd::deque<AZStd::pair<TileKey, uint64_t>> tileOrder;
+            for (const auto& [key, sequence] : m_tileOrder)
+            {
+                auto tileIt = m_tiles.find(key);
+                if (tileIt != m_tiles.end() && tileIt->second.m_sequence == sequence)
+                {
+                    tileOrder.emplace_back(key, sequence);
+                }
+            }
+            m_tileOrder = AZStd::move(tileOrder);
+        }
+    }
+
+    float TerrainHeightCache::GetClampedHeight(float x, float y) const
+    {
+        TileLookup lookup;
+        return SampleClamped(x, y, GetGridResolution(), lookup);
+    }
+
+    float TerrainHeightCache::GetBilinearHeight(float x, float y) const
+    {
+        TileLookup lookup;
+        return SampleBilinear(x, y, GetGridResolution(), lookup);
+    }
+
+    void TerrainHeightCache::GetClampedHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(inPositions.size() == outHeights.size(), "The output vector needs to be the same size as the input positions");
+
+        const AZ::Vector2 gridResolution = GetGridResolution();
+        TileLookup lookup;
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            outHeights[index] = SampleClamped(inPositions[index].GetX(), inPositions[index].GetY(), gridResolution, lookup);
+        }
+    }
+
+    void TerrainHeightCache::GetBilinearHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(inPositions.size() == outHeights.size(), "The output vector needs to be the same size as the input positions");
+
+        using Vec4 = AZ::Simd::Vec4;
+        static constexpr size_t LaneCount = Vec4::ElementCount;
+
+        const AZ::Vector2 gridResolution = GetGridResolution();
+        const Vec4::FloatType resolutionX = Vec4::Splat(gridResolution.GetX());
+        const Vec4::FloatType resolutionY = Vec4::Splat(gridResolution.GetY());
+        TileLookup lookup;
+
+        size_t index = 0;
+        for (; index + LaneCount <= inPositions.size(); index += LaneCount)
+        {
+            const AZ::Vector3* positions = &inPositions[index];
+            const Vec4::FloatType gridX = Vec4::Div(
+                Vec4::LoadImmediate(positions[0].GetX(), positions[1].GetX(), positions[2].GetX(), positions[3].GetX()), resolutionX);
+            const Vec4::FloatType gridY = Vec4::Div(
+                Vec4::LoadImmediate(positions[0].GetY(), positions[1].GetY(), positions[2].GetY(), positions[3].GetY()), resolutionY);
+            const Vec4::FloatType cellX = Vec4::Floor(gridX);
+            const Vec4::FloatType cellY = Vec4::Floor(gridY);
+
+            alignas(16) float cellXs[LaneCount];
+            alignas(16) float cellYs[LaneCount];
+            Vec4::StoreAligned(cellXs, cellX);
+            Vec4::StoreAligned(cellYs, cellY);
+
+            // Gathering the corners is scalar, the filtering below is done for all lanes at once
+            alignas(16) float heights00[LaneCount];
+            alignas(16) float heights10[LaneCount];
+            alignas(16) float heights01[LaneCount];
+            alignas(16) float heights11[LaneCount];
+            for (size_t lane = 0; lane < LaneCount; ++lane)
+            {
+                const float* corner = GetGridPoint(static_cast<int32_t>(cellXs[lane]), static_cast<int32_t>(cellYs[lane]), lookup);
+                heights00[lane] = corner[0];
+                heights10[lane] = corner[1];
+                heights01[lane] = corner[TileSampleCount];
+                heights11[lane] = corner[TileSampleCount + 1];
+            }
+
+            const Vec4::FloatType fractionX = Vec4::Sub(gridX, cellX);
+            const Vec4::FloatType fractionY = Vec4::Sub(gridY, cellY);
+            const Vec4::FloatType height00 = Vec4::LoadAligned(heights00);
+            const Vec4::FloatType height01 = Vec4::LoadAligned(heights01);
+            const Vec4::FloatType bottom = Vec4::Madd(Vec4::Sub(Vec4::LoadAligned(heights10), height00), fractionX, height00);
+            const Vec4::FloatType top = Vec4::Madd(Vec4::Sub(Vec4::LoadAligned(heights11), height01), fractionX, height01);
+            Vec4::StoreUnaligned(&outHeights[index], Vec4::Madd(Vec4::Sub(top, bottom), fractionY, bottom));
+        }
+
+        for (; index < inPositions.size(); ++index)
+        {
+            outHeights[index] = SampleBilinear(inPositions[index].GetX(), inPositions[index].GetY(), gridResolution, lookup);
+        }
+    }
+
+    size_t TerrainHeightCache::GetTileCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        return m_tiles.size();
+    }
+
+    TerrainHeightCache::TileKey TerrainHeightCache::MakeTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<TileKey>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+    }
+
+    int32_t TerrainHeightCache::GetTileIndex(int32_t gridIndex)
+    {
+        // Round towards negative infinity so tiles on both sides of the origin have the same size
+        return (gridIndex >= 0) ? (gridIndex / TileSize) : ((gridIndex - (TileSize - 1)) / TileSize);
+    }
+
+    const float* TerrainHeightCache::GetGridPoint(int32_t gridX, int32_t gridY, TileLookup& lookup) const
+    {
+        const int32_t tileX = GetTileIndex(gridX);
+        const int32_t tileY = GetTileIndex(gridY);
+        const TileKey key = MakeTileKey(tileX, tileY);
+        if (!lookup.m_tile || lookup.m_key != key)
+        {
+            lookup.m_tile = FindOrCreateTile(tileX, tileY);
+            lookup.m_key = key;
+        }
+
+        const int32_t localX = gridX - (tileX * TileSize);
+        const int32_t localY = gridY - (tileY * TileSize);
+        return lookup.m_tile->data() + (localY * TileSampleCount) + localX;
+    }
+
+    float TerrainHeightCache::SampleClamped(float x, float y, const AZ::Vector2& gridResolution, TileLookup& lookup) const
+    {
+        const int32_t gridX = static_cast<int32_t>(floorf((x / gridResolution.GetX()) + 0.5f));
+        const int32_t gridY = static_cast<int32_t>(floorf((y / gridResolution.GetY()) + 0.5f));
+        return *GetGridPoint(gridX, gridY, lookup);
+    }
+
+    float TerrainHeightCache::SampleBilinear(float x, float y, const AZ::Vector2& gridResolution, TileLookup& lookup) const
+    {
+        const float gridX = x / gridResolution.GetX();
+        const float gridY = y / gridResolution.GetY();
+        const float cellX = floorf(gridX);
+        const float cellY = floorf(gridY);
+        const float fractionX = gridX - cellX;
+        const float fractionY = gridY - cellY;
+
+        const float* corner = GetGridPoint(static_cast<int32_t>(cellX), static_cast<int32_t>(cellY), lookup);
+        const float bottom = ((corner[1] - corner[0]) * fractionX) + corner[0];
+        const float top = ((corner[TileSampleCount + 1] - corner[TileSampleCount]) * fractionX) + corner[TileSampleCount];
+        return ((top - bottom) * fractionY) + bottom;
+    }
+
+    AZStd::shared_ptr<const TerrainHeightCache::TileHeights> TerrainHeightCache::FindOrCreateTile(int32_t tileX, int32_t tileY) const
+    {
+        const TileKey key = MakeTileKey(tileX, tileY);
+        uint64_t generation = 0;
+        AZ::Vector2 gridResolution;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_tileMutex);
+            auto tileIt = m_tiles.find(key);
+            if (tileIt != m_tiles.end())
+            {
+                return tileIt->second.m_tile;
+            }
+            generation = m_generation;
+            gridResolution = m_gridResolution;
+        }
+
+        AZ_PROFILE_SCOPE(Entity, "TerrainHeightCache::FillTile");
+
+        // The tile is filled without holding the lock since the height query calls into the terrain areas
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(TileSampleCount * TileSampleCount);
+        for (int32_t localY = 0; localY < TileSampleCount; ++localY)
+        {
+            for (int32_t localX = 0; localX < TileSampleCount; ++localX)
+            {
+                positions.emplace_back(
+                    static_cast<float>((tileX * TileSize) + localX) * gridResolution.GetX(),
+                    static_cast<float>((tileY * TileSize) + localY) * gridResolution.GetY(), 0.0f);
+            }
+        }
+        m_heightQuery(positions);
+
+        auto tile = AZStd::make_shared<TileHeights>(positions.size());
+        TileHeights& heights = *tile;
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            heights[index] = positions[index].GetZ();
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_tileMutex);
+        if (generation != m_generation)
+        {
+            // The terrain changed while the tile was filled, it can answer the current query but may already be out of date
+            return tile;
+        }
+
+        auto [tileIt, inserted] = m_tiles.emplace(key, TileEntry{ tile, m_nextSequence });
+        if (!inserted)
+        {
+            // Another thread filled the same tile first
+            return tileIt->second.m_tile;
+        }
+        m_tileOrder.emplace_back(key, m_nextSequence++);
+
+        while (m_tiles.size() > m_maxTiles && !m_tileOrder.empty())
+        {
+            const auto [oldestKey, oldestSequence] = m_tileOrder.front();
+            m_tileOrder.pop_front();
+            auto oldestIt = m_tiles.find(oldestKey);
+            if (oldestIt != m_tiles.end() && oldestIt->second.m_sequence == oldestSequence)
+            {
+                m_tiles.erase(oldestIt);
+            }
+        }
+
+        return tile;
+    }
+} // namespace Terrain
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace Terrain
+{
+    //! Caches terrain heights at the points of the terrain sample grid in square tiles, so that clamped and bilinear height queries
+    //! don't need to query the terrain areas for every position.
+    //! Tiles are filled on demand and dropped when the region they cover is invalidated, or in the order they were created once the
+    //! cache holds more than the max number of tiles.
+    class TerrainHeightCache
+    {
+    public:
+        //! Number of grid cells along each side of a tile. Tiles store one extra row and column of grid points so that bilinear
+        //! filtering never needs a second tile.
+        static constexpr int32_t TileSize = 64;
+        static constexpr int32_t TileSampleCount = TileSize + 1;
+        static constexpr size_t DefaultMaxTiles = 256;
+
+        //! Sets the Z value of every position to the terrain height at its XY location.
+        using HeightQueryFunction = AZStd::function<void(AZStd::vector<AZ::Vector3>& inOutPositions)>;
+
+        explicit TerrainHeightCache(HeightQueryFunction heightQuery, size_t maxTiles = DefaultMaxTiles);
+
+        //! Sets the spacing of the grid points, the grid is aligned to the world origin. All tiles are dropped if the resolution changes.
+        void SetGridResolution(const AZ::Vector2& gridResolution);
+        AZ::Vector2 GetGridResolution() const;
+
+        //! Drops all tiles overlapping the region on the XY plane. A null region drops all tiles.
+        void Invalidate(const AZ::Aabb& dirtyRegion);
+
+        //! Returns the height of the grid point closest to x,y.
+        float GetClampedHeight(float x, float y) const;
+        //! Returns the height at x,y bilinear filtered between the four surrounding grid points.
+        float GetBilinearHeight(float x, float y) const;
+
+        //! Batched versions of the above, outHeights needs to be the same size as inPositions.
+        //! The bilinear version filters four positions at a time with SIMD.
+        void GetClampedHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights) const;
+        void GetBilinearHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights) const;
+
+        size_t GetTileCount() const;
+
+    private:
+        using TileHeights = AZStd::vector<float>;
+        using TileKey = uint64_t;
+
+        //! Remembers the last tile that was looked up, consecutive positions usually fall in the same tile.
+        struct TileLookup
+        {
+            TileKey m_key = 0;
+            AZStd::shared_ptr<const TileHeights> m_tile;
+        };
+
+        struct TileEntry
+        {
+            AZStd::shared_ptr<const TileHeights> m_tile;
+            uint64_t m_sequence = 0;
+        };
+
+        static TileKey MakeTileKey(int32_t tileX, int32_t tileY);
+        static int32_t GetTileIndex(int32_t gridIndex);
+
+        //! Returns the height of the grid point, filling its tile if it isn't cached. The heights of the grid points at +1 along x
+        //! and/or y follow at offsets 1, TileSampleCount and TileSampleCount + 1, they stay valid as long as the lookup holds the tile.
+        const float* GetGridPoint(int32_t gridX, int32_t gridY, TileLookup& lookup) const;
+        float SampleClamped(float x, float y, const AZ::Vector2& gridResolution, TileLookup& lookup) const;
+        float SampleBilinear(float x, float y, const AZ::Vector2& gridResolution, TileLookup& lookup) const;
+        AZStd::shared_ptr<const TileHeights> FindOrCreateTile(int32_t tileX, int32_t tileY) const;
+
+        HeightQueryFunction m_heightQuery;
+        const size_t m_maxTiles;
+
+        mutable AZStd::shared_mutex m_tileMutex;
+        AZ::Vector2 m_gridResolution{ 1.0f };
+        mutable AZStd::unordered_map<TileKey, TileEntry> m_tiles;
+        //! Tile keys in the order the tiles were created, entries for tiles that were invalidated are skipped by their sequence number.
+        mutable AZStd::deque<AZStd::pair<TileKey, uint64_t>> m_tileOrder;
+        mutable uint64_t m_nextSequence = 0;
+        //! Incremented on every invalidation so tiles filled while the data changed aren't added to the cache.
+        uint64_t m_generation = 0;
+    };
+} // namespace Terrain
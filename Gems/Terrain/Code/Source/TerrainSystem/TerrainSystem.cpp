@@ -18,6 +18,7 @@
 using namespace Terrain;
 
 TerrainSystem::TerrainSystem()
+    : m_heightCache([this](AZStd::vector<AZ::Vector3>& inOutPositions) { GetHeightsSynchronous(inOutPositions); })
 {
     Terrain::TerrainSystemServiceRequestBus::Handler::BusConnect();
     AZ::TickBus::Handler::BusConnect();
@@ -109,25 +110,119 @@ float TerrainSystem::GetHeightSynchronous(float x, float y) const
         outPosition.GetZ(), m_currentSettings.m_worldBounds.GetMin().GetZ(), m_currentSettings.m_worldBounds.GetMax().GetZ());
 }
 
-float TerrainSystem::GetHeight(AZ::Vector3 position, [[maybe_unused]] Sampler sampler, [[maybe_unused]] bool* terrainExistsPtr) const
+void TerrainSystem::GetHeightsSynchronous(AZStd::vector<AZ::Vector3>& inOutPositions) const
+{
+    const float worldMinZ = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    const float worldMaxZ = m_currentSettings.m_worldBounds.GetMax().GetZ();
+    for (AZ::Vector3& position : inOutPositions)
+    {
+        position.SetZ(worldMinZ);
+    }
+
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    // Same as GetHeightSynchronous, but each area is queried once for all the positions it contains
+    AZStd::vector<size_t> areaIndices;
+    AZStd::vector<AZ::Vector3> areaPositions;
+    for (auto& [areaId, areaBounds] : m_registeredAreas)
+    {
+        areaIndices.clear();
+        areaPositions.clear();
+        for (size_t index = 0; index < inOutPositions.size(); ++index)
+        {
+            const AZ::Vector3 inPosition(inOutPositions[index].GetX(), inOutPositions[index].GetY(), areaBounds.GetMin().GetZ());
+            if (areaBounds.Contains(inPosition))
+            {
+                areaIndices.push_back(index);
+                areaPositions.push_back(inPosition);
+            }
+        }
+
+        if (!areaPositions.empty())
+        {
+            Terrain::TerrainAreaHeightRequestBus::Event(
+                areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, areaPositions,
+                Terrain::TerrainAreaHeightRequestBus::Events::Sampler::DEFAULT);
+
+            for (size_t areaIndex = 0; areaIndex < areaIndices.size(); ++areaIndex)
+            {
+                inOutPositions[areaIndices[areaIndex]].SetZ(areaPositions[areaIndex].GetZ());
+            }
+        }
+    }
+
+    for (AZ::Vector3& position : inOutPositions)
+    {
+        position.SetZ(AZ::GetClamp(position.GetZ(), worldMinZ, worldMaxZ));
+    }
+}
+
+float TerrainSystem::GetSampledHeight(float x, float y, Sampler sampler) const
+{
+    switch (sampler)
+    {
+    case Sampler::EXACT:
+        return GetHeightSynchronous(x, y);
+    case Sampler::CLAMP:
+        return m_heightCache.GetClampedHeight(x, y);
+    case Sampler::BILINEAR:
+    default:
+        return m_heightCache.GetBilinearHeight(x, y);
+    }
+}
+
+float TerrainSystem::GetHeight(AZ::Vector3 position, Sampler sampler, [[maybe_unused]] bool* terrainExistsPtr) const
 {
     if (terrainExistsPtr)
     {
         *terrainExistsPtr = true;
     }
 
-    return GetHeightSynchronous(position.GetX(), position.GetY());
+    return GetSampledHeight(position.GetX(), position.GetY(), sampler);
 }
 
 float TerrainSystem::GetHeightFromFloats(
-    float x, float y, [[maybe_unused]] Sampler sampler, [[maybe_unused]] bool* terrainExistsPtr) const
+    float x, float y, Sampler sampler, [[maybe_unused]] bool* terrainExistsPtr) const
 {
     if (terrainExistsPtr)
     {
         *terrainExistsPtr = true;
     }
 
-    return GetHeightSynchronous(x, y);
+    return GetSampledHeight(x, y, sampler);
+}
+
+void TerrainSystem::GetHeights(
+    const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights, Sampler sampler,
+    AZStd::vector<bool>* terrainExists) const
+{
+    AZ_Assert(inPositions.size() == outHeights.size(), "The output vector needs to be the same size as the input positions");
+
+    if (terrainExists)
+    {
+        AZStd::fill(terrainExists->begin(), terrainExists->end(), true);
+    }
+
+    switch (sampler)
+    {
+    case Sampler::EXACT:
+    {
+        AZStd::vector<AZ::Vector3> positions(inPositions);
+        GetHeightsSynchronous(positions);
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outHeights[index] = positions[index].GetZ();
+        }
+        break;
+    }
+    case Sampler::CLAMP:
+        m_heightCache.GetClampedHeights(inPositions, outHeights);
+        break;
+    case Sampler::BILINEAR:
+    default:
+        m_heightCache.GetBilinearHeights(inPositions, outHeights);
+        break;
+    }
 }
 
 bool TerrainSystem::GetIsHoleFromFloats(
@@ -164,6 +259,20 @@ AZ::Vector3 TerrainSystem::GetNormalFromFloats(
 }
 
 
+void TerrainSystem::GetNormals(
+    [[maybe_unused]] const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outNormals,
+    [[maybe_unused]] Sampler sampleFilter, AZStd::vector<bool>* terrainExists) const
+{
+    AZ_Assert(inPositions.size() == outNormals.size(), "The output vector needs to be the same size as the input positions");
+
+    if (terrainExists)
+    {
+        AZStd::fill(terrainExists->begin(), terrainExists->end(), true);
+    }
+
+    AZStd::fill(outNormals.begin(), outNormals.end(), AZ::Vector3::CreateAxisZ());
+}
+
 AzFramework::SurfaceData::SurfaceTagWeight TerrainSystem::GetMaxSurfaceWeight(
     [[maybe_unused]] AZ::Vector3 position, [[maybe_unused]] Sampler sampleFilter, [[maybe_unused]] bool* terrainExistsPtr) const
 {
@@ -189,6 +298,21 @@ AzFramework::SurfaceData::SurfaceTagWeight TerrainSystem::GetMaxSurfaceWeightFro
     return AzFramework::SurfaceData::SurfaceTagWeight();
 }
 
+void TerrainSystem::GetMaxSurfaceWeights(
+    [[maybe_unused]] const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeight>& outSurfaceWeights, [[maybe_unused]] Sampler sampleFilter,
+    AZStd::vector<bool>* terrainExists) const
+{
+    AZ_Assert(inPositions.size() == outSurfaceWeights.size(), "The output vector needs to be the same size as the input positions");
+
+    if (terrainExists)
+    {
+        AZStd::fill(terrainExists->begin(), terrainExists->end(), true);
+    }
+
+    AZStd::fill(outSurfaceWeights.begin(), outSurfaceWeights.end(), AzFramework::SurfaceData::SurfaceTagWeight());
+}
+
 const char* TerrainSystem::GetMaxSurfaceName(
     [[maybe_unused]] AZ::Vector3 position, [[maybe_unused]] Sampler sampleFilter, [[maybe_unused]] bool* terrainExistsPtr) const
 {
@@ -387,6 +511,7 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
 
         if (m_requestedSettings.m_heightQueryResolution != m_currentSettings.m_heightQueryResolution)
         {
+            m_heightCache.SetGridResolution(m_requestedSettings.m_heightQueryResolution);
             m_dirtyRegion = AZ::Aabb::CreateNull();
             m_terrainHeightDirty = true;
             terrainSettingsChanged = true;
@@ -407,8 +532,6 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
 
     if (m_currentSettings.m_systemActive && m_terrainHeightDirty)
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
-
         AZ::EntityId entityId(0);
         AZ::Transform transform = AZ::Transform::CreateTranslation(m_currentSettings.m_worldBounds.GetCenter());
 
@@ -416,37 +539,31 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
             (float)m_currentSettings.m_worldBounds.GetXExtent() / m_currentSettings.m_heightQueryResolution.GetX());
         uint32_t height = aznumeric_cast<uint32_t>(
             (float)m_currentSettings.m_worldBounds.GetYExtent() / m_currentSettings.m_heightQueryResolution.GetY());
-        AZStd::vector<float> pixels;
-        pixels.resize(width * height);
-        const uint32_t pixelDataSize = width * height * sizeof(float);
-        memset(pixels.data(), 0, pixelDataSize);
 
-        for (auto& [areaId, areaBounds] : m_registeredAreas)
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(width * height);
+        for (uint32_t y = 0; y < height; y++)
         {
-            for (uint32_t y = 0; y < height; y++)
+            for (uint32_t x = 0; x < width; x++)
             {
-                for (uint32_t x = 0; x < width; x++)
-                {
-                    AZ::Vector3 inPosition(
-                        (x * m_currentSettings.m_heightQueryResolution.GetX()) + m_currentSettings.m_worldBounds.GetMin().GetX(),
-                        (y * m_currentSettings.m_heightQueryResolution.GetY()) + m_currentSettings.m_worldBounds.GetMin().GetY(),
-                        areaBounds.GetMin().GetZ());
-                    if (areaBounds.Contains(inPosition))
-                    {
-                        AZ::Vector3 outPosition;
-                        const Terrain::TerrainAreaHeightRequests::Sampler sampleFilter =
-                            Terrain::TerrainAreaHeightRequests::Sampler::DEFAULT;
-
-                        Terrain::TerrainAreaHeightRequestBus::Event(
-                            areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeight, inPosition, outPosition, sampleFilter);
-
-                        pixels[(y * width) + x] = (outPosition.GetZ() - m_currentSettings.m_worldBounds.GetMin().GetZ()) /
-                            m_currentSettings.m_worldBounds.GetExtents().GetZ();
-                    }
-                }
+                positions.emplace_back(
+                    (x * m_currentSettings.m_heightQueryResolution.GetX()) + m_currentSettings.m_worldBounds.GetMin().GetX(),
+                    (y * m_currentSettings.m_heightQueryResolution.GetY()) + m_currentSettings.m_worldBounds.GetMin().GetY(),
+                    m_currentSettings.m_worldBounds.GetMin().GetZ());
             }
         }
 
+        // Positions outside of all areas are left at the world min height, which normalizes to 0
+        GetHeightsSynchronous(positions);
+
+        AZStd::vector<float> pixels;
+        pixels.resize(width * height);
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            pixels[index] = (positions[index].GetZ() - m_currentSettings.m_worldBounds.GetMin().GetZ()) /
+                m_currentSettings.m_worldBounds.GetExtents().GetZ();
+        }
+
         const AZ::RPI::Scene* scene = AZ::RPI::RPISystemInterface::Get()->GetDefaultScene().get();
         auto terrainFeatureProcessor = scene->GetFeatureProcessor<TerrainFeatureProcessor>();
 
@@ -481,6 +598,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         m_terrainHeightDirty = false;
         m_dirtyRegion = AZ::Aabb::CreateNull();
 
+        // The cached heights need to be dropped before notifying, listeners are likely to query the changed region right away
+        m_heightCache.Invalidate(dirtyRegion);
+
         AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
             &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged, dirtyRegion,
             changeMask);
@@ -21,6 +21,7 @@
 #include <AzCore/Jobs/JobFunction.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <TerrainSystem/TerrainHeightCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 namespace Terrain
@@ -89,8 +90,21 @@ namespace Terrain
         AZ::Vector3 GetNormalFromFloats(
             float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const override;
 
+        //! Batched queries. BILINEAR and CLAMP heights are read from the height cache, EXACT heights query the terrain areas once per
+        //! area for all positions.
+        void GetHeights(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights,
+            Sampler sampler = Sampler::BILINEAR, AZStd::vector<bool>* terrainExists = nullptr) const override;
+        void GetNormals(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outNormals,
+            Sampler sampleFilter = Sampler::BILINEAR, AZStd::vector<bool>* terrainExists = nullptr) const override;
+        void GetMaxSurfaceWeights(const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeight>& outSurfaceWeights, Sampler sampleFilter = Sampler::BILINEAR,
+            AZStd::vector<bool>* terrainExists = nullptr) const override;
+
     private:
         float GetHeightSynchronous(float x, float y) const;
+        float GetSampledHeight(float x, float y, Sampler sampler) const;
+        //! Sets the Z value of every position to the terrain height at its XY location, without using the height cache.
+        void GetHeightsSynchronous(AZStd::vector<AZ::Vector3>& inOutPositions) const;
         AZ::Vector3 GetNormalSynchronous(float x, float y) const;
 
         // AZ::TickBus::Handler overrides ...
@@ -116,5 +130,8 @@ namespace Terrain
 
         mutable AZStd::shared_mutex m_areaMutex;
         AZStd::unordered_map<AZ::EntityId, AZ::Aabb> m_registeredAreas;
+
+        //! Heights at the points of the height query grid, invalidated by the same dirty regions as OnTerrainDataChanged.
+        TerrainHeightCache m_heightCache;
     };
 } // namespace Terrain
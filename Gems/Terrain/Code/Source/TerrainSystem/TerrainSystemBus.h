@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <AzCore/EBus/EBus.h>
@@ -111,6 +112,17 @@ namespace Terrain
 
         virtual void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, Sampler sampleFilter = Sampler::DEFAULT) = 0;
         virtual void GetNormal(const AZ::Vector3& inPosition, AZ::Vector3& outNormal, Sampler sampleFilter = Sampler::DEFAULT) = 0;
+
+        // Synchronous batch of input locations, the input Z values are ignored and replaced with the heights.
+        virtual void GetHeights(AZStd::vector<AZ::Vector3>& inOutPositions, Sampler sampleFilter = Sampler::DEFAULT)
+        {
+            for (AZ::Vector3& position : inOutPositions)
+            {
+                const AZ::Vector3 inPosition = position;
+                GetHeight(inPosition, position, sampleFilter);
+            }
+        }
+
         //virtual void GetSurfaceWeights(const AZ::Vector3& inPosition, SurfaceTagWeightMap& outSurfaceWeights, Sampler sampleFilter = DEFAULT) = 0;
         //virtual void GetSurfacePoint(const AZ::Vector3& inPosition, SurfacePoint& outSurfacePoint, SurfacePointDataMask dataMask = DEFAULT, Sampler sampleFilter = DEFAULT) = 0;
     };
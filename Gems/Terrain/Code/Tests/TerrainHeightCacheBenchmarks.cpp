@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <TerrainSystem/TerrainHeightCache.h>
+
+namespace UnitTest
+{
+    // Samples heights for a square region at positions between the terrain grid points, the way heightfield generation or
+    // vegetation placement do. Compares computing every height directly, bilinear filtering one position at a time from the
+    // height cache, and bilinear filtering the whole batch from the height cache.
+    class TerrainHeightCacheBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        // Stand in for the terrain areas, rolling hills from a few octaves of sines
+        static float GetTerrainHeight(float x, float y)
+        {
+            float height = 0.0f;
+            float frequency = 0.01f;
+            float amplitude = 64.0f;
+            for (int octave = 0; octave < 4; ++octave)
+            {
+                height += amplitude * sinf(x * frequency) * cosf(y * frequency);
+                frequency *= 2.0f;
+                amplitude *= 0.5f;
+            }
+            return height;
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_cache = AZStd::make_unique<Terrain::TerrainHeightCache>(
+                [](AZStd::vector<AZ::Vector3>& inOutPositions)
+                {
+                    for (AZ::Vector3& position : inOutPositions)
+                    {
+                        position.SetZ(GetTerrainHeight(position.GetX(), position.GetY()));
+                    }
+                });
+
+            const int64_t pointsPerSide = state.range(0);
+            m_positions.reserve(pointsPerSide * pointsPerSide);
+            for (int64_t y = 0; y < pointsPerSide; ++y)
+            {
+                for (int64_t x = 0; x < pointsPerSide; ++x)
+                {
+                    m_positions.emplace_back((x * 0.7f) + 0.25f, (y * 0.7f) + 0.25f, 0.0f);
+                }
+            }
+            m_heights.resize(m_positions.size());
+
+            // Fill the cache up front, the benchmarks measure queries against a warm cache
+            m_cache->GetBilinearHeights(m_positions, m_heights);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_positions = {};
+            m_heights = {};
+            m_cache.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::unique_ptr<Terrain::TerrainHeightCache> m_cache;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<float> m_heights;
+    };
+
+    BENCHMARK_DEFINE_F(TerrainHeightCacheBenchmarkFixture, UncachedHeights)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                m_heights[index] = GetTerrainHeight(m_positions[index].GetX(), m_positions[index].GetY());
+            }
+            benchmark::DoNotOptimize(m_heights.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(TerrainHeightCacheBenchmarkFixture, CachedBilinearHeight)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < m_positions.size(); ++index)
+            {
+                m_heights[index] = m_cache->GetBilinearHeight(m_positions[index].GetX(), m_positions[index].GetY());
+            }
+            benchmark::DoNotOptimize(m_heights.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_DEFINE_F(TerrainHeightCacheBenchmarkFixture, CachedBilinearHeights)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_cache->GetBilinearHeights(m_positions, m_heights);
+            benchmark::DoNotOptimize(m_heights.data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_positions.size());
+    }
+
+    BENCHMARK_REGISTER_F(TerrainHeightCacheBenchmarkFixture, UncachedHeights)
+        ->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TerrainHeightCacheBenchmarkFixture, CachedBilinearHeight)
+        ->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(TerrainHeightCacheBenchmarkFixture, CachedBilinearHeights)
+        ->Arg(256)->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif
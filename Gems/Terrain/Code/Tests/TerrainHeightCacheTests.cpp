@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <TerrainSystem/TerrainHeightCache.h>
+
+namespace UnitTest
+{
+    class TerrainHeightCacheTest
+        : public AllocatorsTestFixture
+    {
+    protected:
+        // Heights on a plane can be reproduced exactly by bilinear filtering, which makes the expected values easy to compute
+        static float GetPlaneHeight(float x, float y)
+        {
+            return (2.0f * x) + (3.0f * y) + 1.0f;
+        }
+
+        Terrain::TerrainHeightCache::HeightQueryFunction CreatePlaneHeightQuery()
+        {
+            return [this](AZStd::vector<AZ::Vector3>& inOutPositions)
+            {
+                ++m_heightQueryCount;
+                for (AZ::Vector3& position : inOutPositions)
+                {
+                    position.SetZ(GetPlaneHeight(position.GetX(), position.GetY()));
+                }
+            };
+        }
+
+        uint32_t m_heightQueryCount = 0;
+    };
+
+    TEST_F(TerrainHeightCacheTest, BilinearHeight_PlanarTerrain_MatchesPlane)
+    {
+        Terrain::TerrainHeightCache cache(CreatePlaneHeightQuery());
+        cache.SetGridResolution(AZ::Vector2(0.5f));
+
+        EXPECT_NEAR(GetPlaneHeight(10.3f, 7.1f), cache.GetBilinearHeight(10.3f, 7.1f), 0.001f);
+        EXPECT_NEAR(GetPlaneHeight(-40.7f, -3.35f), cache.GetBilinearHeight(-40.7f, -3.35f), 0.001f);
+    }
+
+    TEST_F(TerrainHeightCacheTest, ClampedHeight_ReturnsClosestGridPoint)
+    {
+        Terrain::TerrainHeightCache cache(CreatePlaneHeightQuery());
+        cache.SetGridResolution(AZ::Vector2(2.0f));
+
+        EXPECT_FLOAT_EQ(GetPlaneHeight(2.0f, 6.0f), cache.GetClampedHeight(2.9f, 5.2f));
+        EXPECT_FLOAT_EQ(GetPlaneHeight(-2.0f, -6.0f), cache.GetClampedHeight(-2.9f, -5.2f));
+    }
+
+    TEST_F(TerrainHeightCacheTest, BatchedHeights_MatchSingleQueries)
+    {
+        Terrain::TerrainHeightCache cache(CreatePlaneHeightQuery());
+        cache.SetGridResolution(AZ::Vector2(0.75f));
+
+        // An odd number of positions crossing tile boundaries covers both the SIMD and the remainder loop
+        AZStd::vector<AZ::Vector3> positions;
+        for (int32_t index = 0; index < 103; ++index)
+        {
+            positions.emplace_back(-60.0f + (index * 1.37f), 20.0f - (index * 0.91f), 0.0f);
+        }
+
+        AZStd::vector<float> bilinearHeights(positions.size());
+        AZStd::vector<float> clampedHeights(positions.size());
+        cache.GetBilinearHeights(positions, bilinearHeights);
+        cache.GetClampedHeights(positions, clampedHeights);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            EXPECT_NEAR(cache.GetBilinearHeight(positions[index].GetX(), positions[index].GetY()), bilinearHeights[index], 0.001f);
+            EXPECT_FLOAT_EQ(cache.GetClampedHeight(positions[index].GetX(), positions[index].GetY()), clampedHeights[index]);
+        }
+    }
+
+    TEST_F(TerrainHeightCacheTest, Tiles_QueriedOnceUntilInvalidated)
+    {
+        Terrain::TerrainHeightCache cache(CreatePlaneHeightQuery());
+        const float tileExtent = static_cast<float>(Terrain::TerrainHeightCache::TileSize);
+
+        cache.GetBilinearHeight(1.0f, 1.0f);
+        cache.GetBilinearHeight(tileExtent - 1.0f, 2.0f);
+        EXPECT_EQ(1, m_heightQueryCount);
+        EXPECT_EQ(1, cache.GetTileCount());
+
+        // A region that doesn't touch the tile keeps it
+        cache.Invalidate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(tileExtent + 1.0f, 0.0f, 0.0f), AZ::Vector3(tileExtent + 2.0f, 1.0f, 1.0f)));
+        cache.GetBilinearHeight(1.0f, 1.0f);
+        EXPECT_EQ(1, m_heightQueryCount);
+
+        cache.Invalidate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(3.0f, 3.0f, 0.0f), AZ::Vector3(4.0f, 4.0f, 1.0f)));
+        EXPECT_EQ(0, cache.GetTileCount());
+        cache.GetBilinearHeight(1.0f, 1.0f);
+        EXPECT_EQ(2, m_heightQueryCount);
+
+        // A null region invalidates everything
+        cache.Invalidate(AZ::Aabb::CreateNull());
+        EXPECT_EQ(0, cache.GetTileCount());
+    }
+
+    TEST_F(TerrainHeightCacheTest, SetGridResolution_DropsTiles)
+    {
+        Terrain::TerrainHeightCache cache(CreatePlaneHeightQuery());
+        cache.GetClampedHeight(1.0f, 1.0f);
+        EXPECT_EQ(1, cache.GetTileCount());
+
+        cache.SetGridResolution(AZ::Vector2(1.0f));
+        EXPECT_EQ(1, cache.GetTileCount());
+
+        cache.SetGridResolution(AZ::Vector2(2.0f));
+        EXPECT_EQ(0, cache.GetTileCount());
+    }
+
+    TEST_F(TerrainHeightCacheTest, MaxTiles_OldestTilesEvicted)
+    {
+        constexpr size_t MaxTiles = 2;
+        Terrain::TerrainHeightCache cache(CreatePlaneHeightQuery(), MaxTiles);
+        const float tileExtent = static_cast<float>(Terrain::TerrainHeightCache::TileSize);
+
+        cache.GetClampedHeight(1.0f, 1.0f);
+        cache.GetClampedHeight(tileExtent + 1.0f, 1.0f);
+        cache.GetClampedHeight((2.0f * tileExtent) + 1.0f, 1.0f);
+        EXPECT_EQ(MaxTiles, cache.GetTileCount());
+        EXPECT_EQ(3, m_heightQueryCount);
+
+        // The newest tile is still cached, the oldest one needs to be filled again
+        cache.GetClampedHeight((2.0f * tileExtent) + 1.0f, 1.0f);
+        EXPECT_EQ(3, m_heightQueryCount);
+        cache.GetClampedHeight(1.0f, 1.0f);
+        EXPECT_EQ(4, m_heightQueryCount);
+    }
+} // namespace UnitTest
@@ -21,6 +21,8 @@ set(FILES
     Source/Components/TerrainWorldDebuggerComponent.h
     Source/TerrainRenderer/TerrainFeatureProcessor.cpp
     Source/TerrainRenderer/TerrainFeatureProcessor.h
+    Source/TerrainSystem/TerrainHeightCache.cpp
+    Source/TerrainSystem/TerrainHeightCache.h
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
@@ -7,5 +7,7 @@
 #
 
 set(FILES
+    Tests/TerrainHeightCacheBenchmarks.cpp
+    Tests/TerrainHeightCacheTests.cpp
     Tests/TerrainTest.cpp
 )